@@ -0,0 +1,189 @@
+% Clear command window & workspace, and close all figures
+clc, clear, close all;
+
+t_fs = 24000;         % target sample frequency
+t_block = 256;        % IMA-ADPCM block size in bytes (SOUND_ADPCM_BLOCK)
+t_dir = "c24k_adpcm"; % target sub-directory
+% Comment out t_amp to leave the signal amplitude (volume) the same
+% t_amp = 1.0;       % target max amplitude [0.0 to 1.0]
+
+% Select audio files to convert
+[fname,location] = uigetfile(...
+    '*.aifc;*.aiff;*.aif;*.au;*.flac;*.ogg;*.opus;*.mp3;*.m4a;*.mp4;*.wav',...
+    'Select one or more audio files',...
+    'MultiSelect','on');
+if isequal(fname,0) % user canceled selection
+    disp('No file(s) selected');
+    return;
+elseif ischar(fname) % convert to cell array if single file selected
+    fname = {fname};
+end
+
+% Create output sub-directory if nonexistent
+if not(isfolder(t_dir))
+    mkdir(t_dir);
+end
+
+% Process audio data
+for i = 1:length(fname)
+    % read audio wave file into a matrix
+    % returns: [data, sample frequency]
+    [x, fs] = audioread(fullfile(location,fname{i}));
+
+    % combine any channels (e.g. stereo to mono)
+    x1 = mean(x,2);
+
+    % resample at target sample frequency
+    [P,Q] = rat(t_fs/fs);
+    xs = resample(x1,P,Q);
+
+    % rescale data to signed 16-bit
+    gain = 32767;
+    if exist('t_amp','var') == 1 % if t_amp exists, set the max amplitude
+        max_amp = max(abs(min(xs)),abs(max(xs)));
+        gain = gain*t_amp/max_amp;
+    end
+    xr = round(xs .* gain);
+    xr = min(max(xr,-32768),32767); % clip to int16
+
+    % encode and compare the decoded signal with the input
+    [y, n] = ima_encode(xr, t_block);
+    xd = ima_decode(y, t_block);
+    fprintf('%s: %u samples, %u -> %u bytes, SNR %.1f dB\n', fname{i}, ...
+        n, n, length(y), snr(xr, xr - xd(1:n)));
+
+    % save data to file in a 'C' array
+    [path,name,ext] = fileparts(fname{i}); % split filename
+    path = fullfile(path,t_dir); % output to sub-directory
+    dat2c_adpcm(y,path,name,t_fs,n,t_block);
+end
+
+% Encode signed 16-bit samples as mono IMA-ADPCM blocks. Each block starts
+% with the first sample (int16, little endian), the step index and a zero
+% byte, followed by 4-bit codes packed low nibble first.
+%   x: MATLAB array of samples in int16 range
+%   block: block size in bytes
+%   Returns the encoded bytes and the number of samples encoded
+function [y, n] = ima_encode(x, block)
+    [step_tab, index_tab] = ima_tables();
+    n = length(x);
+    spb = 1 + (block-4)*2; % samples per block
+    y = zeros(1, ceil(n/spb)*block, 'uint8');
+    len = 0;
+    index = 0;
+    k = 1;
+    while k <= n
+        pred = x(k); k = k + 1;
+        p = typecast(int16(pred), 'uint8');
+        y(len+1:len+4) = [p(1) p(2) index 0];
+        len = len + 4;
+        codes = zeros(1, 2*(block-4));
+        nc = 0;
+        while nc < 2*(block-4) && k <= n
+            step = step_tab(index+1);
+            diff = x(k) - pred; k = k + 1;
+            code = 0;
+            if diff < 0; code = 8; diff = -diff; end
+            vpdiff = bitshift(step,-3);
+            if diff >= step; code = bitor(code,4); diff = diff - step; vpdiff = vpdiff + step; end
+            step = bitshift(step,-1);
+            if diff >= step; code = bitor(code,2); diff = diff - step; vpdiff = vpdiff + step; end
+            step = bitshift(step,-1);
+            if diff >= step; code = bitor(code,1); vpdiff = vpdiff + step; end
+            if bitand(code,8); pred = pred - vpdiff; else; pred = pred + vpdiff; end
+            pred = min(max(pred,-32768),32767);
+            index = min(max(index + index_tab(code+1),0),88);
+            nc = nc + 1;
+            codes(nc) = code;
+        end
+        if mod(nc,2); nc = nc + 1; end % pad last byte
+        y(len+1:len+nc/2) = codes(1:2:nc) + codes(2:2:nc)*16;
+        len = len + nc/2;
+    end
+    y = y(1:len);
+end
+
+% Decode IMA-ADPCM blocks (reference for checking the encoder).
+%   y: encoded bytes
+%   block: block size in bytes
+%   Returns the decoded samples
+function x = ima_decode(y, block)
+    [step_tab, index_tab] = ima_tables();
+    x = zeros(1, 2*length(y));
+    n = 0;
+    p = 1;
+    while p + 3 <= length(y)
+        pred = double(typecast(uint8(y(p:p+1)), 'int16'));
+        index = min(double(y(p+2)),88);
+        n = n + 1; x(n) = pred;
+        e = min(p + block - 1, length(y));
+        p = p + 4;
+        for b = double(y(p:e))
+            for code = [bitand(b,15), bitshift(b,-4)]
+                step = step_tab(index+1);
+                diff = bitshift(step,-3);
+                if bitand(code,4); diff = diff + step; end
+                if bitand(code,2); diff = diff + bitshift(step,-1); end
+                if bitand(code,1); diff = diff + bitshift(step,-2); end
+                if bitand(code,8); pred = pred - diff; else; pred = pred + diff; end
+                pred = min(max(pred,-32768),32767);
+                index = min(max(index + index_tab(code+1),0),88);
+                n = n + 1; x(n) = pred;
+            end
+        end
+        p = e + 1;
+    end
+    x = x(1:n).';
+end
+
+function [step_tab, index_tab] = ima_tables()
+    step_tab = [ ...
+        7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, ...
+        34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, ...
+        143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, ...
+        494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, ...
+        1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327, 3660, 4026, ...
+        4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, ...
+        11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, ...
+        27086, 29794, 32767];
+    index_tab = [-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8];
+end
+
+% Given a MATLAB array of IMA-ADPCM bytes, create a 'C' array in text
+%   y: MATLAB array of encoded bytes
+%   path: directory path to create 'C' file
+%   name: name of 'C' array and also files with .h and .c extension
+%   fs: sample frequency of data
+%   n: number of samples encoded
+%   block: block size in bytes
+function dat2c_adpcm(y,path,name,fs,n,block)
+    str = upper(name);
+
+    %%%%%%%%%%%%%%%%%%%% Write .h File %%%%%%%%%%%%%%%%%%%%
+    fid_h = fopen(fullfile(path,name+".h"), 'w');
+    fprintf(fid_h, "\n#include <stdint.h>\n\n");
+    fprintf(fid_h, "#define %s_ADPCM_BLOCK %u\n", str, block);
+    fprintf(fid_h, "#define %s_SAMPLE_RATE %u\n", str, fs);
+    fprintf(fid_h, "#define %s_SAMPLES %u\n", str, n);
+    fprintf(fid_h, "#define %s_LENGTH %u\n\n", str, length(y));
+    fprintf(fid_h, "extern const uint8_t %s[%s_LENGTH];\n", name, str);
+    fclose(fid_h);
+
+    %%%%%%%%%%%%%%%%%%%% Write .c File %%%%%%%%%%%%%%%%%%%%
+    ELEM_LINE = 16; % 'C' array elements per line
+    fid_c = fopen(fullfile(path,name+".c"), 'w');
+    pos = 0;
+    elem = length(y);
+
+    fprintf(fid_c, "\n#include <stdint.h>\n\n");
+    fprintf(fid_c, "const uint8_t %s[] = {\n", name); % start array
+    while elem > 0 % array data
+        if elem < ELEM_LINE; size = elem; else; size = ELEM_LINE; end
+        fprintf(fid_c, " 0x%02x,", y(pos+1:pos+size));
+        pos = pos+size;
+        elem = elem-size;
+        fprintf(fid_c, "\n");
+    end
+    fprintf(fid_c, "};\n"); % end array
+    fclose(fid_c);
+end
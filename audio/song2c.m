@@ -0,0 +1,137 @@
+% Clear command window & workspace, and close all figures
+clc, clear, close all;
+
+t_dir = "song"; % target sub-directory
+
+% Convert a text song into the sequencer song format (see sound_seq.c).
+%
+% Text song format, one statement per line ('%' or '#' starts a comment):
+%   tempo 120          beats per minute
+%   lpb 4              rows per beat
+%   rows 16            rows per pattern
+%   channels 3         channels (voices) per row
+%   pattern 0          the following rows belong to pattern 0
+%   C-4 01 ... | E-4 .. V40 | ===          one row, cells split by '|'
+%   order 0 1 0 2      patterns in play order
+%
+% A cell is "note instrument effect", missing fields are empty:
+%   note: C-4, C#4, ... (octave 4 holds A4 = 440 Hz), --- none, === release
+%   instrument: two hex digits (1-based), .. keep the last one
+%   effect: V volume %, G glide x 10 ms, T tempo, followed by two hex
+%     digits of parameter, ... none
+
+% Select song files to convert
+[fname,location] = uigetfile('*.txt', 'Select one or more song files', ...
+    'MultiSelect','on');
+if isequal(fname,0) % user canceled selection
+    disp('No file(s) selected');
+    return;
+elseif ischar(fname) % convert to cell array if single file selected
+    fname = {fname};
+end
+
+% Create output sub-directory if nonexistent
+if not(isfolder(t_dir))
+    mkdir(t_dir);
+end
+
+for i = 1:length(fname)
+    y = song_parse(fullfile(location,fname{i}));
+    fprintf('%s: %u bytes\n', fname{i}, length(y));
+    [path,name,ext] = fileparts(fname{i}); % split filename
+    path = fullfile(path,t_dir); % output to sub-directory
+    dat2c_song(y,path,name);
+end
+
+% Parse a text song and return the song bytes
+function y = song_parse(file)
+    tempo = 120; lpb = 4; rows = 16; chans = 1;
+    pats = {}; order = []; p = -1; r = 0;
+    lines = splitlines(fileread(file));
+    for k = 1:length(lines)
+        ln = strtrim(regexprep(lines{k},'[%#].*$',''));
+        if isempty(ln); continue; end
+        tok = strsplit(ln);
+        switch lower(tok{1})
+            case 'tempo';    tempo = str2double(tok{2});
+            case 'lpb';      lpb = str2double(tok{2});
+            case 'rows';     rows = str2double(tok{2});
+            case 'channels'; chans = str2double(tok{2});
+            case 'order';    order = str2double(tok(2:end));
+            case 'pattern'
+                p = str2double(tok{2});
+                pats{p+1} = zeros(rows, chans*4, 'uint8');
+                r = 0;
+            otherwise % a row of cells
+                if p < 0 || r >= rows
+                    error('%s:%u: row outside of a pattern', file, k);
+                end
+                cells = strsplit(ln,'|');
+                for c = 1:min(length(cells),chans)
+                    pats{p+1}(r+1,(c-1)*4+1:c*4) = cell_parse(strtrim(cells{c}));
+                end
+                r = r + 1;
+        end
+    end
+    if isempty(order); order = 0:length(pats)-1; end
+    y = uint8(['SQ', chans, rows, length(pats), length(order), tempo, lpb, order]);
+    for p = 1:length(pats)
+        if isempty(pats{p}); pats{p} = zeros(rows, chans*4, 'uint8'); end
+        y = [y, reshape(pats{p}.',1,[])]; %#ok<AGROW>
+    end
+end
+
+% Parse one cell into [note instrument effect param]
+function v = cell_parse(str)
+    v = uint8([0 0 0 0]);
+    tok = strsplit(str);
+    names = {'C-','C#','D-','D#','E-','F-','F#','G-','G#','A-','A#','B-'};
+    if ~isempty(tok) && length(tok{1}) == 3
+        n = find(strcmpi(names, tok{1}(1:2)));
+        if strcmp(tok{1},'===')
+            v(1) = 128; % SOUND_SEQ_OFF
+        elseif ~isempty(n)
+            v(1) = 12*(str2double(tok{1}(3))+1) + n-1; % MIDI note
+        end
+    end
+    if length(tok) >= 2 && ~startsWith(tok{2},'.')
+        v(2) = hex2dec(tok{2});
+    end
+    if length(tok) >= 3 && ~startsWith(tok{3},'.')
+        v(3) = find('VGT' == upper(tok{3}(1))); % sound_fx_t
+        v(4) = hex2dec(tok{3}(2:3));
+    end
+end
+
+% Given a MATLAB array of song bytes, create a 'C' array in text
+%   y: MATLAB array of song bytes
+%   path: directory path to create 'C' file
+%   name: name of 'C' array and also files with .h and .c extension
+function dat2c_song(y,path,name)
+    str = upper(name);
+
+    %%%%%%%%%%%%%%%%%%%% Write .h File %%%%%%%%%%%%%%%%%%%%
+    fid_h = fopen(fullfile(path,name+".h"), 'w');
+    fprintf(fid_h, "\n#include <stdint.h>\n\n");
+    fprintf(fid_h, "#define %s_LENGTH %u\n\n", str, length(y));
+    fprintf(fid_h, "extern const uint8_t %s[%s_LENGTH];\n", name, str);
+    fclose(fid_h);
+
+    %%%%%%%%%%%%%%%%%%%% Write .c File %%%%%%%%%%%%%%%%%%%%
+    ELEM_LINE = 16; % 'C' array elements per line
+    fid_c = fopen(fullfile(path,name+".c"), 'w');
+    pos = 0;
+    elem = length(y);
+
+    fprintf(fid_c, "\n#include <stdint.h>\n\n");
+    fprintf(fid_c, "const uint8_t %s[] = {\n", name); % start array
+    while elem > 0 % array data
+        if elem < ELEM_LINE; size = elem; else; size = ELEM_LINE; end
+        fprintf(fid_c, " 0x%02x,", y(pos+1:pos+size));
+        pos = pos+size;
+        elem = elem-size;
+        fprintf(fid_c, "\n");
+    end
+    fprintf(fid_c, "};\n"); % end array
+    fclose(fid_c);
+end
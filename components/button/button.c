@@ -0,0 +1,203 @@
+// Interrupt driven button driver.
+// https://docs.espressif.com/projects/esp-idf/en/stable/esp32/api-reference/peripherals/gpio.html
+//
+// The first edge of a button change is taken at once, so a press is seen
+// with no delay. Further edges within the debounce time are ignored, and
+// an esp_timer then reads the pin again in case it settled the other way.
+// The same timer, started again after the debounce, sends the long press
+// event. Events go to a FreeRTOS queue read by button_get().
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "driver/gpio.h"
+
+#include "button.h"
+
+#define DEBOUNCE_US (CONFIG_BUTTON_DEBOUNCE_MS*1000LL)
+#define LONG_US (CONFIG_BUTTON_LONG_MS*1000LL)
+#define QUEUE_LEN CONFIG_BUTTON_QUEUE_LEN
+#define PULL_MIN 34 // GPIO34-39 are input only, without pull resistors
+
+static const char *TAG = "button";
+
+typedef struct {
+	int8_t pin;
+	bool down;         // Debounced state
+	bool settling;     // Debounce timer running, edges ignored
+	bool long_sent;    // Long press event sent for this press
+	int64_t change_us; // Time of the last accepted change
+	esp_timer_handle_t timer;
+} btn_t;
+
+// Global variables
+static portMUX_TYPE spinlock = portMUX_INITIALIZER_UNLOCKED;
+static btn_t btns[BUTTON_MAX];
+static uint32_t btn_n;
+static QueueHandle_t queue;
+static bool isr_service; // GPIO ISR service installed by this driver
+
+
+// Read a button and accept a change of state. Call in a critical section.
+// Return true if *ev holds an event to send.
+static bool btn_sample(btn_t *b, int64_t now, button_event_t *ev)
+{
+	bool down = !gpio_get_level(b->pin);
+
+	if (down == b->down) return false;
+	b->down = down;
+	b->change_us = now;
+	b->long_sent = false;
+	b->settling = true;
+	esp_timer_stop(b->timer); // may be waiting for a long press
+	esp_timer_start_once(b->timer, DEBOUNCE_US);
+	*ev = (button_event_t){.pin = b->pin, .time_us = now,
+		.type = down ? BUTTON_PRESS : BUTTON_RELEASE};
+	return true;
+}
+
+// GPIO edge interrupt of a button.
+static void btn_isr(void *arg)
+{
+	btn_t *b = arg;
+	button_event_t ev;
+	bool send = false;
+	BaseType_t woken = pdFALSE;
+
+	portENTER_CRITICAL_ISR(&spinlock);
+	if (!b->settling) send = btn_sample(b, esp_timer_get_time(), &ev);
+	portEXIT_CRITICAL_ISR(&spinlock);
+	if (send) xQueueSendFromISR(queue, &ev, &woken);
+	if (woken) portYIELD_FROM_ISR();
+}
+
+// Button timer: end of the debounce time, or time for a long press.
+static void btn_timer(void *arg)
+{
+	btn_t *b = arg;
+	button_event_t ev;
+	bool send;
+	int64_t now = esp_timer_get_time();
+
+	portENTER_CRITICAL(&spinlock);
+	b->settling = false;
+	send = btn_sample(b, now, &ev);
+	if (!send && b->down && !b->long_sent) {
+		int64_t held = now - b->change_us;
+		if (held >= LONG_US) {
+			b->long_sent = send = true;
+			ev = (button_event_t){.pin = b->pin, .type = BUTTON_LONG, .time_us = now};
+		} else {
+			esp_timer_start_once(b->timer, LONG_US - held);
+		}
+	}
+	portEXIT_CRITICAL(&spinlock);
+	if (send) xQueueSend(queue, &ev, 0);
+}
+
+// Initialize the button driver. Must be called before use.
+// Configures the pins as inputs with edge interrupts. Pull-ups are enabled,
+// except on GPIO34-39, which have none.
+// mask: button pins, one pin per bit (e.g. HW_BTN_MASK).
+// Return zero if successful, or non-zero otherwise.
+int32_t button_init(uint64_t mask)
+{
+	if (queue != NULL) button_deinit();
+	queue = xQueueCreate(QUEUE_LEN, sizeof(button_event_t));
+	if (queue == NULL) return 1;
+
+	esp_err_t err = gpio_install_isr_service(0);
+	if (err != ESP_OK && err != ESP_ERR_INVALID_STATE) { // already installed
+		ESP_LOGE(TAG, "cannot install GPIO ISR service");
+		button_deinit();
+		return 1;
+	}
+	isr_service = (err == ESP_OK);
+
+	for (int8_t pin = 0; pin < GPIO_NUM_MAX; pin++) {
+		if (!(mask & 1LLU << pin)) continue;
+		if (btn_n >= BUTTON_MAX) {
+			ESP_LOGE(TAG, "more than %d buttons", BUTTON_MAX);
+			button_deinit();
+			return 1;
+		}
+		btn_t *b = btns + btn_n;
+		gpio_config_t io_conf = {
+			.pin_bit_mask = 1LLU << pin,
+			.mode = GPIO_MODE_INPUT,
+			.pull_up_en = (pin < PULL_MIN) ? GPIO_PULLUP_ENABLE : GPIO_PULLUP_DISABLE,
+			.pull_down_en = GPIO_PULLDOWN_DISABLE,
+			.intr_type = GPIO_INTR_ANYEDGE,
+		};
+		esp_timer_create_args_t timer_args = {
+			.callback = btn_timer,
+			.arg = b,
+			.name = "button",
+		};
+		*b = (btn_t){.pin = pin};
+		if (gpio_config(&io_conf) != ESP_OK ||
+			esp_timer_create(&timer_args, &b->timer) != ESP_OK) {
+			button_deinit();
+			return 1;
+		}
+		btn_n++;
+		b->down = !gpio_get_level(pin);
+		if (gpio_isr_handler_add(pin, btn_isr, b) != ESP_OK) {
+			button_deinit();
+			return 1;
+		}
+	}
+	return 0;
+}
+
+// Free resources used by the button driver.
+// Return zero if successful, or non-zero otherwise.
+int32_t button_deinit(void)
+{
+	if (queue == NULL) return 1;
+	for (uint32_t i = 0; i < btn_n; i++) {
+		gpio_isr_handler_remove(btns[i].pin);
+		gpio_set_intr_type(btns[i].pin, GPIO_INTR_DISABLE);
+		esp_timer_stop(btns[i].timer);
+		esp_timer_delete(btns[i].timer);
+	}
+	btn_n = 0;
+	if (isr_service) gpio_uninstall_isr_service();
+	isr_service = false;
+	vQueueDelete(queue);
+	queue = NULL;
+	return 0;
+}
+
+// Get the next button event. Does not block.
+// *ev: pointer to the event.
+// Return true if an event was read, otherwise false.
+bool button_get(button_event_t *ev)
+{
+	if (queue == NULL || ev == NULL) return false;
+	return xQueueReceive(queue, ev, 0) == pdTRUE;
+}
+
+// Discard all button events waiting to be read.
+void button_flush(void)
+{
+	if (queue != NULL) xQueueReset(queue);
+}
+
+// Return true if the button is pressed (debounced), otherwise false.
+// pin: pin of the button.
+bool button_down(int8_t pin)
+{
+	for (uint32_t i = 0; i < btn_n; i++)
+		if (btns[i].pin == pin) return btns[i].down;
+	return false;
+}
+
+// NOTES:
+// * gpio_get_level() reads the input register, so it is safe in the ISR.
+// The ISR service is installed without ESP_INTR_FLAG_IRAM, so the ISR need
+// not be in IRAM and is held off while the flash cache is disabled.
+// * esp_timer_start_once() and esp_timer_stop() take the esp_timer spinlock
+// and may be called from an ISR. esp_timer_stop() returns an error if the
+// timer is not running, which is ignored.
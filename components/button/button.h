@@ -0,0 +1,52 @@
+#ifndef BUTTON_H_
+#define BUTTON_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// This component turns button presses into events. Each button pin has an
+// edge interrupt, so a press is seen no matter how short it is or how
+// seldom the game checks, and no time is spent reading buttons while none
+// are pressed. Edges are debounced by time and queued as events that a
+// game tick reads with button_get(). Buttons are active low.
+
+#define BUTTON_MAX 8 // Maximum number of buttons
+
+// Button event types
+typedef enum {
+	BUTTON_PRESS,   // Button pressed
+	BUTTON_RELEASE, // Button released
+	BUTTON_LONG,    // Button held down for CONFIG_BUTTON_LONG_MS
+} button_type_t;
+
+// Button event
+typedef struct {
+	int8_t pin;      // Pin of the button
+	uint8_t type;    // button_type_t
+	int64_t time_us; // Time of the event (esp_timer_get_time())
+} button_event_t;
+
+// Initialize the button driver. Must be called before use.
+// Configures the pins as inputs with edge interrupts. Pull-ups are enabled,
+// except on GPIO34-39, which have none.
+// mask: button pins, one pin per bit (e.g. HW_BTN_MASK).
+// Return zero if successful, or non-zero otherwise.
+int32_t button_init(uint64_t mask);
+
+// Free resources used by the button driver.
+// Return zero if successful, or non-zero otherwise.
+int32_t button_deinit(void);
+
+// Get the next button event. Does not block.
+// *ev: pointer to the event.
+// Return true if an event was read, otherwise false.
+bool button_get(button_event_t *ev);
+
+// Discard all button events waiting to be read.
+void button_flush(void);
+
+// Return true if the button is pressed (debounced), otherwise false.
+// pin: pin of the button.
+bool button_down(int8_t pin);
+
+#endif // BUTTON_H_
@@ -44,6 +44,7 @@
 
 #define HW_LCD_SPI_HOST SPI2_HOST
 #define HW_LCD_SPI_FREQ SPI_MASTER_FREQ_40M // MHz
+#define HW_LCD_SPI_TUNE 0 // Tune clock at init (needs HW_LCD_MISO)
 
 #define HW_LCD_INV 1
 #define HW_LCD_DIR 0
@@ -6,13 +6,64 @@
 
 #define SEN_DEFAULT 1.25f // Screen widths per second
 #define THRESH_DEFAULT 0.75f // Raw ADC values
+#define PREC_DISP 0.5f // Dual curve: displacement factor of the precision zone
+#define PREC_GAIN 0.25f // Dual curve: speed in the precision zone vs linear
 #define CLIP(x,lo,hi) ((x) < (lo) ? (lo) : ((x) > (hi) ? (hi) : (x)))
 
+// Positions and speeds are 16.16 fixed point pixels
+#define FIX_SHIFT 16
+#define FIX_ONE (1 << FIX_SHIFT)
+#define FIX_HALF (1 << (FIX_SHIFT-1))
+#define TO_FIX(x) ((int32_t)(x) << FIX_SHIFT)
+
+// Speed table indexed by displacement, interpolated between entries
+#define LUT_SHIFT 3 // Displacement bits per table step
+#define LUT_LEN ((JOY_MAX_DISP >> LUT_SHIFT) + 2) // one past JOY_MAX_DISP
+
 static uint32_t uperiod; // Update period in milliseconds.
-static float sfactor; // Joystick sensitivity factor.
+static float sensitivity; // Speed at full displacement, screen widths/sec.
+static cursor_curve_t curve; // Speed response to displacement.
 static uint32_t thresh; // Joystick displacement threshold.
-static float xpos, ypos; // Current cursor position as a float.
+static int32_t xpos, ypos; // Current cursor position, 16.16 fixed point.
+static int32_t speed[LUT_LEN]; // Pixels per tick by displacement, 16.16.
+
+
+// Fill the speed table from the sensitivity and curve.
+static void cursor_lut(void)
+{
+	float rate = sensitivity*LCD_W; // Convert to pixels per second
+	float vmax = ((rate < 1.0f) ? 1.0f : rate) * uperiod / 1000; // pixels/tick
+	float pv = PREC_GAIN*PREC_DISP; // dual curve speed at the zone edge
+
+	for (uint32_t i = 0; i < LUT_LEN; i++) {
+		float u = (float)(i << LUT_SHIFT) / JOY_MAX_DISP; // 0 to 1
+		float v;
+		if (u > 1.0f) u = 1.0f;
+		switch (curve) {
+		case CURSOR_QUADRATIC:
+			v = u*u;
+			break;
+		case CURSOR_DUAL:
+			v = (u <= PREC_DISP) ? u*PREC_GAIN :
+				pv + (u-PREC_DISP) * (1.0f-pv) / (1.0f-PREC_DISP);
+			break;
+		default:
+			v = u;
+			break;
+		}
+		speed[i] = v * vmax * FIX_ONE + 0.5f;
+	}
+}
 
+// Return the speed for a displacement in pixels per tick, 16.16.
+static int32_t cursor_speed(int32_t d)
+{
+	uint32_t a = abs(d);
+	if (a > JOY_MAX_DISP) a = JOY_MAX_DISP;
+	uint32_t i = a >> LUT_SHIFT, f = a & ((1 << LUT_SHIFT)-1);
+	int32_t v = speed[i] + (((speed[i+1] - speed[i]) * (int32_t)f) >> LUT_SHIFT);
+	return (d < 0) ? -v : v;
+}
 
 // Initialize the cursor. Must be called before use.
 // The initial position is the center of the screen.
@@ -24,11 +75,12 @@ int32_t cursor_init(uint32_t per)
 	if (per == 0 || joy_init()) return -1;
 	uperiod = per; // Save period parameter
 	// Set defaults
+	curve = CURSOR_LINEAR;
 	cursor_set_sensitivity(SEN_DEFAULT);
 	cursor_set_threshold(THRESH_DEFAULT);
 	// Initialize the cursor position to the center of the screen.
-	xpos = LCD_W/2;
-	ypos = LCD_H/2;
+	xpos = TO_FIX(LCD_W/2);
+	ypos = TO_FIX(LCD_H/2);
 	return 0;
 }
 
@@ -44,13 +96,14 @@ void cursor_tick(void)
 	if (abs(dcx) < thresh && abs(dcy) < thresh) return;
 
 	// Based on the joystick position relative to center,
-	// calculate a new position for the cursor.
-	xpos += dcx*sfactor;
-	ypos += dcy*sfactor;
+	// calculate a new position for the cursor. Fractions of a pixel
+	// add up over ticks.
+	xpos += cursor_speed(dcx);
+	ypos += cursor_speed(dcy);
 
 	// Clip new position to screen.
-	xpos = CLIP(xpos, 0, LCD_W-1);
-	ypos = CLIP(ypos, 0, LCD_H-1);
+	xpos = CLIP(xpos, 0, TO_FIX(LCD_W-1));
+	ypos = CLIP(ypos, 0, TO_FIX(LCD_H-1));
 }
 
 // Set the sensitivity (speed) of the cursor relative to joystick movement.
@@ -59,8 +112,18 @@ void cursor_tick(void)
 // sens: joystick movement sensitivity in screen widths/sec.
 void cursor_set_sensitivity(float sens)
 {
-	float rate = sens*LCD_W; // Convert to pixels per second
-	sfactor = ((rate < 1.0f) ? 1.0f : rate) / JOY_MAX_DISP * uperiod / 1000;
+	sensitivity = sens;
+	cursor_lut();
+}
+
+// Set the response curve of cursor speed to joystick displacement.
+// The speed at full displacement is set by the sensitivity.
+// The default is CURSOR_LINEAR.
+// c: response curve.
+void cursor_set_curve(cursor_curve_t c)
+{
+	curve = c;
+	cursor_lut();
 }
 
 // Set the threshold of joystick displacement needed before moving the cursor.
@@ -79,8 +142,8 @@ void cursor_set_threshold(float thr)
 // *y: pointer to y coordinate.
 void cursor_get_pos(coord_t *x, coord_t *y)
 {
-	*x = xpos+0.5f;
-	*y = ypos+0.5f;
+	*x = (xpos + FIX_HALF) >> FIX_SHIFT;
+	*y = (ypos + FIX_HALF) >> FIX_SHIFT;
 }
 
 // Set the cursor position in screen coordinates.
@@ -90,6 +153,6 @@ void cursor_get_pos(coord_t *x, coord_t *y)
 void cursor_set_pos(coord_t x, coord_t y)
 {
 	// Clip new position to screen.
-	xpos = CLIP(x, 0, LCD_W-1);
-	ypos = CLIP(y, 0, LCD_H-1);
+	xpos = TO_FIX(CLIP(x, 0, LCD_W-1));
+	ypos = TO_FIX(CLIP(y, 0, LCD_H-1));
 }
@@ -12,6 +12,16 @@
 // direction, the cursor is incrementally moved in that direction.
 // The cursor position is clipped to the minimum and maximum screen
 // coordinates as defined in the lcd component.
+// The position is kept in fixed point, so the cursor moves by fractions
+// of a pixel per tick at small displacements.
+
+// Cursor speed response to joystick displacement
+typedef enum {
+	CURSOR_LINEAR,    // Speed proportional to displacement
+	CURSOR_QUADRATIC, // Slow near center, fast at full displacement
+	CURSOR_DUAL,      // Precision zone at a quarter speed up to half
+	                  // displacement, then a steeper ramp to full speed
+} cursor_curve_t;
 
 
 // Initialize the cursor. Must be called before use.
@@ -32,6 +42,12 @@ void cursor_tick(void);
 // sens: joystick movement sensitivity in screen widths/sec.
 void cursor_set_sensitivity(float sens);
 
+// Set the response curve of cursor speed to joystick displacement.
+// The speed at full displacement is set by the sensitivity.
+// The default is CURSOR_LINEAR.
+// c: response curve.
+void cursor_set_curve(cursor_curve_t c);
+
 // Set the threshold of joystick displacement needed before moving the cursor.
 // The threshold is specified as a factor (0 to 1) of maximum displacement.
 // If this value is too low, the cursor will drift when the joystick is untouched.
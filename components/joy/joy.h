@@ -19,8 +19,10 @@ int32_t joy_deinit(void);
 
 // Get the joystick displacement from center position.
 // Displacement values range from 0 to +/- JOY_MAX_DISP.
-// This function is not safe to call from an ISR context.
-// Therefore, it must be called from a software task context.
+// With the one-shot driver (joy.c) this function is not safe to call from
+// an ISR context, so it must be called from a software task context. The
+// continuous driver (joy_cont.c, CONFIG_JOY_DRIVER_CONT) returns the latest
+// filtered value and may be called from any context.
 // *dcx: pointer to displacement in x.
 // *dcy: pointer to displacement in y.
 void joy_get_displacement(int32_t *dcx, int32_t *dcy);
@@ -0,0 +1,218 @@
+// Joystick driver using the ADC in continuous (DMA) mode.
+// https://docs.espressif.com/projects/esp-idf/en/stable/esp32/api-reference/peripherals/adc_continuous.html
+//
+// The ADC converts the X and Y axes in turn at CONFIG_JOY_SAMPLE_HZ into
+// DMA frames. When a frame is done, the driver callback averages the
+// samples of each axis, low-pass filters the averages, removes the center
+// and dead zone, and publishes the displacement as one 32-bit word. Readers
+// load that word, so a read never blocks, never sees X and Y from different
+// frames, and is safe from any context.
+
+#include <stdatomic.h>
+#include <stdlib.h> // abs
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_adc/adc_continuous.h"
+
+#include "hw.h"
+#include "joy.h"
+
+#define JOY_X HW_JOY_X // X axis input
+#define JOY_Y HW_JOY_Y // Y axis input
+
+#define SAMPLE_HZ CONFIG_JOY_SAMPLE_HZ // Conversions per second, both axes
+#define FILT_SHIFT CONFIG_JOY_FILTER_SHIFT // IIR filter coefficient 1/2^shift
+#define FILT_Q 4 // Fraction bits of the filter state
+
+#define FRAME_SZ 256 // DMA frame size in bytes, 64 samples per axis
+#define POOL_SZ (FRAME_SZ*2) // Driver pool, unused since frames are
+                             // handled in the callback
+#define CAL_FRAMES 16 // Frames averaged to find the center (~100 ms)
+#define CAL_POLL 10 // Calibration poll period in milliseconds
+#define CAL_TIMEOUT 500 // Calibration time out in milliseconds
+#define DEAD_MIN 16 // Smallest dead zone in raw ADC values
+#define DEAD_NOISE 4 // Dead zone as a multiple of the calibration spread
+#define TRACK_SHIFT 6 // Center tracking rate inside the dead zone
+
+static const char *TAG = "joy";
+
+// Global variables
+static adc_continuous_handle_t adc_handle;
+static uint8_t chan[2]; // ADC channel of each axis
+static atomic_uint disp; // Published displacement: X low, Y high 16 bits
+
+// Used by the callback only, except when the driver is stopped
+static int32_t filt[2]; // Filtered axis values, FILT_Q fraction bits
+static int32_t center[2]; // Axis center, FILT_Q fraction bits
+static int32_t dead; // Dead zone, FILT_Q fraction bits
+static int32_t cal_sum[2], cal_min[2], cal_max[2];
+static volatile uint32_t cal_n; // Calibration frames seen
+
+
+// Pack a displacement pair into one word.
+static inline uint32_t disp_pack(int32_t dx, int32_t dy)
+{
+	return (uint16_t)dx | (uint32_t)(uint16_t)dy << 16;
+}
+
+// Measure the center and noise from the first frames.
+static void IRAM_ATTR joy_calibrate(const int32_t avg[2])
+{
+	for (uint32_t a = 0; a < 2; a++) {
+		if (!cal_n || avg[a] < cal_min[a]) cal_min[a] = avg[a];
+		if (!cal_n || avg[a] > cal_max[a]) cal_max[a] = avg[a];
+		cal_sum[a] += avg[a];
+	}
+	if (++cal_n < CAL_FRAMES) return;
+	int32_t spread = 0;
+	for (uint32_t a = 0; a < 2; a++) {
+		center[a] = filt[a] = (cal_sum[a] << FILT_Q) / CAL_FRAMES;
+		if (cal_max[a] - cal_min[a] > spread) spread = cal_max[a] - cal_min[a];
+	}
+	dead = spread * DEAD_NOISE;
+	if (dead < DEAD_MIN) dead = DEAD_MIN;
+	dead <<= FILT_Q;
+}
+
+// Filter a pair of frame averages and publish the displacement.
+static void IRAM_ATTR joy_update(const int32_t avg[2])
+{
+	int32_t d[2];
+	bool still = true;
+
+	if (cal_n < CAL_FRAMES) {
+		joy_calibrate(avg);
+		return;
+	}
+	for (uint32_t a = 0; a < 2; a++) {
+		filt[a] += ((avg[a] << FILT_Q) - filt[a]) >> FILT_SHIFT;
+		d[a] = filt[a] - center[a];
+		if (abs(d[a]) >= dead) still = false;
+	}
+	if (still) { // follow slow drift of the resting position
+		for (uint32_t a = 0; a < 2; a++) {
+			// at least one step, or the center stops short above the input
+			int32_t step = d[a] >> TRACK_SHIFT;
+			center[a] += step ? step : (d[a] > 0) - (d[a] < 0);
+			d[a] = 0;
+		}
+	}
+	for (uint32_t a = 0; a < 2; a++) {
+		d[a] >>= FILT_Q;
+		if (d[a] > JOY_MAX_DISP) d[a] = JOY_MAX_DISP;
+		else if (d[a] < -JOY_MAX_DISP) d[a] = -JOY_MAX_DISP;
+	}
+	atomic_store_explicit(&disp, disp_pack(d[0], d[1]), memory_order_relaxed);
+}
+
+// Called by the driver (ISR) when a DMA frame of conversions is done.
+static bool IRAM_ATTR joy_conv_done(adc_continuous_handle_t handle,
+	const adc_continuous_evt_data_t *edata, void *user_data)
+{
+	int32_t sum[2] = {0}, n[2] = {0};
+
+	for (uint32_t i = 0; i + SOC_ADC_DIGI_RESULT_BYTES <= edata->size;
+		i += SOC_ADC_DIGI_RESULT_BYTES) {
+		const adc_digi_output_data_t *p = (const void *)(edata->conv_frame_buffer + i);
+		for (uint32_t a = 0; a < 2; a++)
+			if (p->type1.channel == chan[a]) {sum[a] += p->type1.data; n[a]++;}
+	}
+	if (n[0] && n[1]) joy_update((int32_t[2]){sum[0]/n[0], sum[1]/n[1]});
+	return false; // no high priority task awoken
+}
+
+// Initialize the joystick driver. Must be called before use.
+// May be called multiple times. Return if already initialized.
+// Sampling starts at once; the call returns after the center has been
+// measured, so the joystick must be at rest.
+// Return zero if successful, or non-zero otherwise.
+int32_t joy_init(void)
+{
+	const int32_t io[2] = {JOY_X, JOY_Y};
+	adc_digi_pattern_config_t pattern[2];
+
+	if (adc_handle != NULL) return 0;
+	for (uint32_t a = 0; a < 2; a++) {
+		adc_unit_t unit;
+		adc_channel_t ch;
+		if (adc_continuous_io_to_channel(io[a], &unit, &ch) != ESP_OK ||
+			unit != ADC_UNIT_1) {
+			ESP_LOGE(TAG, "GPIO%ld is not an ADC1 input", (long)io[a]);
+			return 1;
+		}
+		chan[a] = ch;
+		pattern[a] = (adc_digi_pattern_config_t){
+			.atten = ADC_ATTEN_DB_12,
+			.channel = ch,
+			.unit = ADC_UNIT_1,
+			.bit_width = SOC_ADC_DIGI_MAX_BITWIDTH,
+		};
+	}
+
+	adc_continuous_handle_cfg_t handle_cfg = {
+		.max_store_buf_size = POOL_SZ,
+		.conv_frame_size = FRAME_SZ,
+		.flags.flush_pool = 1, // frames are used in the callback, not read
+	};
+	ESP_ERROR_CHECK(adc_continuous_new_handle(&handle_cfg, &adc_handle));
+	adc_continuous_config_t cont_cfg = {
+		.pattern_num = 2,
+		.adc_pattern = pattern,
+		.sample_freq_hz = SAMPLE_HZ,
+		.conv_mode = ADC_CONV_SINGLE_UNIT_1,
+		.format = ADC_DIGI_OUTPUT_FORMAT_TYPE1,
+	};
+	ESP_ERROR_CHECK(adc_continuous_config(adc_handle, &cont_cfg));
+	adc_continuous_evt_cbs_t cbs = {
+		.on_conv_done = joy_conv_done,
+	};
+	ESP_ERROR_CHECK(adc_continuous_register_event_callbacks(adc_handle, &cbs, NULL));
+
+	cal_n = 0;
+	for (uint32_t a = 0; a < 2; a++) cal_sum[a] = 0;
+	atomic_store(&disp, 0);
+	ESP_ERROR_CHECK(adc_continuous_start(adc_handle));
+	for (uint32_t t = 0; cal_n < CAL_FRAMES; t += CAL_POLL) {
+		if (t >= CAL_TIMEOUT) {
+			ESP_LOGE(TAG, "no samples from the ADC");
+			joy_deinit();
+			return 1;
+		}
+		vTaskDelay(pdMS_TO_TICKS(CAL_POLL));
+	}
+	return 0;
+}
+
+// Free resources used by the joystick (ADC unit).
+// Return zero if successful, or non-zero otherwise.
+int32_t joy_deinit(void)
+{
+	if (adc_handle == NULL) return 1;
+	ESP_ERROR_CHECK(adc_continuous_stop(adc_handle));
+	ESP_ERROR_CHECK(adc_continuous_deinit(adc_handle));
+	adc_handle = NULL;
+	return 0;
+}
+
+// Get the joystick displacement from center position.
+// Displacement values range from 0 to +/- JOY_MAX_DISP, and are zero
+// inside the dead zone. The latest filtered value is returned, so this
+// function is safe to call from any context, including an ISR.
+// *dcx: pointer to displacement in x.
+// *dcy: pointer to displacement in y.
+void joy_get_displacement(int32_t *dcx, int32_t *dcy)
+{
+	uint32_t d = atomic_load_explicit(&disp, memory_order_relaxed);
+	*dcx = (int16_t)d;
+	*dcy = (int16_t)(d >> 16);
+}
+
+// NOTES:
+// * On the ESP32 the ADC DMA runs through I2S0, which the continuous DAC
+// driver also uses, so this driver cannot be used with the sound DMA driver
+// (see Kconfig).
+// * The ESP32 ADC DMA cannot sample slower than 20 kHz. Averaging each frame
+// of 64 samples per axis lowers the noise before the IIR filter and brings
+// the update rate down to SAMPLE_HZ/128 (156 Hz at 20 kHz).
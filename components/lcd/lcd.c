@@ -21,6 +21,7 @@
 
 #define _DEBUG_ 0
 
+#define LCD_MISO HW_LCD_MISO
 #define LCD_MOSI HW_LCD_MOSI
 #define LCD_SCLK HW_LCD_SCLK
 #define LCD_CS   HW_LCD_CS
@@ -31,6 +32,16 @@
 #define LCD_INV      HW_LCD_INV
 #define LCD_SPI_HOST HW_LCD_SPI_HOST
 #define LCD_SPI_FREQ HW_LCD_SPI_FREQ
+#define LCD_SPI_TUNE HW_LCD_SPI_TUNE
+#define LCD_SPI_RD_FREQ (5*1000*1000) // Panel read cycle is >= 150 ns
+
+#if LCD_SPI_TUNE
+#include "nvs_flash.h"
+#include "nvs.h"
+
+#define LCD_NVS_NS  "lcd"    // NVS namespace
+#define LCD_NVS_KEY "spi_hz" // NVS key of tuned SPI clock frequency
+#endif
 
 #define LCD_OFFSETX HW_LCD_OFFSETX
 #define LCD_OFFSETY HW_LCD_OFFSETY
@@ -53,6 +64,7 @@ typedef struct {
 	bool        font_back_en;
 	color_t     font_back_color;
 	int8_t      res;
+	int8_t      cs;
 	int8_t      dc;
 	int8_t      bl;
 	spi_device_handle_t SPIHandle;
@@ -71,6 +83,9 @@ static TFT_t *dev = &device;
 static const char *TAG = "lcd";
 
 static int32_t clock_freq_hz = LCD_SPI_FREQ;
+#if LCD_SPI_TUNE
+static bool clock_freq_set; // set by lcd_spiClockFreq(), overrides NVS
+#endif
 
 #include "glcdfont.c" // unsigned char font[];
 
@@ -84,7 +99,9 @@ static int32_t clock_freq_hz = LCD_SPI_FREQ;
 #define BUF_LEN 512
 static uint16_t buffer[BUF_LEN];
 
-static void spi_master_init(TFT_t *dev, int16_t GPIO_MOSI, int16_t GPIO_SCLK, int16_t GPIO_CS, int16_t GPIO_DC, int16_t GPIO_RST, int16_t GPIO_BL)
+static esp_err_t spi_master_set_freq(TFT_t *dev, int32_t freq);
+
+static void spi_master_init(TFT_t *dev, int16_t GPIO_MISO, int16_t GPIO_MOSI, int16_t GPIO_SCLK, int16_t GPIO_CS, int16_t GPIO_DC, int16_t GPIO_RST, int16_t GPIO_BL)
 {
 	esp_err_t ret;
 
@@ -114,11 +131,12 @@ static void spi_master_init(TFT_t *dev, int16_t GPIO_MOSI, int16_t GPIO_SCLK, in
 		gpio_set_level( GPIO_RST, 1 );
 	}
 
+	ESP_LOGI(TAG, "GPIO_MISO=%hd", GPIO_MISO);
 	ESP_LOGI(TAG, "GPIO_MOSI=%hd", GPIO_MOSI);
 	ESP_LOGI(TAG, "GPIO_SCLK=%hd", GPIO_SCLK);
 	spi_bus_config_t buscfg = {
 		.mosi_io_num = GPIO_MOSI,
-		.miso_io_num = -1,
+		.miso_io_num = GPIO_MISO,
 		.sclk_io_num = GPIO_SCLK,
 		.quadwp_io_num = -1,
 		.quadhd_io_num = -1,
@@ -130,15 +148,37 @@ static void spi_master_init(TFT_t *dev, int16_t GPIO_MOSI, int16_t GPIO_SCLK, in
 	ESP_LOGD(TAG, "spi_bus_initialize=%d",(int)ret);
 	assert(ret==ESP_OK);
 
+	dev->res = GPIO_RST;
+	dev->cs = GPIO_CS;
+	dev->dc = GPIO_DC;
+	dev->bl = GPIO_BL;
+	dev->SPIHandle = NULL;
+	ret = spi_master_set_freq(dev, clock_freq_hz);
+	assert(ret==ESP_OK);
+}
+
+// Add the display to the bus at the specified clock frequency, replacing
+// the device already added (if any).
+static esp_err_t spi_master_set_freq(TFT_t *dev, int32_t freq)
+{
+	esp_err_t ret;
+
+	if (dev->SPIHandle != NULL) {
+		ret = spi_bus_remove_device(dev->SPIHandle);
+		ESP_LOGD(TAG, "spi_bus_remove_device=%d",(int)ret);
+		if (ret != ESP_OK) return ret;
+		dev->SPIHandle = NULL;
+	}
+
 	spi_device_interface_config_t devcfg;
 	memset(&devcfg, 0, sizeof(devcfg));
-	devcfg.clock_speed_hz = clock_freq_hz;
+	devcfg.clock_speed_hz = freq;
 	devcfg.queue_size = 7;
 	devcfg.mode = 3;
 	devcfg.flags = SPI_DEVICE_NO_DUMMY;
 
-	if ( GPIO_CS >= 0 ) {
-		devcfg.spics_io_num = GPIO_CS;
+	if ( dev->cs >= 0 ) {
+		devcfg.spics_io_num = dev->cs;
 	} else {
 		devcfg.spics_io_num = -1;
 	}
@@ -146,11 +186,9 @@ static void spi_master_init(TFT_t *dev, int16_t GPIO_MOSI, int16_t GPIO_SCLK, in
 	spi_device_handle_t handle;
 	ret = spi_bus_add_device( LCD_SPI_HOST, &devcfg, &handle);
 	ESP_LOGD(TAG, "spi_bus_add_device=%d",(int)ret);
-	assert(ret==ESP_OK);
-	dev->res = GPIO_RST;
-	dev->dc = GPIO_DC;
-	dev->bl = GPIO_BL;
+	if (ret != ESP_OK) return ret;
 	dev->SPIHandle = handle;
+	return ESP_OK;
 }
 
 static bool spi_master_write_bytes(spi_device_handle_t SPIHandle, const uint8_t* Data, size_t DataLength)
@@ -240,14 +278,61 @@ inline static bool spi_master_write_colors(TFT_t *dev, const color_t *colors, si
 	return true;
 }
 
+// Ping-pong buffers for streaming pixel blocks with queued DMA.
+static uint16_t dma_buf[2][BUF_LEN];
+static spi_transaction_t dma_trans[2];
+
+// Stream a w x h block of colors, rows stride elements apart. Pixels are
+// byte swapped into one buffer while the other is being transmitted.
+static bool spi_master_write_colors_rect(TFT_t *dev, const color_t *colors, size_t w, size_t h, size_t stride)
+{
+	spi_transaction_t *rtrans;
+	uint8_t k = 0, pend = 0;
+	size_t idx = 0;
+	esp_err_t ret;
+
+	gpio_set_level(dev->dc, SPI_Data_Mode);
+	for (size_t j = 0; j < h; j++, colors += stride) {
+		for (size_t i = 0; i < w; i++) {
+			dma_buf[k][idx++] = SWAP16(colors[i]);
+			if (idx < BUF_LEN && !(j == h-1 && i == w-1)) continue;
+			memset(&dma_trans[k], 0, sizeof(spi_transaction_t));
+			dma_trans[k].length = idx * sizeof(uint16_t) * 8;
+			dma_trans[k].tx_buffer = dma_buf[k];
+			ret = spi_device_queue_trans(dev->SPIHandle, &dma_trans[k], portMAX_DELAY);
+			assert(ret==ESP_OK);
+			k ^= 1; idx = 0;
+			if (++pend == 2) { // wait for the other buffer to free up
+				ret = spi_device_get_trans_result(dev->SPIHandle, &rtrans, portMAX_DELAY);
+				assert(ret==ESP_OK);
+				pend--;
+			}
+		}
+	}
+	while (pend--) {
+		ret = spi_device_get_trans_result(dev->SPIHandle, &rtrans, portMAX_DELAY);
+		assert(ret==ESP_OK);
+	}
+	return true;
+}
+
 
 //----------------------------------------------------------------------------//
 // LCD
 //----------------------------------------------------------------------------//
 
+#if LCD_SPI_TUNE
+static bool lcd_spiClockLoad(void);
+#endif
+
 void lcd_init(void)
 {
+#if LCD_SPI_TUNE
+	bool tuned = lcd_spiClockLoad();
+#endif
+
 	spi_master_init(dev,
+		LCD_MISO,
 		LCD_MOSI,
 		LCD_SCLK,
 		LCD_CS,
@@ -417,6 +502,12 @@ void lcd_init(void)
 	lcd_inversionOff();
 #endif
 	lcd_fillScreen(BLACK); // assume use_frame_buffer is false
+#if LCD_SPI_TUNE
+	if (!tuned) {
+		lcd_spiClockTune();
+		lcd_fillScreen(BLACK);
+	}
+#endif
 	lcd_displayOn();
 	lcd_backlightOn();
 }
@@ -891,33 +982,302 @@ void lcd_fillArrow(coord_t x0, coord_t y0, coord_t x1, coord_t y1, coord_t w, co
 	lcd_fillTriangle(x1, y1, L[0], L[1], R[0], R[1], color);
 }
 
-void lcd_drawBitmap(coord_t x, coord_t y, const uint8_t *bitmap, coord_t w, coord_t h, color_t color)
+// Polygon edge, X values are 16.16 fixed point.
+typedef struct {
+	coord_t ymin; // First scanline crossed by edge
+	coord_t ymax; // Scanline after the last one crossed by edge
+	int32_t x;    // X crossing at the current scanline
+	int32_t dxdy; // X increment per scanline
+} poly_edge_t;
+
+// Scratch arena for the edge table (sorted by ymin)
+// and active edge table (sorted by x).
+static poly_edge_t poly_et[LCD_POLY_EDGES];
+static poly_edge_t *poly_aet[LCD_POLY_EDGES];
+
+/**
+ * @details Active edge table scanline algorithm. Edges are sorted once by
+ *  their top scanline. Each scanline, edges that start are moved into the
+ *  active table, edges that end are dropped, and the active edges (already
+ *  nearly in order) are insertion sorted by X. Spans between pairs of
+ *  crossings are then filled (even-odd rule). Crossings are sampled at pixel
+ *  centers and stepped incrementally in 16.16 fixed point.
+ */
+void lcd_fillPolygon(const coord_t *xy, coord_t n, color_t color)
 {
-	coord_t byteWidth = (w + 7) / 8; // pad bitmap scanline to whole byte
-	uint8_t b = 0;
+	coord_t ne = 0, na = 0, next = 0;
+	coord_t y, yend = 0;
+
+	// Build the edge table, skipping horizontal edges
+	for (coord_t i = 0; i < n; i++) {
+		coord_t x0 = xy[2*i],         y0 = xy[2*i+1];
+		coord_t x1 = xy[2*((i+1)%n)], y1 = xy[2*((i+1)%n)+1];
+		if (y0 == y1) continue;
+		if (y0 > y1) {
+			swap(coord_t, x0, x1);
+			swap(coord_t, y0, y1);
+		}
+		if (ne == LCD_POLY_EDGES) {
+			ESP_LOGE(TAG, "polygon edge limit exceeded");
+			return;
+		}
+		poly_edge_t *e = poly_et + ne++;
+		e->ymin = y0;
+		e->ymax = y1;
+		e->dxdy = (int64_t)(x1 - x0) * 65536 / (y1 - y0);
+		e->x = x0 * 65536 + e->dxdy / 2; // sample at y0+0.5
+		if (y1 > yend) yend = y1;
+	}
+	if (ne == 0) return;
+
+	// Sort edge table by ymin
+	for (coord_t i = 1; i < ne; i++) {
+		poly_edge_t t = poly_et[i];
+		coord_t j = i;
+		for (; j > 0 && poly_et[j-1].ymin > t.ymin; j--) poly_et[j] = poly_et[j-1];
+		poly_et[j] = t;
+	}
 
+	// Clip scanline range to screen
+	y = (poly_et[0].ymin < 0) ? 0 : poly_et[0].ymin;
+	if (yend > dev->height) yend = dev->height;
+
+	for (; y < yend; y++) {
+		// Move edges that start at or above this scanline into the active table
+		for (; next < ne && poly_et[next].ymin <= y; next++) {
+			poly_edge_t *e = poly_et + next;
+			if (e->ymax <= y) continue; // entirely above the screen
+			e->x += (int64_t)e->dxdy * (y - e->ymin); // skip clipped rows
+			poly_aet[na++] = e;
+		}
+		// Drop edges that have ended and sort the remainder by X
+		coord_t k = 0;
+		for (coord_t i = 0; i < na; i++) {
+			poly_edge_t *e = poly_aet[i];
+			if (e->ymax <= y) continue;
+			coord_t j = k++;
+			for (; j > 0 && poly_aet[j-1]->x > e->x; j--) poly_aet[j] = poly_aet[j-1];
+			poly_aet[j] = e;
+		}
+		na = k;
+		if (na == 0) { // skip empty gap to the next edge
+			if (next == ne) break;
+			y = poly_et[next].ymin - 1;
+			continue;
+		}
+		// Fill spans between pairs of crossings
+		for (coord_t i = 0; i+1 < na; i += 2) {
+			coord_t xa = (poly_aet[i  ]->x + 0x7FFF) >> 16;
+			coord_t xb = (poly_aet[i+1]->x + 0x7FFF) >> 16;
+			if (xb > xa) lcd_drawHLine(xa, y, xb - xa, color);
+		}
+		for (coord_t i = 0; i < na; i++) poly_aet[i]->x += poly_aet[i]->dxdy;
+	}
+}
+
+// Pixel masks for each bitmap byte value, MSB first (0xFFFF for a set bit).
+#define BM_M(n,b) (((n) & (b)) ? 0xFFFF : 0x0000)
+#define BM1(n) {BM_M(n,0x80),BM_M(n,0x40),BM_M(n,0x20),BM_M(n,0x10), \
+                BM_M(n,0x08),BM_M(n,0x04),BM_M(n,0x02),BM_M(n,0x01)}
+#define BM4(n)  BM1(n), BM1((n)+1),  BM1((n)+2),  BM1((n)+3)
+#define BM16(n) BM4(n), BM4((n)+4),  BM4((n)+8),  BM4((n)+12)
+#define BM64(n) BM16(n),BM16((n)+16),BM16((n)+32),BM16((n)+48)
+static const uint16_t bm_mask[256][8] = {BM64(0),BM64(64),BM64(128),BM64(192)};
+
+// Fetch up to 8 bits (MSB first) starting at bit offset b of row.
+// Only the upper n bits of the result are valid; reads stay inside the
+// bytes that hold those bits.
+static inline uint8_t bm_bits(const uint8_t *row, coord_t b, coord_t n)
+{
+	const uint8_t *p = row + (b >> 3);
+	uint8_t s = b & 7;
+	if (!s) return p[0];
+	uint8_t v = p[0] << s;
+	if (s + n > 8) v |= p[1] >> (8 - s);
+	return v;
+}
+
+// Draw a w x h window of a 1-bit bitmap whose rows are stride bytes apart,
+// starting at bit column sx of each row. Set bits are drawn in color; unset
+// bits are drawn in bg if opaque, otherwise left unchanged.
+static void lcd_blit1(coord_t x, coord_t y, const uint8_t *bitmap,
+	coord_t sx, coord_t stride, coord_t w, coord_t h,
+	color_t color, color_t bg, bool opaque)
+{
+	if (w <= 0 || h <= 0) return; // empty
 	if (x+w <= 0 || x >= dev->width) return; // off screen
 	if (y+h <= 0 || y >= dev->height) return;
 
-	for (size_t j = 0; j < h; j++, y++) {
-		for (size_t i = 0; i < w; i++) {
-			if (i & 7) b <<= 1;
-			else b = bitmap[j * byteWidth + i / 8];
-			if (b & 0x80) lcd_drawPixel(x + i, y, color);
+	// clip once; bx is the first source bit column drawn in each row
+	coord_t bx = sx;
+	if (x < 0) {bx -= x; w += x; x = 0;}
+	if (x+w > dev->width) w = dev->width-x;
+	if (y < 0) {bitmap += (size_t)(-y)*stride; h += y; y = 0;}
+	if (y+h > dev->height) h = dev->height-y;
+	if (w <= 0 || h <= 0) return;
+
+	if (dev->use_frame_buffer) {
+		for (coord_t j = 0; j < h; j++, bitmap += stride) {
+			color_t *dst = dev->frame_buffer + (size_t)(y+j)*dev->width + x;
+			for (coord_t i = 0; i < w; i += 8) {
+				coord_t n = (w-i < 8) ? w-i : 8;
+				uint8_t b = bm_bits(bitmap, bx+i, n);
+				const uint16_t *m = bm_mask[b];
+				if (opaque) {
+					for (coord_t k = 0; k < n; k++)
+						dst[i+k] = (color & m[k]) | (bg & ~m[k]);
+				} else if (b) {
+					for (coord_t k = 0; k < n; k++)
+						dst[i+k] = (color & m[k]) | (dst[i+k] & ~m[k]);
+				}
+			}
+		}
+	} else if (opaque) {
+		// one address window, rows expanded into buffer and streamed out
+		coord_t _x1 = x + dev->offsetx;
+		coord_t _y1 = y + dev->offsety;
+		uint16_t fg = SWAP16(color);
+		uint16_t bk = SWAP16(bg);
+		size_t idx = 0;
+
+		spi_master_write_command(dev, 0x2A); // Column(x) Address Set
+		spi_master_write_addr(dev, _x1, _x1+w-1);
+		spi_master_write_command(dev, 0x2B); // Page(y) Address Set
+		spi_master_write_addr(dev, _y1, _y1+h-1);
+		spi_master_write_command(dev, 0x2C); // Memory Write
+		gpio_set_level(dev->dc, SPI_Data_Mode);
+		for (coord_t j = 0; j < h; j++, bitmap += stride) {
+			for (coord_t i = 0; i < w; i += 8) {
+				coord_t n = (w-i < 8) ? w-i : 8;
+				const uint16_t *m = bm_mask[bm_bits(bitmap, bx+i, n)];
+				if (idx+n > BUF_LEN) {
+					spi_master_write_bytes(dev->SPIHandle, (uint8_t *)buffer, idx*sizeof(uint16_t));
+					idx = 0;
+				}
+				for (coord_t k = 0; k < n; k++)
+					buffer[idx++] = (fg & m[k]) | (bk & ~m[k]);
+			}
+		}
+		spi_master_write_bytes(dev->SPIHandle, (uint8_t *)buffer, idx*sizeof(uint16_t));
+	} else {
+		// run-length spans, whole bytes of 0x00 or 0xFF skipped or extended
+		for (coord_t j = 0; j < h; j++, y++, bitmap += stride) {
+			coord_t run = -1; // start of current span, -1 if none
+			for (coord_t i = 0; i < w;) {
+				coord_t n = (w-i < 8) ? w-i : 8;
+				uint8_t full = 0xFF00 >> n;
+				uint8_t b = bm_bits(bitmap, bx+i, n) & full;
+				if (b == 0x00) {
+					if (run >= 0) {lcd_drawHLine(x+run, y, i-run, color); run = -1;}
+					i += n;
+				} else if (b == full) {
+					if (run < 0) run = i;
+					i += n;
+				} else {
+					for (coord_t k = 0; k < n; k++, i++, b <<= 1) {
+						if (b & 0x80) {
+							if (run < 0) run = i;
+						} else if (run >= 0) {
+							lcd_drawHLine(x+run, y, i-run, color);
+							run = -1;
+						}
+					}
+				}
+			}
+			if (run >= 0) lcd_drawHLine(x+run, y, w-run, color);
 		}
 	}
 }
 
+void lcd_drawBitmap(coord_t x, coord_t y, const uint8_t *bitmap, coord_t w, coord_t h, color_t color)
+{
+	lcd_blit1(x, y, bitmap, 0, (w + 7) / 8, w, h, color, 0, false);
+}
+
+void lcd_drawBitmapBg(coord_t x, coord_t y, const uint8_t *bitmap, coord_t w, coord_t h, color_t color, color_t bg)
+{
+	lcd_blit1(x, y, bitmap, 0, (w + 7) / 8, w, h, color, bg, true);
+}
+
 void lcd_drawRGBBitmap(coord_t x, coord_t y, const color_t *bitmap, coord_t w, coord_t h)
+{
+	lcd_drawRGBBitmapStride(x, y, bitmap, w, h, w);
+}
+
+void lcd_drawRGBBitmapStride(coord_t x, coord_t y, const color_t *bitmap, coord_t w, coord_t h, coord_t stride)
 {
 	if (x+w <= 0 || x >= dev->width) return; // off screen
 	if (y+h <= 0 || y >= dev->height) return;
 
-	for (size_t j = 0; j < h; j++, y++) {
-		lcd_drawHPixels(x, y, w, bitmap+j*w);
+	// clip source rectangle once
+	if (x < 0) {bitmap -= x; w += x; x = 0;}
+	if (x+w > dev->width) w = dev->width-x;
+	if (y < 0) {bitmap += (size_t)(-y)*stride; h += y; y = 0;}
+	if (y+h > dev->height) h = dev->height-y;
+
+	if (dev->use_frame_buffer) {
+		color_t *dst = dev->frame_buffer + (size_t)y*dev->width + x;
+		for (coord_t j = 0; j < h; j++, dst += dev->width, bitmap += stride) {
+			memcpy(dst, bitmap, w*sizeof(color_t));
+		}
+	} else {
+		coord_t _x1 = x + dev->offsetx;
+		coord_t _y1 = y + dev->offsety;
+
+		spi_master_write_command(dev, 0x2A); // Column(x) Address Set
+		spi_master_write_addr(dev, _x1, _x1+w-1);
+		spi_master_write_command(dev, 0x2B); // Page(y) Address Set
+		spi_master_write_addr(dev, _y1, _y1+h-1);
+		spi_master_write_command(dev, 0x2C); // Memory Write
+		spi_master_write_colors_rect(dev, bitmap, w, h, stride);
 	}
 }
 
+//----------------------------------------------------------------------------//
+// Sprite atlas frames and animation
+//----------------------------------------------------------------------------//
+
+void lcd_drawAtlasFrame(coord_t x, coord_t y, const lcd_atlas_t *atlas, uint16_t f, color_t color)
+{
+	if (f >= atlas->frames) return;
+	const lcd_frame_t *fr = &atlas->frame[f];
+
+	if (atlas->bpp == 1) {
+		coord_t stride = (atlas->w + 7) / 8;
+		const uint8_t *row = (const uint8_t *)atlas->image + (size_t)fr->y*stride;
+		lcd_blit1(x, y, row, fr->x, stride, fr->w, fr->h, color, 0, false);
+	} else {
+		const color_t *pix = (const color_t *)atlas->image + (size_t)fr->y*atlas->w + fr->x;
+		lcd_drawRGBBitmapStride(x, y, pix, fr->w, fr->h, atlas->w);
+	}
+}
+
+void lcd_animInit(lcd_anim_t *anim, const lcd_atlas_t *atlas)
+{
+	anim->atlas = atlas;
+	anim->frame = 0;
+	anim->elapsed = 0;
+}
+
+uint16_t lcd_animTick(lcd_anim_t *anim, uint32_t ms)
+{
+	const lcd_atlas_t *atlas = anim->atlas;
+
+	anim->elapsed += ms;
+	for (;;) {
+		uint16_t d = atlas->frame[anim->frame].duration;
+		if (d == 0 || anim->elapsed < d) break;
+		anim->elapsed -= d;
+		if (++anim->frame >= atlas->frames) anim->frame = 0;
+	}
+	return anim->frame;
+}
+
+void lcd_animDraw(coord_t x, coord_t y, const lcd_anim_t *anim, color_t color)
+{
+	lcd_drawAtlasFrame(x, y, anim->atlas, anim->frame, color);
+}
+
 //----------------------------------------------------------------------------//
 // Rectangle variants that specify two diagonal corners
 //----------------------------------------------------------------------------//
@@ -1229,6 +1589,174 @@ void lcd_spiClockFreq(int32_t freq)
 {
 	ESP_LOGI(TAG, "SPI clock frequency=%d MHz", (int)freq/1000000);
 	clock_freq_hz = freq;
+#if LCD_SPI_TUNE
+	clock_freq_set = true;
+#endif
+}
+
+#if LCD_SPI_TUNE
+// Initialize the default NVS partition if the application has not. The
+// driver never erases NVS, it holds the data of the application too. A
+// partition that must be erased first (no free pages, new version) is left
+// to the application, and the tuned clock is neither loaded nor saved.
+// Returns true if NVS can be used.
+static bool lcd_nvsInit(void)
+{
+	esp_err_t ret = nvs_flash_init(); // ESP_OK if already initialized
+	if (ret == ESP_ERR_NVS_NO_FREE_PAGES || ret == ESP_ERR_NVS_NEW_VERSION_FOUND) {
+		ESP_LOGE(TAG, "NVS must be erased by the application, SPI clock not loaded or saved");
+		return false;
+	}
+	if (ret != ESP_OK) {
+		ESP_LOGE(TAG, "NVS init failed (%s)", esp_err_to_name(ret));
+		return false;
+	}
+	return true;
+}
+
+// Load a previously tuned clock frequency from NVS, unless one was set with
+// lcd_spiClockFreq(). Returns true if a tuned frequency was found.
+static bool lcd_spiClockLoad(void)
+{
+	nvs_handle_t h;
+	int32_t freq;
+	bool found = false;
+
+	if (!lcd_nvsInit()) return false;
+	if (nvs_open(LCD_NVS_NS, NVS_READONLY, &h) != ESP_OK) return false; // none saved yet
+	if (nvs_get_i32(h, LCD_NVS_KEY, &freq) == ESP_OK && freq > 0) {
+		found = true;
+		if (!clock_freq_set) {
+			ESP_LOGI(TAG, "Tuned SPI clock frequency=%d Hz", (int)freq);
+			clock_freq_hz = freq;
+		}
+	}
+	nvs_close(h);
+	return found;
+}
+#endif // LCD_SPI_TUNE
+
+#if LCD_MISO >= 0
+// Read back n pixels from row y via RAMRD at a slow clock. The panel
+// returns a dummy byte, then R, G, B bytes (6 significant bits each).
+static bool lcd_spiClockVerify(coord_t y, const color_t *pat, coord_t n)
+{
+	uint8_t *rbuf = (uint8_t *)buffer;
+	size_t len = (1 + 3*(size_t)n + 3) & ~3; // whole words for DMA
+	spi_transaction_t t;
+	esp_err_t ret;
+
+	if (spi_master_set_freq(dev, LCD_SPI_RD_FREQ) != ESP_OK) return false;
+
+	spi_master_write_command(dev, 0x2A); // Column(x) Address Set
+	spi_master_write_addr(dev, dev->offsetx, dev->offsetx+n-1);
+	spi_master_write_command(dev, 0x2B); // Page(y) Address Set
+	spi_master_write_addr(dev, dev->offsety+y, dev->offsety+y);
+
+	// Command and data phases must share one chip select assertion
+	ret = spi_device_acquire_bus(dev->SPIHandle, portMAX_DELAY);
+	assert(ret==ESP_OK);
+	uint8_t cmd = 0x2E; // Memory Read
+	memset(&t, 0, sizeof(t));
+	t.length = 8;
+	t.tx_buffer = &cmd;
+	t.flags = SPI_TRANS_CS_KEEP_ACTIVE;
+	gpio_set_level(dev->dc, SPI_Command_Mode);
+	ret = spi_device_polling_transmit(dev->SPIHandle, &t);
+	assert(ret==ESP_OK);
+	memset(&t, 0, sizeof(t));
+	t.length = len * 8;
+	t.rx_buffer = rbuf;
+	gpio_set_level(dev->dc, SPI_Data_Mode);
+	ret = spi_device_polling_transmit(dev->SPIHandle, &t);
+	assert(ret==ESP_OK);
+	spi_device_release_bus(dev->SPIHandle);
+
+	for (coord_t i = 0; i < n; i++) {
+		const uint8_t *p = rbuf + 1 + 3*i;
+		if ((p[0] >> 3) != (pat[i] >> 11) ||
+			(p[1] >> 2) != ((pat[i] >> 5) & 0x3F) ||
+			(p[2] >> 3) != (pat[i] & 0x1F)) return false;
+	}
+	return true;
+}
+#endif
+
+#define TUNE_N 64 // pixels per test row
+#define TUNE_PASSES 8 // test rows per candidate clock
+
+int32_t lcd_spiClockTune(void)
+{
+#if LCD_MISO >= 0
+	// Candidate clocks, fastest first. The driver rounds each to what the
+	// SPI clock divider can produce, so duplicates are skipped.
+	static const int32_t cand[] = {
+		80*1000*1000, 60*1000*1000, 53*1000*1000, 40*1000*1000,
+		26*1000*1000, 20*1000*1000,
+	};
+	color_t pat[TUNE_N];
+	int32_t best = -1;
+	int prev_khz = 0;
+
+	for (size_t c = 0; c < sizeof(cand)/sizeof(cand[0]) && best < 0; c++) {
+		int khz;
+		if (spi_master_set_freq(dev, cand[c]) != ESP_OK) continue;
+		if (spi_device_get_actual_freq(dev->SPIHandle, &khz) != ESP_OK) continue;
+		if (khz == prev_khz) continue;
+		prev_khz = khz;
+
+		bool ok = true;
+		uint32_t seed = 0x1234567;
+		for (uint32_t p = 0; p < TUNE_PASSES && ok; p++) {
+			// alternating, ramp, and pseudo-random patterns
+			for (coord_t i = 0; i < TUNE_N; i++) {
+				seed = seed * 1664525 + 1013904223;
+				pat[i] = (p == 0) ? ((i & 1) ? 0xAAAA : 0x5555) :
+				         (p == 1) ? (color_t)(i * 0x0421) :
+				         (color_t)(seed >> 16);
+			}
+			if (spi_master_set_freq(dev, cand[c]) != ESP_OK) {ok = false; break;}
+			spi_master_write_command(dev, 0x2A); // Column(x) Address Set
+			spi_master_write_addr(dev, dev->offsetx, dev->offsetx+TUNE_N-1);
+			spi_master_write_command(dev, 0x2B); // Page(y) Address Set
+			spi_master_write_addr(dev, dev->offsety+p, dev->offsety+p);
+			spi_master_write_command(dev, 0x2C); // Memory Write
+			spi_master_write_colors(dev, pat, TUNE_N);
+			ok = lcd_spiClockVerify(p, pat, TUNE_N);
+		}
+		ESP_LOGI(TAG, "SPI clock %d kHz: %s", khz, ok ? "pass" : "fail");
+		if (ok) best = khz * 1000;
+	}
+	if (best < 0) {
+		// Nothing verified, e.g. no panel or a bad MISO line. Keep the
+		// default clock and save nothing, so the next boot tunes again.
+		ESP_LOGW(TAG, "No SPI clock verified, tuned clock not saved");
+		clock_freq_hz = LCD_SPI_FREQ;
+		spi_master_set_freq(dev, clock_freq_hz);
+		return clock_freq_hz;
+	}
+	clock_freq_hz = best;
+	spi_master_set_freq(dev, clock_freq_hz);
+
+#if LCD_SPI_TUNE
+	// store for later boots
+	nvs_handle_t h;
+	if (lcd_nvsInit() && nvs_open(LCD_NVS_NS, NVS_READWRITE, &h) == ESP_OK) {
+		nvs_set_i32(h, LCD_NVS_KEY, clock_freq_hz);
+		nvs_commit(h);
+		nvs_close(h);
+	} else {
+		ESP_LOGW(TAG, "Tuned SPI clock not saved to NVS");
+	}
+#endif
+	ESP_LOGI(TAG, "SPI clock frequency=%d Hz", (int)clock_freq_hz);
+	return clock_freq_hz;
+#else
+	// Without MISO the panel cannot be read back, and nothing sent over
+	// a write-only bus can prove the panel latched it. Keep the clock.
+	ESP_LOGW(TAG, "No LCD MISO, SPI clock not tuned");
+	return -1;
+#endif
 }
 
 void lcd_displayOff(void)
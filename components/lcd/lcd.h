@@ -47,6 +47,9 @@
 
 /** @} */
 
+/** @brief Maximum number of edges in a polygon passed to lcd_fillPolygon(). */
+#define LCD_POLY_EDGES 64
+
 /** @brief Coordinate type for x,y screen positions. */
 /** @note Needs to be signed to handle off screen positions. */
 typedef int32_t coord_t;
@@ -79,6 +82,30 @@ typedef enum {
  */
 void lcd_init(void);
 
+/** @brief One frame of a sprite atlas: a sub-rectangle of the atlas image
+ *  and how long it is shown when animated. */
+typedef struct {
+	coord_t  x, y;     /**< Top left corner of the frame in the atlas image. */
+	coord_t  w, h;     /**< Width and height of the frame in pixels. */
+	uint16_t duration; /**< Display time in milliseconds (0 = hold). */
+} lcd_frame_t;
+
+/** @brief Sprite atlas: all frames packed in one image plus a frame table. */
+typedef struct {
+	const void        *image;  /**< 1-bit (packed rows) or color_t pixels. */
+	coord_t            w, h;   /**< Width and height of the atlas image. */
+	uint8_t            bpp;    /**< Bits per pixel of the image, 1 or 16. */
+	uint16_t           frames; /**< Number of entries in the frame table. */
+	const lcd_frame_t *frame;  /**< Frame table, in animation order. */
+} lcd_atlas_t;
+
+/** @brief Animation player state for a sprite atlas. */
+typedef struct {
+	const lcd_atlas_t *atlas;   /**< Atlas being played. */
+	uint16_t           frame;   /**< Current frame table index. */
+	uint32_t           elapsed; /**< Time shown so far in current frame (ms). */
+} lcd_anim_t;
+
 /** @name Draw (outline) and fill primitives. */
 /** @{ */
 
@@ -239,6 +266,19 @@ void lcd_drawArrow(coord_t x0, coord_t y0, coord_t x1, coord_t y1, coord_t w, co
  */
 void lcd_fillArrow(coord_t x0, coord_t y0, coord_t x1, coord_t y1, coord_t w, color_t color);
 
+/**
+ * @brief Draw a filled polygon (convex or concave) using n arbitrary points.
+ * @param xy    Array of vertex coordinates {x0, y0, x1, y1, ...}, length = 2*n.
+ * @param n     Number of vertices. The last vertex connects back to the first.
+ * @param color Color value.
+ * @note  Pixels are filled using the even-odd rule, so self-intersecting
+ *  outlines leave their overlapping regions unfilled. A pixel is inside if
+ *  its center is inside the outline. Pixels on the right and bottom edges
+ *  are excluded so polygons that share an edge do not overdraw each other.
+ *  At most LCD_POLY_EDGES non-horizontal edges are supported.
+ */
+void lcd_fillPolygon(const coord_t *xy, coord_t n, color_t color);
+
 /**
  * @brief Draw a 1-bit image at the specified location using the specified
  *  color for set bits. Unset bits are transparent (no change to destination).
@@ -253,6 +293,21 @@ void lcd_fillArrow(coord_t x0, coord_t y0, coord_t x1, coord_t y1, coord_t w, co
  */
 void lcd_drawBitmap(coord_t x, coord_t y, const uint8_t *bitmap, coord_t w, coord_t h, color_t color);
 
+/**
+ * @brief Draw an opaque 1-bit image at the specified location using the
+ *  specified colors for set and unset bits.
+ * @param x      Top left corner X coordinate.
+ * @param y      Top left corner Y coordinate.
+ * @param bitmap Byte array with monochrome bitmap, one bit for each pixel.
+ * @param w      Width of bitmap in pixels.
+ * @param h      Height of bitmap in pixels.
+ * @param color  Color value for set bits.
+ * @param bg     Color value for unset bits.
+ * @note  Without a frame buffer, the whole image is sent in one address
+ *  window, which is much faster than lcd_drawBitmap().
+ */
+void lcd_drawBitmapBg(coord_t x, coord_t y, const uint8_t *bitmap, coord_t w, coord_t h, color_t color, color_t bg);
+
 /**
  * @brief Draw an image at the specified location.
  * @param x      Top left corner X coordinate.
@@ -263,6 +318,59 @@ void lcd_drawBitmap(coord_t x, coord_t y, const uint8_t *bitmap, coord_t w, coor
  */
 void lcd_drawRGBBitmap(coord_t x, coord_t y, const color_t *bitmap, coord_t w, coord_t h);
 
+/**
+ * @brief Draw a sub-image at the specified location.
+ * @param x      Top left corner X coordinate.
+ * @param y      Top left corner Y coordinate.
+ * @param bitmap Pointer to the top left pixel of the sub-image.
+ * @param w      Width of sub-image in pixels.
+ * @param h      Height of sub-image in pixels.
+ * @param stride Distance between rows of the source image, in pixels.
+ * @note  The visible part of the image is sent in one address window.
+ */
+void lcd_drawRGBBitmapStride(coord_t x, coord_t y, const color_t *bitmap, coord_t w, coord_t h, coord_t stride);
+
+/** @} */
+
+/** @name Sprite atlas frames and animation. */
+/** @{ */
+
+/**
+ * @brief Draw one frame of a sprite atlas at the specified location.
+ * @param x     Top left corner X coordinate.
+ * @param y     Top left corner Y coordinate.
+ * @param atlas Pointer to the sprite atlas.
+ * @param f     Frame table index.
+ * @param color Color value for set bits of a 1-bit atlas (unset bits are
+ *  transparent). Ignored for a 16-bit atlas.
+ */
+void lcd_drawAtlasFrame(coord_t x, coord_t y, const lcd_atlas_t *atlas, uint16_t f, color_t color);
+
+/**
+ * @brief Initialize an animation player to the first frame of an atlas.
+ * @param anim  Pointer to the animation player state.
+ * @param atlas Pointer to the sprite atlas.
+ */
+void lcd_animInit(lcd_anim_t *anim, const lcd_atlas_t *atlas);
+
+/**
+ * @brief Advance an animation by the elapsed time. Frames wrap around to
+ *  the beginning of the frame table.
+ * @param anim Pointer to the animation player state.
+ * @param ms   Time elapsed since the previous call in milliseconds.
+ * @return Current frame table index.
+ */
+uint16_t lcd_animTick(lcd_anim_t *anim, uint32_t ms);
+
+/**
+ * @brief Draw the current frame of an animation.
+ * @param x     Top left corner X coordinate.
+ * @param y     Top left corner Y coordinate.
+ * @param anim  Pointer to the animation player state.
+ * @param color Color value for set bits of a 1-bit atlas.
+ */
+void lcd_animDraw(coord_t x, coord_t y, const lcd_anim_t *anim, color_t color);
+
 /** @} */
 
 /** @name Rectangle variants that specify two diagonal corners. */
@@ -413,6 +521,30 @@ void lcd_noFontBackground(void);
  */
 void lcd_spiClockFreq(int32_t freq);
 
+/**
+ * @brief Find the fastest SPI clock frequency the display accepts, use it,
+ *  and, with HW_LCD_SPI_TUNE, save it in NVS so lcd_init() uses it on
+ *  later boots.
+ * @details Steps down through candidate frequencies, writes test patterns
+ *  to the top rows of the display, and reads them back at a slow clock
+ *  (RAMRD). The first frequency where all patterns verify is selected.
+ * @return Selected frequency in Hz, or -1 if the display has no MISO
+ *  connection (HW_LCD_MISO < 0) and cannot be verified. In that case the
+ *  clock is left unchanged: the panel is write-only then, and nothing sent
+ *  to it shows whether it latched the data, so tuning needs MISO.
+ *  If no frequency verifies, the default (HW_LCD_SPI_FREQ) is used and
+ *  nothing is saved.
+ * @note  Called from lcd_init() when HW_LCD_SPI_TUNE is non-zero and no
+ *  tuned frequency is saved yet. With HW_LCD_SPI_TUNE zero (the default)
+ *  the driver does not use NVS at all. Otherwise lcd_init() and this
+ *  function initialize the default NVS partition if needed, but never
+ *  erase it. If NVS must be erased first (nvs_flash_init() returns ESP_ERR_NVS_NO_FREE_PAGES or
+ *  ESP_ERR_NVS_NEW_VERSION_FOUND), an error is logged and the frequency is
+ *  neither loaded nor saved; the application should erase and initialize
+ *  NVS before lcd_init(). Overwrites the top rows of the display.
+ */
+int32_t lcd_spiClockTune(void);
+
 /**
  * @brief Display off.
  */
@@ -0,0 +1,360 @@
+// Deterministic lockstep over a serial link, see lockstep.h.
+//
+// Packet before COBS encoding, values least significant byte first:
+//   id[4] to[4] first[4] n in[n][2] ack[4] hash_tick[4] hash[4] crc[2]
+// id: random number of the sending board, chosen by lockstep_init(). The
+//   board with the lower id is player 0.
+// to: id of the board the sender is in step with, or 0 if none yet.
+// first, n: inputs of the sender for ticks first to first+n-1.
+// ack: number of inputs of the receiver the sender holds.
+// hash_tick, hash: last state hash of the sender, after hash_tick ticks,
+//   or hash_tick 0 if none.
+// crc: CRC-16/CCITT-FALSE of the bytes before it.
+// The packet is COBS encoded and ends with a zero byte, so the receiver
+// finds the start of the next packet after a lost or corrupt byte.
+//
+// Running tick t gives the local input for tick t+DELAY. Both boards start
+// with zero inputs for ticks 0 to DELAY-1, so a board is at most DELAY
+// ticks ahead of the other, and no more than 2*DELAY inputs of either
+// board are in use at once.
+//
+// A board that restarts has a new id. The other board sees the new id,
+// starts over from tick 0 and keeps its own id, then both are in step
+// again. Until then the restarted board takes no inputs from packets sent
+// to its old id.
+
+#include "esp_log.h"
+#include "esp_random.h"
+
+#include "lockstep.h"
+
+#define DELAY CONFIG_LOCKSTEP_DELAY
+#define HASH_PERIOD CONFIG_LOCKSTEP_HASH_PERIOD
+#define RING 32 // Inputs kept of each board, at least 2*DELAY
+#define SEND_MAX 8 // Most inputs in a packet
+#define HASH_RING 4 // Hashes kept of each board
+#define PKT_HDR (4+4+4+1) // id, to, first, n
+#define PKT_TAIL (4+4+4) // ack, hash_tick, hash
+#define CRC_SZ 2
+#define PKT_MAX (PKT_HDR + SEND_MAX*sizeof(lockstep_input_t) + PKT_TAIL + CRC_SZ)
+#define COBS_MAX (PKT_MAX + PKT_MAX/254 + 2) // Encoded, with delimiter
+#define READ_SZ 32 // Bytes read from the link at once
+
+static const char *TAG = "lockstep";
+
+// CRC-16/CCITT-FALSE (poly 0x1021) of each nibble
+static const uint16_t CRC_TAB[16] = {
+	0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+	0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+};
+
+typedef struct {
+	uint32_t tick; // Ticks run when hashed, 0 if none
+	uint32_t hash;
+} hash_t;
+
+// Global variables
+static lockstep_io_t link;
+static uint32_t my_id, peer_id; // peer_id is 0 until heard from
+static uint32_t tick; // Next tick to run
+static lockstep_input_t lin[RING], rin[RING]; // Local and remote inputs
+static uint32_t local_n, remote_n; // Inputs held, ticks 0 to n-1
+static uint32_t acked_n; // Local inputs the other board holds
+static hash_t lhash[HASH_RING], rhash[HASH_RING]; // Local and remote hashes
+static bool desync;
+static lockstep_stats_t stats;
+static uint8_t rx_buf[COBS_MAX]; // Encoded packet received so far
+static uint32_t rx_len;
+static bool rx_drop; // Bytes lost, skip to the next delimiter
+static bool restarted; // Started over with a restarted board
+
+
+// Return the CRC of a buffer.
+static uint16_t crc16(const uint8_t *p, uint32_t len)
+{
+	uint16_t crc = 0xFFFF;
+	while (len--) {
+		crc = (uint16_t)(crc << 4) ^ CRC_TAB[(crc >> 12) ^ (*p >> 4)];
+		crc = (uint16_t)(crc << 4) ^ CRC_TAB[(crc >> 12) ^ (*p++ & 0xF)];
+	}
+	return crc;
+}
+
+// COBS encode a buffer. The result has no zero bytes.
+// Return the encoded length, without the delimiter.
+static uint32_t cobs_encode(const uint8_t *src, uint32_t len, uint8_t *dst)
+{
+	uint32_t code_i = 0, o = 1;
+	uint8_t code = 1;
+
+	for (uint32_t i = 0; i < len; i++) {
+		if (src[i]) {
+			dst[o++] = src[i];
+			code++;
+		}
+		if (!src[i] || code == 0xFF) {
+			dst[code_i] = code;
+			code = 1;
+			code_i = o++;
+		}
+	}
+	dst[code_i] = code;
+	return o;
+}
+
+// COBS decode a buffer, without the delimiter. dst may be as long as src.
+// Return the decoded length, or a negative number if the data is bad.
+static int32_t cobs_decode(const uint8_t *src, uint32_t len, uint8_t *dst)
+{
+	uint32_t i = 0, o = 0;
+
+	while (i < len) {
+		uint8_t code = src[i++];
+		if (!code || i + code - 1 > len) return -1;
+		for (uint8_t k = 1; k < code; k++) dst[o++] = src[i++];
+		if (code < 0xFF && i < len) dst[o++] = 0;
+	}
+	return o;
+}
+
+static uint8_t *put32(uint8_t *p, uint32_t v)
+{
+	for (uint32_t i = 0; i < sizeof(v); i++, v >>= 8) *p++ = v;
+	return p;
+}
+
+static const uint8_t *get32(const uint8_t *p, uint32_t *v)
+{
+	*v = p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24;
+	return p + sizeof(*v);
+}
+
+// Compare the hashes of both boards after t ticks, if both are here.
+static void hash_check(uint32_t t)
+{
+	const hash_t *l = lhash + (t / HASH_PERIOD) % HASH_RING;
+	const hash_t *r = rhash + (t / HASH_PERIOD) % HASH_RING;
+
+	if (l->tick != t || r->tick != t || l->hash == r->hash || desync) return;
+	ESP_LOGE(TAG, "desync after tick %lu: %08lx != %08lx",
+		(unsigned long)t, (unsigned long)l->hash, (unsigned long)r->hash);
+	desync = true;
+}
+
+// Clear the ticks, inputs and hashes, back to the state before tick 0.
+static void lockstep_reset(void)
+{
+	tick = 0;
+	for (uint32_t i = 0; i < RING; i++) lin[i] = rin[i] = 0;
+	local_n = remote_n = acked_n = DELAY; // zero inputs before the first
+	for (uint32_t i = 0; i < HASH_RING; i++) lhash[i] = rhash[i] = (hash_t){0};
+	desync = false;
+}
+
+// Handle a decoded packet, without its CRC.
+static void pkt_read(const uint8_t *p, uint32_t len)
+{
+	uint32_t id, to, first, ack, ht, h;
+
+	if (len < PKT_HDR + PKT_TAIL || p[PKT_HDR-1] > SEND_MAX ||
+		len != PKT_HDR + p[PKT_HDR-1]*sizeof(lockstep_input_t) + PKT_TAIL) {
+		stats.bad++;
+		return;
+	}
+	p = get32(p, &id);
+	p = get32(p, &to);
+	p = get32(p, &first);
+	uint8_t n = *p++;
+	if (!id || id == my_id) {
+		stats.bad++;
+		return;
+	}
+	if (peer_id && id != peer_id) {
+		ESP_LOGW(TAG, "other board restarted, starting over");
+		lockstep_reset();
+		restarted = true;
+		stats.restarts++;
+	}
+	peer_id = id;
+	if (to && to != my_id) return; // sent before this board restarted
+
+	// Take the next inputs in order, skip those already held
+	for (uint8_t k = 0; k < n; k++, p += sizeof(lockstep_input_t)) {
+		uint32_t t = first + k;
+		if (t != remote_n || t - tick >= RING) continue;
+		rin[t % RING] = p[0] | p[1] << 8;
+		remote_n++;
+	}
+	p = get32(p, &ack);
+	if (ack > acked_n && ack <= local_n) acked_n = ack;
+	p = get32(p, &ht);
+	get32(p, &h);
+	if (ht) {
+		rhash[(ht / HASH_PERIOD) % HASH_RING] = (hash_t){ht, h};
+		hash_check(ht);
+	}
+}
+
+// Read the bytes waiting on the link and split them into packets.
+static void lockstep_rx(void)
+{
+	uint8_t buf[READ_SZ], pkt[COBS_MAX];
+	int32_t n;
+
+	while ((n = link.read(buf, sizeof(buf))) > 0) {
+		for (int32_t i = 0; i < n; i++) {
+			if (buf[i]) {
+				if (rx_len < sizeof(rx_buf)) rx_buf[rx_len++] = buf[i];
+				else rx_drop = true;
+				continue;
+			}
+			int32_t len = (rx_len && !rx_drop) ? cobs_decode(rx_buf, rx_len, pkt) : -1;
+			rx_len = 0;
+			rx_drop = false;
+			if (len < CRC_SZ || crc16(pkt, len - CRC_SZ) !=
+				(pkt[len-2] << 8 | pkt[len-1])) {
+				stats.bad++;
+				continue;
+			}
+			pkt_read(pkt, len - CRC_SZ);
+		}
+	}
+	if (n < 0) rx_drop = true; // bytes lost
+}
+
+// Send the local inputs the other board may not hold, the ack and the
+// last hash.
+static void lockstep_tx(void)
+{
+	uint8_t pkt[PKT_MAX], enc[COBS_MAX];
+	uint8_t *p = pkt;
+	uint32_t first = acked_n;
+
+	if (local_n - first > RING) first = local_n - RING; // held by the other board
+	uint32_t n = local_n - first;
+	if (n > SEND_MAX) n = SEND_MAX;
+	hash_t h = lhash[(tick / HASH_PERIOD) % HASH_RING];
+	if (h.tick != tick - tick % HASH_PERIOD) h = (hash_t){0}; // not yet hashed
+
+	p = put32(p, my_id);
+	p = put32(p, peer_id);
+	p = put32(p, first);
+	*p++ = n;
+	for (uint32_t k = 0; k < n; k++) {
+		lockstep_input_t v = lin[(first + k) % RING];
+		*p++ = v;
+		*p++ = v >> 8;
+	}
+	p = put32(p, remote_n);
+	p = put32(p, h.tick);
+	p = put32(p, h.hash);
+	uint16_t crc = crc16(pkt, p - pkt);
+	*p++ = crc >> 8;
+	*p++ = crc;
+	uint32_t len = cobs_encode(pkt, p - pkt, enc);
+	enc[len++] = 0; // delimiter
+	link.write(enc, len);
+}
+
+// Initialize the lockstep layer. The first tick runs when the other board
+// is heard from.
+// *io: serial link.
+// Return zero if successful, or non-zero otherwise.
+int32_t lockstep_init(const lockstep_io_t *io)
+{
+	if (io == NULL || io->write == NULL || io->read == NULL) return 1;
+	link = *io;
+	do my_id = esp_random(); while (!my_id);
+	peer_id = 0;
+	lockstep_reset();
+	restarted = false;
+	stats = (lockstep_stats_t){0};
+	rx_len = 0;
+	rx_drop = false;
+	return 0;
+}
+
+// Send the local input and get the inputs of the next tick. Call once per
+// game tick. The local input is only used when the tick runs, so input
+// given while waiting should be kept and given again.
+// local: local input, used CONFIG_LOCKSTEP_DELAY ticks from now.
+// in: inputs of the players for the tick, indexed by player.
+// Return true if the tick can run, or false to wait for the other board.
+bool lockstep_tick(lockstep_input_t local, lockstep_input_t in[LOCKSTEP_PLAYERS])
+{
+	bool run;
+
+	if (link.read == NULL) return false;
+	lockstep_rx();
+	run = peer_id && remote_n > tick;
+	if (run) {
+		int8_t me = lockstep_player();
+		lin[local_n++ % RING] = local; // tick + DELAY
+		in[me] = lin[tick % RING];
+		in[!me] = rin[tick % RING];
+		tick++;
+		stats.tick = tick;
+	} else {
+		stats.stalls++;
+	}
+	lockstep_tx();
+	return run;
+}
+
+// Return the player number (0 or 1) of this board, or -1 if the other
+// board has not been heard from. Both boards agree on the numbers.
+int8_t lockstep_player(void)
+{
+	if (!peer_id) return -1;
+	return (my_id < peer_id) ? 0 : 1;
+}
+
+// Report the hash of the game state after the tick just run.
+// hash: game state hash, e.g. from lockstep_fnv().
+void lockstep_hash(uint32_t hash)
+{
+	if (!tick || tick % HASH_PERIOD) return;
+	lhash[(tick / HASH_PERIOD) % HASH_RING] = (hash_t){tick, hash};
+	hash_check(tick);
+}
+
+// Return true if the boards reported different hashes for a tick.
+bool lockstep_desync(void)
+{
+	return desync;
+}
+
+// Return true once after the other board restarted and the ticks started
+// over from tick 0.
+bool lockstep_restarted(void)
+{
+	bool r = restarted;
+	restarted = false;
+	return r;
+}
+
+// Add data to a 32-bit FNV-1a hash.
+// hash: hash so far, or LOCKSTEP_FNV_INIT.
+// *data: pointer to the data.
+// size: size of data in bytes.
+// Return the new hash.
+uint32_t lockstep_fnv(uint32_t hash, const void *data, uint32_t size)
+{
+	const uint8_t *p = data;
+	while (size--) hash = (hash ^ *p++) * 0x01000193U;
+	return hash;
+}
+
+// Get the lockstep statistics.
+// *st: pointer to the statistics.
+void lockstep_get_stats(lockstep_stats_t *st)
+{
+	*st = stats;
+}
+
+// NOTES:
+// * Packets are sent every tick, even while waiting, so lost packets are
+// made up for by the next one. At 25 ticks per second a packet of up to 45
+// bytes uses under 10% of a 115200 baud link.
+// * Rollback is not used: a board waits for the inputs of the other, so
+// link latency up to DELAY ticks is hidden, and more shows as stalls.
@@ -0,0 +1,86 @@
+#ifndef LOCKSTEP_H_
+#define LOCKSTEP_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// This component keeps a game in step on two boards joined by a serial
+// link. Each game tick, each board hands in its local input (buttons,
+// cursor, ...) and the input is scheduled CONFIG_LOCKSTEP_DELAY ticks
+// ahead. A tick is run only when the inputs of both boards for it are
+// here, and both boards get them in the same order, so a game that only
+// changes its state from these inputs stays the same on both boards.
+// Inputs are sent again in every packet until the other board has them,
+// so a lost or corrupt packet costs time but no input. Every
+// CONFIG_LOCKSTEP_HASH_PERIOD ticks the boards compare a hash of their
+// game state to find a game that is not deterministic. When the other
+// board restarts, both boards start over from the first tick, and
+// lockstep_restarted() tells the game to start over too.
+//
+// Use in a game tick:
+//   lockstep_input_t in[LOCKSTEP_PLAYERS];
+//   if (!lockstep_tick(local_input, in)) return; // wait for the other board
+//   if (lockstep_restarted()) ... back to the initial game state ...
+//   ... update the game from in[0], then in[1] ...
+//   lockstep_hash(hash of the game state);
+
+#define LOCKSTEP_PLAYERS 2
+
+typedef uint16_t lockstep_input_t; // Input of a player for one tick
+
+// Serial link, e.g. com_write() and com_read(). Neither may wait.
+typedef struct {
+	int32_t (*write)(const void *buf, uint32_t size);
+	int32_t (*read)(void *buf, uint32_t size);
+} lockstep_io_t;
+
+// Lockstep statistics
+typedef struct {
+	uint32_t tick;     // Ticks run
+	uint32_t stalls;   // Calls that waited for the other board
+	uint32_t bad;      // Packets dropped for a bad length or CRC
+	uint32_t restarts; // Times the other board restarted
+} lockstep_stats_t;
+
+// Initialize the lockstep layer. The first tick runs when the other board
+// is heard from.
+// *io: serial link.
+// Return zero if successful, or non-zero otherwise.
+int32_t lockstep_init(const lockstep_io_t *io);
+
+// Send the local input and get the inputs of the next tick. Call once per
+// game tick.
+// local: local input, used CONFIG_LOCKSTEP_DELAY ticks from now.
+// in: inputs of the players for the tick, indexed by player.
+// Return true if the tick can run, or false to wait for the other board.
+bool lockstep_tick(lockstep_input_t local, lockstep_input_t in[LOCKSTEP_PLAYERS]);
+
+// Return the player number (0 or 1) of this board, or -1 if the other
+// board has not been heard from. Both boards agree on the numbers.
+int8_t lockstep_player(void);
+
+// Report the hash of the game state after the tick just run.
+// hash: game state hash, e.g. from lockstep_fnv().
+void lockstep_hash(uint32_t hash);
+
+// Return true if the boards reported different hashes for a tick.
+bool lockstep_desync(void);
+
+// Return true once after the other board restarted. The ticks started
+// over from the first, so the game should go back to its initial state
+// before it uses the inputs of the tick just returned.
+bool lockstep_restarted(void);
+
+// Add data to a 32-bit FNV-1a hash.
+// hash: hash so far, or LOCKSTEP_FNV_INIT.
+// *data: pointer to the data.
+// size: size of data in bytes.
+// Return the new hash.
+#define LOCKSTEP_FNV_INIT 0x811C9DC5U
+uint32_t lockstep_fnv(uint32_t hash, const void *data, uint32_t size);
+
+// Get the lockstep statistics.
+// *st: pointer to the statistics.
+void lockstep_get_stats(lockstep_stats_t *st);
+
+#endif // LOCKSTEP_H_
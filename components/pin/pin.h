@@ -49,4 +49,29 @@ uint64_t pin_get_in_reg(void);
 // The two 32-bit output registers are concatenated into a uint64_t.
 uint64_t pin_get_out_reg(void);
 
+/***** Operate on many pins at once, one pin per bit of a mask *****/
+
+// Reset the configuration of the pins in the mask to not be inputs or
+// outputs, as pin_reset() does for one pin.
+int32_t pin_reset_mask(uint64_t mask);
+
+// Enable or disable a pull-up on the pins in the mask.
+int32_t pin_pullup_mask(uint64_t mask, bool enable);
+
+// Enable or disable the pins in the mask as input signals.
+int32_t pin_input_mask(uint64_t mask, bool enable);
+
+// Enable or disable the pins in the mask as output signals.
+int32_t pin_output_mask(uint64_t mask, bool enable);
+
+// Set the output level of the pins in the mask high.
+void pin_set_mask(uint64_t mask);
+
+// Set the output level of the pins in the mask low.
+void pin_clear_mask(uint64_t mask);
+
+// Write the output levels of the pins in the mask from the bits of value.
+// Pins outside the mask are not touched.
+void pin_write_mask(uint64_t mask, uint64_t value);
+
 #endif // PIN_H_
@@ -0,0 +1,130 @@
+#include "freertos/FreeRTOS.h" // portMUX_TYPE
+#include "driver/rtc_io.h" // rtc_gpio_*
+#include "pin.h"
+#include "pin_reg.h"
+
+// Mask based pin operations. The GPIO output and enable registers have
+// write-1-to-set (W1TS) and write-1-to-clear (W1TC) aliases, so any number
+// of pins in a bank change with one store and without a read-modify-write
+// that could undo a change made by another task or core. Pins 0-31 are in
+// bank 0 (OUT, ENABLE), pins 32-39 in bank 1 (OUT1, ENABLE1).
+
+#define PIN_VALID ((1LLU << PIN_MAX) - 1)
+
+static portMUX_TYPE spinlock = portMUX_INITIALIZER_UNLOCKED;
+
+
+// Return the mask with pins that do not exist removed.
+static uint64_t pin_mask_valid(uint64_t mask)
+{
+	mask &= PIN_VALID;
+	mask &= ~(0xFLLU << 28); // no pins 28-31
+	return mask;
+}
+
+// Write the two banks of a mask to a pair of registers.
+static inline void pin_mask_store(uint32_t r0, uint32_t r1, uint64_t mask)
+{
+	if ((uint32_t)mask) REG(r0) = (uint32_t)mask;
+	if (mask >> REG_BITS) REG(r1) = mask >> REG_BITS;
+}
+
+// Set or clear an IO_MUX field bit on each pin of the mask. IO_MUX has a
+// register per pin, so these still take one write per pin.
+static void pin_mask_mux(uint64_t mask, uint32_t bit, bool enable)
+{
+	portENTER_CRITICAL(&spinlock);
+	for (pin_num_t pin = 0; mask; pin++, mask >>= 1) {
+		if (!(mask & 1)) continue;
+		if (enable) REG(IO_MUX_REG(pin)) |= 1U << bit;
+		else REG(IO_MUX_REG(pin)) &= ~(1U << bit);
+	}
+	portEXIT_CRITICAL(&spinlock);
+}
+
+// Reset the configuration of the pins in the mask to not be inputs or
+// outputs with pin_reset(), then disable the outputs with one write per
+// bank. Reset is not a hot path, so the per pin sequence is left to
+// pin_reset() in pin.c rather than repeated here.
+// mask: pins, one pin per bit.
+// Return zero if successful, or non-zero otherwise.
+int32_t pin_reset_mask(uint64_t mask)
+{
+	int32_t ret = 0;
+
+	mask = pin_mask_valid(mask);
+	for (pin_num_t pin = 0; pin < PIN_MAX; pin++)
+		if (mask & 1LLU << pin) ret |= pin_reset(pin);
+	pin_mask_store(GPIO_ENABLE_W1TC_REG, GPIO_ENABLE1_W1TC_REG, mask);
+	return ret;
+}
+
+// Enable or disable a pull-up on the pins in the mask.
+// mask: pins, one pin per bit.
+// enable: if true, enable the pull-ups, otherwise disable them.
+// Return zero if successful, or non-zero otherwise.
+int32_t pin_pullup_mask(uint64_t mask, bool enable)
+{
+	mask = pin_mask_valid(mask);
+	for (pin_num_t pin = 0; pin < PIN_MAX; pin++) {
+		if (!(mask & 1LLU << pin) || !rtc_gpio_is_valid_gpio(pin)) continue;
+		// hand-off work to RTC subsystem
+		if (enable) rtc_gpio_pullup_en(pin);
+		else rtc_gpio_pullup_dis(pin);
+		mask &= ~(1LLU << pin);
+	}
+	pin_mask_mux(mask, FUN_WPU, enable);
+	return 0;
+}
+
+// Enable or disable the pins in the mask as input signals.
+// mask: pins, one pin per bit.
+// enable: if true, enable the inputs, otherwise disable them.
+// Return zero if successful, or non-zero otherwise.
+int32_t pin_input_mask(uint64_t mask, bool enable)
+{
+	pin_mask_mux(pin_mask_valid(mask), FUN_IE, enable);
+	return 0;
+}
+
+// Enable or disable the pins in the mask as output signals, one write
+// per bank.
+// mask: pins, one pin per bit.
+// enable: if true, enable the outputs, otherwise disable them.
+// Return zero if successful, or non-zero otherwise.
+int32_t pin_output_mask(uint64_t mask, bool enable)
+{
+	mask = pin_mask_valid(mask);
+	if (enable) pin_mask_store(GPIO_ENABLE_W1TS_REG, GPIO_ENABLE1_W1TS_REG, mask);
+	else pin_mask_store(GPIO_ENABLE_W1TC_REG, GPIO_ENABLE1_W1TC_REG, mask);
+	return 0;
+}
+
+// Set the output level of the pins in the mask high, one write per bank.
+// mask: pins, one pin per bit.
+void pin_set_mask(uint64_t mask)
+{
+	pin_mask_store(GPIO_OUT_W1TS_REG, GPIO_OUT1_W1TS_REG, pin_mask_valid(mask));
+}
+
+// Set the output level of the pins in the mask low, one write per bank.
+// mask: pins, one pin per bit.
+void pin_clear_mask(uint64_t mask)
+{
+	pin_mask_store(GPIO_OUT_W1TC_REG, GPIO_OUT1_W1TC_REG, pin_mask_valid(mask));
+}
+
+// Write the output levels of the pins in the mask, for example a clock and
+// data line of a bit-banged bus. Pins outside the mask are not touched. The
+// clear and set writes of a bank are made back to back with interrupts off,
+// so no task or ISR on this core sees or changes the pins in between.
+// mask: pins, one pin per bit.
+// value: levels, one pin per bit; bits outside the mask are ignored.
+void pin_write_mask(uint64_t mask, uint64_t value)
+{
+	mask = pin_mask_valid(mask);
+	portENTER_CRITICAL(&spinlock);
+	pin_mask_store(GPIO_OUT_W1TC_REG, GPIO_OUT1_W1TC_REG, mask & ~value);
+	pin_mask_store(GPIO_OUT_W1TS_REG, GPIO_OUT1_W1TS_REG, mask & value);
+	portEXIT_CRITICAL(&spinlock);
+}
@@ -0,0 +1,61 @@
+#ifndef PIN_REG_H_
+#define PIN_REG_H_
+
+// GPIO and IO_MUX registers of the ESP32 used by pin_mask.c and the
+// simulator pin_sim.c. Not for use outside the component, and not included
+// by pin_template.c: writing these registers is part of the pin lab.
+// Addresses and fields are from the ESP32 Technical Reference Manual,
+// chapter IO_MUX and GPIO Matrix.
+
+#include <stdint.h>
+#include "soc/reg_base.h" // DR_REG_GPIO_BASE, DR_REG_IO_MUX_BASE
+
+// GPIO Matrix Registers. Pins 0-31 are in bank 0 (OUT, ENABLE, IN), pins
+// 32-39 in bank 1 (OUT1, ENABLE1, IN1).
+#define GPIO_OUT_REG          (DR_REG_GPIO_BASE+0x04)
+#define GPIO_OUT_W1TS_REG     (DR_REG_GPIO_BASE+0x08)
+#define GPIO_OUT_W1TC_REG     (DR_REG_GPIO_BASE+0x0C)
+#define GPIO_OUT1_REG         (DR_REG_GPIO_BASE+0x10)
+#define GPIO_OUT1_W1TS_REG    (DR_REG_GPIO_BASE+0x14)
+#define GPIO_OUT1_W1TC_REG    (DR_REG_GPIO_BASE+0x18)
+#define GPIO_ENABLE_REG       (DR_REG_GPIO_BASE+0x20)
+#define GPIO_ENABLE_W1TS_REG  (DR_REG_GPIO_BASE+0x24)
+#define GPIO_ENABLE_W1TC_REG  (DR_REG_GPIO_BASE+0x28)
+#define GPIO_ENABLE1_REG      (DR_REG_GPIO_BASE+0x2C)
+#define GPIO_ENABLE1_W1TS_REG (DR_REG_GPIO_BASE+0x30)
+#define GPIO_ENABLE1_W1TC_REG (DR_REG_GPIO_BASE+0x34)
+#define GPIO_IN_REG           (DR_REG_GPIO_BASE+0x3C)
+#define GPIO_IN1_REG          (DR_REG_GPIO_BASE+0x40)
+#define GPIO_PIN_REG(n)       (DR_REG_GPIO_BASE+0x88+(n)*4)
+#define GPIO_FUNC_OUT_SEL_CFG_REG(n) (DR_REG_GPIO_BASE+0x530+(n)*4)
+
+// GPIO Pin Register Fields
+#define PAD_DRIVER 2
+
+// IO MUX Registers
+#define IO_MUX_REG(n) (DR_REG_IO_MUX_BASE+PIN_MUX_REG_OFFSET[n])
+
+// IO MUX Register Fields
+#define FUN_WPD  7
+#define FUN_WPU  8
+#define FUN_IE   9
+#define FUN_DRV 10
+#define MCU_SEL 12
+
+#ifndef REG // pin_sim.h provides REG() on the linux target
+#define REG(r) (*(volatile uint32_t *)(r))
+#endif
+#define REG_BITS 32
+#define PIN_MAX 40
+
+// Gives byte offset of IO_MUX Configuration Register
+// from base address DR_REG_IO_MUX_BASE
+static const uint8_t PIN_MUX_REG_OFFSET[] = {
+    0x44, 0x88, 0x40, 0x84, 0x48, 0x6c, 0x60, 0x64, // pin  0- 7
+    0x68, 0x54, 0x58, 0x5c, 0x34, 0x38, 0x30, 0x3c, // pin  8-15
+    0x4c, 0x50, 0x70, 0x74, 0x78, 0x7c, 0x80, 0x8c, // pin 16-23
+    0x90, 0x24, 0x28, 0x2c, 0xFF, 0xFF, 0xFF, 0xFF, // pin 24-31
+    0x1c, 0x20, 0x14, 0x18, 0x04, 0x08, 0x0c, 0x10, // pin 32-39
+};
+
+#endif // PIN_REG_H_
@@ -0,0 +1,218 @@
+#include <stdio.h>
+#include <stdlib.h> // abort
+
+#include "driver/rtc_io.h"
+#include "pin_sim.h"
+#include "pin_reg.h"
+
+// Simulated GPIO and IO_MUX registers for the linux target.
+//
+// REG() hands out a pointer into the register file, so the store (if any)
+// happens after pin_sim_reg() returns. Each call therefore first settles
+// the previous access: a changed value is traced as a write, W1TS and W1TC
+// values are folded into their target register and cleared, and IN and IN1
+// are brought up to date. Writes that leave a register unchanged are
+// counted as accesses but are not traced.
+
+#define GPIO_SZ  0x600 // Bytes of GPIO registers simulated
+#define IOMUX_SZ 0x100 // Bytes of IO_MUX registers simulated
+
+#define W1TS 0x04 // Offset of the W1TS alias from its register
+#define W1TC 0x08 // Offset of the W1TC alias from its register
+#define RTC_PINS (1LLU<<0 | 1LLU<<2 | 1LLU<<4 | 0xFLLU<<12 | 0x7LLU<<25 | 0xFFLLU<<32)
+
+// Simulated register by address
+#define GPIO_R(addr) gpio[((addr) - DR_REG_GPIO_BASE)/4]
+#define MUX_R(addr) iomux[((addr) - DR_REG_IO_MUX_BASE)/4]
+
+// Global variables
+static uint32_t gpio[GPIO_SZ/4];
+static uint32_t iomux[IOMUX_SZ/4];
+static uint64_t rtc_pu, rtc_pd; // RTC pad pull resistors
+static uint64_t ext_mask, ext_levels; // Pads driven from outside
+static volatile uint32_t *last; // Register handed out by the last access
+static uint32_t last_addr, last_val;
+static uint32_t accesses, writes;
+static pin_sim_write_t trace[PIN_SIM_TRACE];
+
+
+// Fold a W1TS/W1TC pair into its register.
+static void sim_w1(uint32_t reg)
+{
+	GPIO_R(reg) |= GPIO_R(reg+W1TS);
+	GPIO_R(reg) &= ~GPIO_R(reg+W1TC);
+	GPIO_R(reg+W1TS) = GPIO_R(reg+W1TC) = 0;
+}
+
+// Update the input registers from the pads.
+static void sim_pads(void)
+{
+	uint64_t out = GPIO_R(GPIO_OUT_REG) | (uint64_t)GPIO_R(GPIO_OUT1_REG) << REG_BITS;
+	uint64_t en = GPIO_R(GPIO_ENABLE_REG) | (uint64_t)GPIO_R(GPIO_ENABLE1_REG) << REG_BITS;
+	uint64_t in = 0;
+
+	for (uint32_t pin = 0; pin < PIN_MAX; pin++) {
+		uint64_t bit = 1LLU << pin;
+		if (PIN_MUX_REG_OFFSET[pin] == 0xFF) continue;
+		uint32_t mux = MUX_R(IO_MUX_REG(pin));
+		bool pu = (RTC_PINS & bit) ? rtc_pu & bit : mux >> FUN_WPU & 1;
+		bool level;
+		if (en & bit) level = out & bit;
+		else if (ext_mask & bit) level = ext_levels & bit;
+		else level = pu; // pull-down or floating reads low
+		if (level && (mux >> FUN_IE & 1)) in |= bit;
+	}
+	GPIO_R(GPIO_IN_REG) = in;
+	GPIO_R(GPIO_IN1_REG) = in >> REG_BITS;
+}
+
+// Complete the previous register access.
+static void sim_settle(void)
+{
+	if (last != NULL && *last != last_val) {
+		trace[writes % PIN_SIM_TRACE] = (pin_sim_write_t){last_addr, *last};
+		writes++;
+	}
+	last = NULL;
+	sim_w1(GPIO_OUT_REG);
+	sim_w1(GPIO_OUT1_REG);
+	sim_w1(GPIO_ENABLE_REG);
+	sim_w1(GPIO_ENABLE1_REG);
+	sim_pads();
+}
+
+// Return a pointer to a simulated register. Used by REG(); aborts on an
+// address outside the GPIO and IO_MUX blocks.
+// addr: register address.
+volatile uint32_t *pin_sim_reg(uint32_t addr)
+{
+	sim_settle();
+	if (addr % 4) {
+		last = NULL;
+	} else if (addr - DR_REG_GPIO_BASE < GPIO_SZ) {
+		last = gpio + (addr - DR_REG_GPIO_BASE)/4;
+	} else if (addr - DR_REG_IO_MUX_BASE < IOMUX_SZ) {
+		last = iomux + (addr - DR_REG_IO_MUX_BASE)/4;
+	}
+	if (last == NULL) {
+		fprintf(stderr, "pin_sim: bad register address 0x%08x\n", (unsigned)addr);
+		abort();
+	}
+	last_addr = addr;
+	last_val = *last;
+	accesses++;
+	return last;
+}
+
+// Reset all registers to their power-on values and clear the trace.
+void pin_sim_reset(void)
+{
+	last = NULL;
+	for (uint32_t i = 0; i < GPIO_SZ/4; i++) gpio[i] = 0;
+	for (uint32_t pin = 0; pin < PIN_MAX; pin++)
+		GPIO_R(GPIO_FUNC_OUT_SEL_CFG_REG(pin)) = 0x100;
+	for (uint32_t i = 0; i < IOMUX_SZ/4; i++) iomux[i] = 2U << FUN_DRV;
+	rtc_pu = rtc_pd = 0;
+	ext_mask = ext_levels = 0;
+	sim_pads();
+	pin_sim_trace_clear();
+}
+
+// Drive pads from outside, as a button or another chip would.
+// mask: pins to drive or release, one pin per bit.
+// levels: levels of the driven pins; pins in mask with drive false are
+//   released and float to their pull-up or pull-down.
+// drive: if true, drive the pins, otherwise release them.
+void pin_sim_drive(uint64_t mask, uint64_t levels, bool drive)
+{
+	sim_settle();
+	if (drive) {
+		ext_mask |= mask;
+		ext_levels = (ext_levels & ~mask) | (levels & mask);
+	} else {
+		ext_mask &= ~mask;
+	}
+	sim_pads();
+}
+
+// Return the value of a register after all writes so far.
+// addr: register address.
+uint32_t pin_sim_get(uint32_t addr)
+{
+	uint32_t val = *pin_sim_reg(addr);
+	sim_settle();
+	accesses--; // not an access by the driver
+	return val;
+}
+
+// Return the number of register accesses (reads and writes) since the
+// last pin_sim_reset() or pin_sim_trace_clear().
+uint32_t pin_sim_accesses(void)
+{
+	return accesses;
+}
+
+// Copy the traced writes, oldest first. At most the last PIN_SIM_TRACE
+// writes are kept.
+// buf: output buffer.
+// max: size of buf in writes.
+// Return the number of writes since the trace was cleared.
+uint32_t pin_sim_trace(pin_sim_write_t *buf, uint32_t max)
+{
+	sim_settle();
+	uint32_t kept = (writes < PIN_SIM_TRACE) ? writes : PIN_SIM_TRACE;
+	uint32_t first = writes - kept;
+	for (uint32_t i = 0; i < kept && i < max; i++)
+		buf[i] = trace[(first + i) % PIN_SIM_TRACE];
+	return writes;
+}
+
+// Clear the trace and the access count.
+void pin_sim_trace_clear(void)
+{
+	sim_settle();
+	accesses = writes = 0;
+}
+
+/***** RTC GPIO functions used by the pin driver *****/
+
+bool rtc_gpio_is_valid_gpio(int gpio_num)
+{
+	return gpio_num >= 0 && gpio_num < PIN_MAX && (RTC_PINS & 1LLU << gpio_num);
+}
+
+esp_err_t rtc_gpio_deinit(int gpio_num)
+{
+	return rtc_gpio_is_valid_gpio(gpio_num) ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+// Set or clear a pull resistor of an RTC pad.
+static esp_err_t rtc_pull(int gpio_num, uint64_t *pull, bool enable)
+{
+	if (!rtc_gpio_is_valid_gpio(gpio_num)) return ESP_ERR_INVALID_ARG;
+	sim_settle();
+	if (enable) *pull |= 1LLU << gpio_num;
+	else *pull &= ~(1LLU << gpio_num);
+	sim_pads();
+	return ESP_OK;
+}
+
+esp_err_t rtc_gpio_pullup_en(int gpio_num)
+{
+	return rtc_pull(gpio_num, &rtc_pu, true);
+}
+
+esp_err_t rtc_gpio_pullup_dis(int gpio_num)
+{
+	return rtc_pull(gpio_num, &rtc_pu, false);
+}
+
+esp_err_t rtc_gpio_pulldown_en(int gpio_num)
+{
+	return rtc_pull(gpio_num, &rtc_pd, true);
+}
+
+esp_err_t rtc_gpio_pulldown_dis(int gpio_num)
+{
+	return rtc_pull(gpio_num, &rtc_pd, false);
+}
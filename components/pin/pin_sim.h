@@ -0,0 +1,62 @@
+#ifndef PIN_SIM_H_
+#define PIN_SIM_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Simulated GPIO and IO_MUX registers for the linux target. The pin driver
+// is built unchanged: the sim/ headers give it the ESP32 register base
+// addresses and a REG() macro that goes through pin_sim_reg(). Writes to
+// the W1TS and W1TC registers set and clear bits of OUT, OUT1, ENABLE and
+// ENABLE1 as on the chip, and IN and IN1 follow the pads: an output drives
+// its pad, an undriven input reads its pull-up or pull-down. Register
+// accesses are counted and writes traced, so the cost of each pin call can
+// be measured.
+
+#define DR_REG_GPIO_BASE   0x3ff44000
+#define DR_REG_IO_MUX_BASE 0x3ff49000
+
+#define REG(r) (*pin_sim_reg(r))
+
+#define PIN_SIM_TRACE 256 // Writes kept in the trace
+
+// A traced register write
+typedef struct {
+	uint32_t addr;  // Register address
+	uint32_t value; // Value written
+} pin_sim_write_t;
+
+// Return a pointer to a simulated register. Used by REG(); aborts on an
+// address outside the GPIO and IO_MUX blocks.
+// addr: register address.
+volatile uint32_t *pin_sim_reg(uint32_t addr);
+
+// Reset all registers to their power-on values and clear the trace.
+void pin_sim_reset(void);
+
+// Drive pads from outside, as a button or another chip would.
+// mask: pins to drive or release, one pin per bit.
+// levels: levels of the driven pins; pins in mask with drive false are
+//   released and float to their pull-up or pull-down.
+// drive: if true, drive the pins, otherwise release them.
+void pin_sim_drive(uint64_t mask, uint64_t levels, bool drive);
+
+// Return the value of a register after all writes so far.
+// addr: register address.
+uint32_t pin_sim_get(uint32_t addr);
+
+// Return the number of register accesses (reads and writes) since the
+// last pin_sim_reset() or pin_sim_trace_clear().
+uint32_t pin_sim_accesses(void);
+
+// Copy the traced writes, oldest first. At most the last PIN_SIM_TRACE
+// writes are kept.
+// buf: output buffer.
+// max: size of buf in writes.
+// Return the number of writes since the trace was cleared.
+uint32_t pin_sim_trace(pin_sim_write_t *buf, uint32_t max);
+
+// Clear the trace and the access count.
+void pin_sim_trace_clear(void);
+
+#endif // PIN_SIM_H_
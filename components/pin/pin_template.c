@@ -14,7 +14,9 @@
 // TODO: IO MUX Register Fields - FUN_WPD, FUN_WPU, ...
 #define FUN_WPD  7
 
+#ifndef REG // pin_sim.h provides REG() on the linux target
 #define REG(r) (*(volatile uint32_t *)(r))
+#endif
 #define REG_BITS 32
 // TODO: Finish these macros. HINT: Use the REG() macro.
 #define REG_SET_BIT(r,b) // TODO:
@@ -0,0 +1,17 @@
+#ifndef RTC_IO_H_
+#define RTC_IO_H_
+
+// RTC GPIO functions used by the pin driver, simulated for the linux
+// target (see pin_sim.c). RTC pads keep their own pull resistors.
+
+#include <stdbool.h>
+#include "esp_err.h"
+
+bool rtc_gpio_is_valid_gpio(int gpio_num);
+esp_err_t rtc_gpio_deinit(int gpio_num);
+esp_err_t rtc_gpio_pullup_en(int gpio_num);
+esp_err_t rtc_gpio_pullup_dis(int gpio_num);
+esp_err_t rtc_gpio_pulldown_en(int gpio_num);
+esp_err_t rtc_gpio_pulldown_dis(int gpio_num);
+
+#endif // RTC_IO_H_
@@ -0,0 +1,2 @@
+// Register base addresses for the linux target, see pin_sim.h.
+#include "pin_sim.h"
@@ -6,6 +6,68 @@
 
 #define MAX_VOL 100U
 
+#define SOUND_VOICES 8 // Number of mixer voices
+#define SOUND_ANY (-1) // Voice argument: pick a free voice
+#define SOUND_ADPCM_BLOCK 256 // IMA-ADPCM block size in bytes
+
+// Audio data formats
+typedef enum {
+	SOUND_FMT_PCM8,  // Unsigned 8-bit PCM
+	SOUND_FMT_ADPCM, // IMA-ADPCM blocks of SOUND_ADPCM_BLOCK bytes
+} sound_fmt_t;
+
+// Synthesizer waveforms
+typedef enum {
+	SOUND_WAVE_SINE,
+	SOUND_WAVE_SQUARE,
+	SOUND_WAVE_TRIANGLE,
+	SOUND_WAVE_SAW,
+	SOUND_WAVE_LAST
+} sound_wave_t;
+
+#define SOUND_WAVE_LEN 256 // Entries in a waveform table (one cycle)
+
+// Synthesizer note envelope. Times are for a full scale change.
+typedef struct {
+	uint16_t attack;  // Rise time in ms
+	uint16_t decay;   // Fall time to the sustain level in ms
+	uint8_t sustain;  // Sustain level 0-100%
+	uint16_t release; // Fall time after release in ms
+} sound_adsr_t;
+
+#define SOUND_SEQ_OFF 0x80 // Sequencer note: release the note
+
+// Sequencer effects, applied when the row plays
+typedef enum {
+	SOUND_FX_NONE,
+	SOUND_FX_VOLUME, // Channel volume 0-100%
+	SOUND_FX_GLIDE,  // Slide to the note in param x 10 ms (synthesizer)
+	SOUND_FX_TEMPO,  // Tempo in beats per minute
+} sound_fx_t;
+
+// Sequencer instrument: a sample or a synthesizer note
+typedef struct {
+	const void *audio;  // Unsigned 8-bit PCM sample, or NULL for a synthesizer
+	uint32_t size;      // Size of the sample in bytes
+	uint32_t rate;      // Sample rate of the sample in Hz, zero for output rate
+	sound_wave_t wave;  // Synthesizer waveform
+	sound_adsr_t adsr;  // Synthesizer envelope
+	uint8_t vol;        // Volume 0-100%
+} sound_inst_t;
+
+// Sound driver statistics
+typedef struct {
+	uint32_t refills;     // Mixer refills
+	uint32_t cyc_min;     // Shortest refill in CPU cycles
+	uint32_t cyc_avg;     // Average refill in CPU cycles
+	uint32_t cyc_max;     // Longest refill in CPU cycles
+	uint32_t underruns;   // Output buffers not refilled in time
+	uint32_t lat_last_us; // Start to DAC output of the last voice started
+	uint32_t lat_max_us;  // Largest start to DAC output latency
+	uint8_t voices;       // Voices playing at the last refill
+	uint8_t voices_max;   // Most voices playing at once
+} sound_stats_t;
+
 // Initialize the sound driver. Must be called before using sound.
 // May be called again to change sample rate.
 // sample_hz: sample rate in Hz to playback audio.
@@ -16,27 +78,160 @@ int32_t sound_init(uint32_t sample_hz);
 // Return zero if successful, or non-zero otherwise.
 int32_t sound_deinit(void);
 
-// Start playing the sound immediately. Play the audio buffer once.
+// Start playing the sound immediately on voice 0. Play the audio buffer once.
 // audio: a pointer to an array of unsigned audio data.
 // size: the size of the array in bytes.
 // wait: if true, block until done playing, otherwise return straight away.
 void sound_start(const void *audio, uint32_t size, bool wait);
 
-// Cyclically play samples from audio buffer until sound_stop() is called.
+// Cyclically play samples from audio buffer on voice 0 until sound_stop()
+// is called.
 // audio: a pointer to an array of unsigned audio data.
 // size: the size of the array in bytes.
 void sound_cyclic(const void *audio, uint32_t size);
 
-// Return true if sound playing, otherwise return false.
+// Start playing audio on a mixer voice. Voices are mixed together, so
+// sounds on different voices overlap instead of cutting each other off.
+// voice: voice number [0, SOUND_VOICES), or SOUND_ANY for a free voice.
+//   With SOUND_ANY and no free voice, the lowest priority voice playing
+//   below prio is taken over.
+// audio: a pointer to an array of unsigned audio data.
+// size: the size of the array in bytes.
+// vol: voice volume 0-100% (scaled again by the master volume).
+// loop: if true, play cyclically until stopped, otherwise play once.
+// prio: voice priority, higher values are kept longer.
+// Return the voice number if successful, or negative otherwise.
+int32_t sound_play(int32_t voice, const void *audio, uint32_t size, uint32_t vol, bool loop, uint8_t prio);
+
+// Start playing IMA-ADPCM audio on a mixer voice. The audio is decoded
+// while it is mixed. Arguments and return value are as for sound_play().
+// audio: a pointer to IMA-ADPCM blocks of SOUND_ADPCM_BLOCK bytes.
+// size: the size of the ADPCM data in bytes.
+int32_t sound_play_adpcm(int32_t voice, const void *audio, uint32_t size, uint32_t vol, bool loop, uint8_t prio);
+
+// Set the sample rate of the audio playing on a voice. The voice is
+// resampled to the output rate by linear interpolation, so audio recorded
+// at any rate plays without calling sound_init() again. Call right after
+// starting the voice; the rate applies from the next refill.
+// voice: voice number [0, SOUND_VOICES) playing PCM or IMA-ADPCM audio.
+// hz: sample rate of the audio in Hz, or zero for the output rate.
+// Return zero if successful, or non-zero otherwise.
+int32_t sound_set_rate(int32_t voice, uint32_t hz);
+
+// Set the volume of the sound playing on a voice. The volume applies from
+// the next refill.
+// voice: voice number [0, SOUND_VOICES).
+// vol: voice volume 0-100% (scaled again by the master volume).
+// Return zero if successful, or non-zero otherwise.
+int32_t sound_voice_volume(int32_t voice, uint32_t vol);
+
+// Start streaming audio from flash. Data is read in chunks by a low
+// priority task into a small ring buffer that the mixer plays from, so the
+// audio can be as long as the storage allows. Only one stream plays at a
+// time; starting a new one stops the previous stream.
+// name: a path starting with '/' names a file (e.g. on a mounted SPIFFS).
+//   Any other name is the label of a raw data partition whose first four
+//   bytes hold the audio length in bytes (little endian).
+// fmt: format of the audio data.
+// vol: voice volume 0-100% (scaled again by the master volume).
+// loop: if true, play cyclically until stopped, otherwise play once.
+// Return the voice number if successful, or negative otherwise.
+int32_t sound_stream_start(const char *name, sound_fmt_t fmt, uint32_t vol, bool loop);
+
+// Stop the audio stream and wait for its task to finish.
+void sound_stream_stop(void);
+
+// Return true if the audio stream is playing, otherwise false.
+bool sound_stream_busy(void);
+
+// Return the number of mixer passes that found the stream ring short of
+// samples since the stream started.
+uint32_t sound_stream_underruns(void);
+
+// Start a synthesizer voice. A phase accumulator steps through a waveform
+// table at the given frequency, so any pitch is available without
+// building a buffer. The note holds at the sustain level until
+// sound_synth_release() is called.
+// voice: voice number [0, SOUND_VOICES), or SOUND_ANY for a free voice.
+// wave: waveform of the note.
+// freq: frequency of the note in Hz.
+// vol: voice volume 0-100% (scaled again by the master volume).
+// adsr: note envelope, or NULL to start and stop without one.
+// prio: voice priority, higher values are kept longer.
+// Return the voice number if successful, or negative otherwise.
+int32_t sound_synth_start(int32_t voice, sound_wave_t wave, uint32_t freq, uint32_t vol, const sound_adsr_t *adsr, uint8_t prio);
+
+// Change the frequency of a synthesizer voice.
+// voice: voice number [0, SOUND_VOICES).
+// freq: new frequency in Hz.
+// glide_ms: time to slide to the new frequency, or zero to jump to it.
+void sound_synth_freq(int32_t voice, uint32_t freq, uint32_t glide_ms);
+
+// Change the waveform of a synthesizer voice.
+// voice: voice number [0, SOUND_VOICES).
+// wave: new waveform.
+void sound_synth_wave(int32_t voice, sound_wave_t wave);
+
+// Release the note on a synthesizer voice. The voice stops at the end of
+// the envelope release.
+// voice: voice number [0, SOUND_VOICES).
+void sound_synth_release(int32_t voice);
+
+// Return the waveform table of a synthesizer waveform: SOUND_WAVE_LEN
+// signed samples of one cycle. Valid after sound_init().
+const int8_t *sound_synth_table(sound_wave_t wave);
+
+// Start playing a song. Rows are timed by the audio clock. Channel c of
+// the song plays on voice voice+c. Samples play at their recorded pitch.
+// data: song data in the format described in sound_seq.c
+//   (see audio/song2c.m to convert a text song).
+// size: the size of the song data in bytes.
+// inst: instrument table, indexed by the 1-based instrument of a cell.
+// insts: number of instruments in the table.
+// voice: voice of the first channel.
+// loop: if true, play the song cyclically until stopped, otherwise once.
+// Return zero if successful, or non-zero otherwise.
+int32_t sound_seq_start(const uint8_t *data, uint32_t size, const sound_inst_t *inst, uint32_t insts, int32_t voice, bool loop);
+
+// Stop playing the song and release its notes.
+void sound_seq_stop(void);
+
+// Return true if a song is playing, otherwise false.
+bool sound_seq_busy(void);
+
+// Change the tempo of the song playing.
+// bpm: beats per minute.
+void sound_seq_tempo(uint32_t bpm);
+
+// Stop playing the sound on a mixer voice.
+// voice: voice number [0, SOUND_VOICES).
+void sound_stop_voice(int32_t voice);
+
+// Return true if a sound is playing on the mixer voice, otherwise false.
+// voice: voice number [0, SOUND_VOICES).
+bool sound_busy_voice(int32_t voice);
+
+// Return true if sound playing on any voice, otherwise return false.
 bool sound_busy(void);
 
-// Stop playing the sound.
+// Stop playing the sound on all voices.
 void sound_stop(void);
 
-// Set the volume.
+// Set the master volume, applied to the mix of all voices.
 // volume: 0-100% as an integer value.
 void sound_set_volume(uint32_t vol);
 
+// Get the sound statistics gathered since sound_init() or the last
+// sound_stats_reset().
+// st: statistics output.
+void sound_stats_get(sound_stats_t *st);
+
+// Clear the sound statistics.
+void sound_stats_reset(void);
+
+// Print the sound statistics to the console.
+void sound_stats_dump(void);
+
 // Enable or disable the sound output device.
 // enable: if true, enable sound, otherwise disable.
 void sound_device(bool enable);
@@ -0,0 +1,51 @@
+#ifndef SOUND_ADPCM_H_
+#define SOUND_ADPCM_H_
+
+#include <stdint.h>
+
+#include "esp_attr.h"
+
+// IMA-ADPCM decoder used by the mixer. The data format matches mono IMA
+// ADPCM in WAV files: blocks of SOUND_ADPCM_BLOCK bytes (the last block may
+// be shorter), each starting with a 4-byte header (predictor as little
+// endian int16, step index, reserved byte) that is also the first sample,
+// followed by 4-bit codes, low nibble first.
+
+#define ADPCM_HDR 4 // Block header size in bytes
+
+typedef struct {
+	int32_t pred;  // Predicted sample, int16 range
+	int32_t index; // Step table index [0, 88]
+} adpcm_state_t;
+
+extern const int16_t adpcm_step_tab[89];
+extern const int8_t adpcm_index_tab[16];
+
+// Load decoder state from a block header and return the first sample.
+static inline int32_t IRAM_ATTR adpcm_header(adpcm_state_t *st, const uint8_t *hdr)
+{
+	st->pred = (int16_t)(hdr[0] | (hdr[1] << 8));
+	st->index = (hdr[2] > 88) ? 88 : hdr[2];
+	return st->pred;
+}
+
+// Decode one 4-bit code and return the next sample.
+static inline int32_t IRAM_ATTR adpcm_decode(adpcm_state_t *st, uint32_t code)
+{
+	int32_t step = adpcm_step_tab[st->index];
+	int32_t diff = step >> 3;
+	if (code & 4) diff += step;
+	if (code & 2) diff += step >> 1;
+	if (code & 1) diff += step >> 2;
+	int32_t pred = (code & 8) ? st->pred - diff : st->pred + diff;
+	if (pred > INT16_MAX) pred = INT16_MAX;
+	else if (pred < INT16_MIN) pred = INT16_MIN;
+	int32_t index = st->index + adpcm_index_tab[code];
+	if (index < 0) index = 0;
+	else if (index > 88) index = 88;
+	st->pred = pred;
+	st->index = index;
+	return pred;
+}
+
+#endif // SOUND_ADPCM_H_
@@ -1,79 +1,71 @@
 // https://docs.espressif.com/projects/esp-idf/en/stable/esp32/api-reference/peripherals/dac.html
 
-#include <string.h> // memset
-
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "esp_log.h"
 #include "esp_check.h"
+#include "esp_timer.h"
 #include "driver/dac_continuous.h"
 #include "driver/gpio.h"
 
 #include "hw.h"
 #include "sound.h"
+#include "sound_mix.h"
 
 #define SOUND_A  HW_SND_A  // Audio output
 #define SOUND_EN HW_SND_EN // Sound enable, active high
 
-#define DAC_DESC_NUM 8 // Number of DAC descriptors
-#define DAC_BUF_SZ 128 // DAC buffer size in bytes
+#define DAC_DESC_NUM CONFIG_SOUND_DAC_DESC_NUM // Number of DAC descriptors
+#define DAC_BUF_SZ CONFIG_SOUND_DAC_BUF_SZ // DAC buffer size in bytes
 // was able to play audio at 48kHz with buf size of  8 and 8 desc, async.
 // was able to play audio at 48kHz with buf size of 64 and 8 desc, sync w/ vol control.
 
 #define SOUND_VOLUME_DEFAULT 50
-#define SILENCE 0x80U
-#define POLL_DELAY 10
-#define PERCENT 100U
 
 static const char *TAG = "sound";
 
-// Critical section protected variables
-static portMUX_TYPE spinlock = portMUX_INITIALIZER_UNLOCKED;
-static const uint8_t *abase;
-static volatile uint32_t asize;
-static volatile uint32_t aidx;
-static volatile bool     cyclic;
-static volatile uint32_t dcnt;
-
-// Other global variables
+// Global variables
 static dac_continuous_handle_t dac_handle;
 static volatile bool device_en;
-static volatile uint32_t volume;
-static volatile uint8_t bias; // to prevent popping at end when vol low.
+static uint32_t dcnt; // Silent buffers still to write, used by ISR only
+static volatile bool running; // Async writing started, callback may write
+static int64_t last_us; // Time of the last callback, used by ISR only
+static uint32_t buf_us; // Time to play one DMA buffer
+
+// Samples for one DMA buffer. Kept off the ISR stack, which is too small
+// for larger DAC_BUF_SZ settings.
+#if CONFIG_DAC_DMA_AUTO_16BIT_ALIGN
+static uint8_t buf[DAC_BUF_SZ/2];
+#else
+static uint8_t buf[DAC_BUF_SZ];
+#endif
 
 
 static bool IRAM_ATTR dac_convert_callback(dac_continuous_handle_t handle,
 	const dac_event_data_t *event, void *user_data)
 {
-#if CONFIG_DAC_DMA_AUTO_16BIT_ALIGN
-	uint8_t buf[event->buf_size/2];
-#else
-	uint8_t buf[event->buf_size];
-#endif
 	// size_t load_bytes = 0;
-	portENTER_CRITICAL_ISR(&spinlock);
-	if (aidx < asize) {
-		uint32_t idx = aidx;
-		uint32_t size = (!cyclic && asize < sizeof(buf)) ? asize : sizeof(buf);
-		aidx =  cyclic ? (aidx + size) % asize : aidx + size;
-		portEXIT_CRITICAL_ISR(&spinlock);
-		uint32_t i;
-		for (i = 0; i < size; i++) buf[i] = abase[(idx+i)%asize]*volume/PERCENT + bias;
-		while (i < sizeof(buf)) buf[i++] = SILENCE; // pad to block size with silence
-		dac_continuous_write_asynchronously(handle,
-			event->buf, event->buf_size,
-			buf, sizeof(buf), NULL /*&load_bytes*/);
-			// error if load_bytes != sizeof(buf)
+	if (!running) return false;
+	// a callback held off past the end of the next buffer misses it, as
+	// the end of frame interrupts merge and only the last buffer is passed
+	// in; each buffer missed is not refilled and the DAC plays it again
+	int64_t now = esp_timer_get_time();
+	if (last_us) {
+		uint32_t bufs = (now - last_us + buf_us/2) / buf_us;
+		while (bufs-- > 1) sound_mix_underrun();
+	}
+	last_us = now;
+	if (sound_mix(buf, sizeof(buf))) {
+		dcnt = DAC_DESC_NUM; // add silence to DMA buffers when done
 	} else if (dcnt) {
-		dcnt--; // add silence to DMA buffer when done
-		portEXIT_CRITICAL_ISR(&spinlock);
-		memset(buf, SILENCE, sizeof(buf));
-		dac_continuous_write_asynchronously(handle,
-			event->buf, event->buf_size,
-			buf, sizeof(buf), NULL /*&load_bytes*/);
+		dcnt--;
 	} else {
-		portEXIT_CRITICAL_ISR(&spinlock);
+		return false; // all DMA buffers already hold silence
 	}
+	dac_continuous_write_asynchronously(handle,
+		event->buf, event->buf_size,
+		buf, sizeof(buf), NULL /*&load_bytes*/);
+		// error if load_bytes != sizeof(buf)
 	return false; // no high priority task awoken
 }
 
@@ -85,6 +77,10 @@ static bool IRAM_ATTR dac_convert_callback(dac_continuous_handle_t handle,
 int32_t sound_init(uint32_t sample_hz)
 {
 	sound_set_volume(SOUND_VOLUME_DEFAULT);
+	// a refill plays after the other DAC_DESC_NUM-1 buffers of the ring
+	sound_mix_init(sample_hz, (DAC_DESC_NUM-1)*sizeof(buf));
+	buf_us = (uint64_t)sizeof(buf)*1000000/sample_hz;
+	last_us = 0;
 	
 	/* * * * * * * * * * GPIO25 Pin Config * * * * * * * * * */
 	// if the first time called, configure GPIO25 as output
@@ -138,7 +134,9 @@ int32_t sound_init(uint32_t sample_hz)
 	// Enable the continuous channels
 	ESP_ERROR_CHECK(dac_continuous_enable(dac_handle));
 	ESP_LOGI(TAG, "Start async audio DMA");
+	dcnt = DAC_DESC_NUM;
 	ESP_ERROR_CHECK(dac_continuous_start_async_writing(dac_handle));
+	running = true;
 	return 0;
 }
 
@@ -146,6 +144,8 @@ int32_t sound_init(uint32_t sample_hz)
 // Return zero if successful, or non-zero otherwise.
 int32_t sound_deinit(void)
 {
+	if (dac_handle == NULL) return 1;
+	running = false; // keep the callback away from a channel being torn down
 	ESP_LOGI(TAG, "Stop async audio DMA");
 	ESP_ERROR_CHECK(dac_continuous_stop_async_writing(dac_handle));
 	ESP_ERROR_CHECK(dac_continuous_disable(dac_handle));
@@ -156,59 +156,6 @@ int32_t sound_deinit(void)
 	return 0;
 }
 
-// Start playing the sound immediately. Play the audio buffer once.
-// audio: a pointer to an array of unsigned audio data.
-// size: the size of the array in bytes.
-// wait: if true, block until done playing, otherwise return straight away.
-void sound_start(const void *audio, uint32_t size, bool wait)
-{
-	portENTER_CRITICAL(&spinlock);
-	abase = audio;
-	asize = size;
-	aidx = 0;
-	cyclic = false;
-	dcnt = DAC_DESC_NUM;
-	portEXIT_CRITICAL(&spinlock);
-	while (wait && aidx < asize)
-		vTaskDelay(pdMS_TO_TICKS(POLL_DELAY));
-}
-
-// Cyclically play samples from audio buffer until sound_stop() is called.
-// audio: a pointer to an array of unsigned audio data.
-// size: the size of the array in bytes.
-void sound_cyclic(const void *audio, uint32_t size)
-{
-	portENTER_CRITICAL(&spinlock);
-	abase = audio;
-	asize = size;
-	aidx = 0;
-	cyclic = true;
-	dcnt = DAC_DESC_NUM;
-	portEXIT_CRITICAL(&spinlock);
-}
-
-// Return true if sound playing, otherwise return false.
-bool sound_busy(void)
-{
-	return aidx < asize;
-}
-
-// Stop playing the sound.
-void sound_stop(void)
-{
-	portENTER_CRITICAL(&spinlock);
-	aidx = asize;
-	portEXIT_CRITICAL(&spinlock);
-}
-
-// Set the volume.
-// volume: 0-100% as an integer value.
-void sound_set_volume(uint32_t vol)
-{
-	volume = vol;
-	bias = SILENCE - (SILENCE * vol / PERCENT);
-}
-
 // Enable or disable the sound output device.
 // enable: if true, enable sound, otherwise disable.
 void sound_device(bool enable)
@@ -218,7 +165,11 @@ void sound_device(bool enable)
 
 // NOTES:
 // * Switching back and forth between sync and async crashes with WDT timeout
-// in ISR. The crash happens when async follows sync.
+// in ISR. The crash happens when async follows sync. This driver only uses
+// async writing, and the callback checks the running flag so it does not
+// touch a channel that sound_deinit() (or a re-init) is stopping. The
+// callback buffer is static: a VLA of DAC_BUF_SZ bytes on the ISR stack
+// overflows it for larger buffer sizes.
 // * Calling dac_continuous_start_async_writing() starts sending data out the
 // DAC from the DMA buffers. Source code shows this function also clears the
 // DMA buffers (to zero) before starting the DMA so you don't have lots of
@@ -0,0 +1,949 @@
+// Software mixer shared by the DAC drivers. Each voice plays its own
+// buffer with its own position, volume, loop flag and priority. Voices are
+// summed into a wide accumulator, saturated to 8 bits, and mapped through
+// a master volume lookup table to the DAC range. A voice may instead be a
+// synthesizer (DDS) voice: a phase accumulator stepping through a waveform
+// table, shaped by an ADSR envelope.
+//
+// Voice state belongs to the audio ISR. Tasks never lock it: they post
+// commands (play, stop, volume, pitch, ...) to a lock-free ring that the
+// ISR applies at the start of each refill. Which voices are in use is kept
+// in an atomic claim word per voice, so a voice can be claimed and tested
+// for busy without waiting for the ISR. Each claim has a new generation,
+// which the play and stop commands carry: the ISR only frees a voice for
+// the claim it is playing, never for a claim made since.
+
+#include <stdio.h>
+#include <stdatomic.h>
+#include <math.h> // sinf
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_attr.h"
+#include "esp_cpu.h"
+#include "esp_timer.h"
+
+#include "sound.h"
+#include "sound_mix.h"
+#include "sound_adpcm.h"
+
+// Make audio buffer extern for testing
+#ifdef EXTERN_BUF
+#define scope
+#else
+#define scope static
+#endif
+
+#define SOUND_VOLUME_DEFAULT 50
+#define POLL_DELAY 10
+#define PERCENT 100U
+
+#define GAIN_ONE 256 // Unity gain in Q8
+#define RATE_ONE (1 << 16) // Native rate step in Q16
+#define RATE_MAX (8 * RATE_ONE) // Largest resampling step
+#define MIX_BLK 64 // Samples mixed per pass
+#define CMD_RING 16 // Command ring slots, a power of two
+#define CLOCK_WAIT_MS 20 // Longest wait for a refill, beyond the driver delay
+#define CLAIM_OWNED 1U // Claim word: generation << 1 | CLAIM_OWNED
+#define CLAIM_NEXT(c) (((c) | CLAIM_OWNED) + 2) // Next generation, owned
+
+#define LEGACY_VOICE 0 // Voice used by sound_start() and sound_cyclic()
+
+#define ENV_ONE (1 << 24) // Full envelope level in Q24
+#define ENV_Q 12 // Envelope bits applied to a sample
+
+typedef enum {VOICE_PCM, VOICE_ADPCM, VOICE_RING, VOICE_SYNTH} voice_kind_t;
+typedef enum {ENV_ATTACK, ENV_DECAY, ENV_SUSTAIN, ENV_RELEASE} env_stage_t;
+
+// Synthesizer voice state. The top 8 bits of the phase index the table.
+typedef struct {
+	const int8_t *tab;   // Waveform table, SOUND_WAVE_LEN entries
+	uint32_t phase;      // Phase accumulator, 2^32 per cycle
+	int32_t inc;         // Phase increment per sample
+	int32_t target;      // Phase increment at the end of a glide
+	int32_t glide;       // Phase increment change per sample
+	int32_t env;         // Envelope level in Q24
+	int32_t att, dec, rel; // Envelope steps per sample in Q24
+	int32_t sus;         // Sustain level in Q24
+	uint8_t stage;       // env_stage_t
+} synth_t;
+
+typedef struct {
+	const uint8_t *base; // Audio data
+	uint32_t size;       // Size of audio data in bytes
+	uint32_t idx;        // Next byte to play
+	int32_t gain;        // Voice gain in Q8
+	uint8_t kind;        // voice_kind_t
+	uint8_t prio;        // Priority used when stealing a voice
+	bool loop;           // Restart at the beginning when done
+	bool active;         // Playing
+	// IMA-ADPCM decoder
+	adpcm_state_t adpcm;
+	uint32_t bend;       // End of current block
+	uint8_t nib;         // Codes left in the current byte (0 or 1)
+	uint8_t code;        // Pending high nibble
+	// Resampling, used when step is not zero
+	uint32_t step;       // Source samples per output sample in Q16
+	uint32_t frac;       // Position between source samples in Q16
+	bool primed;         // s0 and s1 hold decoded samples (ADPCM)
+	int32_t s0, s1;      // Decoded samples around the position (ADPCM)
+	sound_ring_t *ring;  // Stream ring buffer (VOICE_RING)
+	synth_t syn;         // Synthesizer (VOICE_SYNTH)
+	int64_t start_us;    // Start time until first mixed, otherwise zero
+	uint32_t claim;      // Claim word the voice plays for
+} voice_t;
+
+typedef enum {
+	CMD_PLAY,     // Start a voice from init
+	CMD_STOP,     // Stop a voice
+	CMD_STOP_ALL, // Stop all voices
+	CMD_RELEASE,  // Release a synthesizer note
+	CMD_VOLUME,   // Set voice gain
+	CMD_PITCH,    // Slide a synthesizer voice to a phase increment
+	CMD_RATE,     // Set the resampling step
+	CMD_WAVE,     // Set a synthesizer waveform table
+	CMD_CLOCK,    // Install the mixer clock
+	CMD_MASTER,   // Set the master volume
+	CMD_STATS,    // Clear the statistics
+} cmd_op_t;
+
+typedef struct {
+	uint8_t op;   // cmd_op_t
+	int8_t voice; // Voice the command applies to
+	union {
+		voice_t init;        // CMD_PLAY
+		uint32_t claim;      // CMD_STOP
+		uint32_t claims[SOUND_VOICES]; // CMD_STOP_ALL
+		int32_t gain;        // CMD_VOLUME
+		uint32_t step;       // CMD_RATE
+		const int8_t *tab;   // CMD_WAVE
+		sound_clock_t clock; // CMD_CLOCK
+		uint32_t vol;        // CMD_MASTER
+		struct {int32_t inc; uint32_t samples;} pitch; // CMD_PITCH
+	};
+} cmd_t;
+
+// Command ring slot. Any task may post (multiple producers); only the
+// audio ISR applies (single consumer). seq holds the turn of the slot
+// less its index, so a zeroed ring is empty and ready for the first lap.
+typedef struct {
+	atomic_uint seq;
+	cmd_t cmd;
+} slot_t;
+
+// Audio ISR owned variables
+static voice_t voices[SOUND_VOICES];
+static atomic_uint cmd_tail; // Next command to apply
+
+// Shared lock-free variables
+static slot_t cmd_ring[CMD_RING];
+static atomic_uint cmd_head; // Next slot for a producer to claim
+static atomic_uint claim[SOUND_VOICES]; // Voice playing or about to play
+static volatile uint8_t vprio[SOUND_VOICES]; // Priority of owned voices
+static volatile int32_t clock_core = -1; // Core running the mixer clock
+static atomic_uint stats_seq; // Odd while the ISR updates stats
+scope  const uint8_t *abase; // Buffer of the legacy voice
+scope  volatile uint32_t asize;
+
+// Other global variables
+static uint8_t vol_lut[256]; // Master volume table, used by ISR only
+static DRAM_ATTR int32_t acc[MIX_BLK]; // Mix accumulator, used by ISR only
+static DRAM_ATTR int8_t wave_tab[SOUND_WAVE_LAST][SOUND_WAVE_LEN];
+static uint32_t mix_hz; // Output sample rate
+static volatile sound_clock_t clock_fn; // Called at sample exact intervals
+static uint32_t clock_left; // Samples until clock_fn is due, used by ISR only
+static sound_stats_t stats; // Updated by ISR, read under stats_seq
+static uint64_t cyc_sum; // Total refill cycles, for the average
+static uint32_t out_us; // Driver delay from mixer to DAC output
+
+
+// Add n samples of an unsigned 8-bit PCM voice to dst.
+static void IRAM_ATTR mix_pcm(voice_t *vp, int32_t *dst, uint32_t n)
+{
+	const int32_t g = vp->gain;
+	uint32_t idx = vp->idx;
+
+	// copy linear runs; a run ends at the block or the buffer end
+	for (uint32_t i = 0; i < n;) {
+		uint32_t run = vp->size - idx;
+		if (run > n - i) run = n - i;
+		const uint8_t *src = vp->base + idx;
+		for (uint32_t k = 0; k < run; k++)
+			dst[i+k] += ((int32_t)src[k] - (int32_t)SILENCE) * g;
+		i += run;
+		idx += run;
+		if (idx >= vp->size) {
+			if (!vp->loop) {vp->active = false; break;}
+			idx = 0;
+		}
+	}
+	vp->idx = idx;
+}
+
+// Add n samples of an unsigned 8-bit PCM voice to dst, resampling by
+// linear interpolation.
+static void IRAM_ATTR mix_pcm_rs(voice_t *vp, int32_t *dst, uint32_t n)
+{
+	const int32_t g = vp->gain;
+	const uint8_t *src = vp->base;
+	const uint32_t size = vp->size, step = vp->step;
+	uint32_t idx = vp->idx;
+	uint32_t frac = vp->frac;
+
+	for (uint32_t i = 0; i < n; i++) {
+		uint32_t nx = idx + 1;
+		if (nx >= size) nx = vp->loop ? 0 : idx;
+		int32_t s0 = src[idx];
+		int32_t s = s0 + ((((int32_t)src[nx] - s0) * (int32_t)frac) >> 16);
+		dst[i] += (s - (int32_t)SILENCE) * g;
+		frac += step;
+		idx += frac >> 16;
+		frac &= RATE_ONE-1;
+		if (idx >= size) {
+			if (!vp->loop) {vp->active = false; break;}
+			idx %= size;
+		}
+	}
+	vp->idx = idx;
+	vp->frac = frac;
+}
+
+// Decode the next sample of an IMA-ADPCM voice into s.
+// Return false at the end of a voice that does not loop.
+static inline bool IRAM_ATTR adpcm_next(voice_t *vp, int32_t *s)
+{
+	if (vp->nib) { // high nibble of the last byte read
+		*s = adpcm_decode(&vp->adpcm, vp->code);
+		vp->nib = 0;
+	} else if (vp->idx < vp->bend) {
+		uint32_t b = vp->base[vp->idx++];
+		*s = adpcm_decode(&vp->adpcm, b & 0xF);
+		vp->code = b >> 4;
+		vp->nib = 1;
+	} else { // next block
+		if (vp->idx + ADPCM_HDR > vp->size) {
+			if (!vp->loop || vp->size < ADPCM_HDR) return false;
+			vp->idx = 0;
+		}
+		*s = adpcm_header(&vp->adpcm, vp->base + vp->idx);
+		vp->idx += ADPCM_HDR;
+		vp->bend = vp->idx + (SOUND_ADPCM_BLOCK - ADPCM_HDR);
+		if (vp->bend > vp->size) vp->bend = vp->size;
+	}
+	return true;
+}
+
+// Add n samples of an IMA-ADPCM voice to dst, decoding as it goes.
+static void IRAM_ATTR mix_adpcm(voice_t *vp, int32_t *dst, uint32_t n)
+{
+	const int32_t g = vp->gain;
+	int32_t s;
+
+	if (!vp->step) {
+		for (uint32_t i = 0; i < n; i++) {
+			if (!adpcm_next(vp, &s)) {vp->active = false; break;}
+			dst[i] += (s >> 8) * g;
+		}
+		return;
+	}
+	// resample by linear interpolation between decoded samples s0 and s1
+	if (!vp->primed) {
+		if (!adpcm_next(vp, &vp->s0) || !adpcm_next(vp, &vp->s1)) {
+			vp->active = false;
+			return;
+		}
+		vp->primed = true;
+	}
+	for (uint32_t i = 0; i < n; i++) {
+		// 12 bits of fraction keep the 16-bit difference product in range
+		s = vp->s0 + (((vp->s1 - vp->s0) * (int32_t)(vp->frac >> 4)) >> 12);
+		dst[i] += (s >> 8) * g;
+		vp->frac += vp->step;
+		while (vp->frac >= RATE_ONE) {
+			vp->frac -= RATE_ONE;
+			vp->s0 = vp->s1;
+			if (!adpcm_next(vp, &vp->s1)) {vp->active = false; return;}
+		}
+	}
+}
+
+// Add n samples from a stream ring buffer to dst. Samples not yet written
+// by the producer are left silent and counted as an underrun.
+static void IRAM_ATTR mix_ring(voice_t *vp, int32_t *dst, uint32_t n)
+{
+	sound_ring_t *r = vp->ring;
+	const int32_t g = vp->gain;
+	uint32_t tail = atomic_load_explicit(&r->tail, memory_order_relaxed);
+	uint32_t avail = atomic_load_explicit(&r->head, memory_order_acquire) - tail;
+	uint32_t m = (avail < n) ? avail : n;
+
+	for (uint32_t i = 0; i < m; i++)
+		dst[i] += ((int32_t)r->buf[(tail+i) & r->mask] - (int32_t)SILENCE) * g;
+	atomic_store_explicit(&r->tail, tail + m, memory_order_release);
+	if (m < n) {
+		if (r->eof) vp->active = false;
+		else r->underruns++;
+	}
+}
+
+// Add n samples of a synthesizer voice to dst.
+static void IRAM_ATTR mix_synth(voice_t *vp, int32_t *dst, uint32_t n)
+{
+	synth_t *sp = &vp->syn;
+	const int32_t g = vp->gain;
+	const int8_t *tab = sp->tab;
+	uint32_t phase = sp->phase;
+	int32_t env = sp->env;
+
+	for (uint32_t i = 0; i < n; i++) {
+		switch (sp->stage) {
+		case ENV_ATTACK:
+			env += sp->att;
+			if (env >= ENV_ONE) {env = ENV_ONE; sp->stage = ENV_DECAY;}
+			break;
+		case ENV_DECAY:
+			env -= sp->dec;
+			if (env <= sp->sus) {env = sp->sus; sp->stage = ENV_SUSTAIN;}
+			break;
+		case ENV_RELEASE:
+			env -= sp->rel;
+			if (env <= 0) {vp->active = false; n = i;}
+			break;
+		}
+		if (sp->glide) {
+			sp->inc += sp->glide;
+			if ((sp->glide > 0) == (sp->inc >= sp->target)) {
+				sp->inc = sp->target;
+				sp->glide = 0;
+			}
+		}
+		if (i < n) {
+			dst[i] += (tab[phase >> 24] * g * (env >> (24-ENV_Q))) >> ENV_Q;
+			phase += sp->inc;
+		}
+	}
+	sp->phase = phase;
+	sp->env = env;
+}
+
+// Free a voice, unless it has been claimed again since claim c.
+static inline void IRAM_ATTR claim_free(uint32_t v, uint32_t c)
+{
+	atomic_compare_exchange_strong(&claim[v], &c, c & ~CLAIM_OWNED);
+}
+
+// Mix up to MIX_BLK samples.
+static bool IRAM_ATTR mix_block(uint8_t *buf, uint32_t n)
+{
+	bool any = false;
+	uint32_t nv = 0;
+
+	for (uint32_t i = 0; i < n; i++) acc[i] = 0;
+
+	for (uint32_t v = 0; v < SOUND_VOICES; v++) {
+		voice_t *vp = voices+v;
+		if (!vp->active) continue;
+		any = true;
+		nv++;
+		if (vp->start_us) { // first samples of the voice
+			uint32_t lat = esp_timer_get_time() - vp->start_us + out_us;
+			stats.lat_last_us = lat;
+			if (lat > stats.lat_max_us) stats.lat_max_us = lat;
+			vp->start_us = 0;
+		}
+		if (vp->kind == VOICE_ADPCM) mix_adpcm(vp, acc, n);
+		else if (vp->kind == VOICE_PCM && vp->step) mix_pcm_rs(vp, acc, n);
+		else if (vp->kind == VOICE_RING) mix_ring(vp, acc, n);
+		else if (vp->kind == VOICE_SYNTH) mix_synth(vp, acc, n);
+		else mix_pcm(vp, acc, n);
+		if (!vp->active) claim_free(v, vp->claim); // ended
+	}
+	stats.voices = nv;
+	if (nv > stats.voices_max) stats.voices_max = nv;
+
+	// saturate to 8 bits and apply master volume
+	for (uint32_t i = 0; i < n; i++) {
+		int32_t s = acc[i] >> 8;
+		if (s < -(int32_t)SILENCE) s = -(int32_t)SILENCE;
+		else if (s > (int32_t)SILENCE-1) s = SILENCE-1;
+		buf[i] = vol_lut[s + SILENCE];
+	}
+	return any;
+}
+
+// Start updating the statistics (ISR).
+static inline void IRAM_ATTR stats_begin(void)
+{
+	atomic_fetch_add_explicit(&stats_seq, 1, memory_order_relaxed);
+	atomic_thread_fence(memory_order_release);
+}
+
+// Finish updating the statistics (ISR).
+static inline void IRAM_ATTR stats_end(void)
+{
+	atomic_fetch_add_explicit(&stats_seq, 1, memory_order_release);
+}
+
+// Apply a command to the voices. Runs in the audio ISR.
+// Return true if the command found a voice it applies to.
+static bool IRAM_ATTR cmd_apply(const cmd_t *c)
+{
+	voice_t *vp = voices + c->voice;
+	bool ok = true;
+
+	switch (c->op) {
+	case CMD_PLAY:
+		// a claim stopped before its sound started is not played
+		ok = atomic_load(&claim[c->voice]) == c->init.claim;
+		if (ok) {
+			*vp = c->init;
+			vp->active = true;
+		}
+		break;
+	case CMD_STOP:
+		// a sound started for a later claim keeps playing, and a play still
+		// queued for this claim is dropped as the claim is freed
+		ok = vp->active && vp->claim == c->claim;
+		if (ok) vp->active = false;
+		claim_free(c->voice, c->claim);
+		break;
+	case CMD_STOP_ALL:
+		for (uint32_t v = 0; v < SOUND_VOICES; v++) {
+			if (voices[v].claim == c->claims[v]) voices[v].active = false;
+			claim_free(v, c->claims[v]);
+		}
+		break;
+	case CMD_RELEASE:
+		ok = vp->kind == VOICE_SYNTH;
+		if (ok) vp->syn.stage = ENV_RELEASE;
+		break;
+	case CMD_VOLUME:
+		vp->gain = c->gain;
+		break;
+	case CMD_PITCH:
+		ok = vp->kind == VOICE_SYNTH && vp->active;
+		if (ok) {
+			synth_t *sp = &vp->syn;
+			sp->target = c->pitch.inc;
+			sp->glide = c->pitch.samples ?
+				(c->pitch.inc - sp->inc) / (int32_t)c->pitch.samples : 0;
+			if (!sp->glide) sp->inc = c->pitch.inc;
+		}
+		break;
+	case CMD_RATE:
+		ok = vp->kind == VOICE_PCM || vp->kind == VOICE_ADPCM;
+		if (ok) vp->step = c->step;
+		break;
+	case CMD_WAVE:
+		ok = vp->kind == VOICE_SYNTH;
+		if (ok) vp->syn.tab = c->tab;
+		break;
+	case CMD_CLOCK:
+		clock_fn = c->clock;
+		clock_left = 0;
+		break;
+	case CMD_MASTER:
+		// centered scaling keeps silence at SILENCE, so low volumes don't pop
+		for (int32_t i = 0; i < 256; i++)
+			vol_lut[i] = ((i - (int32_t)SILENCE) * (int32_t)c->vol) / (int32_t)PERCENT + SILENCE;
+		break;
+	case CMD_STATS:
+		stats = (sound_stats_t){0};
+		cyc_sum = 0;
+		break;
+	}
+	return ok;
+}
+
+// Apply the commands posted since the last refill. Runs in the audio ISR.
+// At most one lap of the ring is applied, which bounds the time taken.
+static void IRAM_ATTR cmd_drain(void)
+{
+	for (uint32_t k = 0; k < CMD_RING; k++) {
+		uint32_t pos = atomic_load_explicit(&cmd_tail, memory_order_relaxed), idx = pos & (CMD_RING-1);
+		slot_t *sp = cmd_ring + idx;
+		uint32_t seq = atomic_load_explicit(&sp->seq, memory_order_acquire) + idx;
+		if (seq != pos + 1) break; // empty, or a producer is still writing
+		cmd_apply(&sp->cmd);
+		atomic_store_explicit(&sp->seq, pos + CMD_RING - idx, memory_order_release);
+		atomic_store_explicit(&cmd_tail, pos + 1, memory_order_release);
+	}
+}
+
+// Post a command to the audio ISR. Never blocks.
+// at: set to the ring position of the command, or NULL.
+// Return false if the ring is full.
+static bool cmd_put(const cmd_t *c, uint32_t *at)
+{
+	uint32_t pos = atomic_load_explicit(&cmd_head, memory_order_relaxed);
+
+	for (;;) {
+		uint32_t idx = pos & (CMD_RING-1);
+		slot_t *sp = cmd_ring + idx;
+		uint32_t seq = atomic_load_explicit(&sp->seq, memory_order_acquire) + idx;
+		int32_t dif = (int32_t)(seq - pos);
+		if (dif == 0) { // slot free on this lap, try to claim it
+			if (atomic_compare_exchange_weak_explicit(&cmd_head, &pos, pos+1,
+				memory_order_relaxed, memory_order_relaxed)) {
+				sp->cmd = *c;
+				atomic_store_explicit(&sp->seq, pos + 1 - idx, memory_order_release);
+				if (at != NULL) *at = pos;
+				return true;
+			}
+		} else if (dif < 0) { // not yet applied by the ISR
+			return false;
+		} else { // another producer claimed it
+			pos = atomic_load_explicit(&cmd_head, memory_order_relaxed);
+		}
+	}
+}
+
+// Send a command to the voices. From the mixer clock (already in the audio
+// ISR) it is applied at once, otherwise it is posted to the ring.
+// Return false if the command was not applied or could not be posted.
+static bool cmd_send(const cmd_t *c)
+{
+	if (clock_core == xPortGetCoreID()) return cmd_apply(c);
+	return cmd_put(c, NULL);
+}
+
+// Mix the active voices into unsigned 8-bit output samples.
+// Called from the audio ISR each time the driver needs more samples.
+// buf: output sample buffer.
+// n: number of samples to produce.
+// Return true if any voice was playing, otherwise false (buf is silence).
+bool IRAM_ATTR sound_mix(uint8_t *buf, uint32_t n)
+{
+	uint32_t c0 = esp_cpu_get_cycle_count();
+	bool any = false;
+
+	stats_begin();
+	cmd_drain();
+	while (n) {
+		uint32_t m = (n < MIX_BLK) ? n : MIX_BLK;
+		sound_clock_t fn = clock_fn;
+		if (fn != NULL) {
+			// split the block where the clock is due
+			if (!clock_left) {
+				clock_core = xPortGetCoreID();
+				clock_left = fn();
+				clock_core = -1;
+			}
+			if (!clock_left) clock_left = 1;
+			if (m > clock_left) m = clock_left;
+			clock_left -= m;
+		}
+		any |= mix_block(buf, m);
+		buf += m;
+		n -= m;
+	}
+
+	uint32_t cyc = esp_cpu_get_cycle_count() - c0;
+	if (!stats.refills || cyc < stats.cyc_min) stats.cyc_min = cyc;
+	if (cyc > stats.cyc_max) stats.cyc_max = cyc;
+	cyc_sum += cyc;
+	stats.refills++;
+	stats_end();
+	return any;
+}
+
+// Count an output buffer the driver could not refill in time.
+// Called from the audio ISR.
+void IRAM_ATTR sound_mix_underrun(void)
+{
+	stats_begin();
+	stats.underruns++;
+	stats_end();
+}
+
+// Set up the mixer for the output sample rate. Called by the drivers.
+// sample_hz: output sample rate in Hz.
+// delay: samples buffered by the driver between the mixer and the DAC.
+void sound_mix_init(uint32_t sample_hz, uint32_t delay)
+{
+	mix_hz = sample_hz;
+	out_us = (uint64_t)delay * 1000000 / sample_hz;
+	sound_stats_reset();
+	if (wave_tab[SOUND_WAVE_SQUARE][0]) return; // tables already built
+	for (int32_t i = 0; i < SOUND_WAVE_LEN; i++) {
+		const int32_t h = SOUND_WAVE_LEN/2, q = SOUND_WAVE_LEN/4;
+		wave_tab[SOUND_WAVE_SINE][i] = lroundf(INT8_MAX * sinf(2*(float)M_PI*i/SOUND_WAVE_LEN));
+		wave_tab[SOUND_WAVE_SQUARE][i] = (i < h) ? INT8_MAX : -INT8_MAX;
+		wave_tab[SOUND_WAVE_TRIANGLE][i] = (i < q) ? i*INT8_MAX/q :
+			(i < 3*q) ? (h-i)*INT8_MAX/q : (i-SOUND_WAVE_LEN)*INT8_MAX/q;
+		wave_tab[SOUND_WAVE_SAW][i] = (i-h)*INT8_MAX/h;
+	}
+}
+
+// Return the output sample rate in Hz, or zero before sound_init().
+uint32_t sound_mix_rate(void)
+{
+	return mix_hz;
+}
+
+// Install a clock called by the mixer at sample exact intervals. Waits
+// until the ISR has applied the change, so a clock removed is no longer
+// running and is not called again. A mixer that does not refill within
+// the driver delay and CLOCK_WAIT_MS is not running, and is not waited for.
+// fn: clock function, or NULL to remove the clock.
+void sound_mix_clock(sound_clock_t fn)
+{
+	cmd_t c = {.op = CMD_CLOCK, .clock = fn};
+	int64_t end = esp_timer_get_time() + out_us + CLOCK_WAIT_MS*1000;
+	uint32_t pos;
+
+	if (clock_core == xPortGetCoreID()) {
+		cmd_apply(&c);
+		return;
+	}
+	while (!cmd_put(&c, &pos)) { // ring full
+		if (esp_timer_get_time() > end) return;
+		vTaskDelay(1);
+	}
+	while ((int32_t)(atomic_load_explicit(&cmd_tail, memory_order_acquire) - pos) <= 0 &&
+		esp_timer_get_time() < end)
+		vTaskDelay(1);
+}
+
+// Claim a voice for a new sound.
+// voice: voice number [0, SOUND_VOICES), or SOUND_ANY for a free voice.
+// prio: priority of the new sound.
+// next: set to the new claim word.
+// Return the voice number, or negative if none could be claimed.
+static int32_t voice_claim(int32_t voice, uint8_t prio, uint32_t *next)
+{
+	if (voice < 0) {
+		for (int32_t v = 0; v < SOUND_VOICES; v++) {
+			uint32_t c = atomic_load(&claim[v]);
+			if (!(c & CLAIM_OWNED) &&
+				atomic_compare_exchange_strong(&claim[v], &c, CLAIM_NEXT(c))) {
+				vprio[v] = prio;
+				*next = CLAIM_NEXT(c);
+				return v;
+			}
+		}
+		// no free voice, take over the lowest priority voice below prio
+		for (int32_t v = 0; v < SOUND_VOICES; v++)
+			if (vprio[v] < prio && (voice < 0 || vprio[v] < vprio[voice]))
+				voice = v;
+		if (voice < 0) return voice;
+	}
+	uint32_t c = atomic_load(&claim[voice]);
+	while (!atomic_compare_exchange_weak(&claim[voice], &c, CLAIM_NEXT(c)));
+	vprio[voice] = prio;
+	*next = CLAIM_NEXT(c);
+	return voice;
+}
+
+// Claim a voice and start it playing. See sound_play().
+// init: voice state to start from, copied to the claimed voice.
+static int32_t voice_start(int32_t voice, const voice_t *init)
+{
+	uint32_t next;
+
+	if (voice >= SOUND_VOICES || voice < SOUND_ANY) return -1;
+	voice = voice_claim(voice, init->prio, &next);
+	if (voice < 0) return -1;
+	cmd_t c = {.op = CMD_PLAY, .voice = voice, .init = *init};
+	c.init.start_us = esp_timer_get_time();
+	c.init.claim = next;
+	if (!cmd_send(&c)) {
+		// give up the claim, unless claimed again. A sound taken over keeps
+		// playing until the voice is next claimed.
+		atomic_compare_exchange_strong(&claim[voice], &next, next & ~CLAIM_OWNED);
+		return -1;
+	}
+	return voice;
+}
+
+// Convert a voice volume in percent to a gain.
+static int32_t voice_gain(uint32_t vol)
+{
+	if (vol > MAX_VOL) vol = MAX_VOL;
+	return vol*GAIN_ONE/PERCENT;
+}
+
+// Start playing audio on a mixer voice. Voices are mixed together, so
+// sounds on different voices overlap instead of cutting each other off.
+// voice: voice number [0, SOUND_VOICES), or SOUND_ANY for a free voice.
+//   With SOUND_ANY and no free voice, the lowest priority voice playing
+//   below prio is taken over.
+// audio: a pointer to an array of unsigned audio data.
+// size: the size of the array in bytes.
+// vol: voice volume 0-100% (scaled again by the master volume).
+// loop: if true, play cyclically until stopped, otherwise play once.
+// prio: voice priority, higher values are kept longer.
+// Return the voice number if successful, or negative otherwise.
+int32_t sound_play(int32_t voice, const void *audio, uint32_t size, uint32_t vol, bool loop, uint8_t prio)
+{
+	if (audio == NULL || !size) return -1;
+	voice_t init = {.kind = VOICE_PCM, .base = audio, .size = size,
+		.gain = voice_gain(vol), .loop = loop, .prio = prio};
+	return voice_start(voice, &init);
+}
+
+// Start playing IMA-ADPCM audio on a mixer voice. The audio is decoded
+// while it is mixed. Arguments and return value are as for sound_play().
+// audio: a pointer to IMA-ADPCM blocks of SOUND_ADPCM_BLOCK bytes.
+// size: the size of the ADPCM data in bytes.
+int32_t sound_play_adpcm(int32_t voice, const void *audio, uint32_t size, uint32_t vol, bool loop, uint8_t prio)
+{
+	if (audio == NULL || !size) return -1;
+	voice_t init = {.kind = VOICE_ADPCM, .base = audio, .size = size,
+		.gain = voice_gain(vol), .loop = loop, .prio = prio};
+	return voice_start(voice, &init);
+}
+
+// Set the sample rate of the audio playing on a voice. The voice is
+// resampled to the output rate by linear interpolation, so audio recorded
+// at any rate plays without calling sound_init() again. Call right after
+// starting the voice; the rate applies from the next refill.
+// voice: voice number [0, SOUND_VOICES) playing PCM or IMA-ADPCM audio.
+// hz: sample rate of the audio in Hz, or zero for the output rate.
+// Return zero if successful, or non-zero otherwise.
+int32_t sound_set_rate(int32_t voice, uint32_t hz)
+{
+	if (voice < 0 || voice >= SOUND_VOICES || !mix_hz) return 1;
+	uint64_t step = ((uint64_t)hz << 16) / mix_hz;
+	if (step == RATE_ONE) step = 0; // native rate, no resampling
+	else if (step > RATE_MAX) step = RATE_MAX;
+	cmd_t c = {.op = CMD_RATE, .voice = voice, .step = step};
+	return !cmd_send(&c);
+}
+
+// Set the volume of the sound playing on a voice. The volume applies from
+// the next refill.
+// voice: voice number [0, SOUND_VOICES).
+// vol: voice volume 0-100% (scaled again by the master volume).
+// Return zero if successful, or non-zero otherwise.
+int32_t sound_voice_volume(int32_t voice, uint32_t vol)
+{
+	if (voice < 0 || voice >= SOUND_VOICES) return 1;
+	cmd_t c = {.op = CMD_VOLUME, .voice = voice, .gain = voice_gain(vol)};
+	return !cmd_send(&c);
+}
+
+// Start playing a stream ring buffer on a mixer voice. The voice ends when
+// the ring is empty and ring->eof is set.
+// voice: voice number [0, SOUND_VOICES), or SOUND_ANY for a free voice.
+// ring: ring buffer, filled by the caller.
+// vol: voice volume 0-100%.
+// prio: voice priority, higher values are kept longer.
+// Return the voice number if successful, or negative otherwise.
+int32_t sound_mix_ring(int32_t voice, sound_ring_t *ring, uint32_t vol, uint8_t prio)
+{
+	if (ring == NULL) return -1;
+	voice_t init = {.kind = VOICE_RING, .ring = ring,
+		.gain = voice_gain(vol), .prio = prio};
+	return voice_start(voice, &init);
+}
+
+// Convert a frequency in Hz to a phase increment per sample.
+static int32_t synth_inc(uint32_t freq)
+{
+	if (freq >= mix_hz/2) freq = mix_hz/2 - 1; // keep below Nyquist
+	return ((uint64_t)freq << 32) / mix_hz;
+}
+
+// Convert a time in ms to an envelope step per sample for a full scale
+// change.
+static int32_t synth_step(uint32_t ms)
+{
+	uint32_t samples = ms * mix_hz / 1000;
+	return samples ? ENV_ONE / samples : ENV_ONE;
+}
+
+// Start a synthesizer voice from a phase increment. See sound_synth_start().
+int32_t sound_mix_synth(int32_t voice, sound_wave_t wave, int32_t inc, uint32_t vol, const sound_adsr_t *adsr, uint8_t prio)
+{
+	if (wave >= SOUND_WAVE_LAST || !mix_hz) return -1;
+	voice_t init = {.kind = VOICE_SYNTH, .gain = voice_gain(vol), .prio = prio};
+	synth_t *sp = &init.syn;
+	sp->tab = wave_tab[wave];
+	sp->inc = sp->target = inc;
+	if (adsr != NULL) {
+		uint32_t sus = (adsr->sustain > PERCENT) ? PERCENT : adsr->sustain;
+		sp->att = synth_step(adsr->attack);
+		sp->dec = synth_step(adsr->decay);
+		sp->rel = synth_step(adsr->release);
+		sp->sus = sus * ENV_ONE / PERCENT;
+	} else {
+		sp->att = sp->dec = sp->rel = ENV_ONE;
+		sp->sus = ENV_ONE;
+	}
+	return voice_start(voice, &init);
+}
+
+// Slide a synthesizer voice to a new phase increment.
+// voice: voice number [0, SOUND_VOICES).
+// inc: new phase increment.
+// samples: length of the slide, or zero to jump.
+// Return true if the voice is a playing synthesizer voice, otherwise false.
+bool sound_mix_glide(int32_t voice, int32_t inc, uint32_t samples)
+{
+	if (voice < 0 || voice >= SOUND_VOICES) return false;
+	cmd_t c = {.op = CMD_PITCH, .voice = voice,
+		.pitch = {.inc = inc, .samples = samples}};
+	return cmd_send(&c);
+}
+
+// Start a synthesizer voice. A phase accumulator steps through a waveform
+// table at the given frequency, so any pitch is available without
+// building a buffer. The note holds at the sustain level until
+// sound_synth_release() is called.
+// voice: voice number [0, SOUND_VOICES), or SOUND_ANY for a free voice.
+// wave: waveform of the note.
+// freq: frequency of the note in Hz.
+// vol: voice volume 0-100% (scaled again by the master volume).
+// adsr: note envelope, or NULL to start and stop without one.
+// prio: voice priority, higher values are kept longer.
+// Return the voice number if successful, or negative otherwise.
+int32_t sound_synth_start(int32_t voice, sound_wave_t wave, uint32_t freq, uint32_t vol, const sound_adsr_t *adsr, uint8_t prio)
+{
+	if (!mix_hz) return -1;
+	return sound_mix_synth(voice, wave, synth_inc(freq), vol, adsr, prio);
+}
+
+// Change the frequency of a synthesizer voice.
+// voice: voice number [0, SOUND_VOICES).
+// freq: new frequency in Hz.
+// glide_ms: time to slide to the new frequency, or zero to jump to it.
+void sound_synth_freq(int32_t voice, uint32_t freq, uint32_t glide_ms)
+{
+	if (!mix_hz) return;
+	sound_mix_glide(voice, synth_inc(freq), glide_ms * mix_hz / 1000);
+}
+
+// Change the waveform of a synthesizer voice.
+// voice: voice number [0, SOUND_VOICES).
+// wave: new waveform.
+void sound_synth_wave(int32_t voice, sound_wave_t wave)
+{
+	if (voice < 0 || voice >= SOUND_VOICES || wave >= SOUND_WAVE_LAST) return;
+	cmd_t c = {.op = CMD_WAVE, .voice = voice, .tab = wave_tab[wave]};
+	cmd_send(&c);
+}
+
+// Release the note on a synthesizer voice. The voice stops at the end of
+// the envelope release.
+// voice: voice number [0, SOUND_VOICES).
+void sound_synth_release(int32_t voice)
+{
+	if (voice < 0 || voice >= SOUND_VOICES) return;
+	cmd_t c = {.op = CMD_RELEASE, .voice = voice};
+	cmd_send(&c);
+}
+
+// Return the waveform table of a synthesizer waveform: SOUND_WAVE_LEN
+// signed samples of one cycle. Valid after sound_init().
+const int8_t *sound_synth_table(sound_wave_t wave)
+{
+	return (wave < SOUND_WAVE_LAST) ? wave_tab[wave] : NULL;
+}
+
+// Stop playing the sound on a mixer voice.
+// voice: voice number [0, SOUND_VOICES).
+void sound_stop_voice(int32_t voice)
+{
+	if (voice < 0 || voice >= SOUND_VOICES) return;
+	cmd_t c = {.op = CMD_STOP, .voice = voice, .claim = atomic_load(&claim[voice])};
+	if (!(c.claim & CLAIM_OWNED)) return;
+	if (cmd_send(&c)) claim_free(voice, c.claim);
+}
+
+// Return true if a sound is playing on the mixer voice, otherwise false.
+// voice: voice number [0, SOUND_VOICES).
+bool sound_busy_voice(int32_t voice)
+{
+	if (voice < 0 || voice >= SOUND_VOICES) return false;
+	return atomic_load(&claim[voice]) & CLAIM_OWNED;
+}
+
+// Start playing the sound immediately on voice 0. Play the audio buffer once.
+// audio: a pointer to an array of unsigned audio data.
+// size: the size of the array in bytes.
+// wait: if true, block until done playing, otherwise return straight away.
+void sound_start(const void *audio, uint32_t size, bool wait)
+{
+	abase = audio;
+	asize = size;
+	sound_play(LEGACY_VOICE, audio, size, MAX_VOL, false, UINT8_MAX);
+	while (wait && sound_busy_voice(LEGACY_VOICE))
+		vTaskDelay(pdMS_TO_TICKS(POLL_DELAY));
+}
+
+// Cyclically play samples from audio buffer on voice 0 until sound_stop()
+// is called.
+// audio: a pointer to an array of unsigned audio data.
+// size: the size of the array in bytes.
+void sound_cyclic(const void *audio, uint32_t size)
+{
+	abase = audio;
+	asize = size;
+	sound_play(LEGACY_VOICE, audio, size, MAX_VOL, true, UINT8_MAX);
+}
+
+// Return true if sound playing on any voice, otherwise return false.
+bool sound_busy(void)
+{
+	for (uint32_t v = 0; v < SOUND_VOICES; v++)
+		if (atomic_load(&claim[v]) & CLAIM_OWNED) return true;
+	return false;
+}
+
+// Stop playing the sound on all voices.
+void sound_stop(void)
+{
+	cmd_t c = {.op = CMD_STOP_ALL};
+	for (uint32_t v = 0; v < SOUND_VOICES; v++) c.claims[v] = atomic_load(&claim[v]);
+	if (!cmd_send(&c)) return;
+	for (uint32_t v = 0; v < SOUND_VOICES; v++) claim_free(v, c.claims[v]);
+}
+
+// Set the master volume, applied to the mix of all voices. The ISR builds
+// the volume table from the next refill, so setters never share a table.
+// volume: 0-100% as an integer value.
+void sound_set_volume(uint32_t vol)
+{
+	if (vol > MAX_VOL) vol = MAX_VOL;
+	cmd_t c = {.op = CMD_MASTER, .vol = vol};
+	cmd_send(&c);
+}
+
+// Get the sound statistics gathered since sound_init() or the last
+// sound_stats_reset().
+// st: statistics output.
+void sound_stats_get(sound_stats_t *st)
+{
+	uint32_t seq;
+	uint64_t sum;
+
+	if (st == NULL) return;
+	do { // retry if the ISR updated the stats while copying
+		seq = atomic_load_explicit(&stats_seq, memory_order_acquire);
+		*st = stats;
+		sum = cyc_sum;
+		atomic_thread_fence(memory_order_acquire);
+	} while ((seq & 1) || seq != atomic_load_explicit(&stats_seq, memory_order_relaxed));
+	st->cyc_avg = st->refills ? sum / st->refills : 0;
+}
+
+// Clear the sound statistics.
+void sound_stats_reset(void)
+{
+	cmd_t c = {.op = CMD_STATS};
+	cmd_send(&c);
+}
+
+// Print the sound statistics to the console.
+void sound_stats_dump(void)
+{
+	sound_stats_t st;
+	sound_stats_get(&st);
+	printf("sound: refills %lu, cycles min %lu avg %lu max %lu\n",
+		st.refills, st.cyc_min, st.cyc_avg, st.cyc_max);
+	printf("sound: underruns %lu, latency last %lu max %lu us\n",
+		st.underruns, st.lat_last_us, st.lat_max_us);
+	printf("sound: voices %u of %u, max %u\n",
+		st.voices, SOUND_VOICES, st.voices_max);
+}
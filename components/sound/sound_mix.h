@@ -0,0 +1,79 @@
+#ifndef SOUND_MIX_H_
+#define SOUND_MIX_H_
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "sound.h"
+
+// Internal interface between the voice mixer and the DAC drivers.
+
+#define SILENCE 0x80U
+
+// Single producer, single consumer ring of unsigned 8-bit samples. The
+// producer (a task) writes samples and then advances head. The consumer
+// (the mixer) reads samples and then advances tail. Both are free running
+// byte counts, so head - tail is the number of samples ready. Each side
+// stores its own index with release and loads the other with acquire, so
+// samples are written before they are read and read before they are
+// overwritten.
+typedef struct {
+	uint8_t *buf;                // Sample storage, mask+1 bytes
+	uint32_t mask;               // Size - 1, size is a power of two
+	atomic_uint head;            // Samples written
+	atomic_uint tail;            // Samples read
+	volatile bool eof;           // No more samples will be written
+	volatile uint32_t underruns; // Mixer passes short of samples
+} sound_ring_t;
+
+// Mix the active voices into unsigned 8-bit output samples.
+// Called from the audio ISR each time the driver needs more samples.
+// buf: output sample buffer.
+// n: number of samples to produce.
+// Return true if any voice was playing, otherwise false (buf is silence).
+bool sound_mix(uint8_t *buf, uint32_t n);
+
+// Clock called by the mixer from the audio ISR, before the samples it is
+// due at are mixed. Return the number of samples (> 0) until the next call.
+typedef uint32_t (*sound_clock_t)(void);
+
+// Set up the mixer for the output sample rate. Called by the drivers.
+// sample_hz: output sample rate in Hz.
+// delay: samples buffered by the driver between the mixer and the DAC.
+void sound_mix_init(uint32_t sample_hz, uint32_t delay);
+
+// Count an output buffer the driver could not refill in time.
+// Called from the audio ISR.
+void sound_mix_underrun(void);
+
+// Start playing a stream ring buffer on a mixer voice. The voice ends when
+// the ring is empty and ring->eof is set.
+// voice: voice number [0, SOUND_VOICES), or SOUND_ANY for a free voice.
+// ring: ring buffer, filled by the caller.
+// vol: voice volume 0-100%.
+// prio: voice priority, higher values are kept longer.
+// Return the voice number if successful, or negative otherwise.
+int32_t sound_mix_ring(int32_t voice, sound_ring_t *ring, uint32_t vol, uint8_t prio);
+
+// Return the output sample rate in Hz, or zero before sound_init().
+uint32_t sound_mix_rate(void);
+
+// Install a clock called by the mixer at sample exact intervals. Returns
+// once the mixer has applied the change, so a clock removed is no longer
+// running. Called from the clock itself, the change applies at once.
+// fn: clock function, or NULL to remove the clock.
+void sound_mix_clock(sound_clock_t fn);
+
+// Start a synthesizer voice from a phase increment (2^32 per cycle per
+// sample). Otherwise as for sound_synth_start().
+int32_t sound_mix_synth(int32_t voice, sound_wave_t wave, int32_t inc, uint32_t vol, const sound_adsr_t *adsr, uint8_t prio);
+
+// Slide a synthesizer voice to a new phase increment.
+// voice: voice number [0, SOUND_VOICES).
+// inc: new phase increment.
+// samples: length of the slide, or zero to jump.
+// Return true if the voice is a playing synthesizer voice, otherwise false.
+bool sound_mix_glide(int32_t voice, int32_t inc, uint32_t samples);
+
+#endif // SOUND_MIX_H_
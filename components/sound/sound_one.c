@@ -13,13 +13,7 @@
 
 #include "hw.h"
 #include "sound.h"
-
-// Make audio buffer extern for testing
-#ifdef EXTERN_BUF
-#define scope
-#else
-#define scope static
-#endif
+#include "sound_mix.h"
 
 #define SOUND_A  HW_SND_A  // Audio output
 #define SOUND_EN HW_SND_EN // Sound enable, active high
@@ -27,42 +21,35 @@
 #define GPTIMER_RESOLUTION_HZ 1000000
 
 #define SOUND_VOLUME_DEFAULT 50
-#define SILENCE 0x80U
-#define POLL_DELAY 10
-#define PERCENT 100U
+#define ONE_BLK 32 // Samples mixed per refill of the output block
 
 static const char *TAG = "sound";
 
-// Critical section protected variables
-static portMUX_TYPE spinlock = portMUX_INITIALIZER_UNLOCKED;
-scope  const uint8_t *abase;
-scope  volatile uint32_t asize;
-static volatile uint32_t aidx;
-static volatile bool     cyclic;
-
-// Other global variables
+// Global variables
 static dac_oneshot_handle_t dac_handle;
 static gptimer_handle_t dac_timer;
 static volatile bool device_en;
-static volatile uint32_t volume;
-static volatile uint8_t bias; // to prevent popping at end when vol low.
+
+// Output block, refilled by the mixer in the timer ISR
+static uint8_t oblk[ONE_BLK];
+static uint32_t oidx = ONE_BLK;
+static bool oactive; // Block holds mixed voices (not just silence)
+static bool oidle; // Silence already written, the DAC is left alone
 
 
 // DAC timer ISR callback
 static bool IRAM_ATTR dac_timer_isr(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata, void *user_ctx)
 {
-	// TODO: why does critical section cause abort?
-	// portENTER_CRITICAL_ISR(&spinlock);
-	if (aidx < asize) {
-		uint32_t idx = aidx;
-		aidx =  cyclic ? (aidx + 1) % asize : aidx + 1;
-		// portEXIT_CRITICAL_ISR(&spinlock);
-		dac_oneshot_output_voltage(dac_handle, abase[idx]*volume/PERCENT + bias);
-	} else if (aidx == asize) {
-		aidx++;
-		// portEXIT_CRITICAL_ISR(&spinlock);
-		dac_oneshot_output_voltage(dac_handle, SILENCE);
+	if (oidx == ONE_BLK) {
+		bool was_active = oactive;
+		oactive = sound_mix(oblk, ONE_BLK);
+		oidx = 0;
+		oidle = !oactive && !was_active;
 	}
+	// While idle the samples are still counted, so the mixer runs once
+	// every ONE_BLK interrupts and a new voice starts on the next block
+	if (!oidle) dac_oneshot_output_voltage(dac_handle, oblk[oidx]);
+	oidx++;
 	return false; // no high priority task awoken
 }
 
@@ -73,6 +60,7 @@ static bool IRAM_ATTR dac_timer_isr(gptimer_handle_t timer, const gptimer_alarm_
 int32_t sound_init(uint32_t sample_hz)
 {
 	sound_set_volume(SOUND_VOLUME_DEFAULT);
+	sound_mix_init(sample_hz, 0); // a block starts out in the ISR that mixes it
 
 	// if the first time called, configure pins
 	if (dac_handle == NULL) {
@@ -145,6 +133,7 @@ int32_t sound_init(uint32_t sample_hz)
 // Return zero if successful, or non-zero otherwise.
 int32_t sound_deinit(void)
 {
+	if (dac_timer == NULL) return 1;
 	ESP_LOGI(TAG, "Stop DAC timer");
 	ESP_ERROR_CHECK(gptimer_stop(dac_timer));
 	ESP_ERROR_CHECK(gptimer_disable(dac_timer));
@@ -155,57 +144,6 @@ int32_t sound_deinit(void)
 	return 0;
 }
 
-// Start playing the sound immediately. Play the audio buffer once.
-// audio: a pointer to an array of unsigned audio data.
-// size: the size of the array in bytes.
-// wait: if true, block until done playing, otherwise return straight away.
-void sound_start(const void *audio, uint32_t size, bool wait)
-{
-	portENTER_CRITICAL(&spinlock);
-	abase = audio;
-	asize = size;
-	aidx = 0;
-	cyclic = false;
-	portEXIT_CRITICAL(&spinlock);
-	while (wait && aidx < asize)
-		vTaskDelay(pdMS_TO_TICKS(POLL_DELAY));
-}
-
-// Cyclically play samples from audio buffer until sound_stop() is called.
-// audio: a pointer to an array of unsigned audio data.
-// size: the size of the array in bytes.
-void sound_cyclic(const void *audio, uint32_t size)
-{
-	portENTER_CRITICAL(&spinlock);
-	abase = audio;
-	asize = size;
-	aidx = 0;
-	cyclic = true;
-	portEXIT_CRITICAL(&spinlock);
-}
-
-// Return true if sound playing, otherwise return false.
-bool sound_busy(void)
-{
-	return aidx < asize;
-}
-
-// Stop playing the sound.
-void sound_stop(void)
-{
-	portENTER_CRITICAL(&spinlock);
-	aidx = asize;
-	portEXIT_CRITICAL(&spinlock);
-}
-
-// Set the volume.
-// volume: 0-100% as an integer value.
-void sound_set_volume(uint32_t vol)
-{
-	volume = vol;
-	bias = SILENCE - (SILENCE * vol / PERCENT);
-}
-
 // Enable or disable the sound output device.
 // enable: if true, enable sound, otherwise disable.
 void sound_device(bool enable)
@@ -0,0 +1,196 @@
+// Pattern based music sequencer (tracker). Rows of a song are played by
+// the mixer clock, so timing is sample exact and does not depend on task
+// scheduling. Each row costs the same: one cell per channel, each a table
+// lookup and at most one voice start, glide or release.
+//
+// Song format (bytes):
+//   0-1  magic "SQ"
+//   2    channels, each played on its own voice
+//   3    rows per pattern
+//   4    number of patterns
+//   5    number of orders (patterns in play order)
+//   6    tempo in beats per minute
+//   7    rows per beat
+//   8    order list, one pattern number per order
+//   then the patterns, rows x channels cells of 4 bytes:
+//     note: 0 none, 1-127 MIDI note (69 is A4), SOUND_SEQ_OFF release
+//     instrument: 0 keep the last one, otherwise 1-based instrument index
+//     effect: sound_fx_t
+//     param: effect parameter
+
+#include <math.h> // powf
+
+#include "freertos/FreeRTOS.h"
+
+#include "sound.h"
+#include "sound_mix.h"
+
+#define SEQ_HDR 8 // Song header size in bytes
+#define SEQ_CELL 4 // Cell size in bytes
+#define SEQ_NOTES 128 // MIDI notes
+#define SEQ_A4 69 // MIDI note of A4
+#define SEQ_A4_HZ 440.0f
+#define SEQ_GLIDE_MS 10 // Glide parameter unit in ms
+
+typedef struct {
+	const sound_inst_t *inst; // Last instrument used, NULL for none
+	uint8_t vol;              // Channel volume 0-100%
+} chan_t;
+
+// Global variables
+static const uint8_t *song;      // Song header
+static const uint8_t *pats;      // First pattern
+static const sound_inst_t *inst_tab; // Instrument table
+static uint32_t inst_n;
+static uint32_t channels, rows, orders, lpb;
+static int32_t voice0;           // Voice of channel 0
+static bool looping;
+static volatile bool playing;
+static uint32_t order, row;      // Next row to play, used by ISR only
+static uint32_t row_samples;     // Samples per row
+static chan_t chan[SOUND_VOICES];
+static int32_t note_inc[SEQ_NOTES]; // Phase increment of each note
+
+
+// Set the row period from a tempo.
+static void seq_tempo(uint32_t bpm)
+{
+	uint32_t hz = sound_mix_rate();
+	if (!bpm) return;
+	row_samples = hz * 60 / (bpm * lpb);
+	if (!row_samples) row_samples = 1;
+}
+
+// Release the note on a channel voice.
+static void seq_release(uint32_t c)
+{
+	int32_t v = voice0 + c;
+	if (chan[c].inst != NULL && chan[c].inst->audio == NULL)
+		sound_synth_release(v);
+	else
+		sound_stop_voice(v);
+}
+
+// Play one cell of a row on channel c.
+static void seq_cell(uint32_t c, const uint8_t *cell)
+{
+	chan_t *ch = chan+c;
+	int32_t v = voice0 + c;
+	uint32_t note = cell[0], inst = cell[1], fx = cell[2], param = cell[3];
+
+	if (inst && inst <= inst_n) ch->inst = inst_tab + inst-1;
+	switch (fx) {
+	case SOUND_FX_VOLUME:
+		ch->vol = (param > MAX_VOL) ? MAX_VOL : param;
+		break;
+	case SOUND_FX_TEMPO:
+		seq_tempo(param);
+		break;
+	}
+	if (note == SOUND_SEQ_OFF) {
+		seq_release(c);
+	} else if (note && note < SEQ_NOTES && ch->inst != NULL) {
+		const sound_inst_t *ip = ch->inst;
+		uint32_t vol = ch->vol * ip->vol / MAX_VOL;
+		if (ip->audio != NULL) { // samples play at their recorded pitch
+			if (sound_play(v, ip->audio, ip->size, vol, false, UINT8_MAX) >= 0)
+				sound_set_rate(v, ip->rate);
+		} else if (fx != SOUND_FX_GLIDE || !sound_mix_glide(v, note_inc[note],
+			param * SEQ_GLIDE_MS * (sound_mix_rate() / 1000))) {
+			sound_mix_synth(v, ip->wave, note_inc[note], vol, &ip->adsr, UINT8_MAX);
+		}
+	}
+}
+
+// Mixer clock: play a row and return the samples until the next one.
+static uint32_t seq_clock(void)
+{
+	if (!playing) return row_samples;
+	if (order >= orders) { // end of song, one row after the last row
+		if (!looping) {
+			for (uint32_t c = 0; c < channels; c++) seq_release(c);
+			playing = false;
+			return row_samples;
+		}
+		order = 0;
+	}
+	const uint8_t *cell = pats + ((uint32_t)song[SEQ_HDR+order] * rows + row) * channels * SEQ_CELL;
+	for (uint32_t c = 0; c < channels; c++, cell += SEQ_CELL)
+		seq_cell(c, cell);
+	if (++row >= rows) {
+		row = 0;
+		order++;
+	}
+	return row_samples;
+}
+
+// Start playing a song. Rows are timed by the audio clock. Channel c of
+// the song plays on voice voice+c. Samples play at their recorded pitch.
+// data: song data in the format described in sound_seq.c
+//   (see audio/song2c.m to convert a text song).
+// size: the size of the song data in bytes.
+// inst: instrument table, indexed by the 1-based instrument of a cell.
+// insts: number of instruments in the table.
+// voice: voice of the first channel.
+// loop: if true, play the song cyclically until stopped, otherwise once.
+// Return zero if successful, or non-zero otherwise.
+int32_t sound_seq_start(const uint8_t *data, uint32_t size, const sound_inst_t *inst, uint32_t insts, int32_t voice, bool loop)
+{
+	uint32_t hz = sound_mix_rate();
+	if (data == NULL || size < SEQ_HDR || !hz ||
+		data[0] != 'S' || data[1] != 'Q')
+		return 1;
+	uint32_t nc = data[2], nr = data[3], np = data[4], no = data[5];
+	if (!nc || !nr || !no || !data[6] || !data[7] ||
+		voice < 0 || voice + nc > SOUND_VOICES ||
+		size < SEQ_HDR + no + np*nr*nc*SEQ_CELL)
+		return 1;
+	for (uint32_t i = 0; i < no; i++)
+		if (data[SEQ_HDR+i] >= np) return 1;
+
+	sound_seq_stop();
+	song = data;
+	pats = data + SEQ_HDR + no;
+	inst_tab = inst;
+	inst_n = (inst != NULL) ? insts : 0;
+	channels = nc; rows = nr; orders = no; lpb = data[7];
+	voice0 = voice;
+	looping = loop;
+	order = row = 0;
+	for (uint32_t c = 0; c < nc; c++)
+		chan[c] = (chan_t){.inst = NULL, .vol = MAX_VOL};
+	for (uint32_t n = 0; n < SEQ_NOTES; n++) {
+		float f = SEQ_A4_HZ * powf(2.0f, (int32_t)(n - SEQ_A4) / 12.0f);
+		if (f >= hz/2) f = hz/2 - 1; // keep below Nyquist
+		note_inc[n] = (int32_t)(f / hz * 4294967296.0f);
+	}
+	seq_tempo(data[6]);
+	playing = true;
+	sound_mix_clock(seq_clock);
+	return 0;
+}
+
+// Stop playing the song and release its notes.
+void sound_seq_stop(void)
+{
+	if (song == NULL) return;
+	sound_mix_clock(NULL); // returns once seq_clock() is no longer running
+	playing = false;
+	for (uint32_t c = 0; c < channels; c++)
+		seq_release(c);
+	song = NULL;
+}
+
+// Return true if a song is playing, otherwise false.
+bool sound_seq_busy(void)
+{
+	return playing;
+}
+
+// Change the tempo of the song playing.
+// bpm: beats per minute.
+void sound_seq_tempo(uint32_t bpm)
+{
+	if (song == NULL) return;
+	seq_tempo(bpm); // a single store, read by the mixer clock
+}
@@ -0,0 +1,221 @@
+// Stream audio from flash through a ring buffer. A low priority task reads
+// the source in chunks, converts it to unsigned 8-bit samples (decoding
+// IMA-ADPCM if needed) and keeps the ring ahead of the mixer.
+
+#include <stdio.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_partition.h"
+
+#include "sound.h"
+#include "sound_mix.h"
+#include "sound_adpcm.h"
+
+#define RING_SZ CONFIG_SOUND_STREAM_RING_SZ // Ring buffer size in bytes
+#define CHUNK_SZ (SOUND_ADPCM_BLOCK*2) // Bytes read from the source at once
+#define ADPCM_SAMPLES (1+(SOUND_ADPCM_BLOCK-ADPCM_HDR)*2) // Samples per block
+
+#define PART_HDR 4 // Partition header: audio length in bytes
+#define STREAM_POLL 10 // Fill period in milliseconds
+#define STREAM_PRIO 2 // Task priority, below the game loop
+#define STREAM_STACK 3072 // Task stack size in bytes
+
+_Static_assert((RING_SZ & (RING_SZ-1)) == 0, "ring size must be a power of two");
+
+static const char *TAG = "stream";
+
+// Audio source, either a file or a raw partition
+typedef struct {
+	FILE *fp;
+	const esp_partition_t *part;
+	uint32_t base; // Offset of the audio data
+	uint32_t size; // Size of the audio data in bytes
+	uint32_t pos;  // Next byte to read
+} source_t;
+
+// Global variables
+static uint8_t ring_buf[RING_SZ];
+static sound_ring_t ring = {.buf = ring_buf, .mask = RING_SZ-1};
+static uint8_t chunk[CHUNK_SZ];
+static source_t src;
+static sound_fmt_t format;
+static bool looping;
+static int32_t voice = -1;
+static volatile bool stop;
+static TaskHandle_t task;
+
+
+// Open the source. Return zero if successful, or non-zero otherwise.
+static int32_t src_open(const char *name)
+{
+	src = (source_t){0};
+	if (name[0] == '/') {
+		src.fp = fopen(name, "rb");
+		if (src.fp == NULL) return 1;
+		fseek(src.fp, 0, SEEK_END);
+		long len = ftell(src.fp);
+		fseek(src.fp, 0, SEEK_SET);
+		if (len <= 0) {fclose(src.fp); src.fp = NULL; return 1;}
+		src.size = len;
+	} else {
+		uint8_t hdr[PART_HDR];
+		src.part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+			ESP_PARTITION_SUBTYPE_ANY, name);
+		if (src.part == NULL ||
+			esp_partition_read(src.part, 0, hdr, sizeof(hdr)) != ESP_OK)
+			return 1;
+		src.base = PART_HDR;
+		src.size = hdr[0] | hdr[1] << 8 | hdr[2] << 16 | (uint32_t)hdr[3] << 24;
+		if (!src.size || src.size > src.part->size - PART_HDR) return 1;
+	}
+	return 0;
+}
+
+static void src_close(void)
+{
+	if (src.fp != NULL) fclose(src.fp);
+	src = (source_t){0};
+}
+
+static void src_rewind(void)
+{
+	src.pos = 0;
+	if (src.fp != NULL) fseek(src.fp, 0, SEEK_SET);
+}
+
+// Read up to n bytes. Return the number of bytes read, zero at the end.
+static uint32_t src_read(uint8_t *dst, uint32_t n)
+{
+	if (n > src.size - src.pos) n = src.size - src.pos;
+	if (!n) return 0;
+	if (src.fp != NULL) {
+		n = fread(dst, 1, n, src.fp);
+	} else if (esp_partition_read(src.part, src.base + src.pos, dst, n) != ESP_OK) {
+		n = 0;
+	}
+	src.pos += n;
+	return n;
+}
+
+// Convert n source bytes in chunk to samples at the ring head.
+static void ring_put(uint32_t n)
+{
+	uint32_t head = atomic_load_explicit(&ring.head, memory_order_relaxed);
+
+	if (format == SOUND_FMT_ADPCM) {
+		adpcm_state_t st;
+		if (n < ADPCM_HDR) return;
+		ring_buf[head++ & ring.mask] = (adpcm_header(&st, chunk) >> 8) + SILENCE;
+		for (uint32_t i = ADPCM_HDR; i < n; i++) {
+			ring_buf[head++ & ring.mask] = (adpcm_decode(&st, chunk[i] & 0xF) >> 8) + SILENCE;
+			ring_buf[head++ & ring.mask] = (adpcm_decode(&st, chunk[i] >> 4) >> 8) + SILENCE;
+		}
+	} else {
+		for (uint32_t i = 0; i < n; i++)
+			ring_buf[head++ & ring.mask] = chunk[i];
+	}
+	// publish after the samples are written
+	atomic_store_explicit(&ring.head, head, memory_order_release);
+}
+
+// Fill the ring while there is room for another chunk.
+// Return false when the (non-looping) source has ended or failed.
+static bool ring_fill(void)
+{
+	// ADPCM is read a block at a time so each read starts with a header
+	uint32_t in = (format == SOUND_FMT_ADPCM) ? SOUND_ADPCM_BLOCK : CHUNK_SZ;
+	uint32_t out = (format == SOUND_FMT_ADPCM) ? ADPCM_SAMPLES : CHUNK_SZ;
+
+	while (RING_SZ - (atomic_load_explicit(&ring.head, memory_order_relaxed) -
+		atomic_load_explicit(&ring.tail, memory_order_acquire)) >= out) {
+		uint32_t n = src_read(chunk, in);
+		if (!n) {
+			if (!looping || !src.pos) return false;
+			src_rewind();
+			continue;
+		}
+		ring_put(n);
+	}
+	return true;
+}
+
+static void stream_task(void *arg)
+{
+	uint32_t reported = 0;
+
+	while (!stop && sound_busy_voice(voice)) {
+		if (!ring.eof && !ring_fill()) ring.eof = true;
+		if (ring.underruns != reported) {
+			reported = ring.underruns;
+			ESP_LOGW(TAG, "underruns: %lu", (unsigned long)reported);
+		}
+		vTaskDelay(pdMS_TO_TICKS(STREAM_POLL));
+	}
+	src_close();
+	voice = -1;
+	task = NULL;
+	vTaskDelete(NULL);
+}
+
+// Start streaming audio from flash. Data is read in chunks by a low
+// priority task into a small ring buffer that the mixer plays from, so the
+// audio can be as long as the storage allows. Only one stream plays at a
+// time; starting a new one stops the previous stream.
+// name: a path starting with '/' names a file (e.g. on a mounted SPIFFS).
+//   Any other name is the label of a raw data partition whose first four
+//   bytes hold the audio length in bytes (little endian).
+// fmt: format of the audio data.
+// vol: voice volume 0-100% (scaled again by the master volume).
+// loop: if true, play cyclically until stopped, otherwise play once.
+// Return the voice number if successful, or negative otherwise.
+int32_t sound_stream_start(const char *name, sound_fmt_t fmt, uint32_t vol, bool loop)
+{
+	if (name == NULL || (fmt != SOUND_FMT_PCM8 && fmt != SOUND_FMT_ADPCM))
+		return -1;
+	sound_stream_stop();
+	if (src_open(name)) {
+		ESP_LOGE(TAG, "cannot open %s", name);
+		return -1;
+	}
+	format = fmt;
+	looping = loop;
+	atomic_store(&ring.head, 0);
+	atomic_store(&ring.tail, 0);
+	ring.underruns = 0;
+	ring.eof = !ring_fill(); // prime the ring before the mixer sees it
+
+	voice = sound_mix_ring(SOUND_ANY, &ring, vol, UINT8_MAX);
+	if (voice < 0) {src_close(); return -1;}
+	stop = false;
+	if (xTaskCreate(stream_task, "stream", STREAM_STACK, NULL,
+		STREAM_PRIO, &task) != pdPASS) {
+		sound_stop_voice(voice);
+		voice = -1;
+		src_close();
+		return -1;
+	}
+	return voice;
+}
+
+// Stop the audio stream and wait for its task to finish.
+void sound_stream_stop(void)
+{
+	if (task == NULL) return;
+	stop = true;
+	sound_stop_voice(voice);
+	while (task != NULL) vTaskDelay(pdMS_TO_TICKS(STREAM_POLL));
+}
+
+// Return true if the audio stream is playing, otherwise false.
+bool sound_stream_busy(void)
+{
+	return task != NULL;
+}
+
+// Return the number of mixer passes that found the stream ring short of
+// samples since the stream started.
+uint32_t sound_stream_underruns(void)
+{
+	return ring.underruns;
+}
@@ -0,0 +1,164 @@
+% Clear command window & workspace, and close all figures
+clc, clear, close all;
+
+o_max_w = 320; % output atlas maximum width (frames wrap to a new shelf)
+o_bits = 1; % output image bits per pixel (1 or 16)
+o_ms = 50; % display time of each frame in milliseconds
+o_pingpong = true; % append frames in reverse order (e.g. 0,1,2,1)
+o_dir = "atlas"; % output sub-directory
+
+% Select image files to convert, one file per frame, in frame order
+[fname,location] = uigetfile(...
+    '*.bmp;*.cur;*.gif;*.hdf4;*.ico;*.jpg;*.jpeg;*.pcx;*.pbm;*.pgm;*.png;*.ppm;*.ras;*.tif;*.tiff;*.xwd',...
+    'Select the image files of each frame',...
+    'MultiSelect','on');
+if isequal(fname,0) % user canceled selection
+    disp('No file(s) selected');
+    return;
+elseif ischar(fname) % convert to cell array if single file selected
+    fname = {fname};
+end
+fname = sort(fname);
+
+% Atlas name is the common prefix of the file names, less trailing digits
+[~,name,~] = fileparts(fname{1});
+for i = 2:length(fname)
+    [~,n,~] = fileparts(fname{i});
+    m = min(length(name),length(n));
+    k = find(name(1:m) ~= n(1:m),1);
+    if isempty(k); k = m+1; end
+    name = name(1:k-1);
+end
+name = regexprep(name,'[\d_]*$','');
+if isempty(name); name = 'atlas'; end
+
+% Create output sub-directory if nonexistent
+if not(isfolder(o_dir))
+    mkdir(o_dir);
+end
+
+% Read each frame and convert to rgb565
+img = cell(1,length(fname));
+for i = 1:length(fname)
+    [x,cmap] = imread(fullfile(location,fname{i}));
+
+    % if indexed (colormapped) image, convert to 24-bit RGB
+    if numel(cmap) > 0
+        fprintf('Converting: %s to 24-bit RGB.\n', fname{i});
+        x = uint8(ind2rgb(x,cmap) .* 255);
+    end
+
+    % skip if not in 24-bit RGB format
+    if size(x,3) ~= 3 || ~isa(x,'uint8')
+        fprintf(' -- error: %s not in 24-bit RGB format.\n', fname{i});
+        return
+    end
+
+    xr =          bitshift(uint16(bitand(x(:,:,1),0xF8)), 8); % left by 8
+    xr = bitor(xr,bitshift(uint16(bitand(x(:,:,2),0xFC)), 3)); % left by 3
+    xr = bitor(xr,bitshift(uint16(bitand(x(:,:,3),0xF8)),-3)); % right by 3
+    img{i} = xr;
+end
+
+% Pack frames left to right on shelves no wider than o_max_w
+fx = zeros(1,length(img)); fy = fx; fw = fx; fh = fx;
+sx = 0; sy = 0; sh = 0; aw = 0;
+for i = 1:length(img)
+    fw(i) = size(img{i},2); fh(i) = size(img{i},1);
+    if sx > 0 && sx + fw(i) > o_max_w
+        sx = 0; sy = sy + sh; sh = 0;
+    end
+    fx(i) = sx; fy(i) = sy;
+    sx = sx + fw(i); sh = max(sh,fh(i)); aw = max(aw,sx);
+end
+ah = sy + sh;
+
+% Copy frames into the atlas image
+a = zeros(ah,aw,'uint16');
+for i = 1:length(img)
+    a(fy(i)+1:fy(i)+fh(i),fx(i)+1:fx(i)+fw(i)) = img{i};
+end
+figure, imshow(a ~= 0);
+
+% Frame table in animation order
+seq = 1:length(img);
+if o_pingpong && length(img) > 2
+    seq = [seq, length(img)-1:-1:2];
+end
+
+% flatten matrix (row-wise) to a vector
+ar = reshape(a.',[],1);
+
+% save data to file in a 'C' array
+atlas2c(ar,o_dir,name,aw,ah,o_bits,[fx(seq);fy(seq);fw(seq);fh(seq)],o_ms);
+
+% Given a MATLAB array of rgb565 atlas pixels, create a 'C' sprite atlas.
+%   x: MATLAB array of integer data
+%   path: directory path to create 'C' file
+%   name: prefix of 'C' arrays and also files with .h and .c extension
+%   w: atlas image width
+%   h: atlas image height
+%   bits: output image bits per pixel (1: non-zero pixels are set bits)
+%   fr: frame table, one column [x;y;w;h] per frame
+%   ms: display time of each frame in milliseconds
+function atlas2c(x,path,name,w,h,bits,fr,ms)
+    str = upper(name);
+    if bits == 1
+        elem = ceil(w/8); % array elements per line
+        t_type = "uint8_t";
+    else
+        elem = w;
+        t_type = "uint16_t";
+    end
+    len = elem*h;
+
+    %%%%%%%%%%%%%%%%%%%% Write .h File %%%%%%%%%%%%%%%%%%%%
+    fid_h = fopen(fullfile(path,name+".h"), 'w');
+    fprintf(fid_h, "\n#include <stdint.h>\n#include ""lcd.h""\n\n");
+    fprintf(fid_h, "#define %s_BITS_PER_PIXEL %u\n", str, bits);
+    fprintf(fid_h, "#define %s_LENGTH %u\n", str, len);
+    fprintf(fid_h, "#define %s_FRAMES %u\n", str, size(fr,2));
+    fprintf(fid_h, "#define %s_W %u\n", str, max(fr(3,:)));
+    fprintf(fid_h, "#define %s_H %u\n\n", str, max(fr(4,:)));
+    fprintf(fid_h, "extern const %s %s_image[%s_LENGTH];\n", t_type, name, str);
+    fprintf(fid_h, "extern const lcd_frame_t %s_frame[%s_FRAMES];\n", name, str);
+    fprintf(fid_h, "extern const lcd_atlas_t %s_atlas;\n", name);
+    fclose(fid_h);
+
+    %%%%%%%%%%%%%%%%%%%% Write .c File %%%%%%%%%%%%%%%%%%%%
+    fid_c = fopen(fullfile(path,name+".c"), 'w');
+
+    fprintf(fid_c, "\n#include ""%s.h""\n\n", name);
+    fprintf(fid_c, "const %s %s_image[] = {\n", t_type, name); % start array
+    for j = 0:h-1
+        for i = 0:elem-1
+            if bits == 1
+                tmp = 0;
+                for b = 1:8
+                    if (i*8+b <= w); pval = x(j*w+i*8+b); else; pval = 0; end
+                    if (pval == 0); tmp = bitshift(tmp,1);
+                    else; tmp = bitor(1,bitshift(tmp,1)); end
+                end
+                fprintf(fid_c, " 0x%02x,", tmp);
+            else
+                fprintf(fid_c, " 0x%04x,", x(j*w+i+1));
+            end
+        end
+        fprintf(fid_c, "\n");
+    end
+    fprintf(fid_c, "};\n\n"); % end array
+
+    fprintf(fid_c, "const lcd_frame_t %s_frame[] = {\n", name);
+    for i = 1:size(fr,2)
+        fprintf(fid_c, "\t{%3u, %3u, %3u, %3u, %u},\n", fr(:,i), ms);
+    end
+    fprintf(fid_c, "};\n\n");
+
+    fprintf(fid_c, "const lcd_atlas_t %s_atlas = {\n", name);
+    fprintf(fid_c, "\t.image = %s_image,\n", name);
+    fprintf(fid_c, "\t.w = %u,\n\t.h = %u,\n\t.bpp = %u,\n", w, h, bits);
+    fprintf(fid_c, "\t.frames = %s_FRAMES,\n", str);
+    fprintf(fid_c, "\t.frame = %s_frame,\n", name);
+    fprintf(fid_c, "};\n");
+    fclose(fid_c);
+end
@@ -1,10 +1,13 @@
 
 #include <stdint.h>
+#include "lcd.h"
 
-#define PAC_SPRITES 3
 #define PAC_BITS_PER_PIXEL 1
-#define PAC_LENGTH 128
+#define PAC_LENGTH 384
+#define PAC_FRAMES 4
 #define PAC_W 32
 #define PAC_H 32
 
-extern const uint8_t *pac[PAC_SPRITES];
+extern const uint8_t pac_image[PAC_LENGTH];
+extern const lcd_frame_t pac_frame[PAC_FRAMES];
+extern const lcd_atlas_t pac_atlas;
@@ -27,17 +27,18 @@ static const char *TAG = "lab01";
 #define CAR_W 60
 #define CAR_H 32
 
-// body constants
-#define BODY_X0 0
-#define BODY_Y0 12
-#define BODY_X1 59
-#define BODY_Y1 24
-
-// upper constants
-#define UPPER_X0 1
-#define UPPER_Y0 0
-#define UPPER_X1 39
-#define UPPER_Y1 11
+// body outline constants (upper body, hood, and lower body as one polygon)
+#define BODY_N 8
+static const coord_t body_xy[BODY_N*2] = {
+	 1,  0,
+	40,  0,
+	40,  9,
+	60, 12,
+	60, 25,
+	 0, 25,
+	 0, 12,
+	 1, 12,
+};
 
 // wheel constants
 #define L_WHEEL_X 11
@@ -47,14 +48,6 @@ static const char *TAG = "lab01";
 #define HUB_RAD 4
 #define TIRE_RAD 7
 
-// hood constants
-#define HOOD_X0 40
-#define HOOD_Y0 9
-#define HOOD_X1 40
-#define HOOD_Y1 11
-#define HOOD_X2 59
-#define HOOD_Y2 11
-
 // window constants
 #define L_WINDOW_X0 3
 #define L_WINDOW_Y0 1
@@ -74,16 +67,18 @@ static const char *TAG = "lab01";
  */
 void drawCar(coord_t x, coord_t y)
 {
-	// upper & lower body rectangles
-	lcd_fillRect2(x + UPPER_X0, y + UPPER_Y0, x + UPPER_X1, y + UPPER_Y1, CAR_CLR);
-	lcd_fillRect2(x + BODY_X0, y + BODY_Y0, x + BODY_X1, y + BODY_Y1, CAR_CLR);
+	// upper body, hood & lower body outline in one pass
+	coord_t xy[BODY_N*2];
+	for (uint8_t i = 0; i < BODY_N; i++) {
+		xy[2*i  ] = x + body_xy[2*i  ];
+		xy[2*i+1] = y + body_xy[2*i+1];
+	}
+	lcd_fillPolygon(xy, BODY_N, CAR_CLR);
 	// wheels
 	lcd_fillCircle(x + L_WHEEL_X, y + L_WHEEL_Y, TIRE_RAD, TIRE_CLR);
 	lcd_fillCircle(x + L_WHEEL_X, y + L_WHEEL_Y, HUB_RAD, HUB_CLR);
 	lcd_fillCircle(x + R_WHEEL_X, y + R_WHEEL_Y, TIRE_RAD, TIRE_CLR);
 	lcd_fillCircle(x + R_WHEEL_X, y + R_WHEEL_Y, HUB_RAD, HUB_CLR);
-	// hood
-	lcd_fillTriangle(x + HOOD_X0, y + HOOD_Y0, x + HOOD_X1, y + HOOD_Y1, x + HOOD_X2, y + HOOD_Y2, CAR_CLR);
 	// windows
 	lcd_fillRoundRect2(x + L_WINDOW_X0, y + L_WINDOW_Y0, x + L_WINDOW_X1, y + L_WINDOW_Y1, WINDOW_RAD, WINDOW_CLR);
 	lcd_fillRoundRect2(x + R_WINDOW_X0, y + R_WINDOW_Y0, x + R_WINDOW_X1, y + R_WINDOW_Y1, WINDOW_RAD, WINDOW_CLR);
@@ -191,19 +186,25 @@ void app_main(void)
 	// Exercise 5 - Draw an animated Pac-Man moving across the display.
 	// Use Pac-Man sprites instead of the car object.
 	// Cycle through each sprite when moving the Pac-Man character.
-	const uint8_t pidx[] = {0, 1, 2, 1};
+	// The sprites are packed in one atlas whose frame table holds the
+	// 0, 1, 2, 1 sequence and how long each frame is shown.
+	lcd_anim_t anim;
+	lcd_animInit(&anim, &pac_atlas);
+	TickType_t last = xTaskGetTickCount();
 	lcd_frameEnable();
 	// infinite pac man loop
 	for (;;) 
 	{
-		uint16_t i = 0;
 		// vary x coord of pac man
 		for (coord_t x = -PAC_W; x <= LCD_W; x += OBJ_MOVE) 
 		{
-			// draw pac man using bitmap
+			TickType_t now = xTaskGetTickCount();
+			lcd_animTick(&anim, pdTICKS_TO_MS(now - last));
+			last = now;
+			// draw pac man using current atlas frame
 			lcd_fillScreen(BACKGROUND_CLR);
 			lcd_drawString(0, 0, "Exercise 5", TITLE_CLR);
-			lcd_drawBitmap(x, OBJ_Y, pac[pidx[i++ % sizeof(pidx)]], PAC_W, PAC_H, YELLOW);
+			lcd_animDraw(x, OBJ_Y, &anim, YELLOW);
 			lcd_fillRect(0, LCD_H - FONT_H, FONT_W * STR_BUF_LEN, LCD_H, BACKGROUND_CLR);
 			sprintf(str, "%3ld", x);
 			lcd_drawString(0, LCD_H - FONT_H, str, STATUS_CLR);
@@ -49,12 +49,20 @@ typedef enum {SINE_T, SQUARE_T, TRIANGLE_T, SAW_T, LAST_T} tone_t;
 #define tone_set_volume(vol)
 #define tone_start(tone,freq)
 #define sound_start(audio,size,wait)
+#define sound_synth_start(voice,wave,freq,vol,adsr,prio)
+#define sound_synth_freq(voice,freq,glide_ms)
+#define sound_synth_release(voice)
+#define sound_stop_voice(voice)
 #endif // MILESTONE
 
 #define VOL_INC 20 // %
 #define SAMPLE_RATE POWERUP_SAMPLE_RATE // Hz
 #define VOLUME_DEFAULT (VOL_INC*3) // %
 
+#define SAMPLE_VOICE 0 // Mixer voice of sound_start()
+#define SYNTH_VOICE 1 // Mixer voice of the joystick tone
+#define GLIDE_MS UP_PER // Pitch slide time between updates
+
 // Musical note frequencies
 #define A3 220
 #define A4 440
@@ -84,6 +92,12 @@ coord_t dcx, dcy;
 uint32_t vol;
 tone_t tone;
 
+#if MILESTONE == 2
+static const sound_adsr_t tone_env = {
+	.attack = 5, .decay = 50, .sustain = 80, .release = 30,
+};
+#endif // MILESTONE
+
 // Draw the cursor on the display
 void cursor(coord_t x, coord_t y, color_t color)
 {
@@ -115,24 +129,25 @@ void draw_tone_status(void)
 void draw_waveform(void)
 {
 #if MILESTONE == 2
-	extern const uint8_t *abase;
-	extern volatile uint32_t asize;
-	#define WAVE_MAX ((1 << (sizeof(abase[0])*8))-1) // Maximum value
-	float scalex = (float)(WAVE_W/2)/(asize);
+	// tone_t and sound_wave_t list the waveforms in the same order
+	const int8_t *wave = sound_synth_table((sound_wave_t)tone);
+	#define WAVE_MAX UINT8_MAX // Maximum value
+	float scalex = (float)(WAVE_W/2)/(SOUND_WAVE_LEN);
 	float scaley = (float)(WAVE_H-1)/WAVE_MAX;
 	#define W2X(val) ((coord_t)((val) * scalex + 0.5f) + WAVE_X)
-	#define W2Y(val) ((WAVE_Y+WAVE_H-1) - (coord_t)((val) * scaley + 0.5f))
+	#define W2Y(val) ((WAVE_Y+WAVE_H-1) - (coord_t)(((val)-INT8_MIN) * scaley + 0.5f))
 
+	if (wave == NULL) return;
 	coord_t x0 = W2X(-1);
-	coord_t y0 = W2Y(abase[asize-1]);
-	coord_t x2 = (coord_t)(asize * scalex + 0.5f);
+	coord_t y0 = W2Y(wave[SOUND_WAVE_LEN-1]);
+	coord_t x2 = (coord_t)(SOUND_WAVE_LEN * scalex + 0.5f);
 	lcd_drawHLine(WAVE_X, WAVE_Y, WAVE_W, WAVE_MARK_CL);
 	lcd_drawHLine(WAVE_X, WAVE_Y+WAVE_H-1, WAVE_W, WAVE_MARK_CL);
 	lcd_drawVLine(WAVE_X, WAVE_YC-WAVE_MARK_H/2, WAVE_MARK_H, WAVE_MARK_CL);
 	lcd_drawVLine(WAVE_X+x2, WAVE_YC-WAVE_MARK_H/2, WAVE_MARK_H, WAVE_MARK_CL);
-	for (uint32_t i = 0; i < asize; i++) {
+	for (uint32_t i = 0; i < SOUND_WAVE_LEN; i++) {
 		coord_t x1 = W2X(i);
-		coord_t y1 = W2Y(abase[i]);
+		coord_t y1 = W2Y(wave[i]);
 		lcd_drawPixel(x1, WAVE_YC, WAVE_MARK_CL);
 		lcd_drawPixel(x1+x2, WAVE_YC, WAVE_MARK_CL);
 		lcd_drawLine(x0, y0, x1, y1, WAVE_CL);
@@ -142,6 +157,16 @@ void draw_waveform(void)
 #endif // MILESTONE
 }
 
+#if MILESTONE == 2
+// Convert joystick vertical displacement to a tone frequency in Hz
+static uint32_t joy_freq(coord_t dy)
+{
+	return (dy > 0) ?
+		A4-(dy*A3)/JOY_MAX_DISP :
+		A4-(dy*A4)/JOY_MAX_DISP;
+}
+#endif // MILESTONE
+
 // Update the position of the cursor and play sound if button A or B is pressed
 void update(TimerHandle_t pxTimer)
 {
@@ -155,9 +180,9 @@ void update(TimerHandle_t pxTimer)
 	if (!pressed && btns) { // On button press
 		pressed = true;
 		if (PIN_GET_BIT(btns, HW_BTN_A)) { // Play tone
-			tone_start(tone, (dcy > 0) ?
-				A4-(dcy*A3)/JOY_MAX_DISP :
-				A4-(dcy*A4)/JOY_MAX_DISP);
+			// synthesizer voice: pitch follows the joystick while held
+			sound_synth_start(SYNTH_VOICE, (sound_wave_t)tone, joy_freq(dcy),
+				MAX_VOL, &tone_env, UINT8_MAX);
 			cursor(lx, ly, SBG_CL); // Erase cursor
 			draw_waveform();
 		} else if (PIN_GET_BIT(btns, HW_BTN_B)) { // Play user sound
@@ -169,8 +194,11 @@ void update(TimerHandle_t pxTimer)
 			tone_set_volume(vol);
 		}
 		draw_tone_status();
+	} else if (pressed && PIN_GET_BIT(btns, HW_BTN_A)) { // Bend held tone
+		sound_synth_freq(SYNTH_VOICE, joy_freq(dcy), GLIDE_MS);
 	} else if (pressed && !btns) { // On button release, stop playing sound
-		tone_stop();
+		sound_synth_release(SYNTH_VOICE);
+		sound_stop_voice(SAMPLE_VOICE); // User sound, as tone_stop() did
 		pressed = false;
 		lcd_fillRect(WAVE_X, WAVE_Y, WAVE_W, WAVE_H, SBG_CL); // Erase waveform
 		cursor(lx, ly, CUR_CL); // Redraw cursor
@@ -197,18 +225,8 @@ void app_main(void)
 	ESP_LOGI(TAG, "Start up");
 
 	// Configure I/O pins for buttons
-	pin_reset(HW_BTN_A);
-	pin_input(HW_BTN_A, true);
-	pin_reset(HW_BTN_B);
-	pin_input(HW_BTN_B, true);
-	pin_reset(HW_BTN_MENU);
-	pin_input(HW_BTN_MENU, true);
-	pin_reset(HW_BTN_OPTION);
-	pin_input(HW_BTN_OPTION, true);
-	pin_reset(HW_BTN_SELECT);
-	pin_input(HW_BTN_SELECT, true);
-	pin_reset(HW_BTN_START);
-	pin_input(HW_BTN_START, true);
+	pin_reset_mask(HW_BTN_MASK);
+	pin_input_mask(HW_BTN_MASK, true);
 
 	lcd_init(); // Initialize LCD display and device handle
 	lcd_fillScreen(SBG_CL); // Clear the screen
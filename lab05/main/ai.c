@@ -0,0 +1,261 @@
+#include <stdlib.h> // abs
+
+#include "esp_timer.h"
+
+#include "ai.h"
+#include "config.h"
+
+#define BOARD_R CONFIG_BOARD_R // Rows
+#define BOARD_C CONFIG_BOARD_C // Columns
+#define BOARD_N CONFIG_BOARD_N // Number of contiguous marks
+#define BOARD_SPACES CONFIG_BOARD_SPACES
+
+#define WIN 10000 // Score of a win now, less one for each ply until it
+#define WIN_MIN (WIN - BOARD_SPACES) // Scores beyond +/- this are wins
+#define INF 32000
+#define TT_BITS 11 // Transposition table of 2^TT_BITS entries (24 KB)
+#define TT_SIZE (1 << TT_BITS)
+#define TIME_CHECK 0x7F // Check the time every 128 nodes
+#define LINES_MAX (4*BOARD_SPACES) // Upper bound of windows on the board
+#define NO_MOVE -1
+
+#define CELL_R(i) ((i) / BOARD_C)
+#define CELL_C(i) ((i) % BOARD_C)
+
+typedef enum {TT_EXACT, TT_LOWER, TT_UPPER} tt_flag_t;
+
+typedef struct {
+	uint32_t key;  // Upper hash bits, tells positions in a slot apart
+	int16_t score; // Wins are stored relative to this position
+	int8_t depth;  // Depth searched below this position
+	uint8_t flag;  // tt_flag_t
+	int8_t move;   // Best move (cell index), or NO_MOVE
+} tt_entry_t;
+
+// Tables built by ai_init(), tt is cleared for each game
+static tt_entry_t tt[TT_SIZE];
+static uint64_t zob[2][BOARD_SPACES]; // Hash keys by mark and cell
+static uint64_t zob_side; // Hash key of O to move
+static uint64_t lines[LINES_MAX]; // Every window of BOARD_N cells in a row
+static uint16_t line_n;
+static int8_t order[BOARD_SPACES]; // Cells, nearest the center first
+static int16_t line_score[BOARD_N+1]; // Score of a window by its marks
+
+// Search state
+static uint64_t hash; // Zobrist hash of the position searched
+static uint32_t nodes;
+static int64_t deadline;
+static bool timeout;
+static int8_t root_move;
+static ai_stats_t stats;
+
+
+// Pseudo-random 64-bit numbers for the hash keys (xorshift64).
+static uint64_t ai_rand(void)
+{
+	static uint64_t x = 0x9E3779B97F4A7C15LLU;
+	x ^= x << 13;
+	x ^= x >> 7;
+	x ^= x << 17;
+	return x;
+}
+
+// Play a move on the board and update the hash.
+static inline void ai_play(int8_t m, mark_t mark)
+{
+	board_set(CELL_R(m), CELL_C(m), mark);
+	hash ^= zob[mark-X_m][m] ^ zob_side;
+}
+
+// Take a move back and update the hash.
+static inline void ai_undo(int8_t m, mark_t mark)
+{
+	board_unset(CELL_R(m), CELL_C(m));
+	hash ^= zob[mark-X_m][m] ^ zob_side;
+}
+
+// Convert a score to and from the form kept in the table, where wins count
+// plies from the stored position rather than from the root.
+static inline int16_t tt_to(int16_t s, int16_t ply)
+{
+	return (s > WIN_MIN) ? s + ply : (s < -WIN_MIN) ? s - ply : s;
+}
+
+static inline int16_t tt_from(int16_t s, int16_t ply)
+{
+	return (s > WIN_MIN) ? s - ply : (s < -WIN_MIN) ? s + ply : s;
+}
+
+// Score a position for the side with marks mine. Each window of BOARD_N
+// cells that only one side has marks in counts for that side.
+static int16_t ai_eval(uint64_t mine, uint64_t theirs)
+{
+	int32_t s = 0;
+
+	for (uint16_t i = 0; i < line_n; i++) {
+		uint64_t w = lines[i];
+		if (!(w & theirs)) s += line_score[__builtin_popcountll(w & mine)];
+		else if (!(w & mine)) s -= line_score[__builtin_popcountll(w & theirs)];
+	}
+	if (s > WIN_MIN-1) s = WIN_MIN-1;
+	else if (s < -(WIN_MIN-1)) s = -(WIN_MIN-1);
+	return s;
+}
+
+// Negamax search with alpha-beta pruning.
+// me: mark to move.
+// depth: plies left to search.
+// ply: plies from the root.
+// Return the score of the position for me.
+static int16_t ai_search(mark_t me, int16_t depth, int16_t ply, int16_t alpha, int16_t beta)
+{
+	mark_t you = (me == X_m) ? O_m : X_m;
+
+	if (!(++nodes & TIME_CHECK) && esp_timer_get_time() >= deadline) timeout = true;
+	if (timeout) return 0;
+	if (board_winner(you)) return -(WIN - ply); // the last move won
+	if (board_mark_count() >= BOARD_SPACES) return 0; // draw
+	if (depth <= 0) return ai_eval(board_bits(me), board_bits(you));
+
+	tt_entry_t *e = tt + (hash & (TT_SIZE-1));
+	uint32_t key = hash >> 32;
+	int8_t tt_move = NO_MOVE;
+	if (e->key == key) {
+		tt_move = e->move;
+		if (e->depth >= depth && ply) {
+			int16_t s = tt_from(e->score, ply);
+			if (e->flag == TT_EXACT ||
+				(e->flag == TT_LOWER && s >= beta) ||
+				(e->flag == TT_UPPER && s <= alpha))
+				return s;
+		}
+	}
+
+	// Try the table move first, then the cells nearest the center
+	uint64_t empty = ~(board_bits(X_m) | board_bits(O_m));
+	int16_t alpha0 = alpha, best = -INF;
+	int8_t best_move = NO_MOVE;
+	for (int16_t k = -1; k < BOARD_SPACES; k++) {
+		int8_t m = (k < 0) ? tt_move : order[k];
+		if (m == NO_MOVE || (k >= 0 && m == tt_move) || !(empty >> m & 1)) continue;
+		ai_play(m, me);
+		int16_t s = -ai_search(you, depth-1, ply+1, -beta, -alpha);
+		ai_undo(m, me);
+		if (timeout) return 0;
+		if (s > best) {
+			best = s;
+			best_move = m;
+		}
+		if (s > alpha) alpha = s;
+		if (alpha >= beta) break;
+	}
+
+	if (e->key != key || depth >= e->depth)
+		*e = (tt_entry_t){.key = key, .score = tt_to(best, ply),
+			.depth = depth, .move = best_move,
+			.flag = (best <= alpha0) ? TT_UPPER : (best >= beta) ? TT_LOWER : TT_EXACT};
+	if (!ply) root_move = best_move;
+	return best;
+}
+
+// Initialize the computer opponent. Call once before ai_move().
+void ai_init(void)
+{
+	static const int8_t dir[][2] = {{0,1}, {1,0}, {1,1}, {-1,1}};
+
+	ai_new_game();
+	for (int8_t m = 0; m < 2; m++)
+		for (int8_t i = 0; i < BOARD_SPACES; i++) zob[m][i] = ai_rand();
+	zob_side = ai_rand();
+
+	// Windows of BOARD_N cells in each direction
+	line_n = 0;
+	for (int16_t i = 0; i < BOARD_SPACES; i++)
+		for (uint16_t d = 0; d < sizeof(dir)/sizeof(dir[0]); d++) {
+			int16_t r = CELL_R(i), c = CELL_C(i);
+			int16_t er = r + dir[d][0]*(BOARD_N-1), ec = c + dir[d][1]*(BOARD_N-1);
+			if (er < 0 || er >= BOARD_R || ec < 0 || ec >= BOARD_C) continue;
+			uint64_t w = 0;
+			for (int16_t n = 0; n < BOARD_N; n++, r += dir[d][0], c += dir[d][1])
+				w |= 1LLU << (r*BOARD_C + c);
+			lines[line_n++] = w;
+		}
+	// A window with more marks is worth four times as much
+	line_score[0] = 0;
+	for (int16_t k = 1; k <= BOARD_N; k++)
+		line_score[k] = (k == 1) ? 1 : line_score[k-1] * 4;
+
+	// Cells in order of distance from the center (insertion sort)
+	for (int8_t i = 0; i < BOARD_SPACES; i++) {
+		int16_t dr = 2*CELL_R(i) - (BOARD_R-1), dc = 2*CELL_C(i) - (BOARD_C-1);
+		int16_t dist = dr*dr + dc*dc;
+		int8_t j = i;
+		for (; j > 0; j--) {
+			int16_t pr = 2*CELL_R(order[j-1]) - (BOARD_R-1);
+			int16_t pc = 2*CELL_C(order[j-1]) - (BOARD_C-1);
+			if (pr*pr + pc*pc <= dist) break;
+			order[j] = order[j-1];
+		}
+		order[j] = i;
+	}
+}
+
+// Forget the positions searched in the last game. Call when a new game
+// starts, so table entries of the old game are not taken for the new one.
+void ai_new_game(void)
+{
+	for (uint32_t i = 0; i < TT_SIZE; i++) tt[i] = (tt_entry_t){.move = NO_MOVE};
+}
+
+// Find a move for a mark on the current board.
+// mark: mark type to play.
+// budget_us: time allowed for the search in microseconds.
+// *r: pointer to the row of the move.
+// *c: pointer to the column of the move.
+// Return true if a move was found, or false if the board is full.
+bool ai_move(mark_t mark, uint32_t budget_us, int8_t *r, int8_t *c)
+{
+	int64_t start = esp_timer_get_time();
+	int16_t left = BOARD_SPACES - board_mark_count();
+	uint64_t empty = ~(board_bits(X_m) | board_bits(O_m));
+	int8_t move = NO_MOVE;
+
+	stats = (ai_stats_t){0};
+	if (left <= 0) return false;
+	// Until a search finishes, play the free cell nearest the center
+	for (int16_t k = 0; k < BOARD_SPACES && move == NO_MOVE; k++)
+		if (empty >> order[k] & 1) move = order[k];
+
+	hash = (mark == O_m) ? zob_side : 0;
+	for (int8_t i = 0; i < BOARD_SPACES; i++)
+		for (mark_t m = X_m; m <= O_m; m++)
+			if (board_bits(m) >> i & 1) hash ^= zob[m-X_m][i];
+	nodes = 0;
+	timeout = false;
+	root_move = NO_MOVE; // not a move of the last call
+	deadline = start + budget_us;
+
+	// Iterative deepening: each finished depth fills the table with the
+	// move order for the next
+	for (int16_t d = 1; d <= left; d++) {
+		int16_t s = ai_search(mark, d, 0, -INF, INF);
+		if (timeout) break;
+		if (root_move != NO_MOVE) move = root_move;
+		stats.depth = d;
+		stats.score = s;
+		if (abs(s) > WIN_MIN) break; // forced win or loss found
+	}
+
+	stats.nodes = nodes;
+	stats.time_us = esp_timer_get_time() - start;
+	*r = CELL_R(move);
+	*c = CELL_C(move);
+	return true;
+}
+
+// Get the search statistics of the last call to ai_move().
+// *st: pointer to the statistics.
+void ai_get_stats(ai_stats_t *st)
+{
+	*st = stats;
+}
@@ -0,0 +1,43 @@
+#ifndef AI_H_
+#define AI_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "board.h"
+
+// Computer opponent. A negamax search with alpha-beta pruning looks ahead
+// from the current board (board.c) one ply deeper at a time (iterative
+// deepening) until its time budget runs out, and plays the best move of
+// the deepest search that finished. Positions already searched are kept
+// in a fixed-size transposition table, indexed by a Zobrist hash, whose
+// best moves are tried first in the next, deeper search.
+
+// Search statistics of the last call to ai_move()
+typedef struct {
+	uint32_t nodes;   // Positions searched
+	uint32_t time_us; // Time searched
+	int16_t depth;    // Deepest search finished, in plies
+	int16_t score;    // Score of the move for the side that played it
+} ai_stats_t;
+
+// Initialize the computer opponent. Call once before ai_move().
+void ai_init(void);
+
+// Forget the positions searched in the last game. Call when a new game
+// starts, so table entries of the old game are not taken for the new one.
+void ai_new_game(void);
+
+// Find a move for a mark on the current board.
+// mark: mark type to play.
+// budget_us: time allowed for the search in microseconds.
+// *r: pointer to the row of the move.
+// *c: pointer to the column of the move.
+// Return true if a move was found, or false if the board is full.
+bool ai_move(mark_t mark, uint32_t budget_us, int8_t *r, int8_t *c);
+
+// Get the search statistics of the last call to ai_move().
+// *st: pointer to the statistics.
+void ai_get_stats(ai_stats_t *st);
+
+#endif // AI_H_
@@ -6,78 +6,100 @@
 #define BOARD_N CONFIG_BOARD_N // Number of contiguous marks
 #define BOARD_SPACES CONFIG_BOARD_SPACES
 
-static mark_t board[BOARD_R][BOARD_C];
+_Static_assert(BOARD_SPACES <= 64, "board must fit in a 64-bit bitboard");
+
+// Each player's marks are a bitboard, bit r*BOARD_C+c for location (r,c).
+// A win can only come from the mark just placed, so board_set() checks the
+// four lines through it and board_winner() returns the result.
+#define BIT(r,c) (1LLU << ((r)*BOARD_C + (c)))
+
+static uint64_t marks[O_m+1]; // Bitboard per mark type, no_m unused
+static bool won[O_m+1]; // Mark type has BOARD_N contiguous marks
 static uint16_t mark_count;
 
 
+// Count the marks of a bitboard from (r,c) in direction (dr,dc),
+// not counting (r,c) itself. Stops at BOARD_N-1.
+static int16_t board_run(uint64_t b, int16_t r, int16_t c, int16_t dr, int16_t dc)
+{
+	int16_t n = 0;
+	for (r += dr, c += dc; n < BOARD_N-1 &&
+		r >= 0 && r < BOARD_R && c >= 0 && c < BOARD_C &&
+		(b & BIT(r, c)); r += dr, c += dc)
+		n++;
+	return n;
+}
+
+// Check the lines (-, |, /, \) through (r,c) for BOARD_N contiguous marks.
+static bool board_line(uint64_t b, int8_t r, int8_t c)
+{
+	static const int8_t dir[][2] = {{0,1}, {1,0}, {-1,1}, {1,1}};
+	for (uint16_t i = 0; i < sizeof(dir)/sizeof(dir[0]); i++) {
+		int16_t dr = dir[i][0], dc = dir[i][1];
+		if (1 + board_run(b, r, c, dr, dc) + board_run(b, r, c, -dr, -dc) >= BOARD_N)
+			return true;
+	}
+	return false;
+}
+
 // Clear the board
 void board_clear(void)
 {
-	for (int8_t r = 0; r < BOARD_R; r++)
-		for (int8_t c = 0; c < BOARD_C; c++)
-			board[r][c] = no_m;
+	for (mark_t m = no_m; m <= O_m; m++) {
+		marks[m] = 0;
+		won[m] = false;
+	}
 	mark_count = 0;
 }
 
 // Get mark at board location
 mark_t board_get(int8_t r, int8_t c)
 {
-	return board[r][c];
+	uint64_t bit = BIT(r, c);
+	if (marks[X_m] & bit) return X_m;
+	if (marks[O_m] & bit) return O_m;
+	return no_m;
 }
 
 // If location empty, set the mark and return true, otherwise return false.
 bool board_set(int8_t r, int8_t c, mark_t mark)
 {
-	if (board[r][c] == no_m) {
-		board[r][c] = mark;
-		mark_count++;
-		return true;
-	} else return false;
+	uint64_t bit = BIT(r, c);
+	if ((marks[X_m] | marks[O_m]) & bit) return false;
+	if (mark != X_m && mark != O_m) return true; // no_m leaves it empty
+	marks[mark] |= bit;
+	mark_count++;
+	if (!won[mark]) won[mark] = board_line(marks[mark], r, c);
+	return true;
+}
+
+// Remove the mark at a board location, e.g. to undo a move.
+// The winner state is found again from the remaining marks.
+void board_unset(int8_t r, int8_t c)
+{
+	uint64_t bit = BIT(r, c);
+	for (mark_t m = X_m; m <= O_m; m++) {
+		if (!(marks[m] & bit)) continue;
+		marks[m] &= ~bit;
+		mark_count--;
+		if (!won[m]) break; // removing a mark cannot make a win
+		won[m] = false;
+		for (int8_t i = 0; i < BOARD_R && !won[m]; i++)
+			for (int8_t j = 0; j < BOARD_C && !won[m]; j++)
+				if (marks[m] & BIT(i, j)) won[m] = board_line(marks[m], i, j);
+	}
+}
+
+// Get the bitboard of a mark type, bit r*CONFIG_BOARD_C+c for (r,c).
+uint64_t board_bits(mark_t mark)
+{
+	return (mark == X_m || mark == O_m) ? marks[mark] : 0;
 }
 
 // Check if mark type is a winner.
 bool board_winner(mark_t mark)
 {
-	int16_t r; // Row
-	int16_t c; // Column
-	int16_t n; // Contiguous marks
-	int16_t d; // Diagonal (can be row or column)
-
-	// Horizontal (-) cases
-	for (r = 0; r < BOARD_R; r++)
-		for (c = 0, n = 0; c < BOARD_C; c++)
-			if (board[r][c] == mark) {
-				if (++n == BOARD_N) return true;
-			} else n = 0;
-	// Vertical (|) cases
-	for (c = 0; c < BOARD_C; c++)
-		for (r = 0, n = 0; r < BOARD_R; r++)
-			if (board[r][c] == mark) {
-				if (++n == BOARD_N) return true;
-			} else n = 0;
-	// Diagonal up (/) cases
-	for (d = 0; d < BOARD_R; d++)
-		for (r = d, c = 0, n = 0; r >= 0 && c < BOARD_C; r--, c++)
-			if (board[r][c] == mark) {
-				if (++n == BOARD_N) return true;
-			} else n = 0;
-	for (d = 1; d < BOARD_C; d++)
-		for (r = BOARD_R-1, c = d, n = 0; r >= 0 && c < BOARD_C; r--, c++)
-			if (board[r][c] == mark) {
-				if (++n == BOARD_N) return true;
-			} else n = 0;
-	// Diagonal down (\) cases
-	for (d = 0; d < BOARD_R; d++)
-		for (r = d, c = BOARD_C-1, n = 0; r >= 0 && c >= 0; r--, c--)
-			if (board[r][c] == mark) {
-				if (++n == BOARD_N) return true;
-			} else n = 0;
-	for (d = BOARD_C-2; d >= 0; d--)
-		for (r = BOARD_R-1, c = d, n = 0; r >= 0 && c >= 0; r--, c--)
-			if (board[r][c] == mark) {
-				if (++n == BOARD_N) return true;
-			} else n = 0;
-	return false;
+	return (mark == X_m || mark == O_m) && won[mark];
 }
 
 // Get a count of marks in the board.
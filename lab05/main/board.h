@@ -19,6 +19,12 @@ mark_t board_get(int8_t r, int8_t c);
 // If location empty, set the mark and return true, otherwise return false.
 bool board_set(int8_t r, int8_t c, mark_t mark);
 
+// Remove the mark at a board location, e.g. to undo a move.
+void board_unset(int8_t r, int8_t c);
+
+// Get the bitboard of a mark type, bit r*CONFIG_BOARD_C+c for (r,c).
+uint64_t board_bits(mark_t mark);
+
 // Check if mark type is a winner.
 bool board_winner(mark_t mark);
 
@@ -2,6 +2,8 @@
 #include "pin.h"
 #include "com.h"
 
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
 #include "driver/uart.h"
 #include "driver/gpio.h"
 #include "sdkconfig.h"
@@ -14,6 +16,31 @@
 #define TX HW_EX8
 #define RX HW_EX7
 
+#define RX_BUF_SZ 1024 // Room for many frames between reads
+#define TX_BUF_SZ 512 // Writes are copied here and sent by the driver
+#define EVENT_QUEUE_LEN 16
+
+static QueueHandle_t uart_queue; // UART driver events (data, overflow)
+
+// Take the UART events waiting, so the queue never fills and an overflow
+// is not missed. Only the first event may be waited for.
+// wait: ticks to wait for the first event.
+// Return true if received data was lost, then the input is flushed.
+static bool com_events(TickType_t wait) {
+    uart_event_t event;
+    bool lost = false;
+
+    while (xQueueReceive(uart_queue, &event, wait) == pdTRUE) {
+        wait = 0;
+        if (event.type == UART_FIFO_OVF || event.type == UART_BUFFER_FULL) lost = true;
+    }
+    if (lost) { // data lost, start over
+        uart_flush_input(UART_PORT);
+        xQueueReset(uart_queue);
+    }
+    return lost;
+}
+
 // Initialize the communication channel.
 // Return zero if successful, or non-zero otherwise.
 int32_t com_init(void) {
@@ -33,9 +60,9 @@ int32_t com_init(void) {
     // Set UART pins(TX: HW_EX8, RX: HW_EX8, RTS & CTS not used)
     ESP_ERROR_CHECK(uart_set_pin(UART_PORT, TX, RX, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE));
 
-    // Install the driver
-    const uint32_t rx_buffer_size = UART_HW_FIFO_LEN(PORT_NUM)*2;
-    ESP_ERROR_CHECK(uart_driver_install(UART_PORT, rx_buffer_size, 0, 0, NULL, 0));
+    // Install the driver with an event queue, see com_wait()
+    ESP_ERROR_CHECK(uart_driver_install(UART_PORT, RX_BUF_SZ, TX_BUF_SZ,
+        EVENT_QUEUE_LEN, &uart_queue, 0));
     // pull up pin 7
     pin_pullup(HW_EX7, true);
 
@@ -56,14 +83,33 @@ int32_t com_deinit(void) {
 // size: size of data in bytes to write
 // Return number of bytes written, or negative number if error.
 int32_t com_write(const void *buf, uint32_t size) {
-    // fn will not wait and returns num bytes written
-    return uart_tx_chars(UART_PORT, buf, size);
+    // copies to the TX buffer, only waits if the buffer is full
+    return uart_write_bytes(UART_PORT, buf, size);
 }
 
 // Read data from the communication channel. Does not wait for data.
+// Takes the UART events too, for users that never call com_wait().
 // *buf: pointer to data buffer
 // size: size of data in bytes to read
-// Return number of bytes read, or negative number if error.
+// Return number of bytes read, or negative number if error or if
+// received data was lost.
 int32_t com_read(void *buf, uint32_t size) {
+    if (com_events(0)) return -1;
     return uart_read_bytes(UART_PORT, buf, size, 0);
-}
\ No newline at end of file
+}
+
+// Wait for data to arrive on the communication channel. Blocks the
+// calling task on the UART event queue, so no time is spent polling.
+// ms: time to wait in milliseconds.
+// Return number of bytes waiting to be read, zero on time out,
+// or negative number if received data was lost.
+int32_t com_wait(uint32_t ms) {
+    size_t len = 0;
+
+    if (com_events(0)) return -1;
+    uart_get_buffered_data_len(UART_PORT, &len);
+    if (len) return len;
+    if (com_events(pdMS_TO_TICKS(ms))) return -1;
+    uart_get_buffered_data_len(UART_PORT, &len);
+    return len;
+}
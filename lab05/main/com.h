@@ -26,7 +26,15 @@ int32_t com_write(const void *buf, uint32_t size);
 // Read data from the communication channel. Does not wait for data.
 // *buf: pointer to data buffer
 // size: size of data in bytes to read
-// Return number of bytes read, or negative number if error.
+// Return number of bytes read, or negative number if error or if
+// received data was lost.
 int32_t com_read(void *buf, uint32_t size);
 
+// Wait for data to arrive on the communication channel. Blocks the
+// calling task, so use from a task other than the game tick.
+// ms: time to wait in milliseconds.
+// Return number of bytes waiting to be read, zero on time out,
+// or negative number if received data was lost.
+int32_t com_wait(uint32_t ms);
+
 #endif // COM_H_
@@ -3,16 +3,36 @@
 
 #define CONFIG_GAME_TIMER_PERIOD 40.0E-3f
 
-// Board
+// Board. The host tests (test/test_board.c) build other sizes.
+#ifndef CONFIG_BOARD_R
 #define CONFIG_BOARD_R 3 // Rows
 #define CONFIG_BOARD_C 3 // Columns
 #define CONFIG_BOARD_N 3 // Number of contiguous marks
 // #define CONFIG_BOARD_R 5 // Rows
 // #define CONFIG_BOARD_C 7 // Columns
 // #define CONFIG_BOARD_N 4 // Number of contiguous marks
+#endif
 
 #define CONFIG_BOARD_SPACES (CONFIG_BOARD_R*CONFIG_BOARD_C)
 
+// Run the game on two boards in lockstep (lockstep component) instead of
+// sending moves (proto.c).
+#define CONFIG_LOCKSTEP 0
+
+// Play one board against the computer instead of another board. The serial
+// link is not used then. Not in lockstep, since the time-boxed search of
+// the computer may pick different moves on each board.
+#define CONFIG_AI 0
+#if CONFIG_AI
+#define CONFIG_AI_MARK O_m // Mark played by the computer
+#else
+#define CONFIG_AI_MARK no_m
+#endif
+
+#if CONFIG_AI && CONFIG_LOCKSTEP
+#error "CONFIG_AI and CONFIG_LOCKSTEP cannot both be set"
+#endif
+
 // Colors
 #define CONFIG_BACK_CLR rgb565(0, 16, 42)
 #define CONFIG_GRID_CLR WHITE
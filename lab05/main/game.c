@@ -6,12 +6,14 @@
 #include "config.h"
 #include "graphics.h"
 #include "nav.h"
-#include "com.h"
+#include "proto.h"
+#include "lockstep.h"
 
 #include "hw.h"
 #include "lcd.h"
 #include "joy.h"
-#include "pin.h"
+#include "button.h"
+#include "ai.h"
 
 #define MSG_NEW_GAME "Welcome to Tic-Tac-Toe! Player X will begin."
 #define MSG_NEXT_PLAYER_X "It is now Player X's turn."
@@ -19,6 +21,10 @@
 #define MSG_WIN_X "Player X wins!"
 #define MSG_WIN_O "Player O wins!"
 #define MSG_DRAW "The game ends in a draw."
+#define MSG_DESYNC "The boards are out of sync!"
+
+// Computer move search time, half of a tick
+#define AI_BUDGET_US ((uint32_t)(CONFIG_GAME_TIMER_PERIOD * 0.5f * 1.0E6f))
 
 void game_init();
 
@@ -34,19 +40,23 @@ void process_mark();
 
 bool check_end_game();
 
+void send_board();
+
+void load_board(const proto_msg_t *msg);
+
 // debug
 static const char *TAG = "lab05";
 
-// uart buffers
-static uint8_t rec_buf = 0;
-static uint8_t send_buf = 0;
+// lockstep input bits
+#define IN_LOC 0x003F // board location, r*CONFIG_BOARD_C+c
+#define IN_A 0x0040
+#define IN_START 0x0080
 
-// buffer control
-#define BUF_SHIFT 4
-#define R_HEX 0xF0
-#define C_HEX 0x0F
+#if CONFIG_LOCKSTEP
+static bool desync_shown; // desync message drawn
+#endif // CONFIG_LOCKSTEP
 
-// track if a command has been received via uart
+// track if a move has been received via uart
 static int8_t r_rec;
 static int8_t c_rec;
 static bool rec_flag = false;
@@ -73,10 +83,51 @@ static enum game_st_t current_state;
 // Initialize the state machine
 void game_init() {
     current_state = init_st;
+    ai_init();
 }
 
 // Tick function
 void game_tick() {
+    // Read the button presses since the last tick
+    bool press_a = false, press_start = false;
+    button_event_t ev;
+    while (button_get(&ev)) {
+        if (ev.type != BUTTON_PRESS) continue;
+        if (ev.pin == HW_BTN_A) press_a = true;
+        else if (ev.pin == HW_BTN_START) press_start = true;
+    }
+
+#if CONFIG_LOCKSTEP
+    // Run the tick only when the inputs of both boards are here. Presses
+    // are kept until then. Both boards act on the same inputs, player 0
+    // plays X and player 1 plays O.
+    static bool hold_a, hold_start;
+    lockstep_input_t in[LOCKSTEP_PLAYERS];
+    int8_t lr, lc;
+    hold_a |= press_a;
+    hold_start |= press_start;
+    nav_get_loc(&lr, &lc);
+    lockstep_input_t local = (lr * CONFIG_BOARD_C + lc) |
+        (hold_a ? IN_A : 0) | (hold_start ? IN_START : 0);
+    if (!lockstep_tick(local, in)) return; // wait for the other board
+    if (lockstep_restarted()) { // the other board restarted, start over
+        current_state = init_st;
+        rec_flag = false;
+        desync_shown = false;
+    }
+    hold_a = hold_start = false;
+    press_a = press_start = false;
+    for (uint8_t p = 0; p < LOCKSTEP_PLAYERS; p++) {
+        if (in[p] & IN_START) press_start = true;
+        if ((in[p] & IN_A) && current_turn == (p ? O_m : X_m)) {
+            press_a = true; // made at the location of that player
+            rec_flag = true;
+            r_rec = (in[p] & IN_LOC) / CONFIG_BOARD_C;
+            c_rec = (in[p] & IN_LOC) % CONFIG_BOARD_C;
+        }
+    }
+#endif // CONFIG_LOCKSTEP
+
     // Transitions
     switch(current_state) {
         case init_st:
@@ -87,30 +138,62 @@ void game_tick() {
             graphics_drawMessage(MSG_NEW_GAME, CONFIG_MESS_CLR, CONFIG_BACK_CLR);
             break;
         case wait_mark_st:
+#if CONFIG_AI
+            // let the computer make its mark
+            if (current_turn == CONFIG_AI_MARK) {
+                if (ai_move(current_turn, AI_BUDGET_US, &r_rec, &c_rec)) {
+                    ai_stats_t st;
+                    ai_get_stats(&st);
+                    ESP_LOGI(TAG, "AI depth %d score %d nodes %lu time %lu us",
+                        st.depth, st.score, (unsigned long)st.nodes, (unsigned long)st.time_us);
+                    rec_flag = true;
+                    if (check_valid_mark()) {
+                        current_state = mark_st;
+                        break;
+                    }
+                    rec_flag = false;
+                }
+                break;
+            }
+#endif // CONFIG_AI
             // make a mark if A is pressed
-            if (!pin_get_level(HW_BTN_A)) { // A press
+            if (press_a) { // A press
                 ESP_LOGI(TAG, "A pressed!");
                 if (check_valid_mark()) { // validate & send
                     ESP_LOGI(TAG, "Press is valid!");
-                    send_buf = (r << BUF_SHIFT) + (c & C_HEX);
-                    com_write(&send_buf, sizeof(send_buf)); // send loc
+#if !CONFIG_AI && !CONFIG_LOCKSTEP
+                    proto_msg_t msg = {.type = PROTO_MOVE, .move = {r, c}};
+                    proto_send(&msg); // send loc
+#endif // CONFIG_AI, CONFIG_LOCKSTEP
                     ESP_LOGI(TAG, "Mark made");
                     current_state = mark_st;
                     break;
                 }
             }
-            // make a mark if a byte is received
-            if (com_read(&rec_buf, sizeof(rec_buf))) {
-                rec_flag = true;
-                ESP_LOGI(TAG, "A received!");
-                r_rec = (rec_buf & R_HEX) >> BUF_SHIFT;
-                c_rec = rec_buf & C_HEX;
-                if (check_valid_mark()) { // same check as local
-                    ESP_LOGI(TAG, "Received is valid!");
-                    current_state = mark_st;
-                    break;
+#if !CONFIG_AI && !CONFIG_LOCKSTEP
+            // make a mark if a move is received
+            proto_msg_t msg;
+            if (proto_get(&msg)) {
+                if (msg.type == PROTO_MOVE) {
+                    rec_flag = true;
+                    ESP_LOGI(TAG, "A received!");
+                    r_rec = msg.move.r;
+                    c_rec = msg.move.c;
+                    if (check_valid_mark()) { // same check as local
+                        ESP_LOGI(TAG, "Received is valid!");
+                        current_state = mark_st;
+                        break;
+                    }
+                    rec_flag = false;
+                    msg.type = PROTO_RESYNC; // boards differ, ask for theirs
+                    proto_send(&msg);
+                } else if (msg.type == PROTO_RESYNC) {
+                    send_board();
+                } else if (msg.type == PROTO_BOARD) {
+                    load_board(&msg);
                 }
             }
+#endif // CONFIG_AI, CONFIG_LOCKSTEP
             current_state = wait_mark_st;
             break;
         case mark_st:
@@ -123,7 +206,7 @@ void game_tick() {
             }
             break;
         case wait_restart_st:
-            if (!pin_get_level(HW_BTN_START)) { // restart game on start press
+            if (press_start) { // restart game on start press
                 current_state = new_game_st;
             } else {
                 current_state = wait_restart_st;
@@ -151,12 +234,29 @@ void game_tick() {
         default:
             printf("Error!");
     }
+
+#if CONFIG_LOCKSTEP
+    // Compare the game state of the boards now and then
+    uint64_t bits[2] = {board_bits(X_m), board_bits(O_m)};
+    uint32_t hash = lockstep_fnv(LOCKSTEP_FNV_INIT, bits, sizeof(bits));
+    hash = lockstep_fnv(hash, &current_turn, sizeof(current_turn));
+    hash = lockstep_fnv(hash, &current_state, sizeof(current_state));
+    lockstep_hash(hash);
+    if (lockstep_desync() && !desync_shown) {
+        graphics_drawMessage(MSG_DESYNC, CONFIG_MESS_CLR, CONFIG_BACK_CLR);
+        desync_shown = true;
+    }
+#endif // CONFIG_LOCKSTEP
 }
 
 // flush buffer, reset display, turn, and set nav to center
 void start_new_game() {
+#if CONFIG_AI
+    ai_new_game();
+#elif !CONFIG_LOCKSTEP
     // flush buffer
-    while (com_read(&rec_buf, sizeof(rec_buf))) {}
+    proto_flush();
+#endif // CONFIG_AI, CONFIG_LOCKSTEP
     // clear board
     board_clear();
     // draw background
@@ -212,4 +312,32 @@ bool check_end_game() {
         return true;
     }
     return false;
-}
\ No newline at end of file
+}
+
+// send the board state to the other board
+void send_board() {
+    proto_msg_t msg = {.type = PROTO_BOARD, .board = {
+        .turn = current_turn, .x = board_bits(X_m), .o = board_bits(O_m)}};
+    proto_send(&msg);
+}
+
+// replace the board with the state of the other board and redraw it
+void load_board(const proto_msg_t *msg) {
+    board_clear();
+    lcd_fillScreen(CONFIG_BACK_CLR);
+    graphics_drawGrid(CONFIG_GRID_CLR);
+    for (int8_t i = 0; i < CONFIG_BOARD_R; i++) {
+        for (int8_t j = 0; j < CONFIG_BOARD_C; j++) {
+            uint64_t bit = 1LLU << (i * CONFIG_BOARD_C + j);
+            if (msg->board.x & bit) {
+                board_set(i, j, X_m);
+                graphics_drawX(i, j, CONFIG_MARK_CLR);
+            } else if (msg->board.o & bit) {
+                board_set(i, j, O_m);
+                graphics_drawO(i, j, CONFIG_MARK_CLR);
+            }
+        }
+    }
+    current_turn = (msg->board.turn == O_m) ? O_m : X_m;
+    graphics_drawMessage(current_turn == X_m ? MSG_NEXT_PLAYER_X : MSG_NEXT_PLAYER_O, CONFIG_MESS_CLR, CONFIG_BACK_CLR);
+}
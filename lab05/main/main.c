@@ -6,11 +6,13 @@
 #include "esp_timer.h"
 
 #include "hw.h"
-#include "pin.h"
+#include "button.h"
 #include "lcd.h"
 #include "nav.h"
 #if MILESTONE == 2
 #include "com.h"
+#include "proto.h"
+#include "lockstep.h"
 #endif // MILESTONE
 #include "graphics.h"
 #include "game.h"
@@ -55,24 +57,18 @@ void app_main(void)
 	lcd_init();
 	lcd_fillScreen(CONFIG_BACK_CLR);
 	CHK_RET(nav_init(PER_MS));
-#if MILESTONE == 2
+#if MILESTONE == 2 && !CONFIG_AI
 	com_init();
+#if CONFIG_LOCKSTEP
+	CHK_RET(lockstep_init(&(lockstep_io_t){com_write, com_read}));
+#else
+	CHK_RET(proto_init(&(proto_io_t){com_write, com_read, com_wait}));
+#endif // CONFIG_LOCKSTEP
 #endif // MILESTONE
 	game_init();
 
-	// Configure I/O pins for buttons
-	pin_reset(HW_BTN_A);
-	pin_input(HW_BTN_A, true);
-	pin_reset(HW_BTN_B);
-	pin_input(HW_BTN_B, true);
-	pin_reset(HW_BTN_MENU);
-	pin_input(HW_BTN_MENU, true);
-	pin_reset(HW_BTN_OPTION);
-	pin_input(HW_BTN_OPTION, true);
-	pin_reset(HW_BTN_SELECT);
-	pin_input(HW_BTN_SELECT, true);
-	pin_reset(HW_BTN_START);
-	pin_input(HW_BTN_START, true);
+	// Buttons send events on edge interrupts, read by game_tick()
+	CHK_RET(button_init(HW_BTN_MASK));
 
 	// Initialize update timer
 	update_timer = xTimerCreate(
@@ -94,7 +90,7 @@ void app_main(void)
 	// Main game loop
 	uint64_t t1, t2, tmax = 0; // For hardware timer values
 	int8_t r, c; // For navigator location
-	while (pin_get_level(HW_BTN_MENU)) // while MENU button not pressed
+	while (!button_down(HW_BTN_MENU)) // while MENU button not pressed
 	{
 		while (!interrupt_flag) ;
 		t1 = esp_timer_get_time();
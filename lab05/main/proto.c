@@ -0,0 +1,341 @@
+// Message protocol between two game boards, see proto.h.
+//
+// Frame before COBS encoding:
+//   seq ack {type len data[len]}... crc_hi crc_lo
+// seq is 1-255 for a frame with messages, or 0 for a frame that only acks.
+// ack is the seq of the last frame with messages received. The CRC is
+// CRC-16/CCITT-FALSE over seq through the last message.
+//
+// One frame with messages is in flight at a time. Messages queued while it
+// waits for its ack go together in the next frame. A frame is accepted only
+// if all of its messages fit in the receive queue, otherwise it is not
+// acked and the sender tries again later.
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "esp_log.h"
+#include "esp_random.h"
+
+#include "proto.h"
+
+#define QUEUE_LEN 8 // Messages in each direction
+#define FRAME_MAX 64 // Largest frame before encoding, with CRC
+#define COBS_MAX (FRAME_MAX + FRAME_MAX/254 + 2) // Encoded, with delimiter
+#define HDR_SZ 2 // seq, ack
+#define CRC_SZ 2
+#define MSG_HDR 2 // type, len
+#define READ_SZ 32 // Bytes read from the channel at once
+#define WAIT_MS 10 // Longest wait for UART events, sets the send latency
+#define RESEND_MS 100 // Time to wait for an ack before sending again
+#define TASK_STACK 4096
+#define TASK_PRIO 5
+
+static const char *TAG = "proto";
+
+// CRC-16/CCITT-FALSE (poly 0x1021) of each nibble
+static const uint16_t CRC_TAB[16] = {
+	0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+	0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+};
+
+// Global variables
+static QueueHandle_t tx_queue, rx_queue;
+static TaskHandle_t task;
+static proto_io_t link; // Serial link, used by the task
+
+// Used by the task only
+static uint8_t tx_frame[FRAME_MAX]; // Frame waiting for an ack
+static uint32_t tx_len; // Length of tx_frame without CRC, 0 if none
+static TickType_t tx_time; // Time tx_frame was last sent
+static uint8_t tx_seq, rx_seq; // Last seq sent and received
+static bool ack_due; // A frame with messages was received, ack it
+static uint8_t rx_buf[COBS_MAX]; // Encoded frame received so far
+static uint32_t rx_len;
+static bool rx_drop; // Bytes lost, skip to the next delimiter
+
+
+// Return the CRC of a buffer.
+static uint16_t crc16(const uint8_t *p, uint32_t len)
+{
+	uint16_t crc = 0xFFFF;
+	while (len--) {
+		crc = (uint16_t)(crc << 4) ^ CRC_TAB[(crc >> 12) ^ (*p >> 4)];
+		crc = (uint16_t)(crc << 4) ^ CRC_TAB[(crc >> 12) ^ (*p++ & 0xF)];
+	}
+	return crc;
+}
+
+// COBS encode a buffer. The result has no zero bytes.
+// Return the encoded length, without the delimiter.
+static uint32_t cobs_encode(const uint8_t *src, uint32_t len, uint8_t *dst)
+{
+	uint32_t code_i = 0, o = 1;
+	uint8_t code = 1;
+
+	for (uint32_t i = 0; i < len; i++) {
+		if (src[i]) {
+			dst[o++] = src[i];
+			code++;
+		}
+		if (!src[i] || code == 0xFF) {
+			dst[code_i] = code;
+			code = 1;
+			code_i = o++;
+		}
+	}
+	dst[code_i] = code;
+	return o;
+}
+
+// COBS decode a buffer, without the delimiter. dst may be as long as src.
+// Return the decoded length, or a negative number if the data is bad.
+static int32_t cobs_decode(const uint8_t *src, uint32_t len, uint8_t *dst)
+{
+	uint32_t i = 0, o = 0;
+
+	while (i < len) {
+		uint8_t code = src[i++];
+		if (!code || i + code - 1 > len) return -1;
+		for (uint8_t k = 1; k < code; k++) dst[o++] = src[i++];
+		if (code < 0xFF && i < len) dst[o++] = 0;
+	}
+	return o;
+}
+
+// Return the size of a message in a frame, with its header.
+static uint32_t msg_size(const proto_msg_t *m)
+{
+	switch (m->type) {
+		case PROTO_MOVE: return MSG_HDR + 2;
+		case PROTO_BOARD: return MSG_HDR + 1 + 2*sizeof(uint64_t);
+		default: return MSG_HDR;
+	}
+}
+
+// Write a 64-bit value, least significant byte first.
+static void put64(uint8_t *p, uint64_t v)
+{
+	for (uint32_t i = 0; i < sizeof(v); i++, v >>= 8) p[i] = v;
+}
+
+static uint64_t get64(const uint8_t *p)
+{
+	uint64_t v = 0;
+	for (uint32_t i = sizeof(v); i--; ) v = v << 8 | p[i];
+	return v;
+}
+
+// Write a message to a frame. There must be room for msg_size() bytes.
+static void msg_put(uint8_t *p, const proto_msg_t *m)
+{
+	p[0] = m->type;
+	p[1] = msg_size(m) - MSG_HDR;
+	p += MSG_HDR;
+	switch (m->type) {
+		case PROTO_MOVE:
+			p[0] = m->move.r;
+			p[1] = m->move.c;
+			break;
+		case PROTO_BOARD:
+			p[0] = m->board.turn;
+			put64(p+1, m->board.x);
+			put64(p+1+sizeof(uint64_t), m->board.o);
+			break;
+	}
+}
+
+// Read a message from a frame. p[1] bytes of data follow the header.
+// Return true if the message is valid, otherwise false.
+static bool msg_get(const uint8_t *p, proto_msg_t *m)
+{
+	*m = (proto_msg_t){.type = p[0]};
+	if (p[1] != msg_size(m) - MSG_HDR) return false;
+	p += MSG_HDR;
+	switch (m->type) {
+		case PROTO_MOVE:
+			m->move.r = p[0];
+			m->move.c = p[1];
+			return true;
+		case PROTO_RESYNC:
+			return true;
+		case PROTO_BOARD:
+			m->board.turn = p[0];
+			m->board.x = get64(p+1);
+			m->board.o = get64(p+1+sizeof(uint64_t));
+			return true;
+	}
+	return false;
+}
+
+// Add the ack and CRC to a frame, encode and write it.
+// *f: frame with room for the CRC.
+// len: length of the frame without the CRC.
+static void frame_write(uint8_t *f, uint32_t len)
+{
+	uint8_t enc[COBS_MAX];
+
+	f[1] = rx_seq;
+	uint16_t crc = crc16(f, len);
+	f[len] = crc >> 8;
+	f[len+1] = crc;
+	uint32_t n = cobs_encode(f, len + CRC_SZ, enc);
+	enc[n++] = 0; // delimiter
+	link.write(enc, n);
+	ack_due = false;
+}
+
+// Handle an encoded frame received.
+static void frame_read(const uint8_t *enc, uint32_t len)
+{
+	uint8_t f[COBS_MAX];
+	int32_t n = cobs_decode(enc, len, f);
+
+	if (n < HDR_SZ + CRC_SZ || crc16(f, n - CRC_SZ) != (f[n-2] << 8 | f[n-1])) {
+		ESP_LOGD(TAG, "bad frame");
+		return;
+	}
+	n -= CRC_SZ;
+	if (tx_len && f[1] == tx_seq) tx_len = 0; // acked
+	if (!f[0]) return; // ack only
+	if (f[0] == rx_seq) { // sent again, the ack was lost
+		ack_due = true;
+		return;
+	}
+
+	// Check the messages and that they fit before taking any
+	uint32_t count = 0;
+	int32_t i;
+	for (i = HDR_SZ; i + MSG_HDR <= n && i + MSG_HDR + f[i+1] <= n; i += MSG_HDR + f[i+1])
+		count++;
+	if (i != n) {
+		ESP_LOGD(TAG, "bad message length");
+		return;
+	}
+	if (uxQueueSpacesAvailable(rx_queue) < count) return; // no ack, sent again
+	for (i = HDR_SZ; i < n; i += MSG_HDR + f[i+1]) {
+		proto_msg_t m;
+		if (msg_get(f+i, &m)) xQueueSend(rx_queue, &m, 0);
+		else ESP_LOGW(TAG, "unknown message type %u", f[i]);
+	}
+	rx_seq = f[0];
+	ack_due = true;
+}
+
+// Read the bytes waiting on the channel and split them into frames.
+static void proto_rx(void)
+{
+	uint8_t buf[READ_SZ];
+	int32_t n;
+
+	while ((n = link.read(buf, sizeof(buf))) > 0) {
+		for (int32_t i = 0; i < n; i++) {
+			if (buf[i]) {
+				if (rx_len < sizeof(rx_buf)) rx_buf[rx_len++] = buf[i];
+				else rx_drop = true;
+				continue;
+			}
+			if (rx_len && !rx_drop) frame_read(rx_buf, rx_len);
+			rx_len = 0;
+			rx_drop = false;
+		}
+	}
+	if (n < 0) rx_drop = true; // bytes lost
+}
+
+// Send the frame in flight again if its ack is late, or a new frame with
+// the messages queued, or an ack on its own.
+static void proto_tx(void)
+{
+	TickType_t now = xTaskGetTickCount();
+	proto_msg_t m;
+
+	if (tx_len && now - tx_time >= pdMS_TO_TICKS(RESEND_MS)) {
+		frame_write(tx_frame, tx_len);
+		tx_time = now;
+	}
+	if (!tx_len && xQueuePeek(tx_queue, &m, 0) == pdTRUE) {
+		uint32_t len = HDR_SZ;
+		do {
+			if (len + msg_size(&m) + CRC_SZ > FRAME_MAX) break;
+			msg_put(tx_frame + len, &m);
+			len += msg_size(&m);
+			xQueueReceive(tx_queue, &m, 0);
+		} while (xQueuePeek(tx_queue, &m, 0) == pdTRUE);
+		tx_seq = tx_seq % 255 + 1; // 1-255
+		tx_frame[0] = tx_seq;
+		tx_len = len;
+		frame_write(tx_frame, tx_len);
+		tx_time = now;
+	}
+	if (ack_due) {
+		uint8_t f[HDR_SZ + CRC_SZ] = {0};
+		frame_write(f, HDR_SZ);
+	}
+}
+
+// Protocol task. Wakes on UART events, or after WAIT_MS to send.
+static void proto_task(void *arg)
+{
+	for (;;) {
+		if (link.wait(WAIT_MS) < 0) rx_drop = true; // bytes lost
+		proto_rx();
+		proto_tx();
+	}
+}
+
+// Initialize the protocol and start its task. Call after the link is set
+// up, e.g. com_init().
+// *io: serial link.
+// Return zero if successful, or non-zero otherwise.
+int32_t proto_init(const proto_io_t *io)
+{
+	if (task != NULL) return 0;
+	if (io == NULL || io->write == NULL || io->read == NULL || io->wait == NULL) return 1;
+	link = *io;
+	tx_queue = xQueueCreate(QUEUE_LEN, sizeof(proto_msg_t));
+	rx_queue = xQueueCreate(QUEUE_LEN, sizeof(proto_msg_t));
+	if (tx_queue == NULL || rx_queue == NULL) {
+		ESP_LOGE(TAG, "cannot create queues");
+		return 1;
+	}
+	// A board that restarts should not reuse the seq the other board last
+	// received, or its first frame would be taken as sent again
+	tx_seq = esp_random();
+	if (xTaskCreate(proto_task, "proto", TASK_STACK, NULL, TASK_PRIO, &task) != pdPASS) {
+		ESP_LOGE(TAG, "cannot create task");
+		return 1;
+	}
+	return 0;
+}
+
+// Queue a message to send. Does not wait.
+// *msg: pointer to the message.
+// Return true if the message was queued, or false if the queue is full.
+bool proto_send(const proto_msg_t *msg)
+{
+	if (tx_queue == NULL || msg == NULL) return false;
+	return xQueueSend(tx_queue, msg, 0) == pdTRUE;
+}
+
+// Get the next message received. Does not wait.
+// *msg: pointer to the message.
+// Return true if a message was read, otherwise false.
+bool proto_get(proto_msg_t *msg)
+{
+	if (rx_queue == NULL || msg == NULL) return false;
+	return xQueueReceive(rx_queue, msg, 0) == pdTRUE;
+}
+
+// Discard messages received and not yet read.
+void proto_flush(void)
+{
+	if (rx_queue != NULL) xQueueReset(rx_queue);
+}
+
+// NOTES:
+// * A board only acks a frame after its messages are in the receive queue,
+// and only takes a frame whose seq differs from the last, so each message
+// is delivered once, in order, as long as the boards stay connected.
+// * The checks of a frame only look at lengths and the CRC. Message data is
+// checked by the game, e.g. a move to a full cell.
@@ -0,0 +1,62 @@
+#ifndef PROTO_H_
+#define PROTO_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Message protocol between two game boards over a serial link, e.g. the
+// communication channel (com.h). Messages are batched into frames, each
+// with a sequence number, the sequence number of the last frame received
+// (ack) and a CRC-16. The frame is COBS encoded and ends with a zero byte,
+// so the receiver finds the next frame after a lost or corrupt byte. A
+// frame that is not acked in time is sent again. A task started by
+// proto_init() does the work, woken by the link, so the game tick only
+// moves messages in and out of queues.
+
+// Serial link, e.g. com_write(), com_read() and com_wait(). Only wait may
+// block, and all three are called from the protocol task.
+typedef struct {
+	int32_t (*write)(const void *buf, uint32_t size);
+	int32_t (*read)(void *buf, uint32_t size);
+	int32_t (*wait)(uint32_t ms); // Bytes waiting, 0 on time out, <0 if lost
+} proto_io_t;
+
+typedef enum {
+	PROTO_MOVE = 1, // A mark was played at r, c
+	PROTO_RESYNC,   // Ask the other board for its board state
+	PROTO_BOARD,    // Full board state
+} proto_type_t;
+
+typedef struct {
+	uint8_t type; // proto_type_t
+	union {
+		struct {
+			int8_t r, c;
+		} move;
+		struct {
+			uint8_t turn; // mark_t of the player to move
+			uint64_t x, o; // Board bits of each mark (board_bits())
+		} board;
+	};
+} proto_msg_t;
+
+// Initialize the protocol and start its task. Call after the link is set
+// up, e.g. com_init().
+// *io: serial link.
+// Return zero if successful, or non-zero otherwise.
+int32_t proto_init(const proto_io_t *io);
+
+// Queue a message to send. Does not wait.
+// *msg: pointer to the message.
+// Return true if the message was queued, or false if the queue is full.
+bool proto_send(const proto_msg_t *msg);
+
+// Get the next message received. Does not wait.
+// *msg: pointer to the message.
+// Return true if a message was read, otherwise false.
+bool proto_get(proto_msg_t *msg);
+
+// Discard messages received and not yet read.
+void proto_flush(void);
+
+#endif // PROTO_H_
@@ -1,2308 +0,0 @@
-
-#include <stdint.h>
-
-const uint8_t missileLaunch[] = {
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80,
- 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x7f,
- 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
- 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81,
- 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
- 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81,
- 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81,
- 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x7f, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80,
- 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81,
- 0x81, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81,
- 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80,
- 0x81, 0x81, 0x81, 0x80, 0x80, 0x81, 0x80, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81,
- 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f,
- 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81,
- 0x81, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80,
- 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
- 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x7f, 0x80,
- 0x81, 0x80, 0x81, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x80,
- 0x80, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80,
- 0x81, 0x80, 0x80, 0x7e, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80,
- 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f,
- 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x81,
- 0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
- 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x80,
- 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80,
- 0x81, 0x81, 0x80, 0x80, 0x81, 0x82, 0x82, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e,
- 0x7e, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x7f, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81,
- 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x80, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x7f,
- 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80,
- 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x80,
- 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80,
- 0x7f, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7f,
- 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x81,
- 0x81, 0x81, 0x81, 0x81, 0x82, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x7f, 0x7d, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x7f,
- 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f,
- 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x7f, 0x7f,
- 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81, 0x80,
- 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x7f, 0x7f, 0x80, 0x80, 0x7e,
- 0x7e, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80,
- 0x81, 0x82, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80,
- 0x80, 0x81, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x80, 0x82, 0x81, 0x80,
- 0x80, 0x80, 0x80, 0x81, 0x81, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7e, 0x7e, 0x7f, 0x80, 0x80,
- 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x81, 0x81,
- 0x82, 0x82, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x7f, 0x7f, 0x80, 0x81,
- 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x80, 0x7f,
- 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
- 0x83, 0x83, 0x82, 0x7f, 0x7f, 0x81, 0x80, 0x7f, 0x81, 0x81, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x7d, 0x7d, 0x7f, 0x82, 0x82, 0x81, 0x81, 0x82, 0x82, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81,
- 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x81, 0x80,
- 0x80, 0x82, 0x83, 0x83, 0x82, 0x82, 0x81, 0x81, 0x83, 0x82, 0x81, 0x81, 0x82, 0x80, 0x7f, 0x7f,
- 0x80, 0x81, 0x81, 0x7e, 0x7f, 0x82, 0x81, 0x7f, 0x7f, 0x81, 0x81, 0x7f, 0x7e, 0x80, 0x81, 0x81,
- 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x81, 0x81, 0x81, 0x82, 0x82, 0x80, 0x7f, 0x80, 0x81, 0x80,
- 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x81, 0x82, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81,
- 0x80, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x7f,
- 0x7e, 0x7f, 0x80, 0x7f, 0x7d, 0x7d, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x81, 0x82, 0x81, 0x81,
- 0x81, 0x82, 0x82, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x82, 0x83, 0x81, 0x7f, 0x80,
- 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x7e, 0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
- 0x7e, 0x7e, 0x7f, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x81,
- 0x82, 0x82, 0x81, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80,
- 0x7e, 0x7d, 0x7f, 0x7f, 0x7f, 0x7e, 0x7d, 0x7e, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x7e, 0x80, 0x81,
- 0x80, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x83, 0x80, 0x7e,
- 0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7e, 0x7d, 0x7f, 0x7f, 0x7d, 0x7e, 0x7e, 0x80,
- 0x7f, 0x7e, 0x81, 0x82, 0x80, 0x80, 0x81, 0x82, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
- 0x81, 0x82, 0x81, 0x80, 0x82, 0x83, 0x82, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80,
- 0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x80, 0x81, 0x81, 0x80,
- 0x7f, 0x81, 0x82, 0x81, 0x80, 0x82, 0x83, 0x82, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x80,
- 0x81, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x80, 0x81, 0x7f, 0x7e, 0x80, 0x81, 0x80,
- 0x7f, 0x7f, 0x81, 0x81, 0x7f, 0x7f, 0x80, 0x82, 0x82, 0x81, 0x80, 0x80, 0x81, 0x80, 0x82, 0x81,
- 0x80, 0x81, 0x82, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x81, 0x80, 0x7f, 0x80,
- 0x82, 0x80, 0x7f, 0x7f, 0x80, 0x7e, 0x80, 0x82, 0x81, 0x81, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x7f,
- 0x7f, 0x80, 0x7f, 0x7e, 0x81, 0x82, 0x82, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x81, 0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x7f, 0x7f,
- 0x7f, 0x81, 0x82, 0x81, 0x80, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x82,
- 0x82, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x80, 0x81,
- 0x82, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7d, 0x7e, 0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x7e,
- 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x81, 0x81, 0x81, 0x82, 0x84, 0x83, 0x82, 0x83, 0x83,
- 0x81, 0x81, 0x80, 0x7f, 0x81, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x7e,
- 0x7c, 0x7b, 0x7d, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7e, 0x7e,
- 0x7e, 0x7f, 0x7f, 0x80, 0x7f, 0x7e, 0x80, 0x82, 0x80, 0x81, 0x7f, 0x7f, 0x81, 0x7f, 0x7e, 0x7e,
- 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82,
- 0x81, 0x81, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x7e, 0x7d, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x80,
- 0x82, 0x81, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7d, 0x7e, 0x7f, 0x80, 0x80, 0x7e, 0x7f, 0x7e,
- 0x7f, 0x80, 0x80, 0x80, 0x7e, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x80, 0x82, 0x7f, 0x7f, 0x83, 0x82,
- 0x81, 0x7e, 0x7e, 0x80, 0x81, 0x7f, 0x7f, 0x7f, 0x81, 0x80, 0x81, 0x80, 0x82, 0x81, 0x7f, 0x7e,
- 0x7f, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x81, 0x82, 0x81, 0x7f, 0x7d, 0x7d, 0x7f, 0x7f,
- 0x7f, 0x7f, 0x7e, 0x7f, 0x82, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x80, 0x81, 0x82,
- 0x7f, 0x7f, 0x81, 0x80, 0x81, 0x80, 0x7e, 0x7e, 0x7d, 0x7d, 0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x80,
- 0x81, 0x82, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x80,
- 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x81, 0x7f, 0x81, 0x81, 0x80, 0x80, 0x81, 0x82, 0x81, 0x81,
- 0x82, 0x81, 0x80, 0x7f, 0x7e, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x80, 0x80, 0x7f,
- 0x7e, 0x7e, 0x80, 0x7f, 0x7d, 0x7e, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x7f,
- 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x7e,
- 0x7f, 0x80, 0x80, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x7e, 0x7d, 0x80, 0x81, 0x80, 0x7e, 0x7f, 0x81,
- 0x82, 0x83, 0x82, 0x80, 0x80, 0x81, 0x82, 0x82, 0x81, 0x7f, 0x81, 0x82, 0x81, 0x80, 0x81, 0x81,
- 0x7f, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x7f, 0x81, 0x82, 0x7f, 0x7f, 0x80, 0x81,
- 0x81, 0x81, 0x82, 0x80, 0x7f, 0x7f, 0x81, 0x80, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x82, 0x81, 0x81,
- 0x81, 0x80, 0x81, 0x82, 0x82, 0x81, 0x80, 0x81, 0x81, 0x7f, 0x7f, 0x82, 0x82, 0x7e, 0x7e, 0x81,
- 0x82, 0x81, 0x82, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x7e, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x81,
- 0x81, 0x7f, 0x7e, 0x81, 0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x80, 0x7f, 0x81, 0x81, 0x80, 0x7f,
- 0x80, 0x81, 0x80, 0x7f, 0x80, 0x7f, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x81, 0x81, 0x7f, 0x7f, 0x80,
- 0x81, 0x81, 0x81, 0x81, 0x82, 0x83, 0x82, 0x80, 0x80, 0x81, 0x83, 0x85, 0x83, 0x81, 0x80, 0x83,
- 0x82, 0x7d, 0x7c, 0x7e, 0x82, 0x82, 0x7e, 0x7d, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x7e,
- 0x7f, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x82, 0x82, 0x81,
- 0x82, 0x83, 0x82, 0x82, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x82, 0x7f, 0x7f, 0x81, 0x80, 0x7f, 0x7e,
- 0x7e, 0x7e, 0x7e, 0x7f, 0x7d, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x80, 0x7e,
- 0x80, 0x83, 0x82, 0x81, 0x83, 0x85, 0x83, 0x81, 0x7f, 0x80, 0x82, 0x7f, 0x7d, 0x7f, 0x80, 0x80,
- 0x7f, 0x7f, 0x7e, 0x80, 0x7e, 0x7c, 0x7f, 0x7f, 0x7d, 0x7e, 0x7e, 0x7e, 0x80, 0x81, 0x7f, 0x81,
- 0x83, 0x83, 0x81, 0x80, 0x82, 0x82, 0x82, 0x7f, 0x7e, 0x80, 0x81, 0x7f, 0x7e, 0x7f, 0x80, 0x7f,
- 0x7d, 0x7d, 0x7e, 0x7f, 0x80, 0x7f, 0x7f, 0x82, 0x83, 0x83, 0x81, 0x80, 0x81, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x81, 0x80, 0x80, 0x82, 0x82, 0x81, 0x7f, 0x7f, 0x7d, 0x80, 0x7f, 0x7f, 0x7f, 0x7e,
- 0x7d, 0x7e, 0x7f, 0x7e, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x81, 0x82, 0x80, 0x7f, 0x80, 0x81,
- 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 0x82, 0x83,
- 0x82, 0x81, 0x81, 0x81, 0x81, 0x7f, 0x7f, 0x81, 0x82, 0x81, 0x7f, 0x81, 0x80, 0x7e, 0x80, 0x82,
- 0x7f, 0x7d, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x83, 0x82, 0x82, 0x7f, 0x7e, 0x7e, 0x7f, 0x80,
- 0x81, 0x82, 0x84, 0x84, 0x83, 0x83, 0x81, 0x81, 0x82, 0x80, 0x80, 0x81, 0x81, 0x7f, 0x7c, 0x7f,
- 0x81, 0x7f, 0x7e, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x81, 0x81, 0x81, 0x82, 0x81, 0x82, 0x86,
- 0x84, 0x81, 0x80, 0x81, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x82, 0x82, 0x80,
- 0x82, 0x82, 0x80, 0x81, 0x82, 0x80, 0x80, 0x7f, 0x81, 0x82, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x80,
- 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x83, 0x82, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7e, 0x7f, 0x7f,
- 0x7f, 0x81, 0x81, 0x82, 0x84, 0x82, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x80,
- 0x81, 0x82, 0x82, 0x83, 0x80, 0x7e, 0x7f, 0x7d, 0x7e, 0x7e, 0x7e, 0x80, 0x7f, 0x80, 0x7f, 0x80,
- 0x83, 0x82, 0x80, 0x81, 0x82, 0x81, 0x81, 0x82, 0x81, 0x81, 0x81, 0x81, 0x83, 0x81, 0x80, 0x81,
- 0x81, 0x81, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x82, 0x82, 0x83, 0x81, 0x80, 0x81, 0x7f, 0x80,
- 0x80, 0x80, 0x7f, 0x7d, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x83, 0x85,
- 0x83, 0x82, 0x82, 0x81, 0x81, 0x81, 0x80, 0x80, 0x83, 0x82, 0x7f, 0x7d, 0x7e, 0x7f, 0x80, 0x7f,
- 0x7f, 0x7d, 0x7e, 0x7e, 0x7c, 0x7d, 0x7e, 0x7e, 0x7f, 0x7c, 0x7d, 0x80, 0x81, 0x82, 0x82, 0x81,
- 0x7f, 0x82, 0x83, 0x81, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x83, 0x82, 0x81, 0x84,
- 0x84, 0x82, 0x80, 0x7f, 0x81, 0x83, 0x82, 0x81, 0x80, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f,
- 0x7f, 0x80, 0x81, 0x82, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x7e, 0x7d, 0x7e, 0x80, 0x81, 0x80,
- 0x80, 0x81, 0x80, 0x80, 0x7e, 0x7f, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x7f, 0x80,
- 0x83, 0x83, 0x81, 0x81, 0x81, 0x81, 0x83, 0x85, 0x81, 0x80, 0x80, 0x81, 0x82, 0x7f, 0x7f, 0x80,
- 0x81, 0x82, 0x81, 0x7f, 0x80, 0x81, 0x7f, 0x7c, 0x7c, 0x7f, 0x80, 0x7e, 0x7d, 0x80, 0x80, 0x7f,
- 0x7e, 0x7e, 0x7d, 0x7f, 0x80, 0x81, 0x82, 0x83, 0x84, 0x84, 0x82, 0x80, 0x82, 0x83, 0x83, 0x80,
- 0x7f, 0x81, 0x82, 0x81, 0x7f, 0x80, 0x82, 0x82, 0x80, 0x80, 0x81, 0x7f, 0x7e, 0x7f, 0x80, 0x7e,
- 0x7e, 0x81, 0x82, 0x80, 0x81, 0x83, 0x81, 0x81, 0x83, 0x83, 0x81, 0x7e, 0x80, 0x81, 0x81, 0x7f,
- 0x7d, 0x7f, 0x80, 0x80, 0x7e, 0x7d, 0x7e, 0x7f, 0x7e, 0x7e, 0x7d, 0x81, 0x7f, 0x7c, 0x7c, 0x7d,
- 0x80, 0x80, 0x7e, 0x7c, 0x7d, 0x7f, 0x7f, 0x7e, 0x7e, 0x80, 0x81, 0x7f, 0x7f, 0x80, 0x82, 0x85,
- 0x84, 0x81, 0x80, 0x81, 0x82, 0x7f, 0x7d, 0x7e, 0x80, 0x7f, 0x81, 0x80, 0x7e, 0x80, 0x80, 0x7e,
- 0x7e, 0x7f, 0x80, 0x81, 0x7e, 0x7c, 0x7f, 0x7f, 0x7d, 0x7e, 0x7d, 0x7e, 0x7f, 0x80, 0x80, 0x7f,
- 0x80, 0x7f, 0x7d, 0x7e, 0x7e, 0x7d, 0x80, 0x83, 0x83, 0x83, 0x82, 0x81, 0x80, 0x80, 0x80, 0x7f,
- 0x7e, 0x7d, 0x7d, 0x7e, 0x7d, 0x7c, 0x80, 0x80, 0x7f, 0x80, 0x7e, 0x80, 0x81, 0x7e, 0x7e, 0x7f,
- 0x80, 0x82, 0x83, 0x82, 0x80, 0x81, 0x80, 0x7f, 0x7f, 0x81, 0x80, 0x7c, 0x7f, 0x80, 0x80, 0x80,
- 0x7e, 0x7d, 0x7e, 0x7c, 0x7d, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7d, 0x80, 0x81,
- 0x7f, 0x80, 0x83, 0x84, 0x82, 0x80, 0x81, 0x82, 0x80, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7e,
- 0x7e, 0x80, 0x7f, 0x7d, 0x7e, 0x7c, 0x7b, 0x7c, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x82, 0x81, 0x81,
- 0x82, 0x82, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x84, 0x85, 0x81, 0x80, 0x81, 0x82, 0x83, 0x81, 0x7e,
- 0x7d, 0x7f, 0x7f, 0x7d, 0x7d, 0x81, 0x80, 0x7e, 0x7f, 0x81, 0x85, 0x84, 0x82, 0x81, 0x81, 0x81,
- 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x80,
- 0x80, 0x7f, 0x81, 0x82, 0x81, 0x81, 0x81, 0x80, 0x82, 0x81, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f,
- 0x80, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x7e, 0x7d, 0x7e, 0x81, 0x81, 0x7f, 0x7e, 0x7f,
- 0x80, 0x82, 0x83, 0x81, 0x81, 0x82, 0x80, 0x80, 0x82, 0x85, 0x84, 0x82, 0x83, 0x82, 0x81, 0x81,
- 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7c, 0x7e, 0x7f, 0x7f, 0x82, 0x82, 0x80, 0x7d, 0x7f, 0x81,
- 0x81, 0x80, 0x7e, 0x7f, 0x81, 0x83, 0x80, 0x7f, 0x80, 0x7f, 0x7d, 0x7d, 0x81, 0x83, 0x82, 0x81,
- 0x80, 0x81, 0x81, 0x81, 0x81, 0x7f, 0x81, 0x82, 0x83, 0x84, 0x86, 0x83, 0x80, 0x82, 0x84, 0x82,
- 0x80, 0x7e, 0x7f, 0x80, 0x80, 0x81, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f,
- 0x7f, 0x7d, 0x7f, 0x7f, 0x7e, 0x7e, 0x80, 0x81, 0x7f, 0x7d, 0x7f, 0x82, 0x82, 0x81, 0x83, 0x82,
- 0x80, 0x7f, 0x7e, 0x7f, 0x82, 0x84, 0x85, 0x83, 0x80, 0x81, 0x83, 0x84, 0x82, 0x80, 0x7f, 0x7f,
- 0x7e, 0x7f, 0x80, 0x7f, 0x7e, 0x7e, 0x80, 0x80, 0x7f, 0x7e, 0x7d, 0x7f, 0x81, 0x82, 0x82, 0x81,
- 0x81, 0x82, 0x80, 0x80, 0x80, 0x82, 0x81, 0x81, 0x83, 0x84, 0x83, 0x82, 0x81, 0x80, 0x80, 0x7f,
- 0x7d, 0x7c, 0x7c, 0x7c, 0x7e, 0x81, 0x7f, 0x7d, 0x7d, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x82,
- 0x80, 0x81, 0x82, 0x83, 0x82, 0x82, 0x82, 0x84, 0x84, 0x82, 0x81, 0x81, 0x82, 0x81, 0x80, 0x80,
- 0x80, 0x82, 0x82, 0x7f, 0x7e, 0x80, 0x7e, 0x7b, 0x7b, 0x7e, 0x80, 0x7f, 0x80, 0x81, 0x7f, 0x80,
- 0x82, 0x82, 0x80, 0x80, 0x82, 0x7f, 0x7d, 0x7f, 0x81, 0x80, 0x80, 0x80, 0x83, 0x80, 0x7d, 0x81,
- 0x82, 0x82, 0x83, 0x84, 0x84, 0x82, 0x80, 0x80, 0x82, 0x81, 0x7e, 0x7b, 0x7f, 0x85, 0x81, 0x7d,
- 0x7f, 0x82, 0x80, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x81, 0x81, 0x82, 0x7f, 0x7f, 0x81, 0x7f, 0x7e,
- 0x7f, 0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x83, 0x82, 0x80, 0x84, 0x85, 0x82, 0x7d, 0x7f, 0x82, 0x81,
- 0x81, 0x82, 0x84, 0x84, 0x82, 0x81, 0x82, 0x82, 0x7f, 0x7e, 0x80, 0x80, 0x7d, 0x7f, 0x80, 0x7e,
- 0x80, 0x80, 0x80, 0x7d, 0x7e, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x7f, 0x81, 0x82, 0x81,
- 0x84, 0x85, 0x83, 0x83, 0x84, 0x84, 0x80, 0x7d, 0x7e, 0x7f, 0x7e, 0x7d, 0x7e, 0x80, 0x80, 0x7f,
- 0x7e, 0x7d, 0x7e, 0x7f, 0x81, 0x83, 0x82, 0x80, 0x81, 0x82, 0x80, 0x7d, 0x7d, 0x7c, 0x7d, 0x80,
- 0x82, 0x81, 0x80, 0x81, 0x82, 0x82, 0x7f, 0x7d, 0x7e, 0x7e, 0x7f, 0x80, 0x7e, 0x80, 0x82, 0x7e,
- 0x7c, 0x7e, 0x80, 0x80, 0x7d, 0x7e, 0x7f, 0x7d, 0x7d, 0x81, 0x82, 0x82, 0x80, 0x7e, 0x7e, 0x7f,
- 0x83, 0x82, 0x80, 0x7d, 0x7c, 0x7f, 0x80, 0x81, 0x82, 0x83, 0x81, 0x80, 0x81, 0x80, 0x7f, 0x7f,
- 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x81, 0x7f, 0x7d, 0x7e, 0x80, 0x83, 0x83, 0x81, 0x80, 0x80, 0x7e,
- 0x7e, 0x80, 0x80, 0x7e, 0x7e, 0x7f, 0x81, 0x80, 0x7f, 0x7f, 0x81, 0x81, 0x7c, 0x7a, 0x7d, 0x80,
- 0x82, 0x84, 0x83, 0x7e, 0x7e, 0x81, 0x83, 0x80, 0x7e, 0x7e, 0x80, 0x81, 0x7f, 0x80, 0x81, 0x80,
- 0x7d, 0x7c, 0x7e, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x81, 0x84, 0x83, 0x82, 0x81, 0x83, 0x81,
- 0x7f, 0x7e, 0x7e, 0x80, 0x7f, 0x82, 0x82, 0x7f, 0x81, 0x80, 0x7f, 0x83, 0x84, 0x80, 0x7d, 0x7f,
- 0x7f, 0x80, 0x80, 0x7e, 0x80, 0x81, 0x7e, 0x7c, 0x7f, 0x83, 0x84, 0x84, 0x84, 0x88, 0x88, 0x83,
- 0x84, 0x83, 0x7f, 0x7d, 0x7d, 0x7e, 0x7d, 0x81, 0x81, 0x7e, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e,
- 0x7e, 0x7e, 0x80, 0x80, 0x81, 0x82, 0x80, 0x7e, 0x80, 0x83, 0x80, 0x7e, 0x80, 0x83, 0x83, 0x82,
- 0x80, 0x82, 0x84, 0x84, 0x85, 0x81, 0x7f, 0x82, 0x84, 0x80, 0x7e, 0x7e, 0x80, 0x81, 0x7e, 0x7f,
- 0x83, 0x83, 0x81, 0x81, 0x7f, 0x7e, 0x82, 0x83, 0x82, 0x81, 0x82, 0x7e, 0x7f, 0x81, 0x80, 0x81,
- 0x82, 0x7e, 0x7d, 0x80, 0x7f, 0x7e, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x81, 0x82, 0x80, 0x80,
- 0x7f, 0x80, 0x80, 0x81, 0x80, 0x7e, 0x7f, 0x83, 0x84, 0x80, 0x7d, 0x7c, 0x7d, 0x7e, 0x81, 0x81,
- 0x81, 0x80, 0x7d, 0x80, 0x83, 0x82, 0x80, 0x81, 0x82, 0x7f, 0x81, 0x81, 0x82, 0x83, 0x82, 0x81,
- 0x80, 0x83, 0x82, 0x7e, 0x7f, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x7e, 0x7e, 0x7f, 0x7e, 0x7c, 0x7c,
- 0x7c, 0x7d, 0x7e, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7e, 0x7f, 0x81, 0x80, 0x80, 0x80, 0x7e, 0x82,
- 0x85, 0x84, 0x83, 0x82, 0x82, 0x7d, 0x7e, 0x7e, 0x7c, 0x7e, 0x7e, 0x7d, 0x7d, 0x7e, 0x7f, 0x7f,
- 0x7f, 0x7d, 0x7d, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x80, 0x80, 0x7c, 0x7d,
- 0x7e, 0x7e, 0x7e, 0x7d, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x81, 0x81, 0x7f, 0x82, 0x83, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7f, 0x80, 0x7f, 0x7d, 0x7c, 0x7c, 0x7f, 0x7e, 0x7c, 0x7d, 0x7d,
- 0x7c, 0x7d, 0x7e, 0x7e, 0x7d, 0x7e, 0x80, 0x7f, 0x81, 0x85, 0x83, 0x7e, 0x7f, 0x83, 0x83, 0x81,
- 0x7f, 0x81, 0x83, 0x85, 0x84, 0x82, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x80, 0x80, 0x7f,
- 0x7e, 0x7f, 0x80, 0x7f, 0x7c, 0x7c, 0x7f, 0x7f, 0x7c, 0x7e, 0x80, 0x80, 0x80, 0x83, 0x84, 0x81,
- 0x81, 0x84, 0x82, 0x80, 0x81, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x81, 0x83, 0x80, 0x7d, 0x7b,
- 0x7c, 0x7a, 0x78, 0x7a, 0x7b, 0x7a, 0x7b, 0x7d, 0x7f, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x82, 0x80,
- 0x81, 0x81, 0x80, 0x7e, 0x81, 0x82, 0x84, 0x85, 0x82, 0x81, 0x82, 0x83, 0x82, 0x80, 0x7e, 0x7e,
- 0x7f, 0x7e, 0x7d, 0x7c, 0x7b, 0x7b, 0x7c, 0x7c, 0x7d, 0x7f, 0x7f, 0x7e, 0x7e, 0x81, 0x82, 0x82,
- 0x82, 0x82, 0x83, 0x85, 0x84, 0x84, 0x84, 0x85, 0x83, 0x83, 0x82, 0x80, 0x81, 0x82, 0x7f, 0x7e,
- 0x7c, 0x7b, 0x7f, 0x81, 0x80, 0x7f, 0x7f, 0x82, 0x81, 0x7e, 0x80, 0x7f, 0x7e, 0x7e, 0x7b, 0x7e,
- 0x7e, 0x7f, 0x7f, 0x7e, 0x7f, 0x81, 0x82, 0x80, 0x82, 0x80, 0x7f, 0x7e, 0x81, 0x82, 0x81, 0x82,
- 0x81, 0x83, 0x84, 0x85, 0x82, 0x81, 0x81, 0x80, 0x80, 0x81, 0x7f, 0x7c, 0x7e, 0x81, 0x81, 0x7f,
- 0x7d, 0x7c, 0x7c, 0x7d, 0x7a, 0x79, 0x7d, 0x80, 0x81, 0x7f, 0x80, 0x81, 0x81, 0x82, 0x81, 0x82,
- 0x84, 0x84, 0x7d, 0x7d, 0x80, 0x7f, 0x7d, 0x7b, 0x7c, 0x7f, 0x81, 0x80, 0x7e, 0x7f, 0x7f, 0x7f,
- 0x7e, 0x7d, 0x7e, 0x7d, 0x80, 0x7f, 0x7f, 0x82, 0x84, 0x82, 0x81, 0x84, 0x83, 0x83, 0x82, 0x81,
- 0x82, 0x81, 0x7f, 0x7c, 0x7e, 0x7d, 0x82, 0x82, 0x7f, 0x82, 0x81, 0x7f, 0x7c, 0x7c, 0x80, 0x81,
- 0x7e, 0x80, 0x81, 0x82, 0x83, 0x83, 0x83, 0x80, 0x80, 0x80, 0x82, 0x85, 0x85, 0x82, 0x7f, 0x7f,
- 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x82, 0x82, 0x80, 0x7e, 0x7f, 0x7d, 0x7c, 0x7f, 0x82, 0x83, 0x83,
- 0x82, 0x83, 0x82, 0x7e, 0x7e, 0x80, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x81, 0x83, 0x84, 0x80, 0x7f,
- 0x84, 0x87, 0x85, 0x81, 0x7f, 0x82, 0x80, 0x7e, 0x7f, 0x81, 0x81, 0x81, 0x80, 0x7d, 0x7e, 0x81,
- 0x7f, 0x7d, 0x80, 0x7d, 0x7b, 0x7c, 0x80, 0x82, 0x80, 0x80, 0x7f, 0x7e, 0x80, 0x85, 0x84, 0x82,
- 0x82, 0x80, 0x82, 0x84, 0x81, 0x7f, 0x82, 0x85, 0x84, 0x83, 0x83, 0x81, 0x7e, 0x7f, 0x81, 0x80,
- 0x7f, 0x81, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7d, 0x7e, 0x83, 0x81, 0x7f, 0x81, 0x7f,
- 0x7e, 0x7e, 0x7f, 0x80, 0x7f, 0x80, 0x82, 0x81, 0x80, 0x83, 0x81, 0x82, 0x83, 0x81, 0x81, 0x83,
- 0x82, 0x81, 0x84, 0x81, 0x81, 0x84, 0x84, 0x83, 0x80, 0x7d, 0x7e, 0x80, 0x7f, 0x7e, 0x80, 0x7f,
- 0x7d, 0x7e, 0x81, 0x84, 0x81, 0x81, 0x84, 0x82, 0x81, 0x82, 0x83, 0x83, 0x84, 0x83, 0x82, 0x81,
- 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7a, 0x7a, 0x80, 0x7f, 0x7d, 0x7d, 0x7d, 0x80, 0x7f, 0x7d, 0x7e,
- 0x81, 0x82, 0x80, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x81, 0x81, 0x82, 0x82, 0x81, 0x7f, 0x80,
- 0x81, 0x7f, 0x82, 0x85, 0x83, 0x80, 0x7e, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x7d, 0x7f,
- 0x7f, 0x7b, 0x7d, 0x7e, 0x7b, 0x7b, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x83, 0x83, 0x84, 0x88, 0x88,
- 0x87, 0x86, 0x84, 0x82, 0x80, 0x7d, 0x7f, 0x80, 0x7f, 0x80, 0x81, 0x7f, 0x7e, 0x7b, 0x78, 0x7b,
- 0x7a, 0x78, 0x7b, 0x7f, 0x80, 0x80, 0x80, 0x82, 0x84, 0x81, 0x7e, 0x7f, 0x82, 0x83, 0x80, 0x82,
- 0x86, 0x85, 0x82, 0x80, 0x7f, 0x82, 0x83, 0x80, 0x7f, 0x7e, 0x7d, 0x7f, 0x7c, 0x7a, 0x7e, 0x7c,
- 0x7e, 0x7f, 0x7e, 0x80, 0x85, 0x82, 0x7e, 0x80, 0x81, 0x81, 0x80, 0x82, 0x85, 0x85, 0x80, 0x7f,
- 0x83, 0x84, 0x81, 0x81, 0x81, 0x7d, 0x7c, 0x7f, 0x80, 0x7d, 0x7c, 0x7c, 0x7e, 0x80, 0x7e, 0x80,
- 0x82, 0x83, 0x7f, 0x7e, 0x82, 0x83, 0x83, 0x80, 0x80, 0x83, 0x83, 0x7e, 0x80, 0x83, 0x83, 0x82,
- 0x83, 0x84, 0x85, 0x84, 0x80, 0x7f, 0x82, 0x82, 0x80, 0x7d, 0x79, 0x7d, 0x80, 0x7f, 0x7d, 0x7a,
- 0x7c, 0x80, 0x81, 0x7d, 0x7c, 0x7b, 0x7e, 0x80, 0x7f, 0x7f, 0x81, 0x81, 0x84, 0x83, 0x7e, 0x80,
- 0x82, 0x7d, 0x7c, 0x7e, 0x7f, 0x7e, 0x7e, 0x7f, 0x7e, 0x7f, 0x80, 0x7d, 0x7e, 0x84, 0x84, 0x80,
- 0x7e, 0x81, 0x85, 0x84, 0x80, 0x7e, 0x80, 0x81, 0x84, 0x86, 0x86, 0x87, 0x84, 0x84, 0x86, 0x83,
- 0x81, 0x82, 0x81, 0x80, 0x81, 0x82, 0x82, 0x83, 0x84, 0x81, 0x7d, 0x7e, 0x80, 0x7f, 0x7c, 0x7f,
- 0x81, 0x81, 0x82, 0x83, 0x85, 0x87, 0x85, 0x85, 0x85, 0x82, 0x7f, 0x80, 0x82, 0x82, 0x81, 0x7f,
- 0x7f, 0x7c, 0x7c, 0x80, 0x80, 0x80, 0x7f, 0x7d, 0x7f, 0x80, 0x7f, 0x82, 0x85, 0x86, 0x84, 0x82,
- 0x85, 0x86, 0x83, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x82, 0x81, 0x7d, 0x81, 0x86, 0x85, 0x81,
- 0x80, 0x81, 0x7f, 0x81, 0x82, 0x7e, 0x7f, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x83, 0x83, 0x80,
- 0x80, 0x81, 0x82, 0x83, 0x7f, 0x80, 0x83, 0x84, 0x83, 0x81, 0x83, 0x85, 0x82, 0x80, 0x7f, 0x80,
- 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x80, 0x7e, 0x7d, 0x80, 0x83, 0x81, 0x7f, 0x7f, 0x7f, 0x7e, 0x7d,
- 0x7c, 0x7e, 0x80, 0x83, 0x84, 0x85, 0x87, 0x86, 0x87, 0x89, 0x87, 0x82, 0x81, 0x80, 0x7f, 0x80,
- 0x7f, 0x80, 0x7e, 0x7c, 0x80, 0x80, 0x7e, 0x7d, 0x7f, 0x7b, 0x7b, 0x7a, 0x79, 0x7d, 0x7e, 0x7e,
- 0x82, 0x84, 0x81, 0x82, 0x83, 0x85, 0x85, 0x82, 0x7f, 0x81, 0x81, 0x7d, 0x7e, 0x81, 0x82, 0x80,
- 0x80, 0x81, 0x80, 0x7e, 0x81, 0x80, 0x80, 0x80, 0x7b, 0x7e, 0x7f, 0x7c, 0x7c, 0x7d, 0x80, 0x80,
- 0x7e, 0x7e, 0x7f, 0x81, 0x80, 0x7e, 0x80, 0x83, 0x7f, 0x7e, 0x7f, 0x81, 0x82, 0x81, 0x83, 0x84,
- 0x80, 0x7e, 0x7b, 0x7b, 0x7f, 0x7f, 0x7e, 0x7e, 0x7b, 0x7a, 0x7f, 0x82, 0x83, 0x80, 0x82, 0x84,
- 0x83, 0x81, 0x7c, 0x7e, 0x7e, 0x7e, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x7d, 0x7d,
- 0x7e, 0x7f, 0x80, 0x81, 0x7f, 0x80, 0x82, 0x81, 0x83, 0x85, 0x82, 0x7e, 0x80, 0x80, 0x7e, 0x7e,
- 0x80, 0x83, 0x83, 0x82, 0x81, 0x82, 0x82, 0x80, 0x81, 0x80, 0x7e, 0x7d, 0x7e, 0x7f, 0x7e, 0x80,
- 0x83, 0x82, 0x7e, 0x7e, 0x83, 0x84, 0x81, 0x80, 0x7e, 0x7c, 0x7b, 0x7c, 0x7f, 0x80, 0x7d, 0x7a,
- 0x7b, 0x7d, 0x7f, 0x81, 0x81, 0x7f, 0x7f, 0x7d, 0x7b, 0x7d, 0x80, 0x7e, 0x7d, 0x80, 0x81, 0x80,
- 0x81, 0x83, 0x84, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7b, 0x7a, 0x7d, 0x82, 0x82, 0x82, 0x83,
- 0x85, 0x83, 0x82, 0x84, 0x81, 0x7f, 0x7f, 0x82, 0x83, 0x83, 0x80, 0x81, 0x83, 0x81, 0x7f, 0x81,
- 0x7f, 0x7b, 0x7d, 0x7d, 0x7b, 0x78, 0x7b, 0x81, 0x7d, 0x79, 0x7b, 0x7f, 0x84, 0x87, 0x84, 0x81,
- 0x7f, 0x7e, 0x7f, 0x7f, 0x7e, 0x7d, 0x7f, 0x7f, 0x7e, 0x7c, 0x7e, 0x81, 0x7f, 0x7f, 0x81, 0x7f,
- 0x81, 0x83, 0x7f, 0x7b, 0x7e, 0x82, 0x82, 0x80, 0x83, 0x86, 0x84, 0x80, 0x7d, 0x7d, 0x7f, 0x7f,
- 0x81, 0x80, 0x7d, 0x7b, 0x7c, 0x7e, 0x7e, 0x82, 0x82, 0x81, 0x82, 0x82, 0x83, 0x81, 0x80, 0x81,
- 0x83, 0x84, 0x83, 0x81, 0x80, 0x85, 0x84, 0x82, 0x82, 0x80, 0x7d, 0x7f, 0x81, 0x7f, 0x7e, 0x7f,
- 0x7e, 0x7e, 0x7f, 0x7e, 0x80, 0x80, 0x7f, 0x81, 0x81, 0x7e, 0x7e, 0x7d, 0x7f, 0x80, 0x7e, 0x80,
- 0x83, 0x83, 0x81, 0x81, 0x7e, 0x7d, 0x7d, 0x7c, 0x7b, 0x7b, 0x7a, 0x7a, 0x7e, 0x7e, 0x7d, 0x7e,
- 0x7e, 0x7e, 0x7e, 0x7d, 0x7f, 0x7f, 0x7e, 0x7e, 0x81, 0x83, 0x82, 0x84, 0x88, 0x86, 0x83, 0x84,
- 0x84, 0x81, 0x83, 0x83, 0x81, 0x81, 0x80, 0x7e, 0x7f, 0x80, 0x82, 0x81, 0x7e, 0x7b, 0x7d, 0x7e,
- 0x7e, 0x7d, 0x79, 0x7d, 0x80, 0x7f, 0x80, 0x7f, 0x81, 0x81, 0x81, 0x82, 0x7e, 0x7f, 0x83, 0x81,
- 0x7e, 0x7d, 0x81, 0x84, 0x82, 0x7f, 0x7f, 0x81, 0x83, 0x82, 0x80, 0x7e, 0x7c, 0x7e, 0x7e, 0x7e,
- 0x7c, 0x80, 0x81, 0x7d, 0x7c, 0x7d, 0x7f, 0x81, 0x80, 0x7c, 0x7b, 0x7b, 0x7c, 0x7b, 0x7b, 0x7d,
- 0x7f, 0x80, 0x81, 0x84, 0x89, 0x87, 0x81, 0x82, 0x83, 0x80, 0x7d, 0x7f, 0x81, 0x80, 0x7e, 0x7d,
- 0x80, 0x81, 0x7c, 0x7a, 0x7c, 0x7f, 0x7e, 0x7d, 0x7e, 0x81, 0x81, 0x7c, 0x7e, 0x83, 0x81, 0x7e,
- 0x80, 0x84, 0x81, 0x80, 0x82, 0x81, 0x81, 0x7c, 0x7c, 0x80, 0x81, 0x7e, 0x7a, 0x7f, 0x83, 0x83,
- 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7e, 0x80, 0x81, 0x7d, 0x7a, 0x7e, 0x80, 0x81, 0x82, 0x82,
- 0x83, 0x80, 0x7e, 0x7e, 0x7d, 0x7a, 0x78, 0x78, 0x7b, 0x7d, 0x7d, 0x80, 0x83, 0x7f, 0x7e, 0x82,
- 0x84, 0x80, 0x80, 0x82, 0x80, 0x81, 0x83, 0x80, 0x7d, 0x80, 0x81, 0x81, 0x81, 0x7e, 0x7a, 0x79,
- 0x78, 0x77, 0x79, 0x7a, 0x7b, 0x7e, 0x80, 0x81, 0x80, 0x82, 0x82, 0x7f, 0x7e, 0x7d, 0x7c, 0x80,
- 0x7f, 0x7e, 0x81, 0x80, 0x82, 0x85, 0x89, 0x87, 0x83, 0x82, 0x82, 0x81, 0x80, 0x82, 0x80, 0x7e,
- 0x7e, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x7f, 0x7e, 0x7b, 0x79, 0x7b, 0x7e, 0x80, 0x81, 0x7e, 0x7b,
- 0x80, 0x85, 0x85, 0x83, 0x82, 0x83, 0x84, 0x83, 0x7f, 0x7f, 0x7f, 0x7e, 0x80, 0x82, 0x80, 0x7f,
- 0x7f, 0x81, 0x82, 0x81, 0x7b, 0x79, 0x7b, 0x7e, 0x83, 0x85, 0x7f, 0x7d, 0x81, 0x83, 0x83, 0x84,
- 0x84, 0x82, 0x80, 0x81, 0x83, 0x82, 0x81, 0x80, 0x80, 0x7e, 0x7d, 0x81, 0x82, 0x85, 0x85, 0x82,
- 0x80, 0x81, 0x81, 0x7b, 0x7a, 0x79, 0x7a, 0x7d, 0x7d, 0x7c, 0x7c, 0x7e, 0x83, 0x80, 0x7d, 0x7d,
- 0x7e, 0x83, 0x81, 0x7f, 0x81, 0x84, 0x82, 0x82, 0x84, 0x83, 0x82, 0x82, 0x81, 0x81, 0x85, 0x83,
- 0x7c, 0x7b, 0x7f, 0x80, 0x81, 0x81, 0x82, 0x82, 0x84, 0x86, 0x84, 0x7f, 0x7f, 0x83, 0x84, 0x83,
- 0x81, 0x80, 0x80, 0x82, 0x84, 0x83, 0x81, 0x81, 0x83, 0x82, 0x81, 0x84, 0x80, 0x7f, 0x7f, 0x7e,
- 0x7d, 0x7e, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x83, 0x84, 0x80, 0x7d, 0x7f, 0x80, 0x81, 0x81, 0x80,
- 0x80, 0x82, 0x82, 0x82, 0x80, 0x80, 0x83, 0x82, 0x82, 0x7e, 0x7d, 0x81, 0x81, 0x7e, 0x7f, 0x82,
- 0x84, 0x81, 0x82, 0x83, 0x82, 0x83, 0x81, 0x81, 0x7e, 0x7d, 0x7b, 0x7b, 0x7f, 0x83, 0x85, 0x86,
- 0x82, 0x82, 0x83, 0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x7e, 0x80, 0x81, 0x82, 0x82, 0x80, 0x7d, 0x7d,
- 0x82, 0x81, 0x7f, 0x7d, 0x7d, 0x7e, 0x7f, 0x82, 0x80, 0x80, 0x82, 0x83, 0x82, 0x84, 0x86, 0x83,
- 0x7e, 0x7f, 0x7f, 0x7b, 0x7d, 0x81, 0x81, 0x81, 0x7e, 0x7c, 0x7f, 0x7f, 0x7f, 0x7c, 0x7b, 0x7b,
- 0x7a, 0x79, 0x7b, 0x7f, 0x7b, 0x77, 0x7c, 0x7f, 0x7f, 0x83, 0x87, 0x82, 0x80, 0x80, 0x80, 0x7f,
- 0x7f, 0x82, 0x82, 0x84, 0x85, 0x86, 0x85, 0x82, 0x82, 0x85, 0x81, 0x7e, 0x7b, 0x7c, 0x80, 0x7e,
- 0x80, 0x80, 0x7f, 0x85, 0x82, 0x81, 0x82, 0x81, 0x7e, 0x79, 0x7d, 0x80, 0x7c, 0x7a, 0x7e, 0x81,
- 0x81, 0x80, 0x82, 0x82, 0x80, 0x83, 0x82, 0x7f, 0x80, 0x81, 0x83, 0x82, 0x81, 0x84, 0x85, 0x85,
- 0x83, 0x81, 0x80, 0x7d, 0x7f, 0x7b, 0x78, 0x7b, 0x7b, 0x7b, 0x7c, 0x7e, 0x82, 0x82, 0x83, 0x84,
- 0x85, 0x84, 0x83, 0x83, 0x82, 0x7e, 0x80, 0x81, 0x80, 0x7f, 0x81, 0x82, 0x81, 0x82, 0x82, 0x81,
- 0x7f, 0x80, 0x82, 0x81, 0x80, 0x82, 0x82, 0x81, 0x85, 0x85, 0x83, 0x81, 0x81, 0x81, 0x7c, 0x7c,
- 0x7f, 0x7c, 0x80, 0x80, 0x7b, 0x7a, 0x7e, 0x82, 0x83, 0x82, 0x83, 0x84, 0x83, 0x86, 0x84, 0x82,
- 0x82, 0x81, 0x81, 0x81, 0x82, 0x83, 0x82, 0x80, 0x7e, 0x7f, 0x7c, 0x7a, 0x7a, 0x7b, 0x7b, 0x7b,
- 0x79, 0x7d, 0x81, 0x81, 0x83, 0x83, 0x82, 0x83, 0x82, 0x83, 0x88, 0x84, 0x81, 0x82, 0x84, 0x85,
- 0x83, 0x85, 0x89, 0x89, 0x87, 0x82, 0x7f, 0x7e, 0x7d, 0x80, 0x7c, 0x7a, 0x79, 0x7b, 0x7e, 0x7d,
- 0x7d, 0x7e, 0x7f, 0x80, 0x7d, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x82, 0x84, 0x87, 0x88,
- 0x8b, 0x89, 0x84, 0x83, 0x85, 0x83, 0x80, 0x80, 0x82, 0x81, 0x7e, 0x7d, 0x81, 0x82, 0x83, 0x83,
- 0x7d, 0x7d, 0x81, 0x7f, 0x7f, 0x7f, 0x7e, 0x7d, 0x7c, 0x81, 0x83, 0x81, 0x81, 0x82, 0x83, 0x81,
- 0x80, 0x7f, 0x7d, 0x7d, 0x7c, 0x7c, 0x7d, 0x7e, 0x81, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x81, 0x84,
- 0x80, 0x7b, 0x78, 0x7f, 0x83, 0x82, 0x82, 0x80, 0x84, 0x87, 0x88, 0x87, 0x86, 0x83, 0x7f, 0x7b,
- 0x7c, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x83, 0x81, 0x80, 0x80, 0x7f, 0x7b, 0x79, 0x7d,
- 0x80, 0x80, 0x82, 0x88, 0x88, 0x83, 0x83, 0x87, 0x85, 0x83, 0x83, 0x81, 0x80, 0x7f, 0x7e, 0x80,
- 0x80, 0x80, 0x80, 0x82, 0x81, 0x7f, 0x7c, 0x7a, 0x7b, 0x7a, 0x7a, 0x7c, 0x7e, 0x7f, 0x7c, 0x7d,
- 0x80, 0x83, 0x83, 0x81, 0x7f, 0x7c, 0x7d, 0x7e, 0x7e, 0x80, 0x82, 0x84, 0x82, 0x81, 0x85, 0x85,
- 0x86, 0x85, 0x84, 0x85, 0x82, 0x81, 0x83, 0x82, 0x7d, 0x7c, 0x7f, 0x7e, 0x7b, 0x7d, 0x7b, 0x7a,
- 0x7d, 0x80, 0x81, 0x7e, 0x82, 0x84, 0x83, 0x84, 0x85, 0x83, 0x82, 0x84, 0x82, 0x82, 0x83, 0x80,
- 0x82, 0x82, 0x83, 0x81, 0x7e, 0x7b, 0x7b, 0x80, 0x7e, 0x7c, 0x82, 0x88, 0x87, 0x84, 0x82, 0x82,
- 0x7e, 0x7d, 0x7f, 0x7d, 0x7d, 0x7d, 0x7c, 0x81, 0x86, 0x86, 0x82, 0x7f, 0x7f, 0x7d, 0x7d, 0x7c,
- 0x7c, 0x7d, 0x7a, 0x7a, 0x7f, 0x81, 0x81, 0x81, 0x84, 0x84, 0x82, 0x82, 0x7e, 0x79, 0x79, 0x7a,
- 0x7d, 0x80, 0x80, 0x7e, 0x7b, 0x81, 0x83, 0x81, 0x7e, 0x7e, 0x7f, 0x7c, 0x7b, 0x7d, 0x83, 0x85,
- 0x84, 0x83, 0x86, 0x87, 0x84, 0x82, 0x82, 0x80, 0x7d, 0x7c, 0x7d, 0x7a, 0x7c, 0x7e, 0x7d, 0x80,
- 0x80, 0x83, 0x83, 0x7d, 0x81, 0x84, 0x84, 0x82, 0x82, 0x83, 0x83, 0x80, 0x7c, 0x80, 0x84, 0x85,
- 0x85, 0x81, 0x7c, 0x7e, 0x80, 0x7c, 0x77, 0x78, 0x7e, 0x7f, 0x7b, 0x7f, 0x82, 0x81, 0x84, 0x83,
- 0x80, 0x7e, 0x7c, 0x7c, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7c, 0x7e, 0x83, 0x87, 0x83, 0x82, 0x83,
- 0x81, 0x80, 0x82, 0x83, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x80, 0x82, 0x82, 0x80, 0x7e, 0x7e, 0x81,
- 0x81, 0x7f, 0x7e, 0x7e, 0x81, 0x84, 0x84, 0x82, 0x80, 0x84, 0x87, 0x87, 0x89, 0x82, 0x7d, 0x7f,
- 0x81, 0x7f, 0x7d, 0x7a, 0x7a, 0x7d, 0x7f, 0x7e, 0x80, 0x81, 0x7f, 0x7f, 0x7f, 0x80, 0x7b, 0x79,
- 0x7d, 0x81, 0x82, 0x7f, 0x7c, 0x7f, 0x83, 0x81, 0x81, 0x80, 0x7b, 0x7b, 0x79, 0x78, 0x7b, 0x7f,
- 0x7d, 0x7d, 0x84, 0x87, 0x85, 0x82, 0x84, 0x87, 0x84, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x80,
- 0x83, 0x86, 0x82, 0x84, 0x85, 0x81, 0x81, 0x7e, 0x79, 0x79, 0x7e, 0x7f, 0x7d, 0x7d, 0x7e, 0x86,
- 0x87, 0x81, 0x80, 0x80, 0x80, 0x7e, 0x79, 0x7a, 0x7d, 0x83, 0x87, 0x84, 0x80, 0x81, 0x82, 0x80,
- 0x80, 0x7f, 0x7e, 0x7c, 0x7d, 0x7f, 0x7c, 0x7b, 0x7e, 0x7f, 0x7e, 0x83, 0x86, 0x81, 0x7f, 0x7f,
- 0x7d, 0x7c, 0x7d, 0x80, 0x82, 0x80, 0x7e, 0x7f, 0x82, 0x85, 0x85, 0x82, 0x82, 0x81, 0x82, 0x83,
- 0x81, 0x7d, 0x7b, 0x7a, 0x7d, 0x81, 0x83, 0x7f, 0x80, 0x82, 0x82, 0x80, 0x7d, 0x80, 0x80, 0x7c,
- 0x7a, 0x80, 0x82, 0x7e, 0x82, 0x83, 0x83, 0x83, 0x7e, 0x7b, 0x7f, 0x82, 0x81, 0x81, 0x7f, 0x7a,
- 0x7b, 0x80, 0x81, 0x7f, 0x7e, 0x80, 0x7f, 0x7d, 0x7d, 0x7f, 0x80, 0x80, 0x7e, 0x7b, 0x7b, 0x7e,
- 0x83, 0x83, 0x84, 0x84, 0x80, 0x7e, 0x80, 0x82, 0x82, 0x82, 0x81, 0x81, 0x80, 0x7d, 0x7d, 0x7f,
- 0x82, 0x7f, 0x7c, 0x82, 0x85, 0x86, 0x84, 0x7c, 0x78, 0x7c, 0x7f, 0x7b, 0x7b, 0x7f, 0x83, 0x82,
- 0x7f, 0x80, 0x7e, 0x7e, 0x83, 0x7e, 0x7c, 0x80, 0x80, 0x7e, 0x80, 0x83, 0x86, 0x83, 0x7c, 0x7f,
- 0x7f, 0x7e, 0x7f, 0x81, 0x84, 0x7f, 0x7e, 0x80, 0x7f, 0x83, 0x88, 0x87, 0x84, 0x82, 0x81, 0x81,
- 0x83, 0x81, 0x7f, 0x7b, 0x7a, 0x7c, 0x7c, 0x7c, 0x7c, 0x79, 0x76, 0x7b, 0x80, 0x82, 0x83, 0x81,
- 0x7d, 0x7b, 0x7e, 0x82, 0x80, 0x83, 0x84, 0x85, 0x83, 0x84, 0x86, 0x86, 0x84, 0x82, 0x81, 0x81,
- 0x82, 0x80, 0x80, 0x82, 0x80, 0x7d, 0x7d, 0x7b, 0x7a, 0x7b, 0x7b, 0x7a, 0x7f, 0x7d, 0x7d, 0x7c,
- 0x79, 0x7d, 0x7f, 0x82, 0x84, 0x87, 0x87, 0x84, 0x81, 0x80, 0x82, 0x82, 0x85, 0x86, 0x7f, 0x81,
- 0x83, 0x81, 0x83, 0x83, 0x82, 0x81, 0x7d, 0x7a, 0x7d, 0x7f, 0x81, 0x83, 0x80, 0x80, 0x84, 0x84,
- 0x83, 0x83, 0x84, 0x83, 0x80, 0x7f, 0x81, 0x82, 0x80, 0x7d, 0x7b, 0x7e, 0x7f, 0x7f, 0x7e, 0x81,
- 0x83, 0x80, 0x80, 0x81, 0x83, 0x81, 0x7c, 0x7b, 0x7b, 0x7f, 0x84, 0x82, 0x85, 0x89, 0x87, 0x83,
- 0x7e, 0x78, 0x7a, 0x80, 0x81, 0x7b, 0x7b, 0x80, 0x7e, 0x7f, 0x81, 0x7e, 0x7d, 0x7e, 0x7e, 0x7d,
- 0x80, 0x80, 0x7c, 0x7f, 0x7e, 0x7a, 0x7a, 0x7f, 0x82, 0x80, 0x86, 0x87, 0x81, 0x80, 0x83, 0x83,
- 0x84, 0x81, 0x7f, 0x81, 0x81, 0x83, 0x83, 0x83, 0x82, 0x7e, 0x7c, 0x80, 0x7e, 0x80, 0x7c, 0x77,
- 0x7a, 0x7c, 0x7b, 0x7f, 0x83, 0x81, 0x82, 0x83, 0x82, 0x7e, 0x7e, 0x80, 0x81, 0x82, 0x7f, 0x7b,
- 0x7c, 0x7f, 0x80, 0x83, 0x85, 0x7f, 0x7b, 0x7d, 0x80, 0x7b, 0x76, 0x7a, 0x7f, 0x7f, 0x7c, 0x7c,
- 0x7f, 0x7f, 0x81, 0x86, 0x86, 0x82, 0x81, 0x81, 0x82, 0x81, 0x7c, 0x7e, 0x84, 0x84, 0x82, 0x80,
- 0x82, 0x80, 0x7e, 0x7e, 0x81, 0x80, 0x7b, 0x7e, 0x83, 0x81, 0x7f, 0x81, 0x81, 0x84, 0x84, 0x80,
- 0x7c, 0x7a, 0x7f, 0x82, 0x7f, 0x7c, 0x7b, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x84, 0x84, 0x82, 0x83,
- 0x83, 0x83, 0x82, 0x81, 0x81, 0x80, 0x80, 0x81, 0x7d, 0x7c, 0x80, 0x84, 0x83, 0x7f, 0x82, 0x85,
- 0x83, 0x82, 0x7e, 0x7c, 0x7f, 0x81, 0x81, 0x7e, 0x84, 0x86, 0x80, 0x82, 0x84, 0x80, 0x7f, 0x81,
- 0x80, 0x7c, 0x7a, 0x7d, 0x7e, 0x7f, 0x84, 0x87, 0x81, 0x81, 0x84, 0x84, 0x82, 0x7b, 0x7b, 0x7c,
- 0x7b, 0x7f, 0x80, 0x7f, 0x80, 0x82, 0x88, 0x87, 0x82, 0x84, 0x82, 0x81, 0x80, 0x82, 0x83, 0x82,
- 0x7e, 0x7f, 0x86, 0x84, 0x81, 0x7c, 0x7a, 0x80, 0x83, 0x7c, 0x7a, 0x7e, 0x82, 0x7b, 0x79, 0x80,
- 0x83, 0x7f, 0x81, 0x83, 0x83, 0x84, 0x85, 0x83, 0x7f, 0x81, 0x86, 0x86, 0x82, 0x7a, 0x7f, 0x85,
- 0x85, 0x86, 0x85, 0x86, 0x83, 0x80, 0x7e, 0x7c, 0x80, 0x82, 0x7e, 0x79, 0x7c, 0x82, 0x80, 0x80,
- 0x80, 0x7c, 0x7f, 0x7d, 0x80, 0x85, 0x80, 0x7e, 0x7e, 0x7b, 0x7d, 0x84, 0x85, 0x80, 0x7c, 0x7c,
- 0x80, 0x80, 0x7c, 0x7d, 0x7d, 0x7f, 0x85, 0x82, 0x7c, 0x7b, 0x7e, 0x85, 0x87, 0x83, 0x84, 0x84,
- 0x81, 0x81, 0x7f, 0x7f, 0x7e, 0x7c, 0x7b, 0x79, 0x80, 0x85, 0x82, 0x7f, 0x7f, 0x83, 0x83, 0x81,
- 0x7f, 0x7d, 0x7d, 0x80, 0x7b, 0x81, 0x88, 0x86, 0x85, 0x82, 0x83, 0x85, 0x7f, 0x7e, 0x83, 0x81,
- 0x80, 0x7c, 0x7a, 0x7e, 0x84, 0x86, 0x80, 0x83, 0x84, 0x81, 0x7f, 0x7e, 0x83, 0x80, 0x79, 0x7a,
- 0x79, 0x7b, 0x7f, 0x82, 0x85, 0x83, 0x81, 0x83, 0x84, 0x80, 0x7a, 0x7a, 0x7c, 0x7a, 0x7a, 0x80,
- 0x81, 0x7f, 0x81, 0x82, 0x81, 0x83, 0x85, 0x81, 0x7e, 0x80, 0x86, 0x81, 0x7a, 0x7a, 0x80, 0x85,
- 0x86, 0x83, 0x85, 0x87, 0x89, 0x84, 0x78, 0x79, 0x80, 0x80, 0x7d, 0x7b, 0x7d, 0x81, 0x86, 0x85,
- 0x81, 0x81, 0x82, 0x7f, 0x7c, 0x7f, 0x81, 0x7f, 0x7e, 0x81, 0x82, 0x81, 0x82, 0x84, 0x83, 0x81,
- 0x7e, 0x7b, 0x7f, 0x7f, 0x7d, 0x7a, 0x7a, 0x7d, 0x7f, 0x80, 0x86, 0x89, 0x7d, 0x79, 0x83, 0x88,
- 0x85, 0x7f, 0x7e, 0x85, 0x81, 0x7b, 0x7c, 0x7f, 0x84, 0x86, 0x85, 0x84, 0x80, 0x7e, 0x7e, 0x81,
- 0x80, 0x7e, 0x7e, 0x7f, 0x81, 0x7e, 0x7c, 0x7e, 0x7b, 0x79, 0x7e, 0x82, 0x7e, 0x7a, 0x7c, 0x7e,
- 0x7f, 0x80, 0x7f, 0x82, 0x86, 0x84, 0x82, 0x81, 0x80, 0x82, 0x81, 0x81, 0x7f, 0x7f, 0x84, 0x81,
- 0x7c, 0x7a, 0x81, 0x84, 0x81, 0x7d, 0x80, 0x84, 0x80, 0x80, 0x83, 0x85, 0x81, 0x80, 0x82, 0x7f,
- 0x7d, 0x84, 0x7f, 0x80, 0x83, 0x7f, 0x82, 0x7c, 0x79, 0x80, 0x83, 0x80, 0x7b, 0x79, 0x7c, 0x81,
- 0x82, 0x82, 0x83, 0x80, 0x82, 0x84, 0x84, 0x82, 0x86, 0x85, 0x82, 0x7f, 0x7c, 0x80, 0x85, 0x80,
- 0x7f, 0x7c, 0x7a, 0x7e, 0x7d, 0x7d, 0x7d, 0x7b, 0x7b, 0x7d, 0x7d, 0x7e, 0x7e, 0x80, 0x83, 0x81,
- 0x7e, 0x83, 0x82, 0x86, 0x89, 0x84, 0x81, 0x80, 0x7f, 0x83, 0x88, 0x86, 0x83, 0x85, 0x86, 0x87,
- 0x7e, 0x76, 0x7a, 0x7d, 0x7b, 0x7e, 0x7f, 0x79, 0x7e, 0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7d,
- 0x7e, 0x83, 0x7c, 0x7a, 0x7f, 0x82, 0x80, 0x7f, 0x82, 0x7f, 0x7e, 0x82, 0x82, 0x7e, 0x7f, 0x80,
- 0x80, 0x80, 0x7c, 0x7c, 0x7f, 0x83, 0x80, 0x7e, 0x81, 0x88, 0x8a, 0x82, 0x7f, 0x7c, 0x7d, 0x7d,
- 0x7e, 0x7c, 0x7c, 0x81, 0x84, 0x86, 0x81, 0x82, 0x81, 0x7a, 0x7a, 0x7e, 0x79, 0x74, 0x79, 0x7e,
- 0x81, 0x82, 0x85, 0x83, 0x82, 0x84, 0x81, 0x81, 0x7f, 0x7d, 0x7f, 0x80, 0x81, 0x80, 0x7e, 0x82,
- 0x85, 0x80, 0x7f, 0x7e, 0x80, 0x80, 0x7c, 0x7f, 0x7f, 0x7e, 0x7d, 0x7e, 0x7c, 0x82, 0x86, 0x87,
- 0x84, 0x81, 0x85, 0x82, 0x82, 0x7e, 0x7d, 0x83, 0x80, 0x7f, 0x81, 0x86, 0x86, 0x85, 0x81, 0x85,
- 0x85, 0x82, 0x7e, 0x7b, 0x7a, 0x7a, 0x79, 0x7b, 0x7c, 0x81, 0x88, 0x81, 0x81, 0x83, 0x83, 0x85,
- 0x7f, 0x79, 0x79, 0x79, 0x7b, 0x7d, 0x7e, 0x7f, 0x84, 0x82, 0x7f, 0x83, 0x81, 0x7d, 0x7b, 0x81,
- 0x82, 0x7c, 0x77, 0x78, 0x80, 0x81, 0x82, 0x83, 0x83, 0x80, 0x82, 0x84, 0x84, 0x82, 0x80, 0x7f,
- 0x80, 0x84, 0x84, 0x83, 0x80, 0x81, 0x7f, 0x84, 0x83, 0x81, 0x7f, 0x7a, 0x7b, 0x7c, 0x78, 0x7b,
- 0x7b, 0x79, 0x83, 0x87, 0x83, 0x81, 0x83, 0x85, 0x88, 0x84, 0x7f, 0x80, 0x82, 0x84, 0x83, 0x84,
- 0x86, 0x89, 0x85, 0x83, 0x84, 0x81, 0x7f, 0x7b, 0x7d, 0x7e, 0x7a, 0x78, 0x7c, 0x7c, 0x79, 0x7f,
- 0x83, 0x81, 0x7c, 0x79, 0x7b, 0x7d, 0x7b, 0x7d, 0x7e, 0x80, 0x7f, 0x82, 0x85, 0x83, 0x82, 0x85,
- 0x87, 0x87, 0x83, 0x82, 0x81, 0x80, 0x81, 0x7c, 0x7f, 0x82, 0x80, 0x7e, 0x7c, 0x7c, 0x7d, 0x78,
- 0x77, 0x79, 0x7c, 0x7d, 0x78, 0x7a, 0x7c, 0x7c, 0x80, 0x80, 0x81, 0x84, 0x81, 0x81, 0x85, 0x84,
- 0x86, 0x87, 0x86, 0x82, 0x7e, 0x7e, 0x81, 0x82, 0x82, 0x80, 0x7f, 0x7b, 0x7e, 0x80, 0x81, 0x7d,
- 0x78, 0x7e, 0x82, 0x7e, 0x7b, 0x79, 0x7a, 0x84, 0x82, 0x7b, 0x7c, 0x81, 0x84, 0x86, 0x80, 0x7b,
- 0x82, 0x85, 0x84, 0x86, 0x81, 0x7e, 0x83, 0x81, 0x7c, 0x7b, 0x7e, 0x7c, 0x80, 0x7e, 0x82, 0x84,
- 0x7e, 0x7f, 0x80, 0x82, 0x7f, 0x7f, 0x88, 0x8a, 0x83, 0x85, 0x84, 0x81, 0x85, 0x81, 0x7d, 0x7d,
- 0x83, 0x84, 0x82, 0x86, 0x84, 0x7f, 0x7c, 0x7d, 0x7f, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7f, 0x7e,
- 0x7f, 0x7f, 0x7e, 0x81, 0x85, 0x83, 0x81, 0x7e, 0x85, 0x85, 0x85, 0x81, 0x7f, 0x84, 0x88, 0x84,
- 0x83, 0x81, 0x87, 0x86, 0x85, 0x7b, 0x7c, 0x80, 0x78, 0x7c, 0x7f, 0x7c, 0x82, 0x82, 0x7f, 0x7f,
- 0x7f, 0x83, 0x80, 0x82, 0x84, 0x81, 0x83, 0x82, 0x85, 0x7f, 0x85, 0x87, 0x80, 0x7f, 0x82, 0x7f,
- 0x7d, 0x7d, 0x82, 0x82, 0x82, 0x7d, 0x7d, 0x87, 0x86, 0x83, 0x82, 0x7f, 0x7f, 0x80, 0x80, 0x7f,
- 0x85, 0x83, 0x82, 0x82, 0x7e, 0x80, 0x86, 0x84, 0x7c, 0x7f, 0x81, 0x80, 0x80, 0x7f, 0x7d, 0x80,
- 0x80, 0x7c, 0x81, 0x7f, 0x80, 0x86, 0x87, 0x85, 0x86, 0x85, 0x82, 0x7e, 0x7c, 0x81, 0x81, 0x81,
- 0x82, 0x83, 0x85, 0x87, 0x86, 0x80, 0x7e, 0x83, 0x84, 0x82, 0x82, 0x82, 0x83, 0x7e, 0x7c, 0x7f,
- 0x7d, 0x7c, 0x80, 0x80, 0x7e, 0x7f, 0x7f, 0x82, 0x7c, 0x7f, 0x82, 0x83, 0x83, 0x7e, 0x84, 0x85,
- 0x85, 0x83, 0x83, 0x85, 0x81, 0x7e, 0x81, 0x81, 0x80, 0x7f, 0x81, 0x81, 0x7e, 0x7f, 0x7f, 0x80,
- 0x81, 0x7f, 0x7f, 0x7d, 0x7e, 0x7d, 0x81, 0x85, 0x87, 0x80, 0x7e, 0x83, 0x82, 0x83, 0x87, 0x85,
- 0x7e, 0x7d, 0x86, 0x86, 0x80, 0x82, 0x83, 0x7f, 0x7e, 0x7c, 0x80, 0x7f, 0x81, 0x82, 0x7c, 0x7e,
- 0x7e, 0x7b, 0x7a, 0x7f, 0x7f, 0x7c, 0x7e, 0x7f, 0x82, 0x81, 0x7f, 0x80, 0x81, 0x88, 0x88, 0x7f,
- 0x7c, 0x7c, 0x85, 0x83, 0x81, 0x80, 0x82, 0x84, 0x82, 0x87, 0x84, 0x84, 0x87, 0x85, 0x82, 0x81,
- 0x7d, 0x7c, 0x80, 0x7f, 0x7b, 0x7d, 0x7f, 0x7f, 0x82, 0x7e, 0x7b, 0x7a, 0x78, 0x7d, 0x7e, 0x80,
- 0x82, 0x84, 0x82, 0x84, 0x8a, 0x89, 0x89, 0x85, 0x82, 0x84, 0x83, 0x81, 0x84, 0x86, 0x86, 0x7d,
- 0x7d, 0x7d, 0x7a, 0x7d, 0x7b, 0x7c, 0x80, 0x7f, 0x7a, 0x7b, 0x7e, 0x7c, 0x7b, 0x7c, 0x7b, 0x7f,
- 0x83, 0x87, 0x87, 0x80, 0x81, 0x83, 0x81, 0x81, 0x87, 0x87, 0x83, 0x80, 0x7f, 0x85, 0x85, 0x82,
- 0x81, 0x80, 0x7f, 0x7d, 0x7b, 0x7d, 0x7e, 0x7c, 0x7f, 0x7e, 0x7c, 0x7c, 0x7e, 0x84, 0x87, 0x82,
- 0x80, 0x81, 0x7e, 0x80, 0x82, 0x80, 0x85, 0x83, 0x7f, 0x82, 0x82, 0x7e, 0x7c, 0x83, 0x85, 0x7e,
- 0x7d, 0x7b, 0x80, 0x81, 0x7d, 0x7b, 0x7b, 0x7b, 0x7e, 0x7e, 0x7f, 0x7e, 0x7e, 0x7d, 0x7d, 0x82,
- 0x86, 0x82, 0x80, 0x80, 0x7f, 0x81, 0x83, 0x83, 0x81, 0x82, 0x84, 0x80, 0x80, 0x7e, 0x7b, 0x7c,
- 0x7e, 0x80, 0x7f, 0x7f, 0x81, 0x7d, 0x80, 0x85, 0x7f, 0x7b, 0x7e, 0x7f, 0x80, 0x7e, 0x81, 0x85,
- 0x84, 0x80, 0x7e, 0x83, 0x83, 0x81, 0x7d, 0x7f, 0x80, 0x80, 0x82, 0x85, 0x85, 0x80, 0x7e, 0x81,
- 0x80, 0x80, 0x7e, 0x7a, 0x7d, 0x7c, 0x7f, 0x7c, 0x80, 0x83, 0x81, 0x81, 0x83, 0x82, 0x79, 0x7d,
- 0x82, 0x82, 0x83, 0x82, 0x80, 0x85, 0x84, 0x7f, 0x7c, 0x81, 0x82, 0x80, 0x82, 0x81, 0x83, 0x82,
- 0x7e, 0x80, 0x7d, 0x7c, 0x81, 0x7e, 0x82, 0x81, 0x7c, 0x80, 0x84, 0x83, 0x7d, 0x7f, 0x7d, 0x7d,
- 0x7e, 0x7d, 0x86, 0x84, 0x7e, 0x81, 0x85, 0x83, 0x7b, 0x7b, 0x85, 0x85, 0x7d, 0x79, 0x7a, 0x79,
- 0x7d, 0x7d, 0x79, 0x7c, 0x80, 0x84, 0x81, 0x7c, 0x83, 0x81, 0x7e, 0x83, 0x83, 0x7f, 0x7e, 0x7d,
- 0x81, 0x80, 0x7f, 0x83, 0x7f, 0x82, 0x84, 0x80, 0x7f, 0x81, 0x82, 0x81, 0x7b, 0x7c, 0x85, 0x83,
- 0x80, 0x81, 0x82, 0x82, 0x7e, 0x81, 0x83, 0x7e, 0x7d, 0x7f, 0x7f, 0x7f, 0x82, 0x80, 0x7e, 0x7f,
- 0x80, 0x7d, 0x7f, 0x7f, 0x7c, 0x7f, 0x83, 0x7f, 0x81, 0x82, 0x7f, 0x7b, 0x7f, 0x81, 0x81, 0x82,
- 0x7c, 0x7f, 0x7d, 0x7d, 0x80, 0x7c, 0x7d, 0x83, 0x80, 0x7c, 0x80, 0x7f, 0x7e, 0x7f, 0x7e, 0x7d,
- 0x81, 0x80, 0x85, 0x86, 0x82, 0x81, 0x83, 0x88, 0x85, 0x83, 0x7f, 0x7a, 0x7f, 0x86, 0x88, 0x82,
- 0x80, 0x7c, 0x7b, 0x7d, 0x80, 0x7d, 0x7e, 0x7f, 0x80, 0x7f, 0x83, 0x7f, 0x7e, 0x81, 0x84, 0x84,
- 0x82, 0x7e, 0x7d, 0x7b, 0x7d, 0x81, 0x7f, 0x80, 0x7c, 0x7d, 0x7c, 0x7b, 0x80, 0x7b, 0x7e, 0x82,
- 0x7d, 0x7a, 0x7d, 0x7f, 0x86, 0x82, 0x80, 0x80, 0x7f, 0x81, 0x82, 0x80, 0x83, 0x82, 0x81, 0x7e,
- 0x84, 0x84, 0x81, 0x84, 0x84, 0x84, 0x80, 0x7d, 0x7d, 0x7e, 0x84, 0x84, 0x7e, 0x7f, 0x7e, 0x7c,
- 0x7e, 0x7f, 0x7e, 0x79, 0x7a, 0x79, 0x7c, 0x7f, 0x81, 0x7f, 0x80, 0x81, 0x7e, 0x7f, 0x7c, 0x7d,
- 0x86, 0x83, 0x82, 0x82, 0x80, 0x85, 0x86, 0x81, 0x85, 0x85, 0x80, 0x7e, 0x7e, 0x81, 0x7d, 0x79,
- 0x7d, 0x79, 0x7b, 0x7e, 0x7b, 0x79, 0x7c, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x82, 0x7f, 0x7b, 0x80,
- 0x80, 0x85, 0x8a, 0x7e, 0x7d, 0x85, 0x88, 0x84, 0x83, 0x84, 0x83, 0x80, 0x7f, 0x84, 0x80, 0x7f,
- 0x81, 0x7d, 0x82, 0x88, 0x83, 0x7d, 0x7c, 0x7b, 0x80, 0x81, 0x7a, 0x79, 0x7c, 0x7b, 0x7a, 0x7d,
- 0x7c, 0x7a, 0x7f, 0x81, 0x81, 0x82, 0x81, 0x7d, 0x7e, 0x7d, 0x81, 0x7c, 0x7a, 0x80, 0x7e, 0x7a,
- 0x83, 0x86, 0x81, 0x80, 0x7f, 0x81, 0x84, 0x7b, 0x80, 0x80, 0x7d, 0x81, 0x7b, 0x7d, 0x82, 0x83,
- 0x81, 0x7d, 0x7b, 0x7c, 0x7e, 0x7d, 0x7f, 0x7f, 0x7f, 0x7e, 0x82, 0x80, 0x82, 0x81, 0x78, 0x73,
- 0x80, 0x83, 0x81, 0x7f, 0x7e, 0x7f, 0x83, 0x81, 0x7e, 0x7c, 0x7d, 0x7f, 0x82, 0x84, 0x7f, 0x7e,
- 0x80, 0x86, 0x82, 0x80, 0x7e, 0x7f, 0x82, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x83, 0x85, 0x80, 0x7b,
- 0x7e, 0x83, 0x7f, 0x7c, 0x7a, 0x7c, 0x7e, 0x7f, 0x7e, 0x7d, 0x7b, 0x7d, 0x80, 0x80, 0x82, 0x81,
- 0x80, 0x83, 0x84, 0x85, 0x7e, 0x7b, 0x86, 0x87, 0x82, 0x7e, 0x79, 0x7a, 0x81, 0x82, 0x7c, 0x79,
- 0x7d, 0x81, 0x7a, 0x7c, 0x7f, 0x81, 0x80, 0x7e, 0x80, 0x83, 0x7d, 0x7e, 0x81, 0x7f, 0x7e, 0x81,
- 0x7e, 0x7d, 0x85, 0x82, 0x80, 0x82, 0x80, 0x7b, 0x81, 0x80, 0x7d, 0x81, 0x81, 0x80, 0x84, 0x84,
- 0x86, 0x81, 0x83, 0x81, 0x80, 0x87, 0x82, 0x82, 0x81, 0x82, 0x81, 0x7e, 0x7b, 0x7b, 0x7c, 0x7f,
- 0x81, 0x7e, 0x7a, 0x7d, 0x7f, 0x81, 0x7f, 0x82, 0x81, 0x7d, 0x80, 0x82, 0x84, 0x81, 0x7f, 0x83,
- 0x88, 0x85, 0x80, 0x80, 0x85, 0x7f, 0x7d, 0x77, 0x78, 0x7b, 0x7a, 0x79, 0x7a, 0x81, 0x7e, 0x7d,
- 0x80, 0x7e, 0x7f, 0x7c, 0x7a, 0x81, 0x82, 0x83, 0x81, 0x84, 0x83, 0x83, 0x83, 0x85, 0x84, 0x86,
- 0x81, 0x78, 0x7a, 0x7e, 0x80, 0x79, 0x78, 0x7d, 0x80, 0x82, 0x7d, 0x7e, 0x7d, 0x80, 0x7f, 0x7c,
- 0x82, 0x84, 0x81, 0x82, 0x82, 0x83, 0x88, 0x84, 0x7e, 0x83, 0x80, 0x80, 0x7b, 0x7c, 0x7f, 0x7e,
- 0x7e, 0x77, 0x7d, 0x82, 0x82, 0x82, 0x7f, 0x81, 0x80, 0x81, 0x7e, 0x7d, 0x82, 0x83, 0x87, 0x84,
- 0x80, 0x87, 0x84, 0x84, 0x85, 0x7c, 0x80, 0x83, 0x80, 0x86, 0x86, 0x84, 0x80, 0x80, 0x81, 0x7d,
- 0x79, 0x7a, 0x7a, 0x7b, 0x80, 0x7e, 0x7d, 0x7d, 0x80, 0x81, 0x7c, 0x79, 0x7d, 0x80, 0x7f, 0x80,
- 0x7c, 0x7d, 0x84, 0x7e, 0x82, 0x83, 0x83, 0x84, 0x81, 0x85, 0x85, 0x81, 0x81, 0x81, 0x80, 0x81,
- 0x84, 0x7c, 0x80, 0x84, 0x80, 0x7d, 0x79, 0x7a, 0x77, 0x7e, 0x7f, 0x7f, 0x7d, 0x7b, 0x82, 0x84,
- 0x82, 0x80, 0x83, 0x81, 0x83, 0x87, 0x86, 0x85, 0x7e, 0x7f, 0x85, 0x7c, 0x84, 0x84, 0x81, 0x7e,
- 0x78, 0x78, 0x84, 0x86, 0x7d, 0x7c, 0x7a, 0x7c, 0x7b, 0x7d, 0x7c, 0x82, 0x84, 0x81, 0x7f, 0x7a,
- 0x7d, 0x83, 0x81, 0x7f, 0x7c, 0x7f, 0x83, 0x85, 0x82, 0x86, 0x8b, 0x81, 0x85, 0x82, 0x81, 0x87,
- 0x82, 0x7f, 0x80, 0x7d, 0x80, 0x81, 0x80, 0x7d, 0x7b, 0x81, 0x81, 0x7b, 0x79, 0x7b, 0x7e, 0x80,
- 0x81, 0x82, 0x80, 0x82, 0x83, 0x83, 0x82, 0x7d, 0x7e, 0x86, 0x84, 0x7e, 0x7d, 0x7e, 0x83, 0x81,
- 0x7f, 0x83, 0x84, 0x81, 0x7e, 0x83, 0x81, 0x83, 0x82, 0x81, 0x84, 0x80, 0x84, 0x8a, 0x89, 0x7f,
- 0x7c, 0x83, 0x84, 0x81, 0x81, 0x7f, 0x80, 0x7e, 0x82, 0x81, 0x7e, 0x84, 0x82, 0x82, 0x87, 0x84,
- 0x7e, 0x7e, 0x7f, 0x82, 0x82, 0x83, 0x82, 0x84, 0x86, 0x87, 0x82, 0x84, 0x83, 0x7f, 0x7d, 0x80,
- 0x81, 0x7f, 0x82, 0x82, 0x85, 0x82, 0x82, 0x80, 0x81, 0x80, 0x7d, 0x7d, 0x7c, 0x7f, 0x82, 0x82,
- 0x7b, 0x81, 0x85, 0x80, 0x82, 0x81, 0x82, 0x81, 0x83, 0x82, 0x84, 0x83, 0x83, 0x86, 0x86, 0x84,
- 0x86, 0x84, 0x84, 0x82, 0x7f, 0x80, 0x86, 0x84, 0x7d, 0x7e, 0x83, 0x80, 0x7f, 0x7e, 0x7c, 0x80,
- 0x82, 0x81, 0x82, 0x80, 0x7d, 0x84, 0x83, 0x81, 0x85, 0x87, 0x81, 0x7e, 0x80, 0x7e, 0x83, 0x7f,
- 0x7c, 0x80, 0x85, 0x83, 0x84, 0x81, 0x81, 0x86, 0x7f, 0x82, 0x85, 0x83, 0x7f, 0x7d, 0x80, 0x81,
- 0x80, 0x7c, 0x80, 0x80, 0x7c, 0x7f, 0x7d, 0x7c, 0x7b, 0x80, 0x7f, 0x7e, 0x7c, 0x81, 0x87, 0x81,
- 0x85, 0x82, 0x7f, 0x7e, 0x80, 0x83, 0x81, 0x7c, 0x7a, 0x80, 0x85, 0x83, 0x83, 0x81, 0x82, 0x83,
- 0x83, 0x81, 0x7c, 0x7c, 0x82, 0x7c, 0x7f, 0x85, 0x83, 0x81, 0x7d, 0x7b, 0x80, 0x7f, 0x7f, 0x80,
- 0x7f, 0x84, 0x84, 0x7f, 0x7d, 0x7d, 0x7f, 0x81, 0x7d, 0x7c, 0x7e, 0x80, 0x80, 0x7f, 0x80, 0x7e,
- 0x80, 0x7b, 0x7f, 0x81, 0x7e, 0x81, 0x7f, 0x82, 0x80, 0x82, 0x87, 0x82, 0x85, 0x89, 0x85, 0x82,
- 0x81, 0x84, 0x83, 0x80, 0x7f, 0x7f, 0x80, 0x7d, 0x80, 0x7d, 0x78, 0x76, 0x79, 0x79, 0x7c, 0x7f,
- 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x87, 0x81, 0x7d, 0x80, 0x86, 0x87, 0x82, 0x7f, 0x80, 0x82, 0x7f,
- 0x80, 0x82, 0x83, 0x83, 0x7d, 0x7f, 0x82, 0x80, 0x7d, 0x7e, 0x80, 0x7c, 0x7c, 0x7e, 0x81, 0x7f,
- 0x82, 0x7e, 0x7b, 0x7e, 0x7f, 0x81, 0x7e, 0x7d, 0x7b, 0x7b, 0x7d, 0x81, 0x80, 0x83, 0x82, 0x81,
- 0x82, 0x7f, 0x7e, 0x85, 0x80, 0x7e, 0x84, 0x82, 0x7d, 0x7c, 0x81, 0x7f, 0x82, 0x86, 0x82, 0x80,
- 0x7f, 0x7e, 0x7d, 0x80, 0x85, 0x81, 0x7e, 0x7d, 0x7b, 0x7f, 0x80, 0x80, 0x7d, 0x7e, 0x80, 0x80,
- 0x82, 0x82, 0x83, 0x81, 0x7c, 0x7c, 0x7c, 0x7c, 0x84, 0x81, 0x82, 0x83, 0x81, 0x7e, 0x7f, 0x83,
- 0x87, 0x85, 0x7f, 0x81, 0x80, 0x85, 0x84, 0x84, 0x83, 0x84, 0x80, 0x7b, 0x7f, 0x83, 0x81, 0x7b,
- 0x7a, 0x7b, 0x7b, 0x7f, 0x80, 0x81, 0x84, 0x80, 0x7f, 0x7e, 0x82, 0x83, 0x80, 0x80, 0x7c, 0x81,
- 0x80, 0x86, 0x86, 0x83, 0x83, 0x84, 0x85, 0x7c, 0x7d, 0x83, 0x81, 0x82, 0x7f, 0x81, 0x81, 0x7f,
- 0x82, 0x82, 0x7f, 0x80, 0x7f, 0x7c, 0x7c, 0x82, 0x85, 0x82, 0x80, 0x7e, 0x7c, 0x80, 0x7f, 0x82,
- 0x84, 0x83, 0x86, 0x81, 0x7f, 0x85, 0x83, 0x80, 0x7f, 0x7e, 0x82, 0x80, 0x7f, 0x80, 0x82, 0x80,
- 0x7f, 0x80, 0x7f, 0x83, 0x81, 0x81, 0x82, 0x7e, 0x7d, 0x79, 0x81, 0x82, 0x83, 0x83, 0x7e, 0x7e,
- 0x84, 0x83, 0x7e, 0x80, 0x86, 0x82, 0x79, 0x80, 0x87, 0x85, 0x82, 0x85, 0x84, 0x84, 0x81, 0x80,
- 0x81, 0x80, 0x7f, 0x7e, 0x82, 0x7b, 0x7c, 0x81, 0x80, 0x82, 0x80, 0x7a, 0x7b, 0x7f, 0x7f, 0x80,
- 0x7d, 0x80, 0x81, 0x7a, 0x7d, 0x84, 0x81, 0x7b, 0x7c, 0x7d, 0x7e, 0x80, 0x7e, 0x84, 0x82, 0x82,
- 0x82, 0x85, 0x86, 0x7f, 0x82, 0x84, 0x7f, 0x7e, 0x7a, 0x81, 0x7e, 0x7a, 0x7e, 0x7f, 0x82, 0x7e,
- 0x7f, 0x7b, 0x77, 0x7c, 0x7e, 0x7c, 0x83, 0x82, 0x7c, 0x7f, 0x7f, 0x7f, 0x83, 0x80, 0x81, 0x81,
- 0x7e, 0x7c, 0x7c, 0x82, 0x86, 0x80, 0x7f, 0x7f, 0x7b, 0x7f, 0x81, 0x7d, 0x7b, 0x7a, 0x7b, 0x84,
- 0x83, 0x81, 0x7f, 0x7f, 0x80, 0x80, 0x7d, 0x81, 0x85, 0x7f, 0x7a, 0x7d, 0x80, 0x80, 0x7f, 0x7c,
- 0x80, 0x80, 0x80, 0x82, 0x81, 0x80, 0x7d, 0x7a, 0x7b, 0x7b, 0x7e, 0x86, 0x7f, 0x7c, 0x84, 0x84,
- 0x82, 0x81, 0x81, 0x7c, 0x80, 0x81, 0x7d, 0x7d, 0x7f, 0x81, 0x80, 0x84, 0x81, 0x81, 0x7c, 0x77,
- 0x7c, 0x80, 0x81, 0x7e, 0x7c, 0x81, 0x7c, 0x80, 0x86, 0x80, 0x7d, 0x7f, 0x7e, 0x7a, 0x7d, 0x7e,
- 0x84, 0x86, 0x7e, 0x7e, 0x7e, 0x81, 0x80, 0x7d, 0x7c, 0x7f, 0x80, 0x7e, 0x7d, 0x7c, 0x84, 0x87,
- 0x85, 0x7d, 0x7e, 0x83, 0x82, 0x7d, 0x80, 0x84, 0x84, 0x82, 0x7f, 0x80, 0x86, 0x84, 0x81, 0x83,
- 0x7e, 0x7c, 0x7d, 0x7c, 0x82, 0x82, 0x80, 0x80, 0x7b, 0x7c, 0x80, 0x7c, 0x80, 0x81, 0x7b, 0x7b,
- 0x7c, 0x82, 0x85, 0x84, 0x7e, 0x7c, 0x80, 0x83, 0x80, 0x81, 0x82, 0x80, 0x7c, 0x7f, 0x7c, 0x80,
- 0x81, 0x7b, 0x7e, 0x85, 0x7f, 0x81, 0x80, 0x80, 0x7c, 0x7d, 0x82, 0x7e, 0x80, 0x7c, 0x81, 0x85,
- 0x82, 0x7f, 0x7f, 0x80, 0x7f, 0x81, 0x80, 0x7d, 0x80, 0x83, 0x85, 0x85, 0x83, 0x84, 0x7f, 0x7e,
- 0x7d, 0x7d, 0x7f, 0x85, 0x7f, 0x7d, 0x79, 0x79, 0x82, 0x7b, 0x79, 0x7d, 0x7d, 0x7f, 0x80, 0x7c,
- 0x7c, 0x83, 0x7f, 0x7c, 0x81, 0x80, 0x7c, 0x7d, 0x7d, 0x84, 0x87, 0x7c, 0x7c, 0x80, 0x87, 0x88,
- 0x80, 0x7d, 0x7d, 0x7f, 0x81, 0x80, 0x7e, 0x81, 0x82, 0x7b, 0x7d, 0x85, 0x81, 0x80, 0x81, 0x7d,
- 0x7f, 0x84, 0x81, 0x7f, 0x7f, 0x7d, 0x82, 0x83, 0x7e, 0x7e, 0x7e, 0x7d, 0x7e, 0x80, 0x86, 0x82,
- 0x7e, 0x7f, 0x7b, 0x7b, 0x7f, 0x80, 0x7e, 0x7c, 0x80, 0x85, 0x80, 0x7c, 0x7b, 0x7c, 0x7f, 0x7f,
- 0x7d, 0x7c, 0x7c, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7d, 0x7d, 0x7f, 0x81, 0x80, 0x7b, 0x7c, 0x7d,
- 0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x7d, 0x7d, 0x80, 0x84, 0x7f, 0x7c, 0x7f, 0x82, 0x7e, 0x7e,
- 0x81, 0x7d, 0x82, 0x80, 0x7b, 0x7d, 0x81, 0x7e, 0x7e, 0x7e, 0x81, 0x81, 0x7f, 0x82, 0x82, 0x84,
- 0x82, 0x82, 0x81, 0x7d, 0x7f, 0x81, 0x82, 0x7e, 0x7d, 0x7f, 0x7d, 0x7c, 0x80, 0x7f, 0x7c, 0x7d,
- 0x7b, 0x7d, 0x82, 0x81, 0x7c, 0x7b, 0x7e, 0x7f, 0x7c, 0x7b, 0x80, 0x82, 0x80, 0x7e, 0x7d, 0x82,
- 0x84, 0x82, 0x80, 0x7f, 0x82, 0x81, 0x84, 0x83, 0x80, 0x7d, 0x83, 0x87, 0x84, 0x80, 0x7a, 0x7d,
- 0x82, 0x82, 0x7a, 0x7c, 0x7f, 0x85, 0x86, 0x7f, 0x7b, 0x7d, 0x81, 0x82, 0x81, 0x7d, 0x7c, 0x82,
- 0x88, 0x80, 0x7d, 0x83, 0x8a, 0x83, 0x7b, 0x7e, 0x80, 0x81, 0x83, 0x81, 0x7e, 0x82, 0x85, 0x86,
- 0x85, 0x83, 0x86, 0x87, 0x7f, 0x7c, 0x7c, 0x7d, 0x82, 0x84, 0x7f, 0x7a, 0x7c, 0x82, 0x81, 0x7e,
- 0x7f, 0x81, 0x81, 0x7b, 0x7c, 0x7e, 0x7f, 0x7e, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x82, 0x85,
- 0x82, 0x84, 0x81, 0x7e, 0x82, 0x7f, 0x84, 0x85, 0x83, 0x81, 0x7b, 0x7f, 0x83, 0x85, 0x80, 0x7b,
- 0x79, 0x80, 0x82, 0x7c, 0x7f, 0x80, 0x7e, 0x7d, 0x82, 0x82, 0x7e, 0x7f, 0x82, 0x84, 0x87, 0x82,
- 0x83, 0x85, 0x85, 0x85, 0x86, 0x82, 0x82, 0x83, 0x7f, 0x80, 0x82, 0x85, 0x7f, 0x7d, 0x82, 0x80,
- 0x7d, 0x81, 0x82, 0x7f, 0x7d, 0x80, 0x82, 0x82, 0x83, 0x7f, 0x7e, 0x7d, 0x82, 0x83, 0x85, 0x80,
- 0x7f, 0x86, 0x85, 0x80, 0x81, 0x81, 0x80, 0x82, 0x7f, 0x7d, 0x83, 0x84, 0x81, 0x80, 0x80, 0x80,
- 0x80, 0x7e, 0x80, 0x80, 0x7d, 0x7e, 0x7d, 0x81, 0x84, 0x81, 0x7e, 0x80, 0x83, 0x81, 0x83, 0x80,
- 0x7c, 0x7c, 0x84, 0x85, 0x81, 0x7d, 0x7d, 0x86, 0x81, 0x7f, 0x80, 0x7e, 0x80, 0x7e, 0x7e, 0x81,
- 0x83, 0x80, 0x7f, 0x7f, 0x83, 0x82, 0x7d, 0x7f, 0x81, 0x80, 0x82, 0x83, 0x84, 0x82, 0x7c, 0x7f,
- 0x85, 0x85, 0x82, 0x84, 0x82, 0x80, 0x80, 0x83, 0x85, 0x81, 0x80, 0x7b, 0x7d, 0x82, 0x83, 0x7d,
- 0x7b, 0x80, 0x80, 0x7d, 0x7a, 0x7c, 0x7c, 0x81, 0x7f, 0x7f, 0x81, 0x83, 0x80, 0x81, 0x84, 0x83,
- 0x84, 0x83, 0x80, 0x81, 0x85, 0x82, 0x80, 0x7e, 0x80, 0x81, 0x7e, 0x7e, 0x7f, 0x7c, 0x7e, 0x80,
- 0x80, 0x7d, 0x7d, 0x80, 0x85, 0x86, 0x7f, 0x7c, 0x84, 0x82, 0x7e, 0x7f, 0x7f, 0x7f, 0x7d, 0x7f,
- 0x80, 0x82, 0x85, 0x82, 0x82, 0x82, 0x7d, 0x7c, 0x7d, 0x7d, 0x7d, 0x81, 0x82, 0x7d, 0x7c, 0x7e,
- 0x80, 0x85, 0x84, 0x7d, 0x7e, 0x7b, 0x81, 0x81, 0x82, 0x7e, 0x81, 0x83, 0x81, 0x7f, 0x80, 0x82,
- 0x80, 0x83, 0x80, 0x7d, 0x81, 0x85, 0x81, 0x85, 0x82, 0x82, 0x83, 0x7c, 0x81, 0x81, 0x81, 0x84,
- 0x81, 0x7c, 0x80, 0x83, 0x84, 0x7f, 0x7b, 0x7f, 0x81, 0x81, 0x7f, 0x81, 0x7f, 0x80, 0x82, 0x80,
- 0x7e, 0x7f, 0x82, 0x83, 0x81, 0x7f, 0x80, 0x80, 0x80, 0x84, 0x81, 0x7d, 0x7f, 0x83, 0x82, 0x85,
- 0x7f, 0x7a, 0x80, 0x84, 0x80, 0x7e, 0x80, 0x83, 0x86, 0x81, 0x80, 0x84, 0x85, 0x82, 0x7f, 0x7e,
- 0x7e, 0x81, 0x84, 0x83, 0x81, 0x84, 0x82, 0x82, 0x7f, 0x7e, 0x82, 0x83, 0x81, 0x83, 0x7f, 0x7c,
- 0x80, 0x81, 0x80, 0x80, 0x7e, 0x7e, 0x80, 0x7e, 0x81, 0x82, 0x83, 0x7f, 0x7f, 0x82, 0x7f, 0x7f,
- 0x84, 0x7f, 0x7e, 0x80, 0x7f, 0x82, 0x7f, 0x7f, 0x82, 0x84, 0x81, 0x7d, 0x82, 0x80, 0x82, 0x86,
- 0x82, 0x80, 0x81, 0x81, 0x83, 0x83, 0x82, 0x80, 0x7e, 0x85, 0x81, 0x7d, 0x7f, 0x82, 0x7d, 0x7d,
- 0x7f, 0x80, 0x84, 0x81, 0x7d, 0x81, 0x82, 0x7e, 0x7e, 0x7e, 0x7d, 0x7b, 0x82, 0x84, 0x7f, 0x80,
- 0x7f, 0x83, 0x88, 0x83, 0x83, 0x84, 0x84, 0x83, 0x84, 0x84, 0x80, 0x83, 0x84, 0x80, 0x81, 0x7f,
- 0x80, 0x7f, 0x7d, 0x81, 0x7d, 0x7e, 0x7f, 0x83, 0x83, 0x7f, 0x80, 0x82, 0x83, 0x82, 0x82, 0x83,
- 0x7e, 0x7d, 0x85, 0x81, 0x7e, 0x82, 0x81, 0x81, 0x82, 0x80, 0x7e, 0x82, 0x82, 0x81, 0x81, 0x83,
- 0x84, 0x84, 0x7f, 0x7d, 0x83, 0x89, 0x82, 0x7e, 0x80, 0x7c, 0x7e, 0x80, 0x7f, 0x80, 0x7d, 0x7f,
- 0x80, 0x7d, 0x7c, 0x78, 0x7d, 0x85, 0x83, 0x7f, 0x81, 0x85, 0x83, 0x7f, 0x7f, 0x83, 0x83, 0x83,
- 0x83, 0x80, 0x7f, 0x83, 0x80, 0x7c, 0x80, 0x80, 0x82, 0x85, 0x85, 0x80, 0x82, 0x85, 0x83, 0x81,
- 0x7f, 0x82, 0x83, 0x7e, 0x78, 0x7c, 0x7e, 0x80, 0x7d, 0x83, 0x88, 0x80, 0x83, 0x82, 0x81, 0x7e,
- 0x82, 0x80, 0x7c, 0x81, 0x85, 0x85, 0x81, 0x7f, 0x80, 0x82, 0x80, 0x81, 0x82, 0x82, 0x7e, 0x80,
- 0x82, 0x7d, 0x7e, 0x7c, 0x82, 0x80, 0x81, 0x81, 0x7b, 0x7c, 0x7f, 0x7e, 0x7c, 0x7e, 0x80, 0x83,
- 0x81, 0x83, 0x80, 0x7e, 0x80, 0x81, 0x84, 0x80, 0x81, 0x7e, 0x7d, 0x7e, 0x7e, 0x81, 0x80, 0x7c,
- 0x7d, 0x80, 0x84, 0x84, 0x7e, 0x81, 0x80, 0x80, 0x7d, 0x7d, 0x7f, 0x81, 0x7f, 0x7c, 0x7f, 0x7e,
- 0x7c, 0x80, 0x81, 0x7d, 0x7c, 0x80, 0x80, 0x7f, 0x7e, 0x7d, 0x83, 0x81, 0x7c, 0x7f, 0x80, 0x83,
- 0x7f, 0x7c, 0x81, 0x85, 0x80, 0x7e, 0x7f, 0x7d, 0x7d, 0x7f, 0x7e, 0x81, 0x7f, 0x7e, 0x80, 0x7f,
- 0x7f, 0x83, 0x81, 0x7e, 0x7d, 0x7f, 0x80, 0x7e, 0x80, 0x80, 0x80, 0x82, 0x81, 0x7f, 0x7d, 0x7a,
- 0x7c, 0x7f, 0x81, 0x83, 0x82, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x7c, 0x7f, 0x81, 0x81, 0x81, 0x7d,
- 0x7f, 0x7f, 0x7e, 0x7f, 0x7b, 0x7c, 0x7d, 0x7d, 0x7e, 0x82, 0x84, 0x82, 0x80, 0x80, 0x83, 0x82,
- 0x7c, 0x80, 0x81, 0x7e, 0x80, 0x81, 0x82, 0x82, 0x82, 0x83, 0x7c, 0x7e, 0x80, 0x82, 0x7f, 0x7a,
- 0x7c, 0x80, 0x82, 0x7d, 0x7b, 0x7e, 0x82, 0x7f, 0x81, 0x7e, 0x7e, 0x83, 0x82, 0x80, 0x81, 0x80,
- 0x7f, 0x81, 0x7f, 0x81, 0x80, 0x7d, 0x7f, 0x7f, 0x7c, 0x7d, 0x7f, 0x7f, 0x7e, 0x7b, 0x7e, 0x7e,
- 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x82, 0x80, 0x80, 0x80, 0x7e, 0x81, 0x83, 0x80, 0x81, 0x7e, 0x81,
- 0x84, 0x81, 0x80, 0x80, 0x80, 0x82, 0x80, 0x81, 0x80, 0x82, 0x80, 0x7c, 0x7d, 0x7e, 0x81, 0x7f,
- 0x7c, 0x7f, 0x81, 0x83, 0x80, 0x7e, 0x7b, 0x7e, 0x82, 0x80, 0x80, 0x82, 0x82, 0x82, 0x80, 0x7c,
- 0x7e, 0x7f, 0x80, 0x7f, 0x7b, 0x7d, 0x7e, 0x80, 0x80, 0x7c, 0x7d, 0x7f, 0x7e, 0x7d, 0x80, 0x81,
- 0x82, 0x83, 0x81, 0x80, 0x81, 0x80, 0x7f, 0x82, 0x7f, 0x7f, 0x7b, 0x7e, 0x80, 0x7f, 0x7d, 0x7e,
- 0x7d, 0x7b, 0x7e, 0x7e, 0x7e, 0x82, 0x7f, 0x82, 0x82, 0x7f, 0x7f, 0x80, 0x84, 0x80, 0x7f, 0x7f,
- 0x82, 0x83, 0x80, 0x82, 0x80, 0x7e, 0x80, 0x7e, 0x7f, 0x7e, 0x7d, 0x7a, 0x7c, 0x7d, 0x7d, 0x7e,
- 0x7a, 0x7c, 0x7d, 0x7a, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x81, 0x81, 0x82, 0x80, 0x7f,
- 0x85, 0x84, 0x82, 0x84, 0x82, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7d, 0x7c, 0x7e, 0x7e, 0x80, 0x80,
- 0x7e, 0x7e, 0x7c, 0x7e, 0x80, 0x7f, 0x7e, 0x81, 0x81, 0x7e, 0x7d, 0x7c, 0x80, 0x85, 0x85, 0x81,
- 0x7e, 0x7e, 0x80, 0x82, 0x82, 0x80, 0x7e, 0x7c, 0x7f, 0x7f, 0x7b, 0x7f, 0x83, 0x83, 0x80, 0x7d,
- 0x7b, 0x7b, 0x7d, 0x7c, 0x7b, 0x7c, 0x80, 0x7e, 0x82, 0x83, 0x7f, 0x80, 0x81, 0x81, 0x7f, 0x7b,
- 0x7c, 0x80, 0x83, 0x81, 0x82, 0x83, 0x80, 0x80, 0x7e, 0x7e, 0x7f, 0x81, 0x7e, 0x7e, 0x7d, 0x7f,
- 0x7e, 0x7f, 0x7b, 0x7c, 0x7d, 0x7d, 0x7f, 0x7d, 0x7f, 0x80, 0x7e, 0x7c, 0x7e, 0x7f, 0x7e, 0x80,
- 0x7e, 0x7d, 0x80, 0x82, 0x82, 0x82, 0x80, 0x80, 0x82, 0x80, 0x81, 0x7d, 0x7d, 0x83, 0x81, 0x80,
- 0x7d, 0x7e, 0x82, 0x81, 0x80, 0x7e, 0x7c, 0x7c, 0x81, 0x80, 0x7f, 0x81, 0x80, 0x80, 0x80, 0x7e,
- 0x81, 0x83, 0x81, 0x81, 0x7e, 0x7b, 0x7d, 0x82, 0x7f, 0x7e, 0x81, 0x7d, 0x7f, 0x80, 0x80, 0x81,
- 0x80, 0x82, 0x83, 0x80, 0x7e, 0x80, 0x82, 0x80, 0x7d, 0x7a, 0x7e, 0x81, 0x83, 0x83, 0x7d, 0x7e,
- 0x82, 0x83, 0x80, 0x7f, 0x81, 0x7b, 0x7d, 0x82, 0x80, 0x80, 0x80, 0x81, 0x82, 0x7e, 0x7d, 0x7d,
- 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x80, 0x7d, 0x7b, 0x7e, 0x82, 0x82, 0x83, 0x82, 0x7f, 0x82, 0x83,
- 0x7f, 0x7c, 0x7f, 0x84, 0x84, 0x7f, 0x7b, 0x7f, 0x84, 0x85, 0x81, 0x80, 0x82, 0x81, 0x80, 0x82,
- 0x82, 0x82, 0x82, 0x80, 0x81, 0x80, 0x81, 0x84, 0x81, 0x82, 0x7e, 0x7e, 0x82, 0x7f, 0x80, 0x83,
- 0x82, 0x7d, 0x7e, 0x7e, 0x7f, 0x7f, 0x7e, 0x82, 0x83, 0x81, 0x7f, 0x7e, 0x81, 0x80, 0x7d, 0x81,
- 0x84, 0x82, 0x83, 0x83, 0x84, 0x83, 0x81, 0x7f, 0x7f, 0x81, 0x80, 0x81, 0x82, 0x82, 0x80, 0x83,
- 0x83, 0x81, 0x82, 0x7f, 0x80, 0x80, 0x7d, 0x80, 0x80, 0x81, 0x7f, 0x80, 0x81, 0x80, 0x83, 0x80,
- 0x82, 0x82, 0x83, 0x82, 0x82, 0x84, 0x84, 0x82, 0x82, 0x81, 0x82, 0x83, 0x81, 0x84, 0x86, 0x84,
- 0x80, 0x82, 0x81, 0x7e, 0x82, 0x80, 0x80, 0x82, 0x80, 0x83, 0x80, 0x80, 0x83, 0x81, 0x83, 0x84,
- 0x81, 0x82, 0x84, 0x85, 0x86, 0x82, 0x84, 0x80, 0x7e, 0x83, 0x83, 0x81, 0x82, 0x85, 0x82, 0x80,
- 0x81, 0x80, 0x81, 0x83, 0x82, 0x80, 0x80, 0x81, 0x82, 0x84, 0x80, 0x82, 0x83, 0x81, 0x82, 0x80,
- 0x80, 0x85, 0x82, 0x82, 0x84, 0x86, 0x83, 0x80, 0x80, 0x7f, 0x81, 0x81, 0x82, 0x83, 0x84, 0x83,
- 0x80, 0x82, 0x84, 0x85, 0x86, 0x83, 0x81, 0x81, 0x83, 0x84, 0x85, 0x82, 0x80, 0x82, 0x84, 0x84,
- 0x82, 0x86, 0x80, 0x7e, 0x7e, 0x7e, 0x7d, 0x7c, 0x7e, 0x7d, 0x7c, 0x7d, 0x81, 0x80, 0x80, 0x83,
- 0x81, 0x81, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x7f, 0x83, 0x84, 0x81, 0x81, 0x82, 0x81, 0x81, 0x82,
- 0x81, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x82, 0x81, 0x84, 0x83, 0x7f,
- 0x81, 0x85, 0x81, 0x80, 0x7d, 0x7e, 0x81, 0x82, 0x80, 0x80, 0x81, 0x81, 0x82, 0x7e, 0x80, 0x82,
- 0x7f, 0x7d, 0x7d, 0x7f, 0x7f, 0x80, 0x82, 0x7f, 0x80, 0x82, 0x82, 0x82, 0x80, 0x7e, 0x7c, 0x7d,
- 0x7d, 0x7f, 0x82, 0x80, 0x80, 0x80, 0x81, 0x7f, 0x7e, 0x82, 0x81, 0x80, 0x7f, 0x7d, 0x7e, 0x7e,
- 0x7c, 0x7d, 0x80, 0x82, 0x81, 0x81, 0x80, 0x81, 0x82, 0x81, 0x80, 0x7f, 0x7d, 0x7f, 0x82, 0x82,
- 0x83, 0x80, 0x7d, 0x7e, 0x7c, 0x7f, 0x81, 0x81, 0x81, 0x7d, 0x7e, 0x81, 0x81, 0x7f, 0x7e, 0x80,
- 0x81, 0x7e, 0x7e, 0x80, 0x82, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x7c, 0x7b, 0x7f, 0x80,
- 0x81, 0x82, 0x80, 0x82, 0x7f, 0x7e, 0x80, 0x7f, 0x7c, 0x7c, 0x7b, 0x80, 0x7f, 0x7e, 0x81, 0x7e,
- 0x7e, 0x7c, 0x7e, 0x80, 0x80, 0x7f, 0x7d, 0x7e, 0x80, 0x81, 0x7f, 0x81, 0x81, 0x83, 0x83, 0x7f,
- 0x7e, 0x7e, 0x7d, 0x7e, 0x7f, 0x81, 0x83, 0x81, 0x81, 0x80, 0x7e, 0x85, 0x83, 0x81, 0x80, 0x80,
- 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x82, 0x81, 0x7f, 0x7e, 0x81, 0x7d, 0x79, 0x80, 0x83,
- 0x7f, 0x7d, 0x81, 0x83, 0x81, 0x83, 0x7f, 0x81, 0x7d, 0x7a, 0x82, 0x81, 0x81, 0x81, 0x7f, 0x80,
- 0x7f, 0x7f, 0x82, 0x83, 0x81, 0x7b, 0x7c, 0x80, 0x83, 0x7f, 0x7c, 0x7c, 0x7f, 0x7d, 0x7d, 0x80,
- 0x80, 0x80, 0x7e, 0x7d, 0x7e, 0x7e, 0x7c, 0x7f, 0x80, 0x7f, 0x82, 0x82, 0x80, 0x84, 0x82, 0x82,
- 0x85, 0x80, 0x7c, 0x7f, 0x81, 0x80, 0x7c, 0x7e, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x7e, 0x7e,
- 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x7e, 0x7b, 0x7a, 0x7c, 0x80, 0x7f, 0x7e, 0x7f, 0x81, 0x7f, 0x7f,
- 0x80, 0x82, 0x7e, 0x7f, 0x7e, 0x7e, 0x7d, 0x7e, 0x80, 0x80, 0x81, 0x81, 0x82, 0x82, 0x7f, 0x7d,
- 0x7c, 0x7f, 0x7e, 0x7e, 0x7c, 0x7b, 0x7f, 0x7f, 0x80, 0x7e, 0x7e, 0x80, 0x80, 0x7d, 0x7f, 0x80,
- 0x7e, 0x7d, 0x7e, 0x80, 0x83, 0x84, 0x87, 0x85, 0x83, 0x81, 0x7f, 0x83, 0x80, 0x80, 0x83, 0x85,
- 0x81, 0x7b, 0x7e, 0x82, 0x80, 0x81, 0x7e, 0x7e, 0x80, 0x7e, 0x7d, 0x7e, 0x7b, 0x7c, 0x7e, 0x7f,
- 0x82, 0x7d, 0x7e, 0x82, 0x7f, 0x7f, 0x81, 0x81, 0x80, 0x80, 0x7e, 0x80, 0x81, 0x7f, 0x82, 0x80,
- 0x80, 0x82, 0x83, 0x83, 0x83, 0x83, 0x81, 0x81, 0x7d, 0x7e, 0x7e, 0x7f, 0x7e, 0x7d, 0x7e, 0x80,
- 0x83, 0x84, 0x81, 0x81, 0x80, 0x83, 0x84, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x81, 0x82,
- 0x7f, 0x7c, 0x80, 0x81, 0x80, 0x7f, 0x81, 0x81, 0x7d, 0x7b, 0x7f, 0x80, 0x7f, 0x7e, 0x7c, 0x7e,
- 0x80, 0x7f, 0x7e, 0x7d, 0x7b, 0x7d, 0x7d, 0x7e, 0x7d, 0x81, 0x85, 0x86, 0x82, 0x7f, 0x80, 0x80,
- 0x81, 0x81, 0x7e, 0x7e, 0x7e, 0x7f, 0x81, 0x80, 0x81, 0x7f, 0x80, 0x81, 0x7f, 0x7f, 0x7f, 0x83,
- 0x81, 0x7f, 0x7d, 0x7c, 0x81, 0x80, 0x7e, 0x7f, 0x80, 0x80, 0x82, 0x82, 0x80, 0x7f, 0x7d, 0x80,
- 0x7f, 0x7f, 0x81, 0x81, 0x82, 0x80, 0x7e, 0x7f, 0x7f, 0x7f, 0x7e, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e,
- 0x7d, 0x80, 0x7f, 0x7e, 0x81, 0x81, 0x81, 0x82, 0x82, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x7d, 0x7e,
- 0x7d, 0x81, 0x81, 0x7f, 0x7f, 0x7e, 0x7f, 0x7d, 0x7f, 0x80, 0x81, 0x81, 0x7d, 0x7d, 0x7e, 0x7d,
- 0x7c, 0x7e, 0x81, 0x7e, 0x7e, 0x7d, 0x7f, 0x81, 0x81, 0x80, 0x7d, 0x7c, 0x7e, 0x80, 0x7f, 0x82,
- 0x82, 0x81, 0x80, 0x80, 0x7f, 0x7d, 0x7e, 0x7e, 0x7c, 0x7c, 0x7f, 0x82, 0x80, 0x81, 0x82, 0x81,
- 0x7f, 0x7d, 0x7d, 0x81, 0x80, 0x7f, 0x7f, 0x7c, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x81, 0x81, 0x83,
- 0x82, 0x80, 0x7e, 0x81, 0x80, 0x81, 0x7f, 0x80, 0x81, 0x80, 0x82, 0x7f, 0x80, 0x83, 0x7e, 0x7e,
- 0x7c, 0x7c, 0x7e, 0x7f, 0x7d, 0x7f, 0x7f, 0x82, 0x81, 0x7e, 0x80, 0x83, 0x81, 0x7e, 0x7f, 0x81,
- 0x82, 0x80, 0x7d, 0x7d, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x7c, 0x7b, 0x80, 0x81, 0x80, 0x7f,
- 0x80, 0x7d, 0x81, 0x82, 0x82, 0x82, 0x80, 0x81, 0x83, 0x83, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f,
- 0x7f, 0x7f, 0x82, 0x7f, 0x7d, 0x81, 0x7f, 0x7e, 0x7e, 0x82, 0x81, 0x7f, 0x7f, 0x7f, 0x80, 0x81,
- 0x81, 0x7f, 0x81, 0x7d, 0x7e, 0x80, 0x7e, 0x7f, 0x7e, 0x7e, 0x7d, 0x7d, 0x7f, 0x80, 0x82, 0x81,
- 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7c, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x81, 0x83, 0x7f,
- 0x80, 0x7f, 0x82, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7e, 0x80, 0x80, 0x82, 0x80, 0x7d, 0x7e, 0x81,
- 0x84, 0x84, 0x84, 0x80, 0x7f, 0x7e, 0x7f, 0x84, 0x80, 0x81, 0x83, 0x84, 0x81, 0x81, 0x83, 0x81,
- 0x81, 0x7e, 0x7d, 0x7d, 0x80, 0x83, 0x82, 0x82, 0x82, 0x82, 0x81, 0x82, 0x80, 0x81, 0x84, 0x80,
- 0x7f, 0x80, 0x80, 0x82, 0x84, 0x83, 0x80, 0x7d, 0x7f, 0x80, 0x83, 0x80, 0x7e, 0x7d, 0x7d, 0x7f,
- 0x7f, 0x7e, 0x82, 0x86, 0x83, 0x7f, 0x7f, 0x83, 0x82, 0x7e, 0x80, 0x7f, 0x7f, 0x80, 0x7e, 0x81,
- 0x84, 0x7f, 0x80, 0x82, 0x81, 0x82, 0x84, 0x81, 0x7f, 0x81, 0x81, 0x81, 0x82, 0x81, 0x82, 0x81,
- 0x81, 0x82, 0x83, 0x7f, 0x80, 0x81, 0x7e, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x82, 0x83, 0x85,
- 0x84, 0x82, 0x82, 0x81, 0x7f, 0x82, 0x81, 0x83, 0x82, 0x81, 0x80, 0x80, 0x83, 0x84, 0x84, 0x81,
- 0x7f, 0x7f, 0x80, 0x7f, 0x82, 0x7e, 0x7d, 0x80, 0x7f, 0x7d, 0x7d, 0x80, 0x82, 0x7f, 0x7d, 0x7d,
- 0x7d, 0x7e, 0x81, 0x81, 0x80, 0x7d, 0x7e, 0x80, 0x82, 0x82, 0x81, 0x82, 0x83, 0x82, 0x81, 0x7e,
- 0x7e, 0x80, 0x81, 0x7f, 0x7f, 0x82, 0x81, 0x7f, 0x81, 0x83, 0x83, 0x83, 0x81, 0x7e, 0x7c, 0x7d,
- 0x81, 0x84, 0x83, 0x7f, 0x80, 0x82, 0x82, 0x82, 0x84, 0x84, 0x7f, 0x7c, 0x7f, 0x80, 0x7e, 0x7d,
- 0x80, 0x80, 0x81, 0x81, 0x81, 0x7f, 0x82, 0x83, 0x7e, 0x7d, 0x7e, 0x7f, 0x7f, 0x7f, 0x7d, 0x7c,
- 0x7e, 0x7d, 0x7f, 0x7d, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x82, 0x82, 0x81, 0x7e, 0x7d, 0x7f,
- 0x82, 0x84, 0x82, 0x82, 0x80, 0x7f, 0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x7e,
- 0x80, 0x81, 0x82, 0x7f, 0x7f, 0x82, 0x81, 0x7d, 0x7d, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x83, 0x81,
- 0x81, 0x7f, 0x80, 0x80, 0x82, 0x80, 0x7d, 0x80, 0x80, 0x7c, 0x7d, 0x7e, 0x7e, 0x7d, 0x7e, 0x80,
- 0x80, 0x7f, 0x7e, 0x81, 0x7f, 0x7e, 0x7d, 0x7f, 0x83, 0x82, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80,
- 0x80, 0x7e, 0x7e, 0x7e, 0x81, 0x80, 0x7c, 0x7f, 0x81, 0x80, 0x81, 0x7f, 0x80, 0x80, 0x80, 0x80,
- 0x81, 0x81, 0x81, 0x80, 0x7d, 0x7d, 0x7c, 0x7f, 0x82, 0x81, 0x80, 0x81, 0x82, 0x82, 0x81, 0x81,
- 0x82, 0x83, 0x82, 0x81, 0x84, 0x84, 0x84, 0x83, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7d, 0x7e, 0x7f,
- 0x80, 0x7e, 0x7c, 0x80, 0x84, 0x80, 0x7b, 0x7c, 0x7f, 0x81, 0x83, 0x82, 0x80, 0x82, 0x81, 0x7c,
- 0x7d, 0x80, 0x84, 0x83, 0x81, 0x81, 0x80, 0x81, 0x83, 0x84, 0x82, 0x81, 0x80, 0x80, 0x7f, 0x81,
- 0x82, 0x80, 0x82, 0x80, 0x80, 0x7d, 0x7e, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x82, 0x83, 0x82, 0x82,
- 0x81, 0x83, 0x82, 0x83, 0x83, 0x81, 0x83, 0x84, 0x83, 0x82, 0x81, 0x82, 0x82, 0x81, 0x81, 0x82,
- 0x81, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x7f, 0x82, 0x82, 0x80, 0x82, 0x81, 0x82, 0x7e, 0x7e, 0x82,
- 0x82, 0x82, 0x80, 0x82, 0x84, 0x82, 0x80, 0x7f, 0x81, 0x84, 0x85, 0x82, 0x82, 0x81, 0x80, 0x82,
- 0x84, 0x81, 0x7f, 0x83, 0x83, 0x80, 0x7f, 0x82, 0x83, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7e,
- 0x7d, 0x82, 0x82, 0x81, 0x80, 0x81, 0x80, 0x80, 0x83, 0x86, 0x86, 0x82, 0x81, 0x81, 0x81, 0x83,
- 0x83, 0x83, 0x7f, 0x7f, 0x82, 0x82, 0x81, 0x7f, 0x7f, 0x80, 0x7f, 0x81, 0x81, 0x7e, 0x7e, 0x7f,
- 0x80, 0x80, 0x7f, 0x80, 0x82, 0x82, 0x80, 0x7f, 0x80, 0x83, 0x80, 0x7f, 0x7e, 0x7e, 0x7b, 0x7e,
- 0x83, 0x85, 0x84, 0x7e, 0x7d, 0x7e, 0x81, 0x7f, 0x81, 0x80, 0x7c, 0x7f, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x81, 0x83, 0x81, 0x80, 0x80, 0x83, 0x80, 0x7f, 0x81, 0x80, 0x81, 0x80, 0x7e, 0x81, 0x80,
- 0x7f, 0x7e, 0x82, 0x7f, 0x7d, 0x81, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7f, 0x81,
- 0x7f, 0x7e, 0x7d, 0x7f, 0x7f, 0x81, 0x82, 0x7f, 0x7f, 0x7f, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80,
- 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x80, 0x7e, 0x7f, 0x7f, 0x80, 0x7e, 0x7c, 0x7e, 0x7f, 0x7e, 0x7f,
- 0x7f, 0x84, 0x81, 0x7e, 0x7d, 0x80, 0x82, 0x7f, 0x80, 0x81, 0x82, 0x80, 0x7e, 0x7f, 0x7f, 0x81,
- 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x82, 0x82, 0x7e, 0x7f, 0x80, 0x7e, 0x7f, 0x7d, 0x7d, 0x7e, 0x80,
- 0x81, 0x7f, 0x7f, 0x80, 0x7e, 0x7f, 0x7c, 0x7d, 0x80, 0x83, 0x82, 0x80, 0x81, 0x80, 0x7e, 0x7f,
- 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7e, 0x81,
- 0x81, 0x7e, 0x7c, 0x7f, 0x80, 0x7d, 0x7e, 0x7f, 0x81, 0x7f, 0x7d, 0x7e, 0x80, 0x83, 0x81, 0x81,
- 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x81, 0x7e, 0x7e, 0x80, 0x7f, 0x7f, 0x7c, 0x7d, 0x7e, 0x7e,
- 0x7f, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x7e, 0x80, 0x82, 0x7f, 0x7d, 0x7c,
- 0x7f, 0x82, 0x81, 0x7f, 0x80, 0x81, 0x7e, 0x7c, 0x80, 0x80, 0x7d, 0x7f, 0x7f, 0x7f, 0x80, 0x7e,
- 0x83, 0x81, 0x7e, 0x7f, 0x7f, 0x80, 0x81, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x7f, 0x80,
- 0x7f, 0x82, 0x82, 0x81, 0x82, 0x81, 0x81, 0x81, 0x7f, 0x7f, 0x81, 0x7e, 0x7f, 0x80, 0x7d, 0x7b,
- 0x7e, 0x82, 0x81, 0x82, 0x83, 0x80, 0x7e, 0x7f, 0x82, 0x82, 0x7f, 0x7e, 0x7f, 0x83, 0x83, 0x81,
- 0x7e, 0x7e, 0x81, 0x82, 0x81, 0x7e, 0x7e, 0x80, 0x7f, 0x7f, 0x7d, 0x7f, 0x81, 0x7f, 0x7d, 0x7f,
- 0x7f, 0x80, 0x81, 0x7f, 0x7e, 0x7d, 0x7f, 0x81, 0x80, 0x81, 0x81, 0x7d, 0x80, 0x80, 0x7f, 0x81,
- 0x7f, 0x7d, 0x7c, 0x7f, 0x83, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x82, 0x82, 0x81, 0x82, 0x7f, 0x7f,
- 0x80, 0x80, 0x83, 0x80, 0x7e, 0x7e, 0x82, 0x84, 0x7f, 0x7e, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80,
- 0x81, 0x82, 0x80, 0x7e, 0x7f, 0x83, 0x80, 0x7f, 0x80, 0x7f, 0x7e, 0x7d, 0x7f, 0x80, 0x7f, 0x7c,
- 0x7b, 0x7d, 0x7d, 0x7e, 0x81, 0x82, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x81,
- 0x81, 0x7e, 0x7e, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x7e, 0x7f, 0x81, 0x80, 0x7e, 0x7e,
- 0x7f, 0x7f, 0x7f, 0x80, 0x7c, 0x7e, 0x80, 0x7e, 0x7f, 0x81, 0x82, 0x81, 0x7f, 0x80, 0x81, 0x81,
- 0x7f, 0x7e, 0x7f, 0x80, 0x81, 0x80, 0x82, 0x7f, 0x80, 0x85, 0x82, 0x7f, 0x7f, 0x83, 0x82, 0x7c,
- 0x7f, 0x7f, 0x7e, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7d, 0x7e,
- 0x81, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x82,
- 0x83, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x7f, 0x80, 0x82, 0x81, 0x81, 0x83, 0x83, 0x80,
- 0x7f, 0x7f, 0x82, 0x82, 0x7f, 0x81, 0x84, 0x83, 0x82, 0x81, 0x82, 0x81, 0x82, 0x83, 0x80, 0x80,
- 0x81, 0x7f, 0x7e, 0x80, 0x81, 0x81, 0x7f, 0x7e, 0x7f, 0x81, 0x81, 0x7f, 0x7f, 0x81, 0x80, 0x80,
- 0x7f, 0x81, 0x83, 0x81, 0x80, 0x80, 0x81, 0x84, 0x83, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x83,
- 0x85, 0x81, 0x80, 0x80, 0x82, 0x84, 0x81, 0x7e, 0x7f, 0x81, 0x7f, 0x7f, 0x7f, 0x81, 0x81, 0x7f,
- 0x7e, 0x7e, 0x7f, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x84, 0x83, 0x84, 0x82, 0x82, 0x82,
- 0x83, 0x83, 0x80, 0x7f, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x81, 0x82, 0x81, 0x7f, 0x81, 0x82, 0x81,
- 0x81, 0x81, 0x80, 0x81, 0x82, 0x80, 0x82, 0x83, 0x82, 0x81, 0x83, 0x83, 0x82, 0x82, 0x82, 0x80,
- 0x80, 0x80, 0x80, 0x82, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x82,
- 0x81, 0x82, 0x84, 0x83, 0x82, 0x80, 0x81, 0x7f, 0x81, 0x83, 0x80, 0x82, 0x81, 0x81, 0x80, 0x7f,
- 0x80, 0x81, 0x80, 0x7e, 0x7f, 0x83, 0x82, 0x80, 0x7e, 0x7d, 0x81, 0x82, 0x80, 0x7d, 0x81, 0x80,
- 0x80, 0x7f, 0x7e, 0x7f, 0x81, 0x80, 0x81, 0x82, 0x81, 0x80, 0x7d, 0x7f, 0x81, 0x82, 0x82, 0x81,
- 0x7f, 0x81, 0x80, 0x81, 0x83, 0x84, 0x81, 0x82, 0x82, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x7f, 0x80,
- 0x7f, 0x7f, 0x7f, 0x7e, 0x7c, 0x7c, 0x7e, 0x7e, 0x7d, 0x7e, 0x7f, 0x81, 0x7f, 0x7e, 0x81, 0x80,
- 0x82, 0x85, 0x81, 0x82, 0x83, 0x82, 0x7f, 0x7f, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x81,
- 0x7f, 0x7f, 0x81, 0x7e, 0x7f, 0x80, 0x80, 0x81, 0x7e, 0x7d, 0x7f, 0x82, 0x83, 0x80, 0x81, 0x83,
- 0x83, 0x7f, 0x7f, 0x80, 0x80, 0x82, 0x81, 0x7f, 0x7f, 0x7f, 0x7e, 0x7c, 0x7c, 0x7f, 0x7f, 0x80,
- 0x7e, 0x7d, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x83, 0x82, 0x7f, 0x80, 0x80, 0x82, 0x80,
- 0x80, 0x81, 0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x83, 0x82, 0x7f, 0x81, 0x82, 0x81, 0x80, 0x80,
- 0x81, 0x82, 0x81, 0x80, 0x81, 0x80, 0x80, 0x82, 0x83, 0x81, 0x82, 0x80, 0x80, 0x83, 0x84, 0x81,
- 0x81, 0x81, 0x81, 0x80, 0x80, 0x84, 0x82, 0x7f, 0x7f, 0x7c, 0x7e, 0x83, 0x82, 0x7f, 0x7d, 0x80,
- 0x82, 0x7f, 0x7e, 0x7e, 0x82, 0x84, 0x80, 0x7f, 0x81, 0x82, 0x81, 0x80, 0x7f, 0x80, 0x84, 0x85,
- 0x80, 0x80, 0x84, 0x85, 0x7f, 0x7c, 0x80, 0x83, 0x82, 0x81, 0x80, 0x81, 0x80, 0x7e, 0x7f, 0x7f,
- 0x80, 0x82, 0x82, 0x80, 0x81, 0x82, 0x84, 0x82, 0x81, 0x83, 0x83, 0x82, 0x81, 0x7e, 0x7f, 0x83,
- 0x83, 0x80, 0x7c, 0x7d, 0x80, 0x81, 0x80, 0x81, 0x83, 0x80, 0x7e, 0x7f, 0x7f, 0x80, 0x81, 0x7f,
- 0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x80, 0x7f, 0x82, 0x82, 0x81, 0x82, 0x82, 0x80, 0x7f, 0x81, 0x81,
- 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x83, 0x84, 0x84, 0x83, 0x83, 0x81, 0x81, 0x83, 0x83, 0x82,
- 0x80, 0x82, 0x82, 0x80, 0x81, 0x83, 0x83, 0x81, 0x7f, 0x83, 0x84, 0x81, 0x81, 0x81, 0x80, 0x82,
- 0x84, 0x82, 0x7f, 0x80, 0x84, 0x83, 0x80, 0x7f, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x7e,
- 0x7c, 0x80, 0x82, 0x82, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x80,
- 0x81, 0x80, 0x80, 0x7e, 0x7e, 0x82, 0x84, 0x82, 0x80, 0x81, 0x82, 0x80, 0x81, 0x84, 0x83, 0x81,
- 0x81, 0x81, 0x7f, 0x80, 0x81, 0x7e, 0x7f, 0x81, 0x80, 0x7e, 0x80, 0x82, 0x82, 0x81, 0x7f, 0x81,
- 0x82, 0x81, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80,
- 0x7e, 0x7d, 0x7d, 0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7d, 0x80,
- 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x81, 0x7f, 0x7f, 0x81, 0x80, 0x7d, 0x7d, 0x7f, 0x7f,
- 0x7e, 0x7d, 0x7e, 0x81, 0x81, 0x7e, 0x7d, 0x7f, 0x81, 0x81, 0x80, 0x7d, 0x7e, 0x80, 0x82, 0x84,
- 0x82, 0x81, 0x80, 0x82, 0x82, 0x81, 0x82, 0x81, 0x7f, 0x80, 0x81, 0x82, 0x82, 0x82, 0x80, 0x7e,
- 0x7e, 0x7f, 0x81, 0x7f, 0x7f, 0x7e, 0x7d, 0x7e, 0x80, 0x81, 0x81, 0x81, 0x7f, 0x80, 0x80, 0x7f,
- 0x7e, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x81,
- 0x7f, 0x7d, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x80, 0x81, 0x83, 0x81, 0x80,
- 0x80, 0x81, 0x80, 0x7f, 0x80, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7f,
- 0x81, 0x7f, 0x7e, 0x80, 0x81, 0x80, 0x7e, 0x7f, 0x7f, 0x81, 0x82, 0x80, 0x7f, 0x80, 0x82, 0x81,
- 0x80, 0x80, 0x81, 0x7f, 0x80, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e,
- 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7d, 0x7f, 0x83, 0x82, 0x80, 0x7f, 0x7f, 0x7d, 0x7f, 0x83,
- 0x81, 0x7e, 0x7e, 0x7e, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x7e, 0x81, 0x81, 0x80, 0x80, 0x7e,
- 0x7e, 0x80, 0x83, 0x80, 0x7e, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x80,
- 0x81, 0x80, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x7d, 0x7e, 0x80, 0x80,
- 0x7f, 0x7f, 0x81, 0x80, 0x81, 0x7e, 0x7d, 0x80, 0x80, 0x81, 0x82, 0x82, 0x81, 0x80, 0x7f, 0x7e,
- 0x81, 0x81, 0x82, 0x81, 0x7d, 0x7f, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81,
- 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x81, 0x81, 0x7e, 0x7f, 0x81, 0x7f, 0x7c, 0x7b, 0x7b, 0x7c, 0x7e,
- 0x7d, 0x7b, 0x7c, 0x7c, 0x7d, 0x81, 0x7f, 0x7c, 0x7d, 0x7e, 0x7f, 0x81, 0x80, 0x7f, 0x80, 0x7f,
- 0x81, 0x7f, 0x7e, 0x80, 0x81, 0x7f, 0x7d, 0x7f, 0x80, 0x7f, 0x7f, 0x7e, 0x7d, 0x7e, 0x7d, 0x80,
- 0x81, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x7e, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80,
- 0x82, 0x82, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x7e, 0x7f, 0x7f, 0x7f, 0x7e,
- 0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x7e, 0x7d, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x80,
- 0x82, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7e, 0x7e, 0x7d, 0x7d, 0x7e, 0x7f, 0x7f, 0x80, 0x7f, 0x7f,
- 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x81,
- 0x82, 0x80, 0x7e, 0x7f, 0x7f, 0x80, 0x81, 0x82, 0x81, 0x83, 0x82, 0x81, 0x80, 0x7f, 0x81, 0x82,
- 0x81, 0x7f, 0x7f, 0x81, 0x82, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x80, 0x82,
- 0x81, 0x80, 0x81, 0x82, 0x82, 0x7f, 0x7e, 0x7f, 0x80, 0x82, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x7f,
- 0x81, 0x83, 0x81, 0x81, 0x82, 0x82, 0x82, 0x7f, 0x80, 0x82, 0x83, 0x82, 0x7f, 0x7f, 0x7f, 0x7f,
- 0x80, 0x80, 0x7f, 0x7f, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x7f,
- 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x81, 0x82, 0x82, 0x7f, 0x81, 0x83, 0x84, 0x83, 0x81, 0x80, 0x81,
- 0x83, 0x82, 0x81, 0x80, 0x80, 0x82, 0x81, 0x80, 0x80, 0x82, 0x83, 0x80, 0x80, 0x82, 0x82, 0x81,
- 0x80, 0x81, 0x81, 0x81, 0x7f, 0x7f, 0x80, 0x7f, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7d, 0x7e, 0x80,
- 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x81, 0x82, 0x81, 0x80, 0x81, 0x82, 0x82, 0x7f, 0x7f, 0x81,
- 0x81, 0x81, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x81, 0x82, 0x81, 0x80, 0x81, 0x82, 0x83, 0x82, 0x81,
- 0x83, 0x82, 0x83, 0x83, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x7e, 0x7f,
- 0x82, 0x82, 0x80, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x80,
- 0x7e, 0x7d, 0x7f, 0x81, 0x7f, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x82, 0x81, 0x7f, 0x80,
- 0x7e, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x83, 0x82, 0x81, 0x80, 0x80, 0x81, 0x81,
- 0x82, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x84, 0x83, 0x80, 0x7e, 0x7f, 0x81, 0x81, 0x80, 0x7e,
- 0x80, 0x81, 0x7f, 0x80, 0x80, 0x7e, 0x80, 0x7f, 0x7f, 0x82, 0x81, 0x82, 0x80, 0x80, 0x7e, 0x7e,
- 0x80, 0x80, 0x81, 0x81, 0x82, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x7e, 0x7f, 0x81, 0x82,
- 0x81, 0x7e, 0x81, 0x83, 0x81, 0x80, 0x7d, 0x7d, 0x7f, 0x80, 0x81, 0x7e, 0x7f, 0x81, 0x81, 0x80,
- 0x7f, 0x80, 0x81, 0x81, 0x81, 0x82, 0x81, 0x80, 0x7c, 0x7d, 0x80, 0x81, 0x7d, 0x7b, 0x7d, 0x7f,
- 0x81, 0x81, 0x80, 0x7f, 0x7e, 0x7d, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x85, 0x84, 0x81, 0x7e,
- 0x7e, 0x7f, 0x80, 0x80, 0x7e, 0x81, 0x83, 0x82, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 0x81, 0x82,
- 0x7f, 0x81, 0x81, 0x7f, 0x7e, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80,
- 0x80, 0x81, 0x7f, 0x80, 0x81, 0x80, 0x81, 0x81, 0x81, 0x7f, 0x81, 0x81, 0x7f, 0x7f, 0x80, 0x80,
- 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80,
- 0x81, 0x80, 0x80, 0x7f, 0x81, 0x83, 0x81, 0x7f, 0x80, 0x83, 0x82, 0x7f, 0x7f, 0x80, 0x81, 0x81,
- 0x7f, 0x7f, 0x81, 0x82, 0x80, 0x81, 0x81, 0x82, 0x81, 0x7f, 0x7e, 0x80, 0x7f, 0x7f, 0x7f, 0x80,
- 0x7f, 0x80, 0x80, 0x80, 0x81, 0x7f, 0x7f, 0x81, 0x80, 0x7e, 0x7f, 0x7f, 0x80, 0x82, 0x82, 0x80,
- 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7f, 0x7f, 0x81, 0x83,
- 0x81, 0x81, 0x81, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x82, 0x81, 0x82, 0x82, 0x82, 0x83, 0x83,
- 0x81, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x81,
- 0x7d, 0x7e, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x81, 0x83, 0x83, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7e,
- 0x80, 0x7e, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x82, 0x83, 0x80, 0x80, 0x80, 0x82, 0x82, 0x80,
- 0x7f, 0x7e, 0x81, 0x7e, 0x7e, 0x81, 0x80, 0x7d, 0x7f, 0x80, 0x80, 0x80, 0x82, 0x81, 0x80, 0x81,
- 0x81, 0x81, 0x80, 0x81, 0x80, 0x80, 0x81, 0x82, 0x81, 0x81, 0x81, 0x80, 0x80, 0x81, 0x82, 0x83,
- 0x82, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x7e, 0x7f, 0x80, 0x7e,
- 0x7e, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x82, 0x81, 0x81, 0x83, 0x82,
- 0x82, 0x82, 0x81, 0x80, 0x80, 0x7e, 0x7e, 0x80, 0x81, 0x80, 0x7f, 0x81, 0x82, 0x80, 0x7f, 0x80,
- 0x80, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x82, 0x81, 0x7f, 0x7e, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x82,
- 0x81, 0x80, 0x80, 0x81, 0x7f, 0x80, 0x7f, 0x7f, 0x81, 0x80, 0x7d, 0x7f, 0x80, 0x81, 0x80, 0x7f,
- 0x7f, 0x7f, 0x7e, 0x7e, 0x7f, 0x7e, 0x80, 0x81, 0x80, 0x7f, 0x7f, 0x81, 0x7f, 0x7e, 0x7e, 0x7f,
- 0x81, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x7f,
- 0x82, 0x83, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x7f, 0x7e, 0x7e,
- 0x80, 0x7f, 0x7e, 0x81, 0x81, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x80, 0x81, 0x80,
- 0x7d, 0x7e, 0x7f, 0x7f, 0x7e, 0x80, 0x82, 0x81, 0x7e, 0x7e, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7f,
- 0x80, 0x80, 0x7e, 0x7e, 0x80, 0x81, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80,
- 0x7e, 0x7f, 0x81, 0x83, 0x81, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82, 0x81, 0x7f, 0x7e,
- 0x80, 0x82, 0x80, 0x7f, 0x7f, 0x81, 0x82, 0x7f, 0x80, 0x82, 0x80, 0x7e, 0x7f, 0x81, 0x82, 0x7f,
- 0x7e, 0x7f, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x81, 0x84, 0x81, 0x81, 0x80, 0x7e, 0x7f, 0x81,
- 0x81, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x7f, 0x7d, 0x7f, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x81,
- 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7d, 0x7f, 0x80, 0x7e, 0x7e, 0x7d,
- 0x7e, 0x80, 0x82, 0x82, 0x7f, 0x7e, 0x7e, 0x80, 0x81, 0x80, 0x7e, 0x7f, 0x80, 0x80, 0x81, 0x82,
- 0x80, 0x7f, 0x80, 0x82, 0x82, 0x80, 0x7f, 0x80, 0x82, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80,
- 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x7e, 0x7e, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x7f,
- 0x81, 0x80, 0x7e, 0x7e, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x82,
- 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x82, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
- 0x7e, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x82, 0x82, 0x81, 0x7f, 0x82, 0x82, 0x80, 0x81, 0x81,
- 0x81, 0x80, 0x81, 0x82, 0x82, 0x80, 0x7e, 0x7e, 0x7f, 0x81, 0x80, 0x7e, 0x7e, 0x80, 0x82, 0x7f,
- 0x7d, 0x7e, 0x81, 0x82, 0x80, 0x7e, 0x7d, 0x7e, 0x80, 0x7e, 0x7e, 0x80, 0x7f, 0x7f, 0x7f, 0x80,
- 0x81, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x82, 0x82, 0x81, 0x7f, 0x7f, 0x81,
- 0x81, 0x81, 0x80, 0x7f, 0x81, 0x82, 0x83, 0x82, 0x80, 0x80, 0x7f, 0x7f, 0x81, 0x81, 0x7f, 0x7e,
- 0x7f, 0x81, 0x81, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x80, 0x81, 0x7f, 0x80, 0x80, 0x7f,
- 0x7f, 0x80, 0x81, 0x82, 0x80, 0x7e, 0x81, 0x80, 0x7f, 0x82, 0x81, 0x7f, 0x7e, 0x7e, 0x80, 0x7f,
- 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80,
- 0x7f, 0x7e, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x82, 0x82, 0x81, 0x7f, 0x7e, 0x7f, 0x81,
- 0x80, 0x7f, 0x7e, 0x80, 0x81, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x81, 0x82, 0x7e, 0x7e, 0x80, 0x80,
- 0x82, 0x83, 0x80, 0x81, 0x80, 0x7f, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x7e, 0x80,
- 0x81, 0x81, 0x81, 0x82, 0x82, 0x81, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7f, 0x7f, 0x80,
- 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x7f, 0x81, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x82, 0x81, 0x80, 0x81,
- 0x82, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x82, 0x81, 0x81, 0x80, 0x81, 0x80, 0x7e, 0x80, 0x81,
- 0x81, 0x81, 0x80, 0x81, 0x80, 0x80, 0x82, 0x81, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7f,
- 0x80, 0x82, 0x82, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x82, 0x81, 0x80, 0x81, 0x81, 0x80,
- 0x81, 0x81, 0x81, 0x82, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x81, 0x82, 0x82, 0x82,
- 0x83, 0x80, 0x7f, 0x81, 0x81, 0x80, 0x81, 0x81, 0x82, 0x81, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x81,
- 0x82, 0x81, 0x80, 0x7f, 0x7e, 0x7f, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x7f,
- 0x80, 0x7f, 0x7f, 0x81, 0x83, 0x81, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x7f, 0x7f, 0x7f, 0x7f, 0x80,
- 0x81, 0x82, 0x82, 0x80, 0x7f, 0x7f, 0x82, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81,
- 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x82, 0x83, 0x82, 0x7f, 0x7f, 0x80, 0x82, 0x81,
- 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x80,
- 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
- 0x80, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x81, 0x82, 0x82, 0x81, 0x81, 0x80, 0x7f, 0x81, 0x82,
- 0x80, 0x80, 0x82, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x82, 0x81, 0x80,
- 0x81, 0x81, 0x80, 0x80, 0x82, 0x81, 0x7e, 0x7e, 0x81, 0x81, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x82,
- 0x81, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
- 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f,
- 0x7d, 0x7d, 0x7f, 0x80, 0x7e, 0x7f, 0x82, 0x80, 0x80, 0x7f, 0x81, 0x81, 0x7f, 0x7f, 0x7f, 0x7f,
- 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x81, 0x81, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80,
- 0x7f, 0x80, 0x7f, 0x81, 0x81, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x82,
- 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e,
- 0x7e, 0x7d, 0x7e, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x82, 0x81, 0x80, 0x7f, 0x80, 0x82, 0x81,
- 0x81, 0x81, 0x81, 0x82, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x81, 0x81, 0x80,
- 0x80, 0x80, 0x81, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x81, 0x7f, 0x81,
- 0x82, 0x82, 0x83, 0x81, 0x7f, 0x7f, 0x81, 0x82, 0x80, 0x7f, 0x81, 0x81, 0x81, 0x80, 0x80, 0x82,
- 0x82, 0x80, 0x80, 0x80, 0x81, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x81, 0x81, 0x7f, 0x7f, 0x7f,
- 0x7f, 0x82, 0x81, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x7f, 0x80, 0x82, 0x80, 0x81, 0x81, 0x81, 0x80,
- 0x7f, 0x7f, 0x7e, 0x81, 0x82, 0x7f, 0x7e, 0x7e, 0x7e, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x81, 0x80,
- 0x80, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x81, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x80,
- 0x81, 0x80, 0x80, 0x82, 0x81, 0x80, 0x7e, 0x7e, 0x7f, 0x7e, 0x7e, 0x80, 0x81, 0x80, 0x81, 0x81,
- 0x7f, 0x80, 0x82, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x82, 0x82, 0x80, 0x80, 0x81, 0x81, 0x80,
- 0x81, 0x80, 0x80, 0x80, 0x82, 0x81, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x7f, 0x7f, 0x81, 0x81, 0x7f, 0x7f, 0x80, 0x82, 0x81,
- 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81, 0x82, 0x82, 0x81, 0x81, 0x82, 0x80, 0x80,
- 0x81, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x81, 0x81, 0x7f, 0x7e, 0x80, 0x80, 0x80,
- 0x7f, 0x7e, 0x7d, 0x7f, 0x80, 0x81, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f,
- 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80,
- 0x81, 0x80, 0x7e, 0x7f, 0x80, 0x7e, 0x7d, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x80,
- 0x7f, 0x7f, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x7f,
- 0x81, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x81, 0x81, 0x7f, 0x80, 0x82, 0x82,
- 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7e, 0x80, 0x80, 0x80, 0x7e, 0x7f,
- 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x7e, 0x7f, 0x81, 0x82, 0x81, 0x80, 0x81,
- 0x81, 0x7f, 0x7d, 0x7e, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x7e, 0x7e, 0x7e,
- 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x82, 0x81, 0x80, 0x80,
- 0x80, 0x7f, 0x81, 0x81, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x82, 0x80, 0x7d, 0x7d, 0x7e, 0x80, 0x80,
- 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x82, 0x82, 0x80, 0x7e, 0x7e, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80,
- 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x7e, 0x7d, 0x7f, 0x80, 0x81, 0x81,
- 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f,
- 0x80, 0x81, 0x81, 0x81, 0x81, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x81, 0x81, 0x7f, 0x7f,
- 0x7f, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x81, 0x7e, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x7e,
- 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x82, 0x80, 0x80,
- 0x80, 0x81, 0x81, 0x81, 0x81, 0x7f, 0x7e, 0x80, 0x82, 0x83, 0x81, 0x7f, 0x80, 0x80, 0x81, 0x80,
- 0x7f, 0x7e, 0x81, 0x81, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x81,
- 0x80, 0x7f, 0x80, 0x81, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f,
- 0x7f, 0x80, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x80, 0x82,
- 0x81, 0x7e, 0x7f, 0x82, 0x83, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x82, 0x81, 0x7f, 0x81, 0x81, 0x80,
- 0x7e, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7e, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80,
- 0x80, 0x80, 0x80, 0x7e, 0x7f, 0x82, 0x82, 0x80, 0x7e, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x81, 0x81,
- 0x80, 0x7f, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x80, 0x81, 0x80, 0x7f, 0x7f, 0x7f,
- 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80,
- 0x80, 0x81, 0x81, 0x80, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x80, 0x80,
- 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x82, 0x83, 0x81, 0x80, 0x80, 0x80, 0x80,
- 0x7f, 0x80, 0x81, 0x82, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x80,
- 0x80, 0x7f, 0x7f, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x81, 0x7f, 0x7f, 0x7f, 0x80, 0x81,
- 0x80, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f,
- 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81,
- 0x81, 0x82, 0x81, 0x81, 0x82, 0x81, 0x80, 0x81, 0x82, 0x81, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x80,
- 0x81, 0x82, 0x80, 0x80, 0x81, 0x7e, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
- 0x80, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7f, 0x80, 0x81,
- 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x81,
- 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x7f,
- 0x7f, 0x81, 0x80, 0x7f, 0x81, 0x81, 0x80, 0x7f, 0x81, 0x82, 0x81, 0x7f, 0x81, 0x82, 0x81, 0x80,
- 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x82, 0x83, 0x81, 0x7e, 0x80, 0x80, 0x7f, 0x7e,
- 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x7f, 0x7f, 0x80, 0x81,
- 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x82, 0x80, 0x80, 0x81,
- 0x81, 0x82, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x7f, 0x80, 0x81, 0x80,
- 0x81, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x80,
- 0x7e, 0x7f, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x82, 0x81, 0x80, 0x81, 0x83, 0x82, 0x80, 0x80, 0x80,
- 0x81, 0x81, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f,
- 0x7f, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x81, 0x82, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x82,
- 0x81, 0x80, 0x81, 0x80, 0x80, 0x81, 0x7f, 0x7f, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80,
- 0x80, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x81, 0x82, 0x81, 0x81, 0x82, 0x81, 0x80, 0x80,
- 0x81, 0x80, 0x80, 0x81, 0x82, 0x81, 0x7f, 0x7f, 0x7f, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f,
- 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x7f, 0x80, 0x82, 0x81, 0x7f, 0x7f, 0x80, 0x81, 0x80,
- 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f,
- 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x7f, 0x7f, 0x80, 0x80, 0x82, 0x82, 0x81, 0x81, 0x81, 0x82, 0x81, 0x81, 0x80, 0x81, 0x81, 0x7f,
- 0x7f, 0x81, 0x80, 0x81, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
- 0x81, 0x80, 0x80, 0x81, 0x80, 0x81, 0x82, 0x7f, 0x7e, 0x7f, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81,
- 0x80, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x81, 0x81, 0x81,
- 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x7f, 0x7f,
- 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80,
- 0x81, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80,
- 0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7e, 0x7e, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f,
- 0x7f, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x7e, 0x7f, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x81,
- 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x81, 0x80,
- 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80,
- 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e,
- 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x82, 0x81, 0x81, 0x80,
- 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80,
- 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81,
- 0x80, 0x7f, 0x7f, 0x7f, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e,
- 0x7e, 0x7e, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80,
- 0x80, 0x81, 0x81, 0x80, 0x81, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x81, 0x7f,
- 0x80, 0x81, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
- 0x80, 0x81, 0x81, 0x7f, 0x7e, 0x7e, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x80, 0x7f, 0x7f,
- 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x7f,
- 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x82, 0x80,
- 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x81, 0x81, 0x7f, 0x7e, 0x7f,
- 0x80, 0x7f, 0x7f, 0x81, 0x82, 0x82, 0x80, 0x81, 0x80, 0x81, 0x81, 0x82, 0x82, 0x81, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x7e, 0x7e, 0x80, 0x81, 0x82, 0x81, 0x80, 0x80, 0x80,
- 0x81, 0x80, 0x81, 0x82, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80, 0x81,
- 0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x81,
- 0x81, 0x80, 0x7f, 0x7e, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x81, 0x82, 0x82, 0x80, 0x7f, 0x80, 0x81,
- 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x82, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80,
- 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7f,
- 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x82, 0x82, 0x80, 0x80, 0x80, 0x81, 0x81,
- 0x80, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
- 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81,
- 0x81, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
- 0x80, 0x81, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7e,
- 0x80, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x82, 0x80, 0x80, 0x80, 0x7f, 0x7f,
- 0x7f, 0x7f, 0x7e, 0x7e, 0x7f, 0x81, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x7f, 0x7f,
- 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7f,
- 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7e,
- 0x7f, 0x80, 0x7f, 0x80, 0x81, 0x82, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x7f, 0x80, 0x81, 0x7f, 0x7e,
- 0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x81, 0x81, 0x80, 0x7e, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x81,
- 0x80, 0x80, 0x82, 0x81, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x80,
- 0x81, 0x81, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x81, 0x81, 0x82, 0x81, 0x80, 0x81, 0x83, 0x82, 0x80,
- 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x81,
- 0x80, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x80, 0x7f,
- 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
- 0x80, 0x80, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x81,
- 0x81, 0x82, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x82, 0x83, 0x82, 0x81, 0x80, 0x81,
- 0x82, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x81, 0x82, 0x81, 0x80, 0x7f, 0x81, 0x82, 0x80, 0x80,
- 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x81, 0x80, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x7e, 0x7e, 0x80, 0x80,
- 0x80, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81, 0x80, 0x81, 0x81,
- 0x80, 0x7f, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x80,
- 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x81,
- 0x81, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80,
- 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81,
- 0x81, 0x82, 0x81, 0x80, 0x81, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x81, 0x80,
- 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
- 0x7e, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
- 0x80, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x7f,
- 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x7f, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x7f, 0x80,
- 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
- 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80,
- 0x80, 0x80, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80,
- 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7e, 0x7e, 0x7f, 0x80, 0x7f, 0x7e,
- 0x7e, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x81, 0x81,
- 0x81, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
- 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x80,
- 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7f,
- 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80,
- 0x81, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80,
- 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x82, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x80,
- 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80,
- 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x81, 0x82, 0x81, 0x80, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81,
- 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 0x81, 0x82, 0x81, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f,
- 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
- 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x80,
- 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x81,
- 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x80,
- 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x81, 0x80,
- 0x7f, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x80, 0x7f, 0x80, 0x80,
- 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81,
- 0x81, 0x80, 0x80, 0x80, 0x82, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80,
- 0x81, 0x81, 0x81, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7f,
- 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x80, 0x7f,
- 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f,
- 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x81, 0x82, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x81,
- 0x81, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x82, 0x81, 0x80, 0x80, 0x80, 0x81,
- 0x82, 0x81, 0x81, 0x82, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x81,
- 0x80, 0x81, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81,
- 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81,
- 0x81, 0x7f, 0x7f, 0x81, 0x82, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81,
- 0x81, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x81, 0x82, 0x81, 0x80,
- 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80,
- 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81,
- 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
- 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f,
- 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80,
- 0x81, 0x80, 0x7f, 0x80, 0x81, 0x82, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x81, 0x81, 0x7f, 0x7f, 0x80,
- 0x7f, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x82, 0x81, 0x80, 0x80, 0x81, 0x82, 0x80, 0x80, 0x80,
- 0x80, 0x81, 0x81, 0x82, 0x80, 0x7f, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
- 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x7f, 0x7f,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x82,
- 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7e, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f,
- 0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80,
- 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80,
- 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f,
- 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81,
- 0x81, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
- 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
- 0x81, 0x81, 0x7f, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x80,
- 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x81,
- 0x80, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80,
- 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80,
- 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x81,
- 0x80, 0x80, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x80, 0x80,
- 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80,
- 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7f,
- 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80,
- 0x80, 0x80, 0x81, 0x7f, 0x7f, 0x7f, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f,
- 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
- 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80,
- 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80,
- 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80,
- 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x81,
- 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x80,
- 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x7f, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e,
- 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x80,
- 0x80, 0x81, 0x81, 0x82, 0x81, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81,
- 0x81, 0x81, 0x81, 0x80, 0x80, 0x81, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80,
- 0x80, 0x7f, 0x80, 0x81, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x7f, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81, 0x81, 0x80, 0x81,
- 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
- 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x7f, 0x7f,
- 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81,
- 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
- 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
- 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80,
- 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f,
- 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f,
- 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
- 0x7f, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80,
- 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x81, 0x80, 0x7f, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81,
- 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x81,
- 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80,
- 0x80, 0x80, 0x81, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x80,
- 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x81,
- 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81,
- 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80,
- 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
- 0x7f, 0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80,
- 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80,
- 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
- 0x7f, 0x7f, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80,
- 0x81, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81,
- 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7f,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7f,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
- 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x7f,
- 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x80,
- 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81,
- 0x81, 0x81, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f,
- 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
- 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81,
- 0x81, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x81, 0x80, 0x7f,
- 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80,
- 0x80, 0x80, 0x81, 0x81, 0x81, 0x82, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
- 0x80, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x80,
- 0x81, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 0x81,
- 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x81, 0x81,
- 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x81, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f,
- 0x7f, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81,
- 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x81, 0x82, 0x81, 0x81, 0x80, 0x7f, 0x80,
- 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80,
- 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81,
- 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f,
- 0x7f, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x7f, 0x7f,
- 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80,
- 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80,
- 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
- 0x7f, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
- 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x80,
- 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x7f, 0x7f, 0x7f,
- 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x7f, 0x7f, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x81, 0x81, 0x81, 0x81,
- 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x81, 0x81, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80,
- 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x80,
- 0x81, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f,
- 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80,
- 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80,
- 0x81, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x80,
- 0x80, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80,
- 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80,
- 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80,
- 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80,
- 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81,
- 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x80,
- 0x80, 0x80, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x80,
- 0x7f, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80,
- 0x80, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80,
- 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80,
- 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80,
- 0x80, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80,
- 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x80,
- 0x80, 0x80, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80,
- 0x80, 0x80, 0x81, 0x81, 0x80, 0x81, 0x82, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80,
- 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81,
- 0x81, 0x80, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80,
- 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80,
- 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
- 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x81, 0x80, 0x80,
- 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80,
- 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f,
- 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x80,
- 0x7f, 0x80, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
- 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f,
- 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
- 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
- 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80,
- 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81,
- 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x81,
- 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80,
- 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
- 0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x81, 0x81,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x81,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81,
- 0x81, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80,
- 0x80, 0x81, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81,
- 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80,
- 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x81, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
- 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
- 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81,
- 0x81, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81,
- 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80,
- 0x81, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f,
- 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
- 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f,
- 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
- 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
- 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f,
- 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
- 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
- 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80,
- 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80,
- 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
- 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80,
- 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80,
- 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
- 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
- 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
- 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
- 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
- 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80,
- 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80,
- 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
- 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80,
- 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80,
- 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80,
- 0x81, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
- 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-};
@@ -1,8 +0,0 @@
-
-#include <stdint.h>
-
-#define MISSILELAUNCH_BITS_PER_SAMPLE 8
-#define MISSILELAUNCH_SAMPLE_RATE 24000
-#define MISSILELAUNCH_SAMPLES 36847
-
-extern const uint8_t missileLaunch[MISSILELAUNCH_SAMPLES];
@@ -0,0 +1,1173 @@
+
+#include <stdint.h>
+
+const uint8_t missileLaunch[] = {
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x19, 0x01, 0x09, 0x91, 0x19, 0x91, 0x10, 0x00, 0x19, 0x90, 0x10, 0x90, 0x09, 0x01, 0x19,
+ 0x00, 0x99, 0x31, 0x9b, 0x92, 0x11, 0x90, 0x90, 0x9a, 0x11, 0x19, 0x93, 0x39, 0xda, 0x23, 0x9b,
+ 0x11, 0x91, 0x3a, 0x93, 0x9d, 0x04, 0xb0, 0x10, 0x3a, 0xb0, 0x5a, 0xb1, 0x5a, 0xb2, 0x3a, 0xf0,
+ 0x6a, 0x9a, 0x11, 0x00, 0x01, 0x91, 0xd1, 0x2b, 0xa4, 0x9b, 0x7a, 0xb1, 0x34, 0xfa, 0x18, 0x01,
+ 0x98, 0x12, 0xba, 0x88, 0xa7, 0x8d, 0x05, 0x0b, 0x10, 0x90, 0x32, 0xc3, 0xa9, 0x0c, 0x50, 0xb1,
+ 0x72, 0x8a, 0x02, 0xd0, 0x02, 0x0a, 0x09, 0x83, 0x2d, 0xa7, 0x1f, 0xa1, 0x28, 0x00, 0x3a, 0xd8,
+ 0x02, 0xca, 0x53, 0x88, 0x20, 0x9a, 0x9b, 0xb2, 0x38, 0xb3, 0x68, 0xc8, 0x71, 0xa0, 0x00, 0x31,
+ 0x2b, 0xa3, 0x01, 0xec, 0x00, 0x25, 0xaf, 0x02, 0x0a, 0x13, 0x88, 0xb1, 0xa1, 0x8f, 0xa1, 0x05,
+ 0x2b, 0x90, 0x18, 0x98, 0xf2, 0x29, 0xb1, 0xa4, 0x4d, 0xc1, 0x12, 0x8b, 0x22, 0xb4, 0x79, 0xb0,
+ 0x01, 0x09, 0xab, 0x40, 0x90, 0x49, 0xc0, 0x80, 0xc1, 0x50, 0x91, 0x28, 0x93, 0xaf, 0x21, 0x9b,
+ 0xd0, 0xff, 0x12, 0x00, 0x4a, 0x82, 0x58, 0xa4, 0x1c, 0x96, 0x9a, 0x40, 0x9b, 0x33, 0x82, 0x9c,
+ 0x02, 0xae, 0x83, 0x0b, 0x89, 0x17, 0x2c, 0xb4, 0x2a, 0xcb, 0x01, 0x38, 0xb2, 0x5b, 0x8a, 0x87,
+ 0x1a, 0x92, 0x20, 0x90, 0x9d, 0x10, 0x18, 0x2c, 0xc2, 0x04, 0x41, 0x8e, 0xa3, 0x41, 0x8b, 0x18,
+ 0x00, 0x94, 0x99, 0xaa, 0x0a, 0xc7, 0x08, 0x2c, 0x41, 0xc8, 0x08, 0xa2, 0x88, 0x70, 0x98, 0x84,
+ 0x08, 0x19, 0x10, 0xcd, 0x23, 0x3c, 0xa2, 0xf9, 0x1a, 0x19, 0x89, 0xa6, 0xa2, 0x2a, 0x09, 0x4a,
+ 0x86, 0x99, 0x4a, 0x01, 0xaa, 0x17, 0x98, 0x19, 0x92, 0x19, 0x05, 0x8e, 0x98, 0x18, 0xa2, 0x62,
+ 0xcb, 0x30, 0xe1, 0x18, 0x01, 0x80, 0x00, 0x0c, 0xa0, 0x36, 0x8c, 0x91, 0x89, 0x6a, 0xd1, 0x11,
+ 0xa0, 0x18, 0x08, 0xb2, 0x59, 0xd8, 0x41, 0x89, 0xc0, 0x51, 0x80, 0x89, 0x89, 0x15, 0x88, 0xa9,
+ 0x39, 0xd8, 0xb0, 0x30, 0x2a, 0xf9, 0x38, 0x31, 0xe9, 0x42, 0x88, 0x80, 0x89, 0xac, 0x92, 0x87,
+ 0x5b, 0x81, 0xab, 0x02, 0x11, 0x2c, 0xa9, 0x03, 0xe9, 0x12, 0x28, 0xf3, 0x29, 0x0b, 0x26, 0x88,
+ 0x10, 0x09, 0xf2, 0x2a, 0x18, 0x81, 0xa1, 0x7a, 0xbb, 0xc4, 0x39, 0xc9, 0x23, 0xab, 0x19, 0x11,
+ 0x11, 0x70, 0xc2, 0xa1, 0x22, 0xb0, 0x71, 0x0b, 0x33, 0xbc, 0x94, 0x1c, 0xb2, 0x0b, 0x74, 0xb0,
+ 0x1a, 0xb8, 0x39, 0x83, 0xcb, 0x83, 0x90, 0x2c, 0x74, 0x89, 0x90, 0x28, 0xb5, 0x1a, 0xd9, 0x09,
+ 0x91, 0x09, 0x11, 0x31, 0xb4, 0xef, 0x04, 0x18, 0x10, 0x91, 0x11, 0x8b, 0x80, 0x92, 0x20, 0xda,
+ 0x2c, 0xc6, 0x21, 0x19, 0xc1, 0x20, 0x09, 0x21, 0xbf, 0x91, 0x13, 0x9a, 0x18, 0x95, 0x9c, 0x01,
+ 0x2d, 0x87, 0x0b, 0x01, 0x92, 0x9b, 0x12, 0xa3, 0xbc, 0xd2, 0x08, 0x78, 0x02, 0xc0, 0x39, 0x21,
+ 0xa4, 0x00, 0x1e, 0x00, 0x1e, 0xa2, 0xa2, 0x59, 0xc2, 0x38, 0x90, 0xad, 0x20, 0x90, 0x48, 0xcd,
+ 0x05, 0x89, 0x19, 0x02, 0xb8, 0x45, 0x99, 0x29, 0xc0, 0x88, 0x86, 0xa8, 0x1c, 0xb2, 0x00, 0x49,
+ 0xa0, 0x11, 0x10, 0x3c, 0xa2, 0x29, 0xd0, 0x87, 0x10, 0x9b, 0x30, 0x8f, 0x93, 0x2a, 0xb2, 0xfa,
+ 0x21, 0x90, 0x24, 0xa1, 0x99, 0x8b, 0xc0, 0x72, 0xd9, 0x91, 0x42, 0x09, 0x8e, 0x82, 0x09, 0x91,
+ 0x20, 0x9b, 0x07, 0x9a, 0x52, 0x89, 0x18, 0xa8, 0x58, 0xd1, 0x01, 0xa9, 0x0d, 0x12, 0xb9, 0x31,
+ 0xa9, 0x3a, 0x17, 0x48, 0x91, 0x81, 0x1f, 0x81, 0xa9, 0xb9, 0x40, 0x98, 0x29, 0xa0, 0x60, 0x8a,
+ 0x98, 0x43, 0x87, 0x1b, 0x22, 0xa9, 0x8d, 0xa2, 0x20, 0x08, 0x8f, 0xa1, 0x05, 0x19, 0xa2, 0x1b,
+ 0xb5, 0x6c, 0x88, 0x01, 0x81, 0x0a, 0x90, 0x8d, 0x82, 0x12, 0x28, 0xf8, 0x31, 0x84, 0x8e, 0xa9,
+ 0xa8, 0x22, 0x9e, 0x12, 0xa8, 0x52, 0x98, 0x16, 0x9a, 0x20, 0x88, 0x0a, 0x90, 0x80, 0xb1, 0x72,
+ 0xa0, 0x42, 0xba, 0xbb, 0x09, 0x25, 0x34, 0x1d, 0xcb, 0x78, 0xaa, 0x01, 0x21, 0xa9, 0x35, 0xda,
+ 0x49, 0xa8, 0x41, 0x80, 0xb8, 0x1a, 0x0e, 0x08, 0x80, 0x83, 0x23, 0x0c, 0xcc, 0x43, 0xb0, 0x0a,
+ 0x91, 0x86, 0x99, 0x53, 0xa8, 0x00, 0xc5, 0x2b, 0x80, 0x8e, 0xa1, 0x08, 0x33, 0xa3, 0x1e, 0x12,
+ 0xbc, 0x53, 0x83, 0x09, 0x50, 0x9d, 0x98, 0x39, 0x81, 0x08, 0xc3, 0xea, 0x33, 0xfc, 0x11, 0x00,
+ 0x10, 0x09, 0x10, 0x18, 0xab, 0x24, 0x2b, 0x07, 0x1b, 0xc0, 0x89, 0x12, 0x99, 0x23, 0x83, 0x5b,
+ 0x0b, 0xbf, 0x5a, 0xb0, 0x12, 0x38, 0xf2, 0x8a, 0x08, 0x99, 0x24, 0x2d, 0xb0, 0x14, 0x19, 0xe0,
+ 0x14, 0xa9, 0x10, 0x0b, 0x49, 0xd1, 0x48, 0x12, 0x29, 0x90, 0xd0, 0x99, 0x30, 0x83, 0x88, 0xb5,
+ 0xe3, 0x00, 0x1f, 0x00, 0xd0, 0x81, 0xcd, 0x20, 0x03, 0xaa, 0x70, 0xd0, 0x10, 0xd8, 0x18, 0x33,
+ 0x1b, 0xb4, 0x2a, 0xd1, 0x00, 0x28, 0x16, 0x99, 0x98, 0xa9, 0x28, 0xb1, 0x31, 0x91, 0x7a, 0x97,
+ 0x0d, 0x80, 0x99, 0x09, 0xa8, 0x62, 0x00, 0x98, 0x32, 0xe9, 0x1a, 0x14, 0x48, 0xc9, 0x00, 0x10,
+ 0xe8, 0x09, 0x22, 0xfa, 0x18, 0x83, 0x28, 0xb2, 0x28, 0x0d, 0x82, 0x6a, 0xc1, 0x08, 0xb2, 0x4a,
+ 0x88, 0x24, 0x09, 0xf0, 0x29, 0x11, 0x82, 0xab, 0x29, 0xd8, 0x8a, 0x16, 0x9d, 0x52, 0xaa, 0x10,
+ 0xc1, 0x12, 0x11, 0x19, 0x13, 0xdf, 0x03, 0x88, 0xa8, 0x1a, 0x88, 0x14, 0x98, 0x53, 0x24, 0xfc,
+ 0x28, 0x99, 0x13, 0x8d, 0x82, 0x18, 0xfa, 0x38, 0x04, 0x89, 0x01, 0x89, 0x98, 0x11, 0xac, 0x69,
+ 0x91, 0xa8, 0x83, 0x0a, 0x25, 0xba, 0x78, 0x03, 0x8c, 0x19, 0x83, 0x1e, 0xc0, 0x09, 0x22, 0xea,
+ 0x60, 0xb8, 0x20, 0xb0, 0x39, 0x82, 0x10, 0x1a, 0x93, 0x98, 0x49, 0xf4, 0x2b, 0xa2, 0xac, 0x22,
+ 0xb1, 0x70, 0xa2, 0x0a, 0x9b, 0x53, 0xa9, 0x06, 0x08, 0xb8, 0x11, 0xdb, 0x32, 0xc9, 0x2d, 0xb3,
+ 0x0e, 0x01, 0x11, 0x90, 0x35, 0x8b, 0x31, 0xc9, 0x38, 0x82, 0x49, 0xa0, 0xf2, 0x1e, 0x99, 0x30,
+ 0xb9, 0x94, 0x2b, 0xc0, 0x18, 0x01, 0x19, 0x52, 0x8a, 0x9b, 0x97, 0x08, 0x93, 0x63, 0x82, 0xac,
+ 0x91, 0x8e, 0x00, 0x12, 0xa3, 0xa8, 0xaf, 0x05, 0x98, 0x2b, 0x81, 0x48, 0xb8, 0x17, 0x09, 0x81,
+ 0xab, 0x08, 0x83, 0x21, 0x46, 0xbe, 0x90, 0x38, 0x80, 0x30, 0xaf, 0x84, 0x2a, 0x38, 0xa9, 0x17,
+ 0x9a, 0x12, 0x0b, 0xc0, 0x00, 0x19, 0x26, 0xaa, 0x25, 0xab, 0x80, 0xc8, 0x10, 0x80, 0xba, 0x69,
+ 0xa1, 0x20, 0x81, 0xbd, 0x26, 0xc1, 0x48, 0xa2, 0x4a, 0xb2, 0x0c, 0x8b, 0x82, 0x11, 0xf1, 0x28,
+ 0x20, 0xff, 0x29, 0x00, 0x11, 0xda, 0x24, 0xbb, 0x34, 0xd9, 0x31, 0xc0, 0x29, 0x85, 0x8a, 0x10,
+ 0x39, 0xc9, 0x51, 0xb8, 0x1a, 0xa0, 0xbb, 0x47, 0xb9, 0x32, 0x9d, 0x10, 0x2a, 0x87, 0x89, 0x10,
+ 0xc9, 0x08, 0x81, 0x7a, 0x82, 0x9b, 0x08, 0x08, 0x00, 0x10, 0x28, 0x05, 0xac, 0x40, 0xbd, 0x20,
+ 0xc2, 0x02, 0x24, 0x8b, 0x10, 0x99, 0x4d, 0x90, 0xba, 0x37, 0x1e, 0x00, 0x9a, 0x22, 0x08, 0x29,
+ 0xf2, 0x40, 0xb0, 0x0a, 0x90, 0xcc, 0x61, 0x8a, 0x92, 0x98, 0x58, 0xa0, 0x18, 0x05, 0x38, 0x93,
+ 0x0a, 0xd0, 0xb9, 0x69, 0xaa, 0x13, 0xd8, 0x89, 0x82, 0xbc, 0x6a, 0x83, 0x10, 0x89, 0x13, 0x2d,
+ 0xe8, 0x00, 0x10, 0x91, 0x7b, 0xc2, 0xa2, 0x38, 0x9c, 0x28, 0x92, 0x91, 0x90, 0x63, 0x19, 0x89,
+ 0x38, 0xe1, 0x91, 0x1e, 0x93, 0xd8, 0x3a, 0x82, 0x00, 0x78, 0xa8, 0x88, 0x8c, 0x98, 0x23, 0x82,
+ 0x0d, 0x29, 0x84, 0xd0, 0x31, 0x82, 0x1b, 0xf6, 0x50, 0xa8, 0x8a, 0x03, 0x0b, 0x31, 0x09, 0x48,
+ 0xf8, 0x19, 0x00, 0xa2, 0x01, 0x00, 0x93, 0xdf, 0x20, 0x80, 0xa8, 0x73, 0x08, 0x80, 0x98, 0x09,
+ 0x48, 0xe8, 0x20, 0x08, 0xca, 0xb1, 0x10, 0x38, 0x43, 0x3a, 0xc6, 0x99, 0x28, 0x90, 0x48, 0xaa,
+ 0xa4, 0x01, 0x62, 0x90, 0xb0, 0x2d, 0xa0, 0x21, 0xc3, 0x41, 0x9d, 0xaa, 0xc2, 0x20, 0x08, 0x9c,
+ 0x27, 0xab, 0x32, 0xbb, 0x52, 0x83, 0x8b, 0x95, 0x09, 0x1a, 0x30, 0xc9, 0x39, 0x88, 0xf8, 0x29,
+ 0x12, 0x1f, 0x82, 0x8e, 0x22, 0xe0, 0x38, 0x92, 0x0b, 0x16, 0x80, 0x0c, 0x11, 0xb1, 0x2c, 0xa4,
+ 0x2a, 0xc8, 0x12, 0x98, 0x3a, 0xd9, 0x60, 0xe1, 0x10, 0x00, 0x01, 0x9c, 0x48, 0xba, 0x01, 0x33,
+ 0xa2, 0x19, 0x2c, 0x85, 0xcb, 0x94, 0x0c, 0x86, 0x0d, 0x12, 0x08, 0xab, 0x18, 0xa1, 0x22, 0x09,
+ 0x1a, 0x00, 0x25, 0x00, 0x04, 0xfa, 0x69, 0x02, 0x99, 0x00, 0x9c, 0x84, 0x9a, 0x21, 0xc9, 0x92,
+ 0x14, 0xa8, 0x4a, 0xd1, 0x4a, 0x82, 0x89, 0x52, 0xbb, 0x28, 0x27, 0xba, 0x59, 0xf9, 0x18, 0x12,
+ 0x8d, 0x83, 0x88, 0x19, 0x98, 0x30, 0xb1, 0x3a, 0x18, 0xa3, 0xab, 0x64, 0xa0, 0x43, 0x9b, 0xa9,
+ 0x9c, 0x73, 0x8c, 0x93, 0xaa, 0x00, 0x08, 0x2d, 0x06, 0x88, 0x89, 0x41, 0xbc, 0x35, 0x98, 0x33,
+ 0xfb, 0x19, 0xc1, 0x29, 0x81, 0x89, 0x28, 0xbc, 0x05, 0x0a, 0x91, 0x15, 0x3a, 0x05, 0x8c, 0x82,
+ 0xd8, 0x39, 0xb0, 0x29, 0xc2, 0x0b, 0x50, 0xb2, 0x61, 0x82, 0x8c, 0x91, 0x19, 0x90, 0xa2, 0x51,
+ 0xa1, 0x9f, 0x5a, 0x88, 0xa8, 0x29, 0xa1, 0x29, 0x19, 0xc2, 0x57, 0xaa, 0x11, 0x0a, 0x10, 0xb3,
+ 0x0a, 0x96, 0x4a, 0xa0, 0x33, 0x9c, 0x90, 0xf2, 0x38, 0xb3, 0x3c, 0xca, 0x43, 0xbd, 0x04, 0x09,
+ 0x38, 0x03, 0xea, 0x89, 0x12, 0x12, 0x05, 0x89, 0x8d, 0xb2, 0x39, 0xc8, 0x3f, 0xb2, 0x29, 0xa8,
+ 0x91, 0x52, 0x01, 0x90, 0x71, 0xd0, 0x08, 0x82, 0x19, 0x88, 0x1b, 0x21, 0xea, 0x13, 0x2e, 0xb1,
+ 0x89, 0x33, 0xda, 0x0a, 0x22, 0xbb, 0x00, 0x71, 0x85, 0x8d, 0x10, 0x99, 0x91, 0x50, 0x28, 0xb4,
+ 0x09, 0x89, 0xba, 0x11, 0x4b, 0x16, 0x01, 0xbf, 0xa1, 0x01, 0x38, 0x28, 0x4c, 0x96, 0x0a, 0x91,
+ 0x01, 0x0a, 0x00, 0xd5, 0x39, 0x98, 0x2c, 0xa0, 0x59, 0x83, 0xd2, 0x09, 0x0a, 0x82, 0xeb, 0x14,
+ 0x99, 0x31, 0x88, 0x10, 0x27, 0x9b, 0xb1, 0x2a, 0x0d, 0x87, 0xac, 0x20, 0x91, 0xb8, 0x20, 0x0e,
+ 0x11, 0xe1, 0x40, 0x11, 0x90, 0x4b, 0xb2, 0x0b, 0xa0, 0x18, 0x32, 0x97, 0x7a, 0xb0, 0x8a, 0x32,
+ 0xa8, 0xcb, 0x21, 0x80, 0x89, 0x28, 0x16, 0x9a, 0x90, 0x92, 0xbf, 0x52, 0xa1, 0x10, 0x99, 0x1e,
+ 0xab, 0x00, 0x2c, 0x00, 0xaa, 0x88, 0x48, 0xb3, 0x71, 0xb2, 0x88, 0x50, 0xf3, 0x09, 0x01, 0x9b,
+ 0x22, 0x90, 0x2d, 0xc1, 0x0d, 0x23, 0x9b, 0x04, 0x99, 0x89, 0x14, 0x32, 0x22, 0xf0, 0x3b, 0x82,
+ 0xae, 0x04, 0xa9, 0x40, 0xb8, 0x20, 0x9d, 0x11, 0x0a, 0x16, 0x1b, 0xa3, 0x48, 0xc8, 0x2c, 0x01,
+ 0xdb, 0x12, 0xa0, 0x2a, 0x80, 0x9b, 0x07, 0x0e, 0x40, 0xa8, 0x19, 0x02, 0x8b, 0x16, 0x8b, 0x43,
+ 0xa5, 0x9b, 0x11, 0xcc, 0x21, 0x38, 0xc9, 0x03, 0x0d, 0x11, 0xe2, 0x3a, 0xc1, 0x81, 0x38, 0x00,
+ 0x29, 0xda, 0x91, 0x79, 0x84, 0x80, 0x8a, 0x88, 0x9a, 0x0a, 0xc1, 0x78, 0x91, 0xc1, 0x23, 0x0d,
+ 0x01, 0x13, 0xb9, 0x90, 0x0d, 0xa5, 0x2d, 0x82, 0xb0, 0x1a, 0x1a, 0x06, 0x18, 0x98, 0xaa, 0x79,
+ 0xa2, 0x61, 0xa0, 0x1a, 0xc2, 0x1a, 0x81, 0x00, 0x8d, 0xa3, 0x0b, 0xbb, 0x71, 0x83, 0x18, 0x97,
+ 0x28, 0xa8, 0x99, 0x21, 0x17, 0xac, 0x12, 0xc1, 0x8c, 0x01, 0x0b, 0x87, 0x1a, 0x52, 0xa8, 0x89,
+ 0xb0, 0x00, 0x90, 0x9a, 0x88, 0x15, 0x91, 0x3a, 0x85, 0x6c, 0xa1, 0x80, 0x4a, 0xc8, 0x90, 0x29,
+ 0x28, 0x38, 0xd0, 0x03, 0xfa, 0x2a, 0x05, 0x8b, 0x10, 0x06, 0x89, 0xb1, 0x58, 0x94, 0x2b, 0x8a,
+ 0xa8, 0x99, 0x91, 0xdc, 0x23, 0x71, 0xa8, 0x1c, 0x84, 0xa9, 0x31, 0xd2, 0x18, 0xd9, 0x50, 0x81,
+ 0x89, 0x00, 0x08, 0x3b, 0x13, 0x34, 0xfd, 0x12, 0xaa, 0x2a, 0x10, 0x01, 0xa9, 0x18, 0x80, 0xb3,
+ 0xac, 0x3e, 0xa8, 0x78, 0xc2, 0x2a, 0x05, 0x18, 0xb8, 0xba, 0x73, 0x12, 0xcb, 0x41, 0xb0, 0x9a,
+ 0x89, 0x21, 0xa9, 0x7a, 0xa1, 0xaa, 0x34, 0x03, 0x8a, 0xd1, 0x29, 0x83, 0x7b, 0x93, 0xba, 0x8b,
+ 0xdb, 0x99, 0x79, 0xa4, 0x0a, 0x21, 0x08, 0x88, 0x97, 0x20, 0x91, 0x09, 0x15, 0x9c, 0x28, 0xab,
+ 0x4c, 0x00, 0x29, 0x00, 0x68, 0xe0, 0x29, 0xca, 0x30, 0xa3, 0x13, 0x1e, 0x02, 0x8a, 0xc2, 0x3b,
+ 0x83, 0x88, 0xc7, 0x4a, 0x00, 0x21, 0xc8, 0x0a, 0x93, 0xbe, 0x64, 0xaa, 0x21, 0x9a, 0x11, 0x02,
+ 0x0a, 0xe1, 0x28, 0x9a, 0x82, 0x1a, 0x20, 0x87, 0x6a, 0xb1, 0x1e, 0x92, 0x00, 0x82, 0x99, 0x81,
+ 0x8d, 0x82, 0x2c, 0xa0, 0x83, 0xd8, 0x31, 0x98, 0x48, 0x91, 0x4c, 0xa2, 0x15, 0x89, 0xa2, 0xbf,
+ 0x11, 0xaa, 0x51, 0x90, 0x9a, 0x02, 0x26, 0xc9, 0x02, 0xcb, 0xa0, 0x62, 0x92, 0x19, 0x91, 0x9d,
+ 0x00, 0x20, 0x3b, 0xe5, 0x2a, 0x02, 0x1c, 0xb0, 0x70, 0x00, 0x9a, 0x10, 0x84, 0xbb, 0x49, 0x11,
+ 0x13, 0x9d, 0x91, 0x8a, 0xb4, 0x91, 0x79, 0xba, 0x22, 0x87, 0x0a, 0x99, 0x28, 0xc0, 0x10, 0x94,
+ 0x09, 0x83, 0xcf, 0x32, 0x32, 0xfa, 0x28, 0xb2, 0x89, 0x12, 0x2b, 0xb1, 0x9f, 0x32, 0x18, 0x00,
+ 0x10, 0x85, 0xab, 0xb5, 0xaa, 0x48, 0x79, 0xb8, 0x92, 0x69, 0xa0, 0x1b, 0x10, 0xc0, 0x12, 0x9d,
+ 0x62, 0x81, 0x50, 0xc8, 0x80, 0xab, 0x10, 0x49, 0xb0, 0x01, 0x99, 0x18, 0x08, 0x14, 0x22, 0xdd,
+ 0x52, 0x9b, 0x42, 0xa0, 0x3a, 0x22, 0xf8, 0x4b, 0xc2, 0x8a, 0x12, 0x1b, 0x06, 0x8a, 0x8a, 0x15,
+ 0x89, 0xd8, 0x30, 0x1a, 0xf2, 0x28, 0x98, 0x82, 0x0b, 0x10, 0x24, 0x8c, 0x19, 0x11, 0xe9, 0x70,
+ 0xb0, 0x8a, 0x20, 0x83, 0x98, 0x4d, 0x93, 0x2b, 0xb0, 0x11, 0x41, 0xc9, 0x58, 0xe9, 0x10, 0x99,
+ 0x10, 0x99, 0x82, 0x0d, 0x39, 0x52, 0x81, 0xb0, 0x2c, 0xa3, 0x81, 0x6d, 0x84, 0x89, 0xe9, 0x00,
+ 0x2b, 0xa1, 0x28, 0x01, 0xe1, 0x28, 0x12, 0x98, 0x09, 0x9b, 0x07, 0x0f, 0x00, 0x90, 0x2a, 0x32,
+ 0x82, 0xd9, 0x25, 0x8c, 0x80, 0xb0, 0x10, 0xb3, 0x9d, 0x68, 0xb8, 0x81, 0x19, 0x82, 0x38, 0x96,
+ 0x8c, 0x00, 0x2c, 0x00, 0x87, 0x0d, 0x02, 0xa9, 0x31, 0xa3, 0xab, 0x08, 0x0c, 0x98, 0x05, 0x8b,
+ 0x30, 0xf9, 0x59, 0xa9, 0x31, 0x01, 0x14, 0x0c, 0xb4, 0x2a, 0x0d, 0x00, 0x98, 0x34, 0xbd, 0x0a,
+ 0xda, 0x03, 0x18, 0x43, 0x03, 0xaa, 0x42, 0x1a, 0xd0, 0x5a, 0x32, 0xe1, 0x19, 0xa1, 0xba, 0x28,
+ 0x9a, 0xac, 0x38, 0x21, 0x07, 0x8a, 0x27, 0x09, 0x10, 0xa3, 0x18, 0xd2, 0x98, 0x2e, 0xc0, 0xc9,
+ 0x58, 0x81, 0x09, 0x94, 0x2b, 0x89, 0xd9, 0x03, 0x81, 0x19, 0x15, 0x3b, 0xbb, 0x78, 0x81, 0x90,
+ 0x33, 0xf1, 0x09, 0x0a, 0xb0, 0x3d, 0x84, 0xab, 0x89, 0xf1, 0x48, 0x13, 0x1a, 0x91, 0x92, 0x51,
+ 0xf8, 0x2a, 0xa8, 0x1a, 0x43, 0xb8, 0x81, 0x88, 0x1b, 0x79, 0x88, 0x25, 0xa9, 0x96, 0x98, 0x18,
+ 0xb9, 0x2d, 0x79, 0xa0, 0x82, 0xba, 0x58, 0xb1, 0x02, 0x21, 0x90, 0x8d, 0x48, 0x84, 0xbc, 0x01,
+ 0x89, 0x18, 0x15, 0xbb, 0xa0, 0x6a, 0x14, 0x98, 0xa2, 0x8f, 0x02, 0x88, 0x88, 0x24, 0xd0, 0x6a,
+ 0x92, 0x9b, 0xa3, 0x1a, 0x01, 0xa0, 0x1f, 0xb3, 0x5a, 0xab, 0x51, 0xa2, 0x90, 0x29, 0x87, 0x89,
+ 0x29, 0xc2, 0x29, 0x84, 0x89, 0xda, 0x11, 0x98, 0xa3, 0x3a, 0xb3, 0xb0, 0x1f, 0x97, 0x29, 0x9a,
+ 0x10, 0xa1, 0x52, 0x9a, 0xa5, 0x11, 0x8b, 0xa4, 0x40, 0x0c, 0x03, 0xea, 0x0a, 0x93, 0x3a, 0xca,
+ 0x71, 0xb2, 0x21, 0x8a, 0x01, 0x01, 0xb8, 0xdc, 0x88, 0x92, 0x9f, 0x87, 0x09, 0x28, 0xa8, 0x40,
+ 0xa1, 0x0a, 0x08, 0x10, 0x12, 0x02, 0xad, 0x02, 0x7c, 0x92, 0xac, 0x02, 0x89, 0x3a, 0xc8, 0x94,
+ 0x2e, 0xb0, 0x20, 0x20, 0x22, 0x86, 0x70, 0x90, 0x99, 0xaa, 0x1b, 0xa3, 0x31, 0xad, 0xbd, 0x83,
+ 0x5c, 0x03, 0x00, 0x32, 0xbd, 0x41, 0xc0, 0x42, 0xb8, 0x8a, 0x13, 0x9c, 0x99, 0xd2, 0x5a, 0x19,
+ 0x77, 0xff, 0x31, 0x00, 0x29, 0x97, 0x1b, 0x00, 0x29, 0x95, 0x8c, 0x03, 0x8a, 0xd0, 0x4a, 0xc1,
+ 0x08, 0x21, 0x2a, 0x04, 0x8d, 0x03, 0xc1, 0x48, 0xd8, 0x21, 0x88, 0x10, 0xa2, 0x8e, 0x02, 0xca,
+ 0x3c, 0x93, 0xbb, 0x73, 0xb0, 0x98, 0x23, 0x1a, 0x03, 0x94, 0x1f, 0xd1, 0x18, 0x80, 0x80, 0x28,
+ 0xd0, 0x71, 0xb0, 0x39, 0x93, 0x9c, 0x02, 0x13, 0x01, 0x8c, 0xd3, 0x2a, 0x9a, 0x12, 0x18, 0xf4,
+ 0x1c, 0xa2, 0x29, 0x02, 0x20, 0x53, 0x0c, 0xd0, 0x09, 0x01, 0xb8, 0xe0, 0x40, 0x08, 0x9a, 0x12,
+ 0x38, 0x17, 0xaa, 0x13, 0x9d, 0x88, 0xb8, 0x43, 0xe9, 0x53, 0xb8, 0x19, 0x29, 0xd0, 0x10, 0x81,
+ 0x09, 0x58, 0xb0, 0x18, 0x02, 0x0f, 0x13, 0xb9, 0x53, 0xac, 0x08, 0x90, 0xb0, 0x40, 0xab, 0x27,
+ 0xa9, 0x08, 0xaa, 0x69, 0x41, 0x11, 0x92, 0x31, 0xfb, 0x9a, 0x2a, 0x2a, 0x9c, 0x05, 0x8b, 0xd2,
+ 0x98, 0x69, 0x00, 0x33, 0x8b, 0x23, 0xd0, 0x1c, 0xd0, 0x21, 0x90, 0x29, 0xc8, 0x84, 0x89, 0x2f,
+ 0xa0, 0x18, 0x03, 0x9a, 0x42, 0xb9, 0x44, 0x8d, 0x20, 0xa1, 0x13, 0xae, 0x8b, 0x05, 0x09, 0x8c,
+ 0x25, 0xb1, 0x22, 0xb9, 0x1e, 0x80, 0x92, 0x0a, 0x80, 0x13, 0x0f, 0x10, 0x11, 0x2c, 0x92, 0x44,
+ 0xbd, 0x82, 0x0a, 0x42, 0xa1, 0x09, 0xb0, 0x90, 0x9d, 0x02, 0x69, 0x95, 0x8d, 0x05, 0x8a, 0xa9,
+ 0x18, 0x13, 0xbc, 0x20, 0x43, 0xb0, 0xb8, 0x3d, 0xb5, 0x20, 0x82, 0x68, 0xd1, 0x88, 0x08, 0xc9,
+ 0x49, 0x04, 0x18, 0x91, 0x18, 0xac, 0x40, 0x80, 0x0b, 0xa5, 0x2b, 0xfa, 0x81, 0xc9, 0x63, 0xba,
+ 0x32, 0x24, 0xba, 0x99, 0x01, 0xa9, 0x12, 0xbb, 0x46, 0x0b, 0xc3, 0x42, 0xbd, 0x42, 0x98, 0x33,
+ 0xcb, 0x8b, 0x83, 0x93, 0xae, 0x21, 0x70, 0x88, 0x00, 0xa0, 0x08, 0x23, 0xca, 0x79, 0xa0, 0xa0,
+ 0xf6, 0xfc, 0x30, 0x00, 0x32, 0xaa, 0xa1, 0x20, 0x69, 0x99, 0x84, 0x8d, 0x28, 0xc2, 0x63, 0xa8,
+ 0xc0, 0x09, 0x99, 0xa0, 0x78, 0x90, 0x82, 0x18, 0x4a, 0x90, 0x58, 0x93, 0x73, 0xb9, 0x81, 0x2b,
+ 0xc0, 0xb1, 0x0a, 0x52, 0xe9, 0x1a, 0x82, 0xe9, 0x33, 0x19, 0x18, 0x00, 0xf2, 0x58, 0xb9, 0x48,
+ 0xa2, 0x0a, 0x21, 0xb9, 0xab, 0x84, 0xc8, 0x16, 0x9c, 0x21, 0x92, 0x9d, 0x18, 0x09, 0x32, 0x14,
+ 0x65, 0xd9, 0x81, 0xa9, 0x12, 0xa9, 0x48, 0xe0, 0x19, 0x82, 0x08, 0x03, 0x0e, 0x95, 0x2a, 0xa2,
+ 0x18, 0x09, 0x8e, 0x13, 0xcb, 0x34, 0xa8, 0x88, 0x18, 0xc0, 0x23, 0xaf, 0x13, 0x11, 0x18, 0xbc,
+ 0x80, 0xad, 0x48, 0x02, 0x43, 0x9c, 0x14, 0x0b, 0xa1, 0x41, 0xbc, 0x13, 0x80, 0xcd, 0x99, 0x39,
+ 0x21, 0x25, 0x80, 0x02, 0x8f, 0x89, 0x95, 0x28, 0x28, 0x63, 0xb9, 0x0a, 0x98, 0xa2, 0x0c, 0x82,
+ 0x39, 0xd2, 0xea, 0x29, 0x33, 0xd2, 0x5d, 0x02, 0x89, 0x00, 0xb9, 0x08, 0x4a, 0x91, 0x0a, 0x13,
+ 0xf8, 0x1f, 0x41, 0xb0, 0x29, 0x02, 0x08, 0xaa, 0x30, 0xa9, 0x1a, 0x8e, 0x15, 0x03, 0xcb, 0x81,
+ 0xaf, 0x00, 0x02, 0x89, 0x54, 0xaa, 0x18, 0x95, 0x19, 0xa3, 0x30, 0x9a, 0x98, 0x70, 0xf9, 0x39,
+ 0x08, 0x01, 0x38, 0xb2, 0x8f, 0x84, 0x98, 0x88, 0x31, 0x9a, 0x20, 0x9a, 0xc6, 0x89, 0x89, 0x11,
+ 0x38, 0x10, 0x35, 0xcf, 0x02, 0x00, 0x09, 0x82, 0xa8, 0x79, 0x88, 0x8d, 0x84, 0x0a, 0x23, 0x1c,
+ 0xa1, 0xa2, 0xd9, 0xb9, 0x70, 0x23, 0xc0, 0x08, 0x9a, 0x29, 0x99, 0x04, 0x83, 0xfb, 0x68, 0x98,
+ 0x89, 0x01, 0xa3, 0x48, 0x90, 0x24, 0xec, 0x00, 0x1b, 0x03, 0xc0, 0x29, 0x80, 0xbb, 0xb1, 0x6b,
+ 0xb6, 0x4b, 0x83, 0x53, 0x8c, 0x08, 0x89, 0x03, 0x12, 0x91, 0x0e, 0xd3, 0x9b, 0x40, 0x2a, 0x80,
+ 0xe3, 0x04, 0x30, 0x00, 0x8c, 0x90, 0xdc, 0x32, 0x9c, 0x33, 0x90, 0x02, 0x5b, 0xb9, 0x10, 0x94,
+ 0x59, 0x81, 0xab, 0xda, 0xe2, 0x3a, 0x88, 0x31, 0x85, 0x21, 0x90, 0x1a, 0xfb, 0x11, 0x89, 0x21,
+ 0x19, 0xb0, 0x3d, 0xb3, 0x38, 0xa9, 0x47, 0xbb, 0x00, 0x9f, 0xa2, 0x85, 0x9c, 0x24, 0x80, 0x11,
+ 0x29, 0xb9, 0x89, 0x08, 0x23, 0xfa, 0x0b, 0xdb, 0x10, 0x88, 0x7a, 0x84, 0x02, 0x19, 0x2a, 0xa7,
+ 0x1b, 0x12, 0x1a, 0x06, 0xda, 0x99, 0x38, 0x9d, 0x18, 0x93, 0x28, 0x01, 0x0d, 0x30, 0x12, 0x12,
+ 0x3d, 0x15, 0xa2, 0x9f, 0xa2, 0x89, 0x81, 0x9c, 0x05, 0x81, 0x0f, 0x92, 0x80, 0x89, 0x58, 0x91,
+ 0x00, 0xb1, 0x99, 0x1b, 0x8b, 0x14, 0xb7, 0x18, 0x81, 0x42, 0xdd, 0x5a, 0x82, 0x90, 0x22, 0x00,
+ 0xc9, 0xbc, 0x21, 0x10, 0x80, 0x09, 0x96, 0x89, 0xf9, 0x39, 0x83, 0x72, 0xa8, 0x38, 0xa9, 0xa0,
+ 0xa8, 0x18, 0x01, 0x48, 0xba, 0xaf, 0x91, 0x10, 0x05, 0x0b, 0x35, 0xa0, 0xea, 0x01, 0x10, 0x33,
+ 0xab, 0x07, 0x91, 0x19, 0x9c, 0x92, 0x8f, 0x92, 0x2b, 0x9a, 0x25, 0xa0, 0x34, 0x1a, 0xc2, 0x39,
+ 0x0a, 0xd0, 0x02, 0xb0, 0xce, 0x50, 0x99, 0x45, 0xa8, 0x09, 0x8b, 0xa2, 0x88, 0x78, 0x03, 0x9c,
+ 0xa0, 0x90, 0x18, 0x0c, 0x16, 0x08, 0x82, 0x89, 0xcd, 0x18, 0x32, 0xa0, 0x6c, 0x91, 0x0a, 0xb0,
+ 0x28, 0x17, 0x98, 0x13, 0x9c, 0x98, 0x8b, 0xc0, 0x22, 0x48, 0x40, 0xf8, 0x22, 0x98, 0x18, 0xb8,
+ 0x3d, 0x14, 0xd8, 0x0a, 0xc2, 0x0b, 0x15, 0x3b, 0x82, 0x82, 0xac, 0x1a, 0x83, 0x10, 0xf8, 0x61,
+ 0xb2, 0x18, 0xa9, 0x22, 0x0e, 0x98, 0x11, 0x82, 0xab, 0x50, 0xa0, 0x8b, 0x27, 0xb0, 0x59, 0x02,
+ 0xf2, 0x1c, 0x91, 0xa9, 0x20, 0x92, 0x12, 0x8b, 0x10, 0xbf, 0x34, 0xa1, 0x2c, 0x95, 0x98, 0x0c,
+ 0x6c, 0xf9, 0x35, 0x00, 0x39, 0xa4, 0x70, 0x91, 0x19, 0xa2, 0x0c, 0x98, 0x10, 0x30, 0xc4, 0x01,
+ 0x0b, 0xdd, 0x30, 0x80, 0x18, 0x17, 0x8c, 0x00, 0xb9, 0x38, 0x25, 0xb9, 0x10, 0x0a, 0x99, 0x1b,
+ 0xd3, 0x49, 0x91, 0x17, 0x9b, 0xa0, 0x08, 0x24, 0xab, 0x41, 0x85, 0x8a, 0x19, 0xc2, 0xad, 0x38,
+ 0x15, 0x1b, 0x01, 0xcb, 0x84, 0x9d, 0x15, 0x2a, 0x81, 0xd8, 0x39, 0x81, 0x98, 0x1f, 0x02, 0x89,
+ 0x92, 0x1b, 0x22, 0xd8, 0x8b, 0x46, 0x08, 0xc0, 0x18, 0x81, 0x88, 0x90, 0x0d, 0x41, 0xda, 0x15,
+ 0x91, 0x9e, 0x11, 0x0a, 0x23, 0xa9, 0xa1, 0x60, 0x8c, 0x02, 0x2a, 0x32, 0xfb, 0x00, 0x19, 0x31,
+ 0x8e, 0x91, 0x34, 0xb8, 0xa8, 0x20, 0xba, 0x8e, 0x82, 0x08, 0xad, 0x54, 0x01, 0xb9, 0x4a, 0x92,
+ 0x12, 0xa1, 0x40, 0xb0, 0xab, 0x38, 0x8d, 0xb4, 0x8c, 0x9b, 0x93, 0x7a, 0x80, 0xc9, 0x24, 0x33,
+ 0x03, 0xcc, 0x39, 0x48, 0xf1, 0x18, 0x29, 0x88, 0xd9, 0x3a, 0x11, 0xc3, 0x40, 0x90, 0x18, 0xd8,
+ 0x18, 0xa1, 0x9e, 0x22, 0x98, 0x15, 0x8b, 0x31, 0xfb, 0x09, 0x53, 0x39, 0xa3, 0xbd, 0x1c, 0x04,
+ 0x0c, 0x92, 0x11, 0x8b, 0x00, 0x48, 0xf0, 0x82, 0x0c, 0x23, 0x69, 0xc0, 0x10, 0x08, 0x8a, 0x81,
+ 0x02, 0x98, 0x8f, 0x92, 0xb1, 0x1f, 0x92, 0x23, 0x09, 0x91, 0x0c, 0x11, 0xc0, 0x1c, 0x03, 0x14,
+ 0x9f, 0x20, 0xac, 0x42, 0xa8, 0x20, 0x28, 0x86, 0x8a, 0x08, 0xd9, 0x52, 0x98, 0x19, 0x99, 0x20,
+ 0xe9, 0x42, 0x99, 0x01, 0x82, 0xcc, 0x49, 0xa2, 0x9a, 0x95, 0x18, 0x68, 0xa0, 0x81, 0x80, 0x0a,
+ 0x09, 0xe0, 0x48, 0x93, 0x3b, 0xb4, 0xe8, 0x39, 0x81, 0x7b, 0xb1, 0x20, 0x9b, 0x81, 0x9d, 0x12,
+ 0x61, 0xc1, 0x10, 0x90, 0x0f, 0x80, 0x11, 0x09, 0x62, 0xb8, 0x91, 0x89, 0x11, 0xe8, 0x51, 0x99,
+ 0x0a, 0xfc, 0x38, 0x00, 0x49, 0xc1, 0x28, 0xc1, 0x59, 0x90, 0x10, 0x00, 0x91, 0x1c, 0x04, 0xcc,
+ 0x32, 0x00, 0x08, 0xab, 0xaa, 0x25, 0xbd, 0x52, 0x09, 0xa8, 0x91, 0x53, 0xab, 0xb0, 0x72, 0xb1,
+ 0x8a, 0x83, 0x0b, 0x20, 0x87, 0x8d, 0x51, 0x90, 0x80, 0x0a, 0x09, 0xb8, 0x99, 0x47, 0x8a, 0x28,
+ 0x90, 0xaa, 0x30, 0x4e, 0x94, 0xa0, 0x20, 0x8d, 0x92, 0xc0, 0x39, 0x05, 0x2b, 0xa0, 0x8a, 0xa5,
+ 0x0d, 0x18, 0x32, 0x91, 0x2a, 0xf2, 0x0c, 0x80, 0x58, 0x80, 0x00, 0x18, 0xb2, 0x1c, 0xa6, 0x0d,
+ 0x32, 0xa0, 0x21, 0xd1, 0x8f, 0x02, 0x89, 0x20, 0x83, 0x8a, 0xa0, 0x3c, 0xa1, 0x38, 0x92, 0x30,
+ 0xd8, 0xcc, 0x04, 0xba, 0x48, 0x12, 0x27, 0xaf, 0x14, 0xa9, 0x20, 0xb9, 0x10, 0x14, 0x09, 0x9c,
+ 0x20, 0x98, 0x19, 0xb2, 0x2a, 0xbd, 0x27, 0xba, 0x12, 0x01, 0x48, 0xa3, 0xaa, 0x48, 0x0a, 0x0b,
+ 0x97, 0x8e, 0x23, 0xc9, 0x32, 0x8b, 0x14, 0x8c, 0xb1, 0x79, 0x0a, 0xb2, 0xd2, 0x49, 0xa2, 0x9b,
+ 0x51, 0x00, 0xa0, 0x21, 0xa8, 0x96, 0xaa, 0x5b, 0xb3, 0xa9, 0x5b, 0x09, 0xb0, 0x30, 0x39, 0x10,
+ 0x97, 0x6b, 0x38, 0xc1, 0x8a, 0x38, 0x95, 0x1a, 0x82, 0xef, 0x11, 0x19, 0xb0, 0x03, 0x09, 0x80,
+ 0xa1, 0x61, 0x8d, 0x12, 0x89, 0xb3, 0x59, 0xb8, 0x11, 0x09, 0x0e, 0x32, 0xaa, 0x64, 0xd1, 0x99,
+ 0x00, 0x90, 0x40, 0x21, 0x0c, 0xd9, 0x38, 0xac, 0x33, 0x11, 0x92, 0x29, 0x0c, 0xaa, 0x12, 0x91,
+ 0x7b, 0xd3, 0x98, 0x02, 0x2e, 0x88, 0x08, 0x7a, 0x02, 0xa9, 0xb3, 0xb8, 0x79, 0x89, 0x31, 0x91,
+ 0x3c, 0xb8, 0xbc, 0x89, 0x38, 0x71, 0xb7, 0x00, 0x10, 0xbc, 0x00, 0x20, 0x10, 0xa4, 0x39, 0xe9,
+ 0x59, 0xb0, 0x0b, 0x06, 0x00, 0x98, 0x11, 0xa0, 0x99, 0x41, 0x90, 0x0b, 0x7a, 0xa0, 0xe9, 0x00,
+ 0x3a, 0xf8, 0x36, 0x00, 0x02, 0x7a, 0xa3, 0x08, 0x21, 0xcb, 0x20, 0x91, 0x11, 0xc4, 0x09, 0xab,
+ 0x1d, 0xc1, 0x39, 0xb8, 0x37, 0xc9, 0x19, 0x91, 0x01, 0x82, 0x53, 0x9a, 0x43, 0xd8, 0x88, 0x1a,
+ 0x2d, 0xa2, 0xa9, 0x18, 0x9f, 0x22, 0xe1, 0x11, 0x20, 0x00, 0xb3, 0x60, 0x19, 0xa2, 0xbc, 0x38,
+ 0x81, 0x9a, 0x1f, 0x12, 0xcd, 0x24, 0xaa, 0x09, 0x07, 0x0b, 0x22, 0xd1, 0x4a, 0x81, 0xb1, 0x3a,
+ 0xd8, 0x18, 0x39, 0x49, 0xd1, 0x00, 0x91, 0x79, 0xc2, 0x81, 0x19, 0xaa, 0x58, 0x90, 0x93, 0xac,
+ 0x11, 0x81, 0x0b, 0x00, 0x00, 0xc1, 0x36, 0xa9, 0x7c, 0x80, 0x9a, 0x24, 0x9a, 0x59, 0x88, 0x8f,
+ 0xc2, 0x11, 0x28, 0xa0, 0x08, 0x92, 0x11, 0x2a, 0x49, 0x3f, 0xc1, 0x29, 0x9a, 0x40, 0x80, 0x0d,
+ 0x87, 0x09, 0x0a, 0x00, 0x49, 0x98, 0xb0, 0x61, 0xc9, 0x11, 0x09, 0x98, 0x11, 0x4c, 0x1a, 0x05,
+ 0x09, 0xa8, 0x8c, 0x03, 0x18, 0x30, 0x92, 0xbf, 0x14, 0x89, 0x00, 0x9e, 0x92, 0x49, 0xa0, 0x00,
+ 0xf3, 0x21, 0x00, 0x4c, 0x80, 0x09, 0xc2, 0x2a, 0x88, 0x18, 0xc0, 0x81, 0x01, 0x0b, 0x2d, 0x69,
+ 0x15, 0x9d, 0x02, 0x38, 0xf8, 0x48, 0xb0, 0x01, 0x8b, 0x39, 0x28, 0xf0, 0x81, 0x99, 0x84, 0x19,
+ 0x21, 0xb8, 0x11, 0x27, 0x9f, 0x30, 0x98, 0x18, 0x91, 0xa4, 0x20, 0xc9, 0xc8, 0x38, 0xc9, 0x21,
+ 0x30, 0xad, 0xa9, 0x06, 0x21, 0x91, 0x72, 0x88, 0xaa, 0x81, 0x3a, 0x82, 0xaf, 0xa8, 0xa3, 0x41,
+ 0xd8, 0x20, 0x99, 0x80, 0x35, 0x84, 0x0e, 0x91, 0x40, 0xa8, 0x8a, 0x05, 0x8a, 0x99, 0xa9, 0x12,
+ 0x4a, 0xb9, 0x40, 0x27, 0x9b, 0xb0, 0x22, 0x7b, 0xb8, 0x02, 0x9c, 0x06, 0x9b, 0x38, 0xb1, 0x8a,
+ 0x48, 0x18, 0x88, 0x1a, 0x47, 0xaa, 0x90, 0x22, 0xb0, 0x31, 0x8f, 0xb9, 0x21, 0xa3, 0x30, 0x2f,
+ 0x82, 0x05, 0x32, 0x00, 0xaf, 0x02, 0x90, 0x32, 0xc9, 0x59, 0xa0, 0x1b, 0x01, 0x32, 0xf0, 0x2a,
+ 0x08, 0xbb, 0x83, 0xc4, 0x24, 0x98, 0xa3, 0x0f, 0x03, 0x90, 0x69, 0xc8, 0x29, 0x91, 0x91, 0x93,
+ 0x1e, 0x8a, 0x94, 0x02, 0x2e, 0x82, 0x0c, 0x09, 0x91, 0x07, 0x2c, 0x91, 0x8c, 0x86, 0x9a, 0x80,
+ 0x01, 0x1a, 0x33, 0xcb, 0x96, 0x39, 0xa8, 0x09, 0x92, 0x40, 0x2b, 0xe2, 0x18, 0x81, 0x0f, 0x85,
+ 0x09, 0x08, 0x2a, 0xc1, 0x18, 0x80, 0x92, 0x1a, 0xd1, 0x82, 0x3c, 0xb5, 0x21, 0xbc, 0x23, 0x10,
+ 0x0f, 0x88, 0xb2, 0x71, 0xaa, 0x83, 0x09, 0x98, 0x85, 0x04, 0x9a, 0x61, 0x9a, 0xca, 0x53, 0xc1,
+ 0xa8, 0x18, 0xa2, 0x00, 0x92, 0xc4, 0x28, 0x83, 0xd9, 0xa9, 0x52, 0x09, 0x0b, 0x89, 0xb6, 0x42,
+ 0xac, 0x12, 0xa7, 0x88, 0x28, 0x88, 0x92, 0xc8, 0x05, 0x2a, 0x00, 0x9d, 0x08, 0x06, 0x0c, 0x98,
+ 0x11, 0xc9, 0x91, 0x32, 0xa1, 0x02, 0x1c, 0x1c, 0x87, 0x80, 0x5a, 0xb0, 0x02, 0x9c, 0x20, 0xdb,
+ 0xb3, 0x21, 0xaa, 0x63, 0x88, 0x81, 0xc2, 0x5b, 0x58, 0xf2, 0x28, 0x91, 0x08, 0xa8, 0x38, 0x8a,
+ 0xb0, 0x36, 0xcb, 0x89, 0x04, 0x9c, 0x82, 0x39, 0xa9, 0x16, 0x18, 0xb9, 0x80, 0xc4, 0x49, 0xb9,
+ 0x27, 0x8a, 0x08, 0xf2, 0x01, 0x29, 0x0b, 0x03, 0xa9, 0x1a, 0x81, 0x82, 0xa0, 0x87, 0x81, 0xdf,
+ 0x05, 0x88, 0x08, 0x81, 0x99, 0x10, 0x03, 0x8c, 0x61, 0x9a, 0x19, 0xa2, 0x88, 0x00, 0x34, 0xaf,
+ 0x31, 0xba, 0x19, 0x12, 0x89, 0x3b, 0x14, 0xa3, 0x79, 0x01, 0xbf, 0x07, 0x99, 0x0a, 0x03, 0x9b,
+ 0x32, 0x0e, 0x12, 0x99, 0x31, 0x0e, 0x92, 0x29, 0xa9, 0x87, 0x19, 0xb9, 0x84, 0x4a, 0x88, 0x83,
+ 0xd2, 0x90, 0x78, 0x8a, 0x00, 0xa9, 0x89, 0x21, 0xc3, 0x2d, 0x21, 0x4a, 0xd8, 0x12, 0xa1, 0x4a,
+ 0x38, 0x08, 0x34, 0x00, 0xea, 0x20, 0xab, 0x0c, 0x82, 0x88, 0x97, 0x10, 0x09, 0x9a, 0x07, 0x90,
+ 0x82, 0x88, 0x81, 0xe2, 0x0e, 0x02, 0x8b, 0x22, 0xb1, 0x90, 0x83, 0x7c, 0xa1, 0x00, 0x30, 0xea,
+ 0xa3, 0xb8, 0x30, 0x89, 0x2f, 0x03, 0xb0, 0x01, 0xc0, 0x58, 0x21, 0xca, 0x96, 0x08, 0x1d, 0xa2,
+ 0x03, 0xa9, 0x29, 0xad, 0x00, 0x50, 0x89, 0x10, 0xe1, 0x29, 0x82, 0xb0, 0x70, 0x2a, 0x00, 0xb0,
+ 0x85, 0x0b, 0x88, 0x40, 0x1f, 0xa2, 0xaa, 0xa0, 0x06, 0x90, 0x59, 0x91, 0x29, 0x19, 0x83, 0xf9,
+ 0x48, 0x3d, 0x98, 0xa9, 0x78, 0xa0, 0x88, 0x80, 0x91, 0x14, 0x9a, 0x1a, 0x95, 0xa8, 0x41, 0xa1,
+ 0x53, 0x1f, 0x09, 0x91, 0x09, 0x2a, 0x80, 0xaa, 0x06, 0x8c, 0x20, 0x01, 0x90, 0x02, 0x98, 0x0f,
+ 0x87, 0x0b, 0x20, 0x99, 0x03, 0xba, 0x95, 0x81, 0x39, 0x3c, 0x86, 0x9e, 0x03, 0x0a, 0x08, 0x29,
+ 0xb8, 0x86, 0x38, 0xca, 0x08, 0x02, 0x80, 0x22, 0xf2, 0x00, 0x9d, 0x12, 0x29, 0x20, 0x8b, 0x2b,
+ 0xca, 0x89, 0x26, 0xf0, 0x32, 0x1c, 0x08, 0x18, 0x28, 0x89, 0x85, 0x2a, 0x8a, 0xea, 0x61, 0xc9,
+ 0x30, 0x8a, 0xa9, 0x24, 0x19, 0xca, 0x87, 0x18, 0xb1, 0x1a, 0x5a, 0xaa, 0x52, 0x19, 0x8a, 0xd4,
+ 0x02, 0xb8, 0x39, 0x90, 0x3b, 0xd0, 0xa3, 0x99, 0x87, 0x99, 0x54, 0x2b, 0x9a, 0x18, 0x92, 0xad,
+ 0x35, 0x89, 0x19, 0x00, 0xea, 0x58, 0x1b, 0x94, 0xa8, 0x4a, 0x88, 0x91, 0x04, 0x9c, 0x10, 0xc1,
+ 0x28, 0x81, 0x08, 0x29, 0x2f, 0xa1, 0xa3, 0xa3, 0x72, 0x3b, 0xc4, 0x99, 0x93, 0x9a, 0x00, 0x4c,
+ 0xeb, 0x29, 0x10, 0x83, 0x80, 0x11, 0xb7, 0x2a, 0x06, 0x9b, 0x10, 0x0a, 0x12, 0xf8, 0x20, 0xa9,
+ 0x10, 0x0c, 0x41, 0x3a, 0xbc, 0x13, 0xd3, 0x99, 0x38, 0x95, 0x84, 0x19, 0x9c, 0xa7, 0x38, 0xc9,
+ 0xc6, 0xfb, 0x38, 0x00, 0x93, 0x32, 0x9c, 0x98, 0x48, 0xb3, 0x8c, 0x39, 0x82, 0x0c, 0x03, 0x03,
+ 0xc1, 0x9f, 0x00, 0x87, 0x18, 0xa9, 0x30, 0x94, 0x1e, 0x28, 0x80, 0x08, 0xcc, 0x23, 0xd9, 0x88,
+ 0x40, 0x00, 0xc2, 0x88, 0x13, 0x9a, 0x5c, 0x48, 0xb0, 0x01, 0xf0, 0x38, 0x19, 0x1a, 0xa8, 0x84,
+ 0x0b, 0xd0, 0x60, 0x91, 0xa9, 0x39, 0x48, 0x91, 0xd3, 0x6a, 0x99, 0x88, 0x92, 0x19, 0xb2, 0x18,
+ 0x79, 0x09, 0xc8, 0xc8, 0x06, 0x00, 0x0b, 0x84, 0x1b, 0xa5, 0x2e, 0x93, 0x29, 0x09, 0x8a, 0x80,
+ 0x98, 0xf4, 0x20, 0x18, 0xc9, 0x20, 0x00, 0x4b, 0xe0, 0x41, 0xb9, 0x10, 0x00, 0x69, 0x09, 0x28,
+ 0xe0, 0x11, 0x8b, 0x5a, 0xa9, 0x02, 0xb2, 0xa0, 0x3d, 0x81, 0x86, 0x1b, 0x18, 0xb3, 0x00, 0xcb,
+ 0x70, 0xc3, 0x88, 0x3b, 0xc2, 0x89, 0x70, 0x90, 0x08, 0x08, 0x4a, 0xd2, 0x1a, 0x82, 0xa8, 0x84,
+ 0x38, 0xa9, 0xda, 0x00, 0x74, 0x9b, 0x85, 0x88, 0xa8, 0x02, 0x8a, 0x21, 0x59, 0x8a, 0xbd, 0x24,
+ 0xa0, 0x6a, 0x2b, 0xb4, 0x19, 0xb9, 0x12, 0x16, 0x8d, 0x10, 0x98, 0x29, 0xa1, 0x88, 0x27, 0xd9,
+ 0x20, 0xb8, 0x32, 0x98, 0x0b, 0x87, 0x2a, 0x9c, 0x80, 0x04, 0x09, 0x1d, 0xa1, 0x13, 0x0f, 0x30,
+ 0x81, 0x9c, 0x13, 0x09, 0xa0, 0x2d, 0x39, 0xf1, 0x41, 0x1b, 0x88, 0x0a, 0xa4, 0xc1, 0x24, 0xa9,
+ 0x08, 0x18, 0xb8, 0x34, 0x82, 0x2b, 0xaf, 0x88, 0x72, 0x9b, 0x8a, 0xa7, 0x29, 0x00, 0xb1, 0x78,
+ 0x99, 0x82, 0x0b, 0x60, 0xd1, 0x18, 0x03, 0x9c, 0x00, 0x81, 0x29, 0xf1, 0x40, 0x89, 0xa0, 0x21,
+ 0xa9, 0xa1, 0x05, 0x0c, 0x90, 0x10, 0x97, 0x0a, 0x0b, 0x13, 0xaa, 0x44, 0xbb, 0x08, 0x83, 0x9a,
+ 0x68, 0x81, 0x80, 0x8c, 0x23, 0xf9, 0x18, 0x02, 0x80, 0x11, 0x8f, 0x42, 0x9c, 0x21, 0x8a, 0xc2,
+ 0x42, 0x02, 0x33, 0x00, 0xda, 0x31, 0x8a, 0x30, 0xb8, 0x05, 0xa2, 0x99, 0x2e, 0x21, 0x9e, 0x92,
+ 0x49, 0xb8, 0xa0, 0x72, 0xb8, 0x28, 0xc1, 0x69, 0x91, 0x89, 0x23, 0xaa, 0x38, 0x49, 0xc8, 0x6c,
+ 0xa2, 0xca, 0x41, 0xd8, 0x20, 0x83, 0x9c, 0x30, 0x90, 0x8b, 0x36, 0x9d, 0x33, 0xbc, 0x11, 0x00,
+ 0x99, 0x42, 0x90, 0x39, 0xf1, 0x8b, 0x31, 0xd2, 0x1b, 0x85, 0x0a, 0x82, 0x0d, 0x01, 0x38, 0xa9,
+ 0x82, 0x20, 0xb6, 0xb2, 0x4b, 0x6a, 0x90, 0xda, 0x32, 0xd1, 0x9a, 0x15, 0x1c, 0x90, 0x20, 0xb0,
+ 0x21, 0x33, 0x0f, 0x01, 0x08, 0x8b, 0xd1, 0x11, 0xe2, 0x39, 0xa9, 0x04, 0xaa, 0x23, 0x18, 0x9e,
+ 0x50, 0x10, 0x8c, 0x85, 0x0b, 0x80, 0xb1, 0x7a, 0x90, 0x88, 0x80, 0x29, 0xc8, 0x81, 0x25, 0xab,
+ 0x31, 0x29, 0xbe, 0x78, 0xa1, 0x0a, 0xa7, 0x08, 0x08, 0x88, 0x12, 0x9a, 0x58, 0xb9, 0x11, 0x38,
+ 0x11, 0xfb, 0x60, 0x98, 0x80, 0x89, 0x22, 0x9c, 0x1c, 0x05, 0x8d, 0x02, 0x9a, 0x81, 0x94, 0x10,
+ 0xb2, 0x51, 0x19, 0xba, 0x61, 0xaa, 0x2a, 0xc1, 0x28, 0x2c, 0x02, 0x8d, 0x44, 0xf1, 0x49, 0xa8,
+ 0x00, 0x88, 0x10, 0x31, 0x8b, 0xf0, 0x08, 0x80, 0x84, 0x8b, 0x12, 0x96, 0x0c, 0x5a, 0x08, 0x2a,
+ 0xa1, 0x09, 0x92, 0xb4, 0x4c, 0xb3, 0xb3, 0x28, 0x1f, 0x80, 0xa3, 0x2e, 0x02, 0xac, 0x22, 0xa8,
+ 0x92, 0x30, 0xbb, 0x70, 0xa1, 0x1a, 0x80, 0xb6, 0x2c, 0x03, 0xf2, 0x4b, 0x91, 0x19, 0x22, 0x8d,
+ 0x03, 0xba, 0x09, 0x43, 0x99, 0xb4, 0xc0, 0x59, 0x90, 0xd2, 0x3a, 0x92, 0xa8, 0x38, 0x4b, 0x13,
+ 0x8f, 0xb3, 0x68, 0x9b, 0x92, 0xa3, 0x49, 0xb2, 0x5d, 0x09, 0xa3, 0x0a, 0x30, 0xa8, 0xbb, 0x87,
+ 0x2c, 0xc1, 0x28, 0x50, 0xca, 0x03, 0x0b, 0xa0, 0x79, 0xb2, 0x90, 0x35, 0x0c, 0x80, 0x08, 0xb8,
+ 0x38, 0x03, 0x31, 0x00, 0xd0, 0x90, 0x80, 0x5a, 0x1b, 0x41, 0xd0, 0x11, 0x80, 0x18, 0x8f, 0x96,
+ 0x2a, 0x08, 0xa0, 0x39, 0x80, 0x49, 0x91, 0x9e, 0x35, 0xac, 0xa1, 0x11, 0x08, 0x2b, 0xb0, 0xda,
+ 0x65, 0x99, 0x21, 0x9a, 0x38, 0x08, 0xb8, 0x69, 0xca, 0x03, 0x21, 0xe0, 0x21, 0xa9, 0x39, 0xf0,
+ 0x2b, 0x21, 0x5a, 0xd3, 0x81, 0xa8, 0x92, 0x4b, 0x84, 0x9b, 0x30, 0x1b, 0x82, 0x1f, 0xd2, 0x90,
+ 0x84, 0x00, 0x0d, 0x81, 0x19, 0x22, 0x19, 0xbb, 0x14, 0xf3, 0xa1, 0x09, 0x40, 0xc9, 0x30, 0x85,
+ 0x1c, 0x09, 0x8a, 0x22, 0xd9, 0x93, 0x5a, 0xc0, 0x30, 0x88, 0x9a, 0x87, 0x2b, 0x30, 0xbc, 0x25,
+ 0x9b, 0xb1, 0x30, 0x5a, 0x9a, 0x93, 0x50, 0xaa, 0x3a, 0xc2, 0x82, 0x50, 0xb9, 0xdb, 0x51, 0x12,
+ 0x99, 0x89, 0x00, 0x2f, 0x01, 0xe0, 0x01, 0x08, 0x0c, 0x01, 0x50, 0xa2, 0x0a, 0xa4, 0x2e, 0x90,
+ 0x01, 0x01, 0x00, 0x8f, 0x21, 0xdb, 0x31, 0xc1, 0x19, 0xa5, 0xa1, 0x68, 0xa8, 0x81, 0x29, 0x2a,
+ 0xd8, 0x82, 0x0b, 0x03, 0xe9, 0x12, 0x10, 0x2a, 0x41, 0x0c, 0xa9, 0x25, 0x0b, 0x3d, 0xb3, 0x09,
+ 0x48, 0x0a, 0x48, 0xec, 0x10, 0xa3, 0x3b, 0x23, 0xad, 0x3b, 0x97, 0x28, 0x80, 0xcb, 0x11, 0x91,
+ 0x1d, 0x30, 0xf1, 0x10, 0x88, 0x12, 0x82, 0x9a, 0xa2, 0x6a, 0x8b, 0x2f, 0x92, 0x09, 0xaa, 0x85,
+ 0x68, 0x3a, 0xa9, 0x18, 0xb6, 0x08, 0x02, 0x3b, 0xba, 0xa1, 0xa2, 0xfb, 0x02, 0x20, 0x1f, 0xb0,
+ 0x07, 0x88, 0x00, 0x29, 0x10, 0x9b, 0x07, 0x19, 0x9a, 0x98, 0x18, 0x9c, 0x83, 0x03, 0x1d, 0x3c,
+ 0x93, 0x7b, 0xa8, 0x99, 0x46, 0xb8, 0x89, 0x21, 0xa0, 0xbb, 0x86, 0x3c, 0x84, 0xaa, 0x0b, 0x82,
+ 0x1a, 0x97, 0x04, 0x1b, 0x00, 0xdb, 0x50, 0x91, 0x01, 0x8a, 0x8a, 0x31, 0x8c, 0x4a, 0x19, 0x0f,
+ 0x24, 0xfd, 0x33, 0x00, 0x28, 0x2a, 0xb2, 0x2b, 0xb3, 0xb6, 0x59, 0x82, 0xa0, 0x20, 0x0a, 0x9f,
+ 0x87, 0xa9, 0x41, 0x89, 0xaa, 0x60, 0x98, 0x92, 0x00, 0x2a, 0xa3, 0xd8, 0x2c, 0x95, 0x29, 0x2b,
+ 0x01, 0x88, 0x14, 0x9e, 0x21, 0xba, 0x4d, 0x22, 0xe8, 0x20, 0xb1, 0x28, 0x0f, 0x93, 0x80, 0x01,
+ 0x8c, 0x80, 0x20, 0x21, 0xfa, 0x29, 0x85, 0x80, 0x4b, 0xc0, 0x2a, 0x05, 0xac, 0x33, 0xb0, 0x29,
+ 0x89, 0x83, 0x90, 0x1c, 0x39, 0xb5, 0xf0, 0x48, 0x0a, 0x83, 0x0f, 0x00, 0x90, 0x04, 0xa9, 0x38,
+ 0xc9, 0x24, 0x19, 0x00, 0xb9, 0x8b, 0xa4, 0x22, 0xb8, 0x07, 0x0a, 0x0c, 0xe0, 0x83, 0x91, 0x10,
+ 0x59, 0x3b, 0x18, 0x0a, 0x85, 0x8a, 0x3a, 0xd1, 0x16, 0xe9, 0x91, 0x39, 0x99, 0xa3, 0xc4, 0x30,
+ 0x3a, 0xd0, 0x31, 0x11, 0x1f, 0xab, 0x86, 0x09, 0xa2, 0x09, 0x08, 0x83, 0x0c, 0x20, 0xf3, 0x01,
+ 0x09, 0x0b, 0x97, 0x20, 0xb1, 0x8c, 0x49, 0x18, 0x10, 0xe9, 0x22, 0x82, 0xbb, 0x40, 0x01, 0x9e,
+ 0x31, 0xa8, 0xd6, 0x89, 0x90, 0x18, 0x89, 0x61, 0x88, 0xa4, 0x90, 0x2a, 0x00, 0x7b, 0xa1, 0x29,
+ 0x1a, 0x80, 0x8e, 0x00, 0x30, 0xa8, 0x29, 0x95, 0x96, 0x1d, 0xb4, 0xa8, 0x20, 0xb2, 0x10, 0x00,
+ 0x2f, 0xb2, 0x8b, 0x12, 0x40, 0x2d, 0x01, 0xa8, 0xcc, 0x82, 0x53, 0x99, 0x38, 0x8d, 0x84, 0xa8,
+ 0x1b, 0xb1, 0x52, 0x93, 0xc1, 0x32, 0x8c, 0xca, 0x62, 0x10, 0xbc, 0xa1, 0x14, 0x00, 0x1f, 0x01,
+ 0x9a, 0x12, 0x8b, 0x43, 0x8e, 0x80, 0x00, 0xf2, 0x38, 0x10, 0xa1, 0xd3, 0x29, 0xc9, 0x80, 0x86,
+ 0x29, 0x8a, 0x3a, 0x02, 0xaa, 0x51, 0xa0, 0x03, 0x83, 0xaf, 0xa0, 0x12, 0x24, 0x1b, 0xac, 0x17,
+ 0x9a, 0x10, 0x89, 0x80, 0x8b, 0x87, 0x9a, 0xd5, 0x7b, 0xa1, 0x18, 0x91, 0xa1, 0xc1, 0x7a, 0x08,
+ 0xa5, 0x00, 0x3a, 0x00, 0x19, 0x88, 0x12, 0xea, 0x20, 0xb2, 0x8a, 0x93, 0x48, 0x90, 0x9a, 0x82,
+ 0x5c, 0x91, 0x13, 0x6b, 0x0a, 0xe3, 0x2b, 0x81, 0x1b, 0x95, 0x89, 0x18, 0x09, 0x91, 0x01, 0xc0,
+ 0x9f, 0x53, 0x89, 0x11, 0x8a, 0x22, 0x0f, 0x08, 0x09, 0x83, 0x93, 0x12, 0xaf, 0x39, 0x89, 0x9b,
+ 0x07, 0xa1, 0x20, 0xf0, 0x12, 0x9a, 0x40, 0x13, 0xb4, 0xb9, 0x5a, 0x8b, 0x24, 0xec, 0x31, 0x09,
+ 0x0b, 0xa2, 0x1a, 0x1c, 0x13, 0xe4, 0x40, 0x0b, 0x01, 0x19, 0x2b, 0xb1, 0xa6, 0x38, 0x01, 0x88,
+ 0x0b, 0x8f, 0x18, 0x99, 0x50, 0x05, 0x9a, 0x48, 0xd0, 0x18, 0x89, 0x19, 0x13, 0xbd, 0x15, 0x99,
+ 0x02, 0x8f, 0x12, 0x99, 0x2a, 0xa4, 0x98, 0x3b, 0x10, 0x79, 0x15, 0x9c, 0x80, 0x81, 0x0b, 0x18,
+ 0x94, 0xc1, 0x21, 0x8c, 0x70, 0x99, 0x8a, 0x85, 0x89, 0x11, 0x01, 0xab, 0x6b, 0x19, 0x02, 0xb0,
+ 0x1d, 0x08, 0xb9, 0x30, 0xa1, 0x7c, 0x98, 0x86, 0x18, 0x90, 0xa9, 0x02, 0x1f, 0x59, 0x98, 0x98,
+ 0xa1, 0x13, 0x02, 0x8f, 0x90, 0x39, 0xb4, 0xa8, 0x15, 0xa0, 0x8c, 0x22, 0x58, 0x90, 0x99, 0xd9,
+ 0x82, 0x8b, 0x37, 0x1a, 0xa1, 0xbb, 0x70, 0x88, 0xa9, 0x95, 0x80, 0x48, 0x10, 0xb8, 0x4b, 0x18,
+ 0x1d, 0xa2, 0xd3, 0x41, 0x8e, 0x88, 0x21, 0x2b, 0x40, 0xc9, 0x32, 0xca, 0x21, 0xa1, 0x8d, 0x12,
+ 0x09, 0x28, 0xbf, 0x07, 0x88, 0xa0, 0x13, 0x08, 0x0a, 0x84, 0x9d, 0x00, 0x91, 0x80, 0xc6, 0x49,
+ 0x89, 0x59, 0x98, 0x08, 0x00, 0xa0, 0xe2, 0x11, 0x09, 0x09, 0x89, 0x23, 0xa6, 0x2b, 0x88, 0xa9,
+ 0x7d, 0x90, 0x81, 0x28, 0xe3, 0x80, 0x92, 0x0a, 0x81, 0x3c, 0x31, 0xdc, 0x50, 0x93, 0xd0, 0x98,
+ 0x61, 0x1b, 0x01, 0x8a, 0xb3, 0xd8, 0x08, 0x24, 0x19, 0x88, 0x09, 0x1a, 0xd7, 0x00, 0x28, 0x82,
+ 0x65, 0x00, 0x2f, 0x00, 0x1d, 0x32, 0x9c, 0x99, 0x03, 0x79, 0xa3, 0x8c, 0x84, 0x1b, 0x09, 0xb0,
+ 0x26, 0x0c, 0xa2, 0x12, 0x9c, 0x82, 0x01, 0x3a, 0x0a, 0x22, 0x9f, 0xe1, 0x92, 0x82, 0x18, 0x22,
+ 0xa3, 0x1d, 0xca, 0x84, 0xa2, 0xb8, 0x71, 0x01, 0x9d, 0x18, 0x4a, 0x8c, 0x93, 0x0b, 0x15, 0xbb,
+ 0x81, 0x60, 0x80, 0x1c, 0x21, 0x90, 0x21, 0xc9, 0x0d, 0x03, 0x0b, 0x85, 0x2b, 0x85, 0xb0, 0x9e,
+ 0x41, 0x93, 0x0d, 0x02, 0x28, 0xf0, 0x2a, 0xb1, 0x48, 0x08, 0x80, 0x39, 0xf1, 0x09, 0x01, 0xb8,
+ 0x38, 0x5a, 0x3b, 0x90, 0xa2, 0x62, 0x90, 0x8f, 0x22, 0xa2, 0xb8, 0x18, 0xaa, 0x82, 0xa2, 0x50,
+ 0x3d, 0x12, 0x0f, 0x93, 0x8d, 0x82, 0x10, 0x40, 0x0b, 0x1b, 0x41, 0xdc, 0x83, 0x0c, 0x82, 0x19,
+ 0x93, 0x98, 0xa7, 0x99, 0x73, 0xa8, 0x00, 0x09, 0x08, 0x9b, 0x71, 0xc9, 0x32, 0x1a, 0x1a, 0x88,
+ 0x30, 0x98, 0xf9, 0x8a, 0x45, 0x99, 0x01, 0x80, 0x00, 0x92, 0x7a, 0x80, 0xb9, 0xa0, 0x89, 0x1f,
+ 0x11, 0xac, 0x55, 0xcb, 0x30, 0x11, 0xa8, 0x82, 0x8f, 0x42, 0x99, 0x90, 0x21, 0x90, 0x99, 0xa9,
+ 0x25, 0x3d, 0x9a, 0x1c, 0x92, 0x19, 0x61, 0x91, 0xa0, 0x95, 0x81, 0x3c, 0x91, 0x9b, 0x12, 0x8c,
+ 0xc3, 0x8a, 0xc0, 0x30, 0x07, 0x3b, 0x08, 0x8f, 0x85, 0x98, 0x12, 0xc9, 0x39, 0x14, 0x9b, 0x98,
+ 0x33, 0xaf, 0x85, 0x8a, 0x13, 0x1e, 0x19, 0x88, 0x99, 0x07, 0x89, 0x90, 0x40, 0x02, 0x8d, 0x08,
+ 0x82, 0xd8, 0x20, 0x08, 0x0c, 0x91, 0x03, 0x0f, 0x00, 0x91, 0x21, 0xc1, 0x2a, 0xc4, 0x99, 0xd0,
+ 0x44, 0x81, 0x8e, 0x20, 0x19, 0xc8, 0x02, 0x00, 0x08, 0x30, 0xab, 0x70, 0x9b, 0x93, 0xa1, 0x5c,
+ 0x99, 0x69, 0x9a, 0x13, 0x89, 0x88, 0x08, 0x1b, 0xc5, 0x98, 0x83, 0x24, 0x9d, 0x31, 0x99, 0x00,
+ 0xa3, 0xff, 0x29, 0x00, 0xa8, 0x40, 0xc2, 0x1a, 0x49, 0xbe, 0x05, 0x09, 0x71, 0xb9, 0x28, 0xc3,
+ 0x01, 0xb2, 0x1b, 0x48, 0xba, 0x80, 0x70, 0xd2, 0x10, 0x0a, 0x8a, 0x51, 0xb1, 0x38, 0x0d, 0x2c,
+ 0x43, 0xa9, 0x91, 0x1b, 0x12, 0xaa, 0x33, 0xdb, 0x82, 0x19, 0x83, 0x6f, 0xb8, 0x5b, 0xc1, 0x01,
+ 0xc3, 0x2a, 0x33, 0x8a, 0xc0, 0xa8, 0x29, 0xc6, 0x38, 0x09, 0x0e, 0x01, 0x30, 0xa9, 0x08, 0x12,
+ 0x90, 0x3f, 0xc5, 0x9a, 0x34, 0xb9, 0x22, 0x9f, 0x03, 0x2b, 0x00, 0xb0, 0x87, 0x1b, 0x10, 0xb0,
+ 0x92, 0x81, 0x20, 0x0d, 0x78, 0xa0, 0x91, 0x80, 0x0c, 0xd3, 0x20, 0xad, 0x63, 0x18, 0xa8, 0x1a,
+ 0x84, 0x9b, 0x70, 0x90, 0x8b, 0x23, 0xca, 0x38, 0x89, 0x4b, 0xd3, 0x3a, 0x10, 0xd2, 0x98, 0x23,
+ 0x19, 0xf0, 0x83, 0x29, 0xcb, 0x59, 0xa5, 0x1a, 0x81, 0x02, 0x29, 0x8f, 0x81, 0xb4, 0x89, 0x25,
+ 0x8e, 0x01, 0x88, 0x80, 0x12, 0xcb, 0x52, 0x8b, 0x80, 0x9a, 0x33, 0xcc, 0x29, 0x11, 0x16, 0x8d,
+ 0x10, 0x08, 0x90, 0x31, 0xe8, 0x28, 0x81, 0xa0, 0xa1, 0x2a, 0x97, 0x8b, 0x11, 0x10, 0x0f, 0xc4,
+ 0x21, 0x91, 0x1a, 0x10, 0x9d, 0x02, 0xa2, 0xc5, 0x71, 0xb9, 0x30, 0xf8, 0x01, 0x08, 0x88, 0x00,
+ 0x08, 0x90, 0x88, 0x3b, 0x27, 0x8a, 0x81, 0x29, 0xbb, 0xa8, 0x92, 0x71, 0xb5, 0x19, 0x01, 0x88,
+ 0x1d, 0x95, 0x49, 0xc8, 0x88, 0x04, 0x2c, 0x93, 0xa9, 0xa2, 0x04, 0x0e, 0xb1, 0x39, 0x93, 0xbc,
+ 0x53, 0xb0, 0x49, 0x0a, 0x4a, 0xb5, 0x88, 0x51, 0xd8, 0x00, 0x98, 0x41, 0xc2, 0x0a, 0x23, 0xcc,
+ 0x11, 0x0a, 0x49, 0xc0, 0x88, 0x41, 0x09, 0x09, 0x42, 0x82, 0xd2, 0x08, 0x92, 0xaf, 0x03, 0x9a,
+ 0x48, 0xa2, 0x5b, 0xb1, 0x81, 0x3b, 0xf3, 0x13, 0xa8, 0x03, 0x8a, 0xf0, 0x88, 0x21, 0x1d, 0x80,
+ 0x48, 0xff, 0x2a, 0x00, 0x20, 0x38, 0x9b, 0x97, 0x61, 0x89, 0x1c, 0x3c, 0xc3, 0x81, 0x89, 0x19,
+ 0xc3, 0x2c, 0x86, 0xb9, 0x59, 0xa1, 0x4b, 0x88, 0x98, 0x31, 0x19, 0x92, 0xfb, 0x31, 0x01, 0xba,
+ 0xa3, 0x73, 0xd1, 0x00, 0x89, 0xb1, 0x0a, 0xb3, 0x88, 0xf9, 0x59, 0x98, 0x11, 0xa5, 0x59, 0x29,
+ 0xc4, 0x01, 0xc8, 0x28, 0xa9, 0x80, 0xa3, 0xd3, 0x21, 0x1d, 0x92, 0xe2, 0x39, 0x13, 0x0b, 0x85,
+ 0x0e, 0x80, 0x92, 0x8a, 0x90, 0x0d, 0x04, 0xb1, 0x6a, 0x80, 0x88, 0x1a, 0x07, 0x1c, 0x10, 0x8a,
+ 0xa1, 0x1a, 0x02, 0x78, 0xc8, 0x03, 0xa9, 0x11, 0x91, 0x09, 0x09, 0x16, 0x2b, 0x8d, 0x15, 0x0c,
+ 0x08, 0x0a, 0x97, 0x8b, 0x1a, 0x87, 0x9a, 0x13, 0x8b, 0x68, 0xb1, 0x29, 0xa1, 0x89, 0x71, 0xe1,
+ 0x20, 0xd1, 0x29, 0x81, 0x98, 0x91, 0x19, 0x19, 0x04, 0x1c, 0x21, 0x9a, 0x84, 0x9a, 0x1f, 0x04,
+ 0xcb, 0x30, 0x80, 0x40, 0xbb, 0x00, 0x21, 0x8d, 0x00, 0x21, 0xa8, 0x07, 0x19, 0xd0, 0x28, 0xa0,
+ 0x88, 0x90, 0x72, 0x82, 0x98, 0x1c, 0x12, 0xd9, 0x93, 0x1d, 0x85, 0xab, 0x16, 0x8a, 0x98, 0x33,
+ 0xad, 0x41, 0xc8, 0x18, 0xa8, 0x80, 0x01, 0xbb, 0x37, 0xc0, 0x09, 0x02, 0x8a, 0x19, 0x29, 0x04,
+ 0x09, 0x8f, 0x27, 0x8b, 0x00, 0x19, 0x94, 0x1b, 0xc9, 0x12, 0x0d, 0x93, 0x2a, 0x04, 0xca, 0x33,
+ 0xbb, 0x11, 0xb0, 0x11, 0xab, 0x78, 0x20, 0xbd, 0x0b, 0x16, 0x89, 0x89, 0x14, 0x10, 0xf9, 0x21,
+ 0x90, 0x28, 0xb0, 0xe1, 0x58, 0xda, 0x38, 0xa0, 0x39, 0x86, 0xab, 0x42, 0x90, 0x1e, 0x22, 0xb2,
+ 0x99, 0x13, 0x3b, 0xcc, 0x13, 0x01, 0xf8, 0x99, 0x33, 0x9c, 0xa8, 0x41, 0x12, 0xf0, 0x01, 0x99,
+ 0x93, 0x38, 0x00, 0xba, 0x39, 0xe2, 0x52, 0xba, 0x6d, 0x98, 0x00, 0x01, 0x80, 0x18, 0xb5, 0x1b,
+ 0x09, 0x01, 0x29, 0x00, 0xd9, 0x33, 0xba, 0x00, 0x88, 0x04, 0x9c, 0xb7, 0x39, 0xa1, 0x0b, 0x61,
+ 0xb1, 0x2a, 0x84, 0x0b, 0xd2, 0x30, 0xba, 0xa1, 0x22, 0x01, 0xaf, 0x83, 0x21, 0xe1, 0x3d, 0x87,
+ 0x9a, 0xb0, 0x73, 0xa9, 0x08, 0x02, 0x19, 0x99, 0x6a, 0x88, 0xa8, 0x59, 0xb5, 0x1a, 0x80, 0x00,
+ 0xb9, 0x04, 0x80, 0xa2, 0x3e, 0x91, 0x90, 0x0b, 0x81, 0x1f, 0x96, 0x08, 0x82, 0xd0, 0x5a, 0x10,
+ 0x80, 0x99, 0x99, 0x04, 0x82, 0x0f, 0xa2, 0x10, 0x91, 0x82, 0x1a, 0x19, 0xcb, 0x78, 0xc8, 0x40,
+ 0xac, 0x89, 0x41, 0xba, 0x01, 0x73, 0xb9, 0x20, 0x41, 0xa9, 0xa1, 0xb5, 0x49, 0xb1, 0x2b, 0x92,
+ 0xb8, 0x6b, 0x6a, 0x91, 0x8a, 0x21, 0x0c, 0x18, 0x21, 0x2c, 0x10, 0x97, 0x9b, 0x21, 0x19, 0xa0,
+ 0xf8, 0x01, 0xa9, 0x92, 0x69, 0x88, 0xc1, 0x19, 0x22, 0x39, 0x5d, 0xd2, 0x80, 0x90, 0x88, 0x8b,
+ 0x32, 0x41, 0x8a, 0xab, 0x53, 0xc2, 0x11, 0x1b, 0x20, 0x1d, 0x32, 0xc7, 0x0c, 0x21, 0x40, 0x39,
+ 0xb9, 0xbb, 0x17, 0xc9, 0x38, 0xe2, 0x28, 0xa0, 0x08, 0x11, 0x48, 0xa9, 0x13, 0xf0, 0x2c, 0x21,
+ 0xa8, 0xa9, 0xa2, 0x46, 0x0a, 0x00, 0xe8, 0x30, 0xb2, 0x9c, 0x80, 0x94, 0x09, 0xa4, 0x10, 0x4a,
+ 0x99, 0x9b, 0xa4, 0xa2, 0xe4, 0x31, 0x94, 0x3d, 0x03, 0xd9, 0x18, 0x82, 0x9b, 0x40, 0xaa, 0x50,
+ 0xf2, 0x38, 0x98, 0x19, 0x91, 0x0d, 0x91, 0x23, 0x0d, 0xba, 0x51, 0x81, 0x98, 0x88, 0x36, 0xca,
+ 0x41, 0xd9, 0x48, 0x08, 0x99, 0xa2, 0x39, 0xb4, 0x2a, 0x33, 0xba, 0xa7, 0x83, 0x8e, 0x19, 0x90,
+ 0x0a, 0x10, 0x2e, 0x07, 0x9b, 0x08, 0x11, 0x29, 0x90, 0x0d, 0x21, 0xae, 0x24, 0xaa, 0x03, 0x88,
+ 0x11, 0xb5, 0x1c, 0x4a, 0xb0, 0x21, 0x9b, 0x55, 0x98, 0x0a, 0x00, 0xa4, 0x9a, 0x20, 0x70, 0xf0,
+ 0xbd, 0xfd, 0x33, 0x00, 0x11, 0xa1, 0x3a, 0xa0, 0x01, 0x3e, 0x0a, 0x85, 0xa0, 0xa8, 0x49, 0x01,
+ 0x11, 0x0a, 0x2b, 0xd2, 0x9c, 0x52, 0x81, 0x3f, 0x91, 0xd9, 0x28, 0x11, 0x1d, 0x93, 0x99, 0x32,
+ 0x08, 0x80, 0xfd, 0x30, 0xd0, 0x19, 0x22, 0xa0, 0xa8, 0x49, 0xa2, 0x98, 0x73, 0xd3, 0x0b, 0x11,
+ 0xa9, 0x25, 0x89, 0x90, 0xa0, 0x49, 0xe1, 0x11, 0xab, 0xa4, 0xa0, 0x41, 0x98, 0x29, 0x20, 0xe1,
+ 0x30, 0x4b, 0x18, 0x2f, 0xc0, 0x10, 0x88, 0x82, 0x88, 0x48, 0xa8, 0x40, 0x80, 0xab, 0x30, 0x9b,
+ 0x7d, 0x94, 0x0d, 0x85, 0x8b, 0x01, 0xb0, 0x31, 0xd2, 0x01, 0x91, 0x8f, 0x82, 0x08, 0xa0, 0x03,
+ 0x18, 0x0e, 0xa4, 0x1a, 0x30, 0x05, 0x9d, 0x28, 0x81, 0x00, 0x19, 0xb1, 0xf2, 0x59, 0xb3, 0x19,
+ 0x0d, 0x21, 0x09, 0x91, 0x12, 0x48, 0xf0, 0x0c, 0x80, 0x11, 0x89, 0x88, 0x6b, 0x20, 0xfa, 0x20,
+ 0x00, 0x8a, 0x34, 0xd0, 0x09, 0x08, 0x3c, 0x3b, 0x22, 0xdb, 0x42, 0xd2, 0x09, 0x03, 0xac, 0x58,
+ 0x8c, 0x95, 0x3b, 0x00, 0x10, 0x98, 0x10, 0xd0, 0x92, 0x4a, 0x81, 0x09, 0x0c, 0x42, 0xb2, 0x9d,
+ 0xb3, 0x28, 0x8d, 0x4a, 0x99, 0x32, 0x8e, 0x07, 0x88, 0x20, 0x88, 0x89, 0xa1, 0x60, 0x89, 0x90,
+ 0x0c, 0x8d, 0x14, 0x9a, 0x14, 0xab, 0x82, 0x29, 0xb4, 0x50, 0xf8, 0x29, 0x91, 0x28, 0x93, 0x0b,
+ 0xd2, 0xb1, 0x41, 0xf9, 0x11, 0x92, 0x1b, 0x99, 0x10, 0x5a, 0xb5, 0x08, 0xd2, 0x88, 0x42, 0x8c,
+ 0x83, 0x2b, 0x00, 0x89, 0x14, 0x88, 0x5e, 0xb2, 0x08, 0x88, 0x0b, 0x80, 0x68, 0xbb, 0x58, 0xc9,
+ 0x16, 0x8b, 0x11, 0x90, 0x8b, 0x33, 0xfb, 0x20, 0xb8, 0x45, 0xba, 0x48, 0x91, 0x91, 0x1b, 0xf0,
+ 0x30, 0xb1, 0x18, 0x12, 0xb0, 0x29, 0xf8, 0x40, 0xa4, 0x1c, 0x80, 0x28, 0x21, 0xfb, 0x49, 0xa1,
+ 0x5f, 0xff, 0x2d, 0x00, 0x49, 0xd1, 0x31, 0xca, 0x31, 0xe1, 0x19, 0x93, 0x09, 0x89, 0x45, 0x8b,
+ 0xa9, 0x21, 0xc0, 0x10, 0x84, 0xb9, 0x2d, 0x32, 0x9c, 0x31, 0xd9, 0x00, 0x21, 0xd9, 0x8c, 0x51,
+ 0xa0, 0x98, 0x41, 0x04, 0x9d, 0x20, 0xa2, 0x1c, 0x83, 0x11, 0x8d, 0x22, 0xc8, 0x2a, 0xa5, 0x09,
+ 0x02, 0x99, 0x8a, 0xb3, 0x19, 0xf1, 0x59, 0xb3, 0x29, 0xa8, 0xa6, 0x0c, 0x84, 0x19, 0x00, 0x80,
+ 0x03, 0x69, 0x9c, 0x38, 0x39, 0xf0, 0x10, 0xba, 0x02, 0x9a, 0x48, 0xa4, 0x6a, 0x21, 0xc8, 0x5a,
+ 0xc0, 0x11, 0x89, 0x11, 0xf2, 0x8a, 0x31, 0xba, 0x40, 0xc4, 0x1b, 0x34, 0xbc, 0x18, 0xd3, 0x30,
+ 0x0a, 0x30, 0xc1, 0x09, 0x21, 0xab, 0x64, 0x91, 0xe9, 0x40, 0x88, 0xa8, 0x13, 0xa2, 0x0e, 0x09,
+ 0x83, 0x9d, 0x61, 0xa8, 0x00, 0x88, 0x8a, 0x06, 0x0a, 0x98, 0x11, 0x23, 0xcd, 0x95, 0x49, 0x99,
+ 0x9a, 0x94, 0x83, 0x09, 0xb9, 0x02, 0x09, 0x94, 0xa4, 0x09, 0xd9, 0x26, 0x8a, 0x1a, 0x53, 0xa8,
+ 0xac, 0x42, 0x99, 0x4c, 0x81, 0xb2, 0x1a, 0x24, 0xbf, 0x85, 0x02, 0x0b, 0x99, 0x23, 0xaa, 0x30,
+ 0xc9, 0x5c, 0x11, 0x38, 0xaa, 0x8e, 0x02, 0x08, 0x0d, 0x01, 0x90, 0x28, 0xc4, 0x83, 0x80, 0x3c,
+ 0xa6, 0x3b, 0xa3, 0x99, 0x28, 0x58, 0xa9, 0x19, 0xfb, 0x41, 0x00, 0x2c, 0x0a, 0x85, 0x8d, 0x80,
+ 0x18, 0xc2, 0x61, 0xa1, 0x8a, 0x1a, 0x33, 0xa1, 0x2f, 0xa1, 0x81, 0x68, 0x8b, 0x01, 0x2a, 0x9a,
+ 0x62, 0x19, 0xf3, 0x3b, 0xa0, 0x03, 0xd2, 0x29, 0x9a, 0x48, 0x92, 0xda, 0x3b, 0x06, 0x88, 0x00,
+ 0x9c, 0x29, 0xc3, 0x68, 0xb4, 0x1a, 0x08, 0xd1, 0x88, 0x21, 0x51, 0xe0, 0x09, 0x03, 0x09, 0x29,
+ 0xb8, 0x49, 0x98, 0x0a, 0xa2, 0x02, 0x47, 0xfa, 0x10, 0x81, 0x0c, 0x80, 0x01, 0x4b, 0xb2, 0x19,
+ 0x1e, 0x00, 0x27, 0x00, 0x0f, 0x82, 0x92, 0x88, 0x85, 0x0b, 0x00, 0x90, 0x89, 0x5c, 0x88, 0x30,
+ 0xc2, 0x23, 0xc9, 0xd1, 0x7b, 0xb1, 0x50, 0xab, 0x82, 0x88, 0x90, 0x59, 0xa3, 0x08, 0xc2, 0x40,
+ 0xf9, 0x48, 0xb8, 0x01, 0x11, 0xb2, 0x0d, 0x01, 0x28, 0xb8, 0x01, 0x88, 0x20, 0xa3, 0x2f, 0xc0,
+ 0x10, 0x48, 0xd2, 0x89, 0x1a, 0xf0, 0x49, 0xb1, 0x71, 0x89, 0x18, 0xc2, 0x09, 0x00, 0x90, 0x49,
+ 0xa3, 0x1b, 0x32, 0xa8, 0xd4, 0x19, 0x88, 0xe1, 0x51, 0xb8, 0x38, 0x09, 0x6a, 0xab, 0x92, 0x87,
+ 0x1a, 0xb2, 0x08, 0x92, 0x6a, 0x91, 0x29, 0xa9, 0x48, 0x8c, 0x93, 0x0a, 0xe0, 0x0c, 0x39, 0x96,
+ 0x38, 0x81, 0xc2, 0x9a, 0x34, 0x89, 0x00, 0xb1, 0xfc, 0x30, 0x19, 0xab, 0x17, 0x99, 0x10, 0x1c,
+ 0xc3, 0x11, 0x9c, 0x41, 0xb0, 0x15, 0x38, 0xbe, 0x30, 0xc2, 0x28, 0x00, 0x0c, 0x84, 0x8a, 0x10,
+ 0x9d, 0x04, 0x9a, 0x14, 0x8d, 0x80, 0x97, 0x2a, 0x18, 0xa8, 0x31, 0x0a, 0x00, 0xea, 0x88, 0x17,
+ 0x9c, 0x00, 0x81, 0x21, 0x2a, 0x8a, 0x82, 0x9c, 0x19, 0x3a, 0x97, 0x2a, 0x89, 0x33, 0x1c, 0x97,
+ 0x9c, 0x19, 0x08, 0x14, 0x4a, 0xe8, 0x31, 0x8a, 0x10, 0x08, 0x02, 0x0f, 0x92, 0x18, 0x9a, 0x71,
+ 0xaa, 0x81, 0x20, 0x98, 0x8a, 0x21, 0x89, 0x9f, 0x24, 0x0e, 0x83, 0x1c, 0x32, 0xeb, 0x11, 0x10,
+ 0x90, 0x19, 0x03, 0x0a, 0xf2, 0x28, 0x1a, 0xd9, 0x33, 0xbb, 0x25, 0x9f, 0x02, 0x98, 0x9b, 0x34,
+ 0xf3, 0x20, 0xa0, 0x18, 0x98, 0x19, 0x88, 0x58, 0xd1, 0x20, 0x0d, 0x81, 0x08, 0x22, 0xdb, 0x21,
+ 0xad, 0x24, 0x99, 0x48, 0x94, 0xaa, 0x51, 0xb8, 0x88, 0xc1, 0x1a, 0x38, 0x12, 0x7b, 0xb2, 0x2a,
+ 0xe1, 0x29, 0x30, 0xe1, 0x42, 0xb9, 0x0a, 0x03, 0x0e, 0x10, 0xaa, 0x15, 0xc9, 0x82, 0x1a, 0x4a,
+ 0x58, 0xfe, 0x28, 0x00, 0x50, 0xc8, 0x42, 0x90, 0x09, 0xe1, 0x1a, 0x03, 0xa8, 0x29, 0x28, 0xd8,
+ 0x99, 0x13, 0xa1, 0xe0, 0x42, 0x1b, 0x50, 0x94, 0x0b, 0xb0, 0x05, 0x8c, 0xd0, 0x62, 0xc9, 0x18,
+ 0x12, 0x1b, 0x18, 0x23, 0xd8, 0x8c, 0x04, 0x98, 0x82, 0xa8, 0x41, 0x80, 0xa8, 0xa4, 0xbf, 0x14,
+ 0x11, 0x9c, 0x83, 0x9b, 0x01, 0xa1, 0x04, 0x1a, 0xa8, 0x26, 0x28, 0xf9, 0x39, 0xa0, 0x89, 0x07,
+ 0x9b, 0x10, 0x09, 0x1a, 0x32, 0xf2, 0x8a, 0x20, 0xa8, 0x0c, 0x30, 0x41, 0x24, 0xca, 0x38, 0x61,
+ 0xab, 0x31, 0x09, 0xf8, 0x4c, 0x04, 0xab, 0x11, 0xa0, 0x9a, 0x07, 0x9a, 0x13, 0x88, 0x49, 0xc9,
+ 0x69, 0xa9, 0x22, 0x0a, 0x09, 0x9b, 0xc4, 0x98, 0x84, 0x21, 0xc3, 0x69, 0xa8, 0x19, 0xa1, 0xab,
+ 0x57, 0xba, 0x41, 0xc1, 0x1a, 0x10, 0xb3, 0x4d, 0xa0, 0x2a, 0x81, 0x91, 0x0d, 0x13, 0x92, 0x1a,
+ 0x90, 0x3b, 0xfa, 0x70, 0xa0, 0x2b, 0x39, 0x89, 0x05, 0xbb, 0x96, 0x98, 0x32, 0x09, 0x2c, 0xd9,
+ 0x28, 0x82, 0x90, 0x9b, 0x26, 0xc2, 0x1b, 0x84, 0x99, 0x51, 0x9a, 0x81, 0x8c, 0x21, 0x9b, 0x07,
+ 0xa8, 0x19, 0x92, 0xab, 0x87, 0x61, 0xc1, 0x0a, 0x08, 0x39, 0x23, 0xaf, 0x12, 0x98, 0x00, 0x91,
+ 0x1c, 0xc0, 0x51, 0xb1, 0x1a, 0x18, 0xd4, 0x89, 0x14, 0x2a, 0xd2, 0x3a, 0x30, 0xdb, 0x11, 0x80,
+ 0xaa, 0x05, 0x3b, 0x98, 0x92, 0x19, 0x71, 0xc1, 0x39, 0x13, 0xb9, 0xa7, 0x2c, 0xb3, 0x09, 0x90,
+ 0x0e, 0x25, 0x8c, 0xe1, 0x92, 0x28, 0x00, 0x09, 0x84, 0x0a, 0x01, 0x2b, 0xa8, 0x22, 0x0b, 0xf8,
+ 0x60, 0xa9, 0x04, 0x8b, 0x32, 0x89, 0x4b, 0xd8, 0x20, 0x2c, 0x01, 0xf1, 0x69, 0xa8, 0xa0, 0x12,
+ 0xc9, 0x41, 0x9a, 0x85, 0x9a, 0x14, 0xc9, 0x42, 0xa9, 0x89, 0x02, 0x08, 0x0a, 0x47, 0xad, 0x01,
+ 0xf7, 0xfe, 0x2d, 0x00, 0x09, 0x20, 0x10, 0xa8, 0x00, 0x12, 0xf0, 0x39, 0x83, 0x88, 0x91, 0xab,
+ 0x35, 0xb1, 0x79, 0x1f, 0x00, 0xc2, 0x08, 0x11, 0x9b, 0x28, 0xf2, 0x30, 0x3a, 0xba, 0x92, 0x32,
+ 0xd8, 0x9b, 0x22, 0xb9, 0x53, 0x1a, 0x38, 0x93, 0x95, 0xc3, 0x20, 0xf0, 0x89, 0x20, 0x4e, 0x08,
+ 0xca, 0x30, 0x92, 0x2f, 0xd8, 0x13, 0x1a, 0x12, 0x91, 0x4b, 0x94, 0x8d, 0x10, 0x89, 0x30, 0xd0,
+ 0xb8, 0x20, 0x0f, 0x82, 0x08, 0x82, 0xc6, 0x38, 0x91, 0x89, 0x11, 0x39, 0xd3, 0x2b, 0x0a, 0xf1,
+ 0x48, 0xc1, 0x48, 0x88, 0x89, 0x83, 0xab, 0x19, 0x79, 0xa5, 0x10, 0xaa, 0x48, 0x8b, 0x42, 0xf9,
+ 0x00, 0x92, 0x98, 0x09, 0x20, 0x80, 0xb4, 0x12, 0x0f, 0x96, 0x0b, 0x21, 0x8a, 0xc3, 0x28, 0x08,
+ 0x90, 0x3a, 0xf1, 0x0a, 0x02, 0x22, 0xa0, 0x2b, 0x31, 0xf1, 0x08, 0xb2, 0xb9, 0x5d, 0x72, 0xb0,
+ 0xa2, 0xb3, 0x98, 0x01, 0x8f, 0x03, 0xf0, 0x38, 0x08, 0x99, 0x08, 0x21, 0x28, 0x2a, 0xd2, 0x26,
+ 0xaf, 0x31, 0x8a, 0x22, 0xc8, 0x3a, 0x89, 0xa4, 0x11, 0xc9, 0x3b, 0x06, 0xa8, 0x99, 0x91, 0xac,
+ 0x16, 0x00, 0x92, 0x8d, 0x41, 0x9b, 0x8a, 0x94, 0x4c, 0x82, 0xa8, 0x03, 0x11, 0x9f, 0x30, 0x2c,
+ 0x04, 0x00, 0x8d, 0x83, 0x09, 0xcc, 0x12, 0x89, 0xc6, 0x19, 0x89, 0x94, 0x10, 0xa1, 0x0a, 0x90,
+ 0x73, 0xa2, 0x8c, 0x29, 0x97, 0x00, 0x89, 0xb1, 0x11, 0xc8, 0x0a, 0x44, 0xaa, 0x01, 0x2a, 0x28,
+ 0x23, 0xc9, 0x39, 0xa2, 0xf8, 0x84, 0x2f, 0x80, 0x18, 0x84, 0x8e, 0xa8, 0x30, 0x10, 0x19, 0x9b,
+ 0x93, 0x42, 0x44, 0xb9, 0x09, 0xa5, 0x2a, 0xc0, 0x80, 0xc3, 0x29, 0x82, 0x9c, 0x1a, 0x14, 0xa0,
+ 0xf3, 0x39, 0xd0, 0x79, 0xb1, 0x89, 0x71, 0x99, 0x80, 0x83, 0x8d, 0x80, 0x89, 0x68, 0x08, 0x91,
+ 0x2c, 0xfe, 0x28, 0x00, 0x11, 0x09, 0x13, 0x2c, 0x22, 0xd0, 0x34, 0xc9, 0x10, 0x39, 0x31, 0xef,
+ 0x11, 0x89, 0x90, 0x09, 0x22, 0xba, 0x4a, 0x89, 0x26, 0xf8, 0x89, 0x84, 0x8a, 0x00, 0x23, 0xba,
+ 0x10, 0x00, 0x6d, 0x02, 0x88, 0x0a, 0x28, 0xf0, 0x5a, 0xa0, 0x82, 0x19, 0x99, 0x95, 0x19, 0xa6,
+ 0x0c, 0x92, 0x4a, 0x98, 0x98, 0x52, 0xb9, 0x3b, 0xb5, 0x58, 0x83, 0x0c, 0x19, 0x31, 0xb9, 0x9a,
+ 0x01, 0xc8, 0x4a, 0x9e, 0x40, 0x24, 0x9b, 0x09, 0xb2, 0x17, 0xab, 0x00, 0x1b, 0x23, 0xab, 0x14,
+ 0xe0, 0x20, 0xd0, 0xa0, 0x83, 0xab, 0x13, 0x16, 0xb8, 0x9d, 0x14, 0x3a, 0x79, 0x00, 0xbb, 0x70,
+ 0x8a, 0x20, 0x89, 0x01, 0x81, 0x89, 0xc1, 0xb2, 0x3b, 0xa8, 0x87, 0x31, 0x8b, 0xfc, 0x01, 0x00,
+ 0x1a, 0x88, 0x06, 0x1a, 0x8a, 0x80, 0x17, 0xbc, 0x83, 0x0a, 0x80, 0x29, 0x74, 0xc1, 0x09, 0x02,
+ 0x0a, 0x22, 0x9e, 0x20, 0x01, 0x9c, 0x82, 0x89, 0xa2, 0x3a, 0xe4, 0x0d, 0x04, 0x99, 0x80, 0x90,
+ 0x43, 0xa9, 0x84, 0xae, 0x42, 0x0b, 0x13, 0x08, 0xc1, 0x08, 0x3b, 0x07, 0x0a, 0x80, 0x91, 0xa2,
+ 0x5d, 0xaa, 0x23, 0xab, 0x03, 0x88, 0x8f, 0x8c, 0x26, 0xa9, 0x20, 0x88, 0x39, 0xc6, 0x00, 0x8b,
+ 0x08, 0x9b, 0x27, 0x9a, 0x21, 0x98, 0x03, 0x8f, 0x92, 0x12, 0x1c, 0x04, 0x8d, 0x01, 0x98, 0x90,
+ 0x19, 0x30, 0x03, 0x0f, 0x14, 0x8e, 0x80, 0x19, 0x12, 0xe1, 0x21, 0x9a, 0x10, 0xaa, 0x42, 0xcc,
+ 0x23, 0x2b, 0x25, 0xad, 0x03, 0xd0, 0x30, 0x8e, 0x11, 0xb0, 0x39, 0x04, 0xcb, 0x84, 0x18, 0x82,
+ 0x3b, 0xa4, 0xda, 0x41, 0x08, 0xbb, 0x04, 0x18, 0xa0, 0x0f, 0x00, 0x98, 0x51, 0x98, 0x12, 0xa9,
+ 0x97, 0x1b, 0x11, 0x18, 0x32, 0xec, 0x43, 0xc9, 0x01, 0x08, 0x0a, 0xc3, 0x01, 0x0b, 0x1e, 0x03,
+ 0x1e, 0x00, 0x25, 0x00, 0x1f, 0x80, 0x12, 0x00, 0xc9, 0x18, 0xb4, 0x2b, 0x10, 0x9a, 0x16, 0x99,
+ 0x2a, 0xaa, 0xc2, 0x50, 0x33, 0xec, 0x30, 0x18, 0x81, 0xa9, 0x3b, 0x15, 0x94, 0xdb, 0xa1, 0x50,
+ 0x31, 0xb1, 0xbd, 0x16, 0x0a, 0xca, 0x83, 0x04, 0xba, 0x68, 0xa0, 0x89, 0xa1, 0x4b, 0xb3, 0x1d,
+ 0x20, 0xc8, 0x48, 0x80, 0x59, 0xa1, 0x39, 0x81, 0x86, 0xb9, 0x49, 0xd0, 0x39, 0xa0, 0x08, 0x30,
+ 0xc3, 0x09, 0x9d, 0x84, 0x41, 0x98, 0x11, 0xb9, 0x28, 0x00, 0x8f, 0x02, 0x8e, 0x08, 0x02, 0x0e,
+ 0x00, 0xa8, 0x91, 0x07, 0x9a, 0x82, 0xd1, 0x08, 0x19, 0x14, 0x60, 0x8a, 0xa5, 0x3b, 0x0c, 0x01,
+ 0x09, 0x42, 0x91, 0x8d, 0x82, 0x8c, 0x11, 0xc0, 0x0a, 0x06, 0x1b, 0x01, 0x88, 0x82, 0x18, 0x03,
+ 0xf0, 0x9c, 0x50, 0xca, 0x12, 0x09, 0x42, 0x00, 0x1d, 0x98, 0x90, 0x3b, 0x14, 0xea, 0x43, 0x8c,
+ 0xb1, 0x84, 0x9c, 0x11, 0x0a, 0x84, 0x0b, 0x27, 0xa8, 0x1c, 0x81, 0x92, 0x0a, 0x33, 0x0a, 0x8c,
+ 0xc2, 0x8d, 0x10, 0x10, 0x02, 0x20, 0xce, 0x59, 0xd1, 0x80, 0x38, 0x91, 0x29, 0x99, 0x84, 0x2b,
+ 0x91, 0xa3, 0x1f, 0x01, 0x0a, 0x07, 0xb8, 0x59, 0x89, 0x22, 0xa0, 0xab, 0x64, 0xcb, 0x21, 0xba,
+ 0x12, 0x82, 0x09, 0xe0, 0x1e, 0x22, 0xb0, 0x11, 0xa1, 0x71, 0xa9, 0x81, 0x88, 0x8b, 0x43, 0x85,
+ 0xab, 0x92, 0x5e, 0xa8, 0x91, 0x01, 0x89, 0x5a, 0xf8, 0x29, 0x82, 0x1d, 0x93, 0x01, 0x89, 0x98,
+ 0x42, 0xa2, 0x30, 0x60, 0xfa, 0x28, 0xb0, 0x2d, 0x12, 0x90, 0x1a, 0x04, 0xba, 0x04, 0xa2, 0x0c,
+ 0xb0, 0xc2, 0x6c, 0x91, 0x98, 0x80, 0x0b, 0x7a, 0x01, 0x80, 0xda, 0x40, 0xa0, 0x18, 0x06, 0x0b,
+ 0x88, 0x02, 0xa1, 0x20, 0x81, 0x0d, 0x84, 0x0a, 0xe9, 0x93, 0x2c, 0x23, 0xcb, 0x83, 0x78, 0x81,
+ 0x6e, 0x00, 0x25, 0x00, 0x90, 0x00, 0x4b, 0x85, 0x8a, 0xc8, 0x39, 0x1a, 0x78, 0xa0, 0x2b, 0x04,
+ 0x88, 0x80, 0xc9, 0x06, 0x0c, 0x1a, 0xb2, 0xb4, 0xaa, 0x78, 0x3a, 0xb4, 0x1a, 0x82, 0x99, 0x35,
+ 0xbb, 0xe3, 0x30, 0x98, 0x01, 0x0c, 0x11, 0x00, 0x2c, 0x23, 0x2f, 0xb2, 0x8f, 0x81, 0x89, 0x23,
+ 0xc1, 0x00, 0x28, 0xe8, 0x11, 0xba, 0x11, 0xa4, 0x3c, 0x39, 0x0c, 0x86, 0x8b, 0xa1, 0x30, 0xa0,
+ 0x11, 0x0e, 0x90, 0x17, 0x18, 0xbb, 0x43, 0xab, 0x82, 0x84, 0x9a, 0x2f, 0x98, 0xb4, 0x58, 0xaa,
+ 0x80, 0x41, 0xe0, 0x11, 0x19, 0x12, 0xa9, 0x10, 0xd9, 0x44, 0x8e, 0xa2, 0x80, 0x30, 0x90, 0x3b,
+ 0x32, 0xbe, 0xa2, 0x89, 0x3e, 0x82, 0x40, 0xc1, 0x08, 0x8a, 0x20, 0x01, 0x38, 0xd3, 0x78, 0xc8,
+ 0x18, 0x87, 0x89, 0x28, 0x80, 0x8a, 0x89, 0x05, 0x39, 0xcc, 0x92, 0x18, 0x10, 0x10, 0xaf, 0x33,
+ 0xb8, 0x18, 0x22, 0x2b, 0xf3, 0x39, 0xfb, 0x21, 0xaa, 0x04, 0x8c, 0x01, 0xb0, 0x34, 0xab, 0x49,
+ 0x10, 0x23, 0xfb, 0x34, 0x8f, 0x81, 0x30, 0xca, 0x91, 0x39, 0x01, 0x39, 0x28, 0xf0, 0x80, 0xa1,
+ 0x40, 0x8b, 0x04, 0x10, 0xf3, 0x09, 0x10, 0xa3, 0x22, 0xbe, 0x10, 0x11, 0xaf, 0x32, 0x88, 0x39,
+ 0x3b, 0xbe, 0x86, 0x00, 0x88, 0x81, 0x0a, 0x19, 0x81, 0x00, 0xb9, 0x7c, 0x01, 0xbb, 0x70, 0xc0,
+ 0x00, 0x39, 0x89, 0x18, 0x20, 0xf1, 0x21, 0xf0, 0x58, 0xb1, 0x08, 0xa8, 0x11, 0xa9, 0x68, 0x90,
+ 0x88, 0xa5, 0x1b, 0x8a, 0x97, 0x2b, 0x22, 0x90, 0x11, 0x2a, 0xf0, 0x02, 0x9a, 0xb1, 0x92, 0x10,
+ 0x32, 0xf4, 0x0b, 0x22, 0xb8, 0x36, 0xbd, 0x41, 0xb0, 0xa8, 0x21, 0x4a, 0xd1, 0x8a, 0x11, 0xa2,
+ 0x83, 0x4d, 0xb0, 0x16, 0x8f, 0x02, 0xa0, 0x19, 0x01, 0x99, 0x80, 0x10, 0x8a, 0x07, 0x2a, 0xab,
+ 0x91, 0xff, 0x20, 0x00, 0x20, 0x98, 0x3c, 0x97, 0x98, 0x83, 0x24, 0xcc, 0x20, 0xa9, 0x48, 0x39,
+ 0xab, 0xc9, 0x71, 0xb1, 0x10, 0x18, 0x23, 0x8d, 0x95, 0x9b, 0x51, 0xca, 0x41, 0x92, 0xb8, 0x9b,
+ 0x03, 0x88, 0xb0, 0x6b, 0x96, 0xa9, 0x91, 0x0b, 0x27, 0x8f, 0x82, 0x48, 0x98, 0x10, 0x92, 0x0c,
+ 0x12, 0x8e, 0x10, 0x20, 0xf1, 0x19, 0xb8, 0x22, 0x80, 0x90, 0x85, 0xc9, 0x69, 0x00, 0x99, 0x00,
+ 0xc1, 0x98, 0x02, 0x80, 0x38, 0x95, 0x3a, 0xd8, 0x68, 0x18, 0x91, 0x8a, 0x83, 0xca, 0x8f, 0x84,
+ 0x29, 0x9a, 0x00, 0x1e, 0x01, 0x20, 0xc1, 0x89, 0x10, 0x05, 0x2a, 0xa9, 0xa6, 0x29, 0x19, 0x93,
+ 0x19, 0x58, 0xa9, 0x9c, 0x81, 0x0a, 0xa7, 0x02, 0x8f, 0x93, 0x30, 0xd8, 0x22, 0x9a, 0x14, 0x99,
+ 0xe9, 0x10, 0x93, 0x1c, 0x2b, 0x21, 0x89, 0x3a, 0x90, 0x27, 0x0e, 0x94, 0x10, 0xcb, 0x92, 0x59,
+ 0xa9, 0x0a, 0x28, 0xf2, 0x20, 0x21, 0xb8, 0x41, 0x00, 0x09, 0x81, 0x9f, 0x52, 0x9a, 0x81, 0x0b,
+ 0x94, 0x9b, 0x49, 0xa9, 0x95, 0x4d, 0x81, 0x81, 0x18, 0x9a, 0x16, 0xf8, 0x21, 0x9b, 0x01, 0x11,
+ 0x99, 0x29, 0xd2, 0x19, 0x19, 0x91, 0x2f, 0x81, 0x0b, 0xc4, 0x02, 0xa0, 0x78, 0x99, 0x80, 0x30,
+ 0xc3, 0x98, 0x21, 0x0d, 0xea, 0x24, 0x48, 0xa0, 0x01, 0x1f, 0x91, 0xa1, 0x10, 0x00, 0x9d, 0x00,
+ 0x93, 0x1d, 0x88, 0x80, 0x2b, 0xd2, 0x05, 0x98, 0x60, 0x8a, 0x92, 0x23, 0xad, 0x81, 0x8b, 0x13,
+ 0x1b, 0x1f, 0x97, 0x10, 0xb9, 0x00, 0x28, 0xa8, 0x4c, 0xb4, 0xb8, 0x38, 0x0d, 0x85, 0x8a, 0x14,
+ 0xa9, 0x59, 0x00, 0xe0, 0x38, 0x88, 0x03, 0x19, 0x98, 0x88, 0x9e, 0x84, 0x2a, 0xb2, 0xd9, 0x42,
+ 0x00, 0x18, 0xbc, 0x06, 0x88, 0xa2, 0x3c, 0x1d, 0x83, 0xd0, 0x12, 0x00, 0x9d, 0x78, 0x90, 0x08,
+ 0x74, 0x00, 0x29, 0x00, 0x8a, 0x88, 0x01, 0x01, 0x04, 0xbb, 0x1e, 0x03, 0x00, 0x8e, 0x01, 0xa0,
+ 0x60, 0x88, 0xa2, 0x80, 0x0c, 0x01, 0xf1, 0x38, 0x02, 0x00, 0xac, 0x90, 0x21, 0x13, 0x68, 0x9a,
+ 0x8b, 0x3c, 0xb6, 0x39, 0xa8, 0x7b, 0xa0, 0x88, 0x81, 0x89, 0xa6, 0x69, 0x80, 0x02, 0xba, 0x1a,
+ 0xd9, 0x21, 0xc0, 0x0a, 0x95, 0x50, 0x99, 0x91, 0x28, 0xc2, 0x4b, 0x83, 0x09, 0xaa, 0x79, 0xc2,
+ 0x3a, 0xb5, 0x09, 0x12, 0xb8, 0x20, 0x2c, 0x87, 0x0c, 0xa0, 0x22, 0x1b, 0xd0, 0x8c, 0x72, 0xa9,
+ 0x82, 0x38, 0xc1, 0x19, 0x40, 0xd0, 0x30, 0x22, 0xbc, 0x11, 0xea, 0x92, 0x9a, 0x22, 0x02, 0x1a,
+ 0x06, 0x1c, 0xa2, 0xc3, 0x2e, 0x81, 0x08, 0x90, 0x87, 0x1a, 0x90, 0x38, 0xb9, 0x11, 0x12, 0xba,
+ 0x49, 0x3d, 0x9d, 0x00, 0x24, 0xb8, 0x9c, 0x06, 0x9c, 0x81, 0x51, 0xc8, 0x20, 0x08, 0x88, 0x00,
+ 0xa2, 0x0b, 0x07, 0x3a, 0x98, 0x3b, 0xf3, 0xa8, 0x33, 0x18, 0x8c, 0x82, 0x12, 0xd1, 0x0d, 0x82,
+ 0x11, 0x39, 0xfd, 0x12, 0x08, 0x8d, 0x28, 0x29, 0x90, 0x12, 0x92, 0xbf, 0x05, 0x30, 0xd9, 0x83,
+ 0x9a, 0x9a, 0x91, 0x05, 0x28, 0x95, 0x19, 0xb2, 0x0d, 0x01, 0x48, 0x83, 0x0c, 0xa1, 0x0e, 0x03,
+ 0x1c, 0x19, 0x04, 0x9b, 0xa7, 0x1a, 0x98, 0xa0, 0x1a, 0x33, 0x11, 0x8f, 0x90, 0x81, 0x0d, 0x16,
+ 0x0c, 0x91, 0x23, 0xba, 0x09, 0x85, 0x9d, 0x13, 0xba, 0x89, 0x25, 0xb0, 0x70, 0x8a, 0x90, 0x03,
+ 0x1b, 0x02, 0xf0, 0x8a, 0x70, 0xaa, 0x21, 0xb2, 0x02, 0x39, 0x48, 0xd8, 0x10, 0x4b, 0xc9, 0x23,
+ 0x98, 0x1d, 0x31, 0xaf, 0x13, 0xb8, 0x32, 0x99, 0x8b, 0x06, 0x99, 0x94, 0x92, 0x89, 0x9b, 0x25,
+ 0x0c, 0x99, 0x58, 0xb4, 0x88, 0x1e, 0x85, 0x8d, 0x83, 0x3b, 0x85, 0x99, 0x80, 0xa9, 0x30, 0x94,
+ 0xa6, 0xff, 0x21, 0x00, 0x95, 0x39, 0x20, 0x0f, 0xb2, 0x88, 0x12, 0x9b, 0x22, 0xf8, 0x19, 0x96,
+ 0x2a, 0x88, 0x01, 0xa0, 0xb1, 0x59, 0xa9, 0x00, 0x96, 0x38, 0xf0, 0x18, 0x92, 0x2d, 0x12, 0xb1,
+ 0x19, 0x11, 0xb1, 0x29, 0x90, 0xfd, 0x08, 0x11, 0x81, 0x9a, 0x89, 0x43, 0x8d, 0x2a, 0x44, 0xb2,
+ 0x4d, 0xb2, 0xab, 0x33, 0xd8, 0x60, 0x93, 0xbb, 0x08, 0x92, 0x01, 0x92, 0xe8, 0x0c, 0x32, 0x10,
+ 0xa2, 0xf0, 0x32, 0x1f, 0x91, 0x1a, 0x03, 0xd0, 0x3c, 0xb1, 0x49, 0xc9, 0x33, 0x8d, 0xa3, 0x48,
+ 0x08, 0x22, 0xeb, 0x28, 0x03, 0x99, 0x41, 0xdc, 0x21, 0xa0, 0xb0, 0x41, 0x09, 0x09, 0xb6, 0x0b,
+ 0x05, 0x28, 0x00, 0x0d, 0xfa, 0x04, 0x1b, 0x81, 0xaa, 0x10, 0xac, 0x31, 0x04, 0xb1, 0x63, 0xaa,
+ 0x22, 0x89, 0x82, 0x8b, 0xa6, 0x08, 0xa9, 0x1f, 0x04, 0xba, 0x23, 0xa1, 0x12, 0x49, 0x18, 0xf2,
+ 0x19, 0x99, 0xa5, 0x90, 0x10, 0xa1, 0x0f, 0xc2, 0x19, 0xa1, 0x40, 0x30, 0x81, 0x1c, 0xbb, 0x9a,
+ 0x7b, 0xe1, 0x70, 0x01, 0x89, 0xa8, 0xa0, 0x21, 0x8b, 0x53, 0x38, 0xcc, 0x0a, 0x91, 0x50, 0x21,
+ 0xa2, 0x3a, 0xa0, 0x31, 0x0a, 0xf9, 0xd0, 0x20, 0x8a, 0x92, 0xdb, 0x74, 0xca, 0x12, 0x8a, 0x48,
+ 0x88, 0x88, 0x14, 0x8a, 0x18, 0xb3, 0x1f, 0x20, 0xf1, 0x2a, 0x11, 0xa8, 0x05, 0x8c, 0x11, 0x08,
+ 0xc1, 0x1b, 0x94, 0x29, 0x99, 0xd8, 0x62, 0xa8, 0xa0, 0x10, 0x4b, 0x84, 0xc8, 0x50, 0xa0, 0x81,
+ 0x8a, 0x88, 0x80, 0x35, 0x9f, 0x13, 0x0a, 0x8b, 0xc0, 0x22, 0x23, 0xb9, 0x0e, 0xa8, 0x59, 0xa2,
+ 0x3a, 0x73, 0xc0, 0x18, 0x01, 0x08, 0x29, 0xe0, 0x20, 0x11, 0xfb, 0x2a, 0xa1, 0x10, 0x33, 0x0b,
+ 0xfb, 0x10, 0x11, 0x8f, 0x83, 0x01, 0xa2, 0x0b, 0xc9, 0x80, 0x92, 0x7b, 0xb3, 0x4a, 0x18, 0x06,
+ 0xb3, 0x00, 0x24, 0x00, 0x9b, 0x80, 0x12, 0xb0, 0x2b, 0xba, 0x8c, 0x43, 0x25, 0x0b, 0x19, 0xf9,
+ 0x38, 0x3a, 0x07, 0x0b, 0x03, 0x09, 0xa3, 0x3f, 0xd0, 0x81, 0x93, 0x29, 0xfb, 0x10, 0x81, 0x01,
+ 0x5a, 0xd9, 0x81, 0x90, 0x49, 0x01, 0x01, 0x24, 0xfb, 0x02, 0x9b, 0x19, 0x04, 0xda, 0x32, 0x80,
+ 0x8d, 0xa0, 0x48, 0x82, 0x8c, 0x23, 0x9c, 0x98, 0x02, 0x04, 0x72, 0xd0, 0x0a, 0x14, 0x9b, 0x92,
+ 0x29, 0x12, 0x1f, 0x92, 0x19, 0x3b, 0xd1, 0x18, 0x11, 0x8c, 0x92, 0x8d, 0x07, 0x0b, 0x82, 0x8a,
+ 0x40, 0x00, 0x9a, 0x9a, 0x30, 0x23, 0x09, 0xfb, 0x03, 0x9d, 0x2b, 0x38, 0xc0, 0x40, 0x07, 0x8a,
+ 0x04, 0xad, 0x31, 0x90, 0x10, 0xb2, 0x1b, 0x20, 0xb9, 0x7b, 0x87, 0x9a, 0x1b, 0x96, 0x88, 0xa1,
+ 0x0b, 0x40, 0xb0, 0xa3, 0x49, 0x0f, 0x12, 0xb0, 0x10, 0x3a, 0xc1, 0x30, 0xa0, 0x4c, 0x22, 0xfb,
+ 0x3a, 0x81, 0xba, 0x07, 0x1a, 0x1a, 0x03, 0xcc, 0x10, 0x20, 0xa2, 0x61, 0xc9, 0x05, 0x88, 0x98,
+ 0x88, 0x81, 0xd1, 0x8a, 0x25, 0x18, 0xaa, 0x5a, 0x90, 0x2b, 0xb6, 0x2a, 0xb2, 0x88, 0x48, 0x22,
+ 0xbb, 0x18, 0xfb, 0x32, 0x39, 0x8a, 0x40, 0xe2, 0x20, 0xf8, 0x10, 0x20, 0xc9, 0x18, 0xd1, 0x4a,
+ 0xa8, 0x2b, 0x03, 0x2f, 0x80, 0x20, 0xb3, 0xa5, 0x9a, 0x72, 0x8a, 0x98, 0x21, 0x89, 0xf1, 0x32,
+ 0xa8, 0x82, 0x10, 0xfb, 0x09, 0x90, 0x43, 0xa9, 0x34, 0xea, 0x10, 0x88, 0x88, 0x28, 0xc3, 0x89,
+ 0x08, 0x84, 0x28, 0x8d, 0x68, 0x10, 0xd8, 0xa3, 0x58, 0xa0, 0x1d, 0xa0, 0x08, 0xa1, 0x0c, 0x04,
+ 0x0e, 0x20, 0xa3, 0xa1, 0x21, 0xd2, 0x1b, 0x35, 0xaa, 0x29, 0xc2, 0x19, 0x07, 0x8d, 0x01, 0xa1,
+ 0x19, 0x60, 0xc9, 0x00, 0x11, 0xc1, 0x49, 0xd0, 0x21, 0x99, 0x18, 0xba, 0xa3, 0x72, 0x12, 0xa0,
+ 0x09, 0x01, 0x1f, 0x00, 0xea, 0x3a, 0xa1, 0x8b, 0x80, 0x02, 0x39, 0xa0, 0xd3, 0xa0, 0x15, 0xba,
+ 0x79, 0x98, 0x32, 0x80, 0x9e, 0xc2, 0xd0, 0x72, 0x90, 0x88, 0x12, 0xab, 0x38, 0x8b, 0x08, 0xaa,
+ 0x33, 0x86, 0x09, 0x8a, 0x59, 0xdb, 0x73, 0xa8, 0x00, 0x10, 0x49, 0xaa, 0xa4, 0x9e, 0x05, 0x19,
+ 0x19, 0x10, 0xf9, 0x39, 0x12, 0xa8, 0x94, 0x0a, 0x99, 0x22, 0x18, 0x9a, 0x04, 0x00, 0x3e, 0x90,
+ 0x9b, 0xe5, 0x30, 0x91, 0xb1, 0x8f, 0xb3, 0x60, 0xa9, 0x29, 0xb3, 0x20, 0x09, 0xaf, 0x05, 0x1a,
+ 0x08, 0x83, 0xb9, 0x14, 0x08, 0x03, 0x9f, 0x03, 0x0b, 0x13, 0x28, 0x80, 0xbe, 0x50, 0x9a, 0x03,
+ 0x8c, 0xa3, 0xcb, 0x95, 0x09, 0x3f, 0x82, 0x11, 0x09, 0xa9, 0x85, 0x19, 0x89, 0x15, 0x19, 0x08,
+ 0xa9, 0xd2, 0x40, 0x98, 0x83, 0xb5, 0x0d, 0x8a, 0x08, 0x42, 0xcd, 0x83, 0x13, 0x8a, 0x8b, 0x17,
+ 0x2b, 0xf0, 0x1a, 0x00, 0x68, 0xb2, 0x88, 0x28, 0x39, 0xf8, 0x18, 0x02, 0x89, 0x98, 0x28, 0x8d,
+ 0x13, 0x16, 0xbc, 0x80, 0x10, 0x01, 0xac, 0x84, 0x50, 0xab, 0x13, 0xaa, 0x33, 0xbd, 0xc1, 0x52,
+ 0x30, 0xad, 0x81, 0xaa, 0x58, 0xb3, 0x80, 0x59, 0x82, 0xc1, 0x1c, 0xc1, 0x09, 0x11, 0x40, 0xb2,
+ 0x2f, 0x08, 0x91, 0x12, 0xa8, 0x28, 0xe2, 0x82, 0x41, 0x8c, 0xd1, 0x90, 0x68, 0xb2, 0xba, 0x61,
+ 0xa1, 0x5b, 0x91, 0x89, 0x81, 0x2d, 0xa0, 0x01, 0x22, 0x80, 0x2a, 0xfb, 0x32, 0xb0, 0x88, 0x31,
+ 0xc3, 0x81, 0xae, 0x30, 0xb0, 0x78, 0x8c, 0x80, 0x53, 0x09, 0xad, 0x13, 0x6a, 0x91, 0xc9, 0x09,
+ 0x22, 0x93, 0x0e, 0x98, 0x87, 0x09, 0x1a, 0x01, 0x10, 0x12, 0x8f, 0xa1, 0x30, 0x8c, 0x00, 0xb9,
+ 0x15, 0xb8, 0x7a, 0xd1, 0x11, 0x08, 0x08, 0x9a, 0x85, 0x2a, 0xc2, 0x19, 0x23, 0xad, 0x32, 0xca,
+ 0x8f, 0xff, 0x21, 0x00, 0x11, 0xa1, 0x10, 0x61, 0xa8, 0xa9, 0x4c, 0x88, 0x14, 0xf8, 0x20, 0x90,
+ 0x00, 0x2a, 0x18, 0xc2, 0x30, 0xc0, 0xa9, 0x5b, 0x84, 0xc1, 0x20, 0x88, 0x4b, 0xe4, 0x89, 0x28,
+ 0x11, 0xae, 0x43, 0xa8, 0x28, 0xd1, 0x0a, 0x43, 0x90, 0xca, 0x69, 0xb1, 0x7a, 0xb1, 0x29, 0x00,
+ 0x98, 0x20, 0xa9, 0x80, 0x3a, 0x2b, 0xf2, 0x4b, 0x85, 0x8a, 0x39, 0xb2, 0x39, 0xd2, 0x0d, 0x01,
+ 0x40, 0xf8, 0x11, 0x1b, 0x18, 0x12, 0xe2, 0x00, 0x2a, 0xb9, 0xa3, 0x3c, 0x11, 0x1c, 0x15, 0xa8,
+ 0x99, 0x19, 0xd4, 0x29, 0x98, 0x11, 0x89, 0x3d, 0x93, 0x8a, 0x57, 0x8a, 0x28, 0xe0, 0x19, 0x91,
+ 0xab, 0x55, 0xa8, 0x30, 0xd8, 0x20, 0xb0, 0x1c, 0x04, 0xa9, 0x90, 0x31, 0x99, 0x59, 0x01, 0x9d,
+ 0x01, 0x30, 0xe2, 0x28, 0x91, 0x00, 0x48, 0x80, 0x7b, 0xa3, 0x9b, 0x00, 0xb9, 0x1e, 0x13, 0xd8,
+ 0x28, 0xea, 0x62, 0x89, 0x90, 0x2a, 0x70, 0x90, 0x9a, 0x18, 0x22, 0xbb, 0x23, 0xa7, 0x4c, 0xd3,
+ 0x1a, 0x80, 0x20, 0xa8, 0x30, 0x91, 0x0a, 0xe2, 0x08, 0x1a, 0x41, 0x96, 0x9b, 0x91, 0x48, 0xba,
+ 0x00, 0x2b, 0x40, 0xa3, 0x1a, 0x0c, 0x39, 0x9c, 0x07, 0x1b, 0x24, 0x08, 0x99, 0xc2, 0xc0, 0x06,
+ 0x0d, 0x82, 0x02, 0x9c, 0xb1, 0x2b, 0x83, 0x5b, 0x88, 0x04, 0x84, 0xad, 0xa2, 0x4a, 0x11, 0x2b,
+ 0xdb, 0x37, 0x9c, 0x09, 0x08, 0xa2, 0x22, 0xb2, 0x1c, 0x82, 0xa1, 0x91, 0x78, 0xb1, 0x8c, 0x85,
+ 0x1b, 0x82, 0x96, 0x8b, 0x10, 0xc2, 0xa4, 0x20, 0x9c, 0x10, 0xda, 0x48, 0x12, 0xf1, 0x30, 0xab,
+ 0x84, 0xa8, 0x40, 0x18, 0x88, 0x8b, 0xc4, 0x31, 0xbc, 0x11, 0x88, 0x40, 0xc1, 0x15, 0x38, 0xbe,
+ 0x09, 0x90, 0x16, 0x0a, 0xe4, 0x19, 0x82, 0xa9, 0x00, 0x94, 0x49, 0x98, 0xa3, 0x2b, 0x30, 0x1e,
+ 0xa3, 0x00, 0x1f, 0x00, 0xb1, 0x0f, 0x33, 0xf8, 0x18, 0x08, 0xc1, 0x11, 0x2c, 0x80, 0x80, 0xa9,
+ 0x28, 0x81, 0x9b, 0x45, 0xeb, 0x39, 0x86, 0x28, 0xa8, 0x08, 0x99, 0x33, 0xf3, 0x39, 0xa2, 0x19,
+ 0xb1, 0x1d, 0x19, 0xb1, 0x19, 0xe1, 0x09, 0x01, 0x43, 0x08, 0x0a, 0xb8, 0xf0, 0x14, 0x8c, 0x38,
+ 0x83, 0x99, 0x1f, 0xa5, 0x8c, 0x40, 0x89, 0x80, 0x34, 0xfa, 0x00, 0x09, 0x31, 0x88, 0xb8, 0x02,
+ 0x18, 0xab, 0x39, 0x90, 0xf3, 0x38, 0x07, 0x8c, 0x09, 0xb3, 0x60, 0x00, 0xc8, 0x29, 0xb8, 0x20,
+ 0xb1, 0x14, 0xb2, 0x44, 0x0f, 0x92, 0xab, 0x71, 0x0a, 0xb3, 0x10, 0x1a, 0x28, 0xca, 0x93, 0x1c,
+ 0x23, 0xf8, 0x41, 0xc1, 0x10, 0xc1, 0x90, 0x4a, 0xb2, 0x4a, 0x80, 0xad, 0x23, 0xb0, 0x8c, 0x07,
+ 0x09, 0x10, 0xa1, 0xb0, 0x40, 0xc8, 0x31, 0x8e, 0x21, 0x99, 0x82, 0x1e, 0x21, 0x99, 0x40, 0x18,
+ 0xc8, 0x10, 0xb9, 0x2b, 0x17, 0xb2, 0x3e, 0xa8, 0x18, 0xa1, 0x6c, 0xa9, 0x01, 0x48, 0xb0, 0x92,
+ 0x1b, 0x00, 0x9d, 0x25, 0x88, 0xba, 0x86, 0x3c, 0x12, 0x81, 0xb8, 0x78, 0x08, 0x09, 0xa1, 0xab,
+ 0x3d, 0xa3, 0x19, 0x87, 0x0c, 0x22, 0x0a, 0x88, 0x29, 0x28, 0x9b, 0xd2, 0x79, 0xba, 0x03, 0x10,
+ 0x27, 0x8f, 0x81, 0x19, 0x88, 0x10, 0xc0, 0x84, 0x8a, 0xa0, 0x09, 0xc2, 0x7a, 0x82, 0x92, 0x98,
+ 0x1b, 0xd8, 0x07, 0x20, 0xaa, 0x00, 0x02, 0x40, 0xb9, 0x00, 0xc5, 0x19, 0x51, 0xb8, 0x9a, 0xa1,
+ 0x2f, 0x13, 0xba, 0xd9, 0x41, 0x99, 0x93, 0xa9, 0x54, 0xb9, 0x29, 0x9b, 0x52, 0x0a, 0xb1, 0x93,
+ 0x99, 0x74, 0xa8, 0xc1, 0x20, 0x0a, 0x03, 0x28, 0x9d, 0x31, 0xf9, 0x38, 0x4b, 0xd8, 0x12, 0xaa,
+ 0x2c, 0x84, 0x01, 0x81, 0x5b, 0xba, 0x62, 0x88, 0xa8, 0x08, 0x32, 0xdd, 0x40, 0x88, 0x00, 0xc2,
+ 0x49, 0xff, 0x1f, 0x00, 0x39, 0x83, 0x10, 0xd0, 0x30, 0x2b, 0x90, 0xe2, 0x10, 0x50, 0xa5, 0xb0,
+ 0x1d, 0x08, 0xb3, 0x22, 0x1b, 0x3e, 0xf0, 0x20, 0x09, 0x00, 0x80, 0x1b, 0x50, 0x98, 0x23, 0x8f,
+ 0x01, 0x81, 0x99, 0x5b, 0xc2, 0x11, 0x08, 0xac, 0x22, 0x93, 0x30, 0xd4, 0x4a, 0x90, 0xab, 0xd3,
+ 0x5d, 0x92, 0x2a, 0xc1, 0x48, 0xca, 0x11, 0x94, 0x3a, 0xa2, 0x30, 0x8c, 0x9a, 0x13, 0x2a, 0xa6,
+ 0x40, 0xfa, 0x32, 0x8d, 0x18, 0xa0, 0x0a, 0x13, 0x92, 0xab, 0x08, 0xc4, 0x20, 0x14, 0xb9, 0x27,
+ 0xba, 0x4c, 0x02, 0xa9, 0x52, 0xe8, 0x80, 0x91, 0x2c, 0xd1, 0x93, 0x21, 0x49, 0xb1, 0x8d, 0x21,
+ 0xaa, 0x42, 0xa2, 0x2c, 0x48, 0x80, 0xc9, 0x9b, 0x11, 0x23, 0xcf, 0x23, 0x09, 0xb2, 0x99, 0x10,
+ 0x8c, 0x44, 0xc2, 0x13, 0x9f, 0x20, 0x01, 0x9b, 0x05, 0x89, 0x81, 0x88, 0x48, 0xae, 0x14, 0x8a,
+ 0x93, 0x2d, 0xb2, 0xa9, 0x30, 0x80, 0x90, 0x00, 0x8a, 0x74, 0xb9, 0xb9, 0x06, 0x00, 0x19, 0xa8,
+ 0x94, 0x9e, 0x28, 0x96, 0x90, 0x43, 0xab, 0x13, 0x8f, 0x90, 0x52, 0x98, 0x0a, 0x91, 0x8b, 0x04,
+ 0x8b, 0x48, 0x22, 0x8f, 0x00, 0xba, 0x02, 0x50, 0xb0, 0x69, 0xb1, 0xa8, 0x3f, 0xa3, 0x09, 0x20,
+ 0x90, 0x01, 0x9c, 0x79, 0x91, 0x18, 0x81, 0xd8, 0x31, 0xb3, 0x8f, 0x01, 0x08, 0xab, 0x71, 0x90,
+ 0x89, 0xa4, 0x8a, 0x39, 0x14, 0x91, 0x9e, 0x14, 0xcb, 0x03, 0x1c, 0x83, 0x98, 0x81, 0x0d, 0x04,
+ 0x08, 0xb8, 0x88, 0x07, 0x29, 0xa9, 0x00, 0x41, 0xc2, 0xca, 0x11, 0x08, 0xa6, 0x41, 0xb8, 0x48,
+ 0xd1, 0x39, 0x01, 0x91, 0x9a, 0xb3, 0x2f, 0x10, 0xb8, 0x85, 0x0b, 0x89, 0x18, 0x97, 0x1d, 0x18,
+ 0x8a, 0x33, 0x1a, 0xda, 0x86, 0x19, 0xaa, 0x03, 0x72, 0xa8, 0x13, 0xcb, 0x1a, 0xa9, 0x44, 0xc1,
+ 0x1f, 0x00, 0x1f, 0x00, 0xb3, 0x1b, 0xa2, 0xb2, 0x61, 0x98, 0x0f, 0x07, 0x99, 0x08, 0x10, 0xc9,
+ 0x22, 0x98, 0x18, 0x9a, 0x03, 0x9b, 0x22, 0xc7, 0x38, 0x9b, 0x05, 0x89, 0x98, 0x1d, 0x38, 0x11,
+ 0x92, 0x2d, 0xa2, 0xaa, 0xb4, 0x5b, 0xc8, 0x85, 0x88, 0x28, 0x10, 0x8e, 0x08, 0xd2, 0x23, 0x99,
+ 0x40, 0xbb, 0xd0, 0x0d, 0x14, 0x90, 0x22, 0xbb, 0x99, 0x33, 0x99, 0x8f, 0x13, 0x72, 0xc8, 0x00,
+ 0xb8, 0x11, 0x33, 0xbd, 0x31, 0xa8, 0x2a, 0xc0, 0x20, 0xcc, 0x44, 0xb2, 0x1d, 0x84, 0x0c, 0x80,
+ 0x29, 0x98, 0x94, 0x00, 0x09, 0xa9, 0xb1, 0x03, 0x7a, 0x13, 0xc9, 0xba, 0x48, 0xb2, 0x4a, 0xb8,
+ 0x72, 0x90, 0x43, 0xd9, 0xba, 0x71, 0xa8, 0x01, 0x09, 0xf3, 0x28, 0x01, 0x1b, 0x22, 0x08, 0xb1,
+ 0x39, 0xf0, 0x2f, 0x01, 0x2a, 0xc1, 0x09, 0x00, 0x01, 0x09, 0xf1, 0x12, 0x19, 0xb0, 0x17, 0x28,
+ 0xab, 0x0a, 0x17, 0x9a, 0x00, 0x89, 0x78, 0xa1, 0x0a, 0xa2, 0x81, 0x1a, 0x9e, 0x97, 0x09, 0x00,
+ 0x8a, 0x82, 0x8a, 0x08, 0x34, 0xc0, 0x41, 0xdb, 0x39, 0x83, 0x00, 0x9a, 0x15, 0xbb, 0x30, 0x52,
+ 0xb1, 0x08, 0x20, 0xdf, 0x12, 0x82, 0xa4, 0x92, 0xaf, 0x04, 0x88, 0x38, 0x19, 0xf2, 0x1a, 0x89,
+ 0x05, 0x1a, 0x91, 0x1c, 0xb3, 0x0b, 0x27, 0x98, 0x88, 0x89, 0x29, 0x0c, 0x85, 0x29, 0x5b, 0xb1,
+ 0x08, 0x01, 0x09, 0xcb, 0x92, 0x32, 0xa4, 0xcb, 0x3f, 0xa9, 0x11, 0x25, 0xab, 0x06, 0x19, 0x9a,
+ 0x3a, 0x13, 0x8f, 0x87, 0x28, 0xab, 0x00, 0xa2, 0x39, 0x8a, 0x58, 0xb1, 0x19, 0x1c, 0x9f, 0x13,
+ 0x98, 0x24, 0x1a, 0x95, 0x9a, 0x89, 0x32, 0xf1, 0x2b, 0x94, 0x2b, 0xa4, 0x1f, 0x02, 0x89, 0xa0,
+ 0x63, 0x18, 0xc9, 0x81, 0x1c, 0x92, 0x1a, 0x34, 0xbb, 0x81, 0xac, 0x32, 0x82, 0xc4, 0xb0, 0x3c,
+ 0x1d, 0x00, 0x18, 0x00, 0xb2, 0x9c, 0x37, 0xb9, 0x18, 0x94, 0x49, 0xa9, 0x81, 0x1c, 0xa2, 0x03,
+ 0x4a, 0xdd, 0x33, 0xb9, 0x2a, 0xc2, 0x23, 0x3c, 0xd1, 0x81, 0x89, 0x10, 0x3e, 0x06, 0x89, 0x09,
+ 0xc9, 0xb3, 0x1d, 0x13, 0x82, 0x3c, 0xe2, 0x39, 0x19, 0x90, 0xb8, 0x27, 0x2b, 0xa8, 0x9a, 0xa6,
+ 0x2a, 0x98, 0x06, 0x98, 0x2b, 0x12, 0xbc, 0x83, 0x0f, 0x30, 0xb3, 0x40, 0xeb, 0x8a, 0x23, 0xa3,
+ 0x68, 0xc0, 0x11, 0xaa, 0x51, 0xb0, 0x22, 0xa0, 0xa1, 0x1f, 0x10, 0xda, 0x91, 0x84, 0x3c, 0x93,
+ 0xab, 0x53, 0x0b, 0x8a, 0xb0, 0x17, 0x8b, 0x20, 0xa1, 0x0a, 0x84, 0x90, 0x2b, 0x31, 0x1a, 0x1b,
+ 0x20, 0x09, 0xef, 0x22, 0x5b, 0xb9, 0xc5, 0x18, 0xb2, 0x19, 0x04, 0x62, 0xa9, 0x3a, 0xb1, 0x6d,
+ 0x88, 0x92, 0x29, 0xc9, 0xa1, 0x3d, 0xb1, 0x38, 0x91, 0xdb, 0x42, 0x05, 0xac, 0x10, 0x02, 0x1b,
+ 0xb0, 0x17, 0xaa, 0x18, 0x92, 0x9a, 0x6d, 0x84, 0x90, 0x98, 0x00, 0x2d, 0x99, 0xc2, 0x30, 0x00,
+ 0x85, 0x88, 0x3d, 0xc0, 0x99, 0x04, 0x99, 0x23, 0x9c, 0x04, 0x9c, 0xc3, 0x4a, 0x99, 0x43, 0x98,
+ 0x48, 0xc8, 0x08, 0x58, 0xaa, 0x95, 0x31, 0x9f, 0x02, 0xa0, 0x03, 0x0a, 0x10, 0xf8, 0x21, 0x8b,
+ 0x01, 0xaa, 0x21, 0x8f, 0x04, 0x0a, 0x2b, 0x00, 0x91, 0x1b, 0x7a, 0xb1, 0x20, 0xda, 0x72, 0x88,
+ 0x91, 0x88, 0x40, 0x09, 0xa0, 0x0b, 0xa5, 0x81, 0x49, 0xf2, 0x1b, 0x59, 0xa1, 0x99, 0x34, 0xcb,
+ 0x31, 0xa1, 0x89, 0x5c, 0x01, 0xab, 0x04, 0x99, 0x2a, 0x8a, 0xa4, 0x29, 0x27, 0xe9, 0x31, 0x0c,
+ 0x81, 0xa0, 0xc1, 0x50, 0xb8, 0x5a, 0x88, 0x88, 0xa8, 0x85, 0x88, 0x22, 0xc8, 0x20, 0xa3, 0x8b,
+ 0xb2, 0x37, 0x88, 0x10, 0xa5, 0x8e, 0x81, 0x8c, 0x82, 0x61, 0xb9, 0x02, 0xb8, 0x1b, 0x04, 0x0a,
+ 0xee, 0xff, 0x17, 0x00, 0x20, 0x97, 0x0c, 0x83, 0x19, 0x18, 0x28, 0xe9, 0x20, 0x14, 0x9c, 0xa8,
+ 0x0a, 0x10, 0xc2, 0x92, 0x70, 0x88, 0x09, 0xc1, 0x58, 0x01, 0x0f, 0xa2, 0x28, 0xa1, 0x9a, 0x29,
+ 0x88, 0xa0, 0xa3, 0x7b, 0x1c, 0xb6, 0x40, 0x90, 0x8a, 0x90, 0x28, 0x8b, 0xa9, 0xa3, 0x07, 0x98,
+ 0x21, 0x1c, 0xa8, 0x5d, 0x13, 0xc4, 0x28, 0x00, 0xe8, 0x8b, 0xb0, 0x88, 0x78, 0x01, 0xa8, 0x78,
+ 0xa0, 0x80, 0x01, 0x89, 0x12, 0x9a, 0x8f, 0x29, 0x05, 0xaa, 0x12, 0xf9, 0x01, 0x38, 0x28, 0xb8,
+ 0x1b, 0x8a, 0x87, 0x7b, 0x88, 0xa0, 0x02, 0x2a, 0x00, 0x1b, 0x97, 0x1b, 0x90, 0x84, 0xa1, 0x11,
+ 0x90, 0x3e, 0x91, 0x92, 0xbc, 0x3e, 0xb4, 0x2b, 0x08, 0xc0, 0x44, 0xc8, 0x39, 0x4a, 0xa4, 0x89,
+ 0x0c, 0x12, 0xc0, 0x2a, 0x28, 0x10, 0xa7, 0x29, 0xb2, 0x00, 0x02, 0xaf, 0x02, 0x3d, 0x91, 0x20,
+ 0xae, 0x41, 0x9a, 0x94, 0x09, 0x24, 0xbb, 0xa8, 0x88, 0x32, 0xc0, 0x97, 0x3a, 0x40, 0xc9, 0x19,
+ 0xd0, 0x3a, 0x05, 0x80, 0xa0, 0x71, 0xc0, 0x1a, 0x10, 0x10, 0x92, 0x9a, 0x98, 0x90, 0xb8, 0x53,
+ 0x3a, 0x9e, 0x82, 0x38, 0xf0, 0x2c, 0x07, 0x1a, 0x01, 0x8a, 0x92, 0x1b, 0xa9, 0x27, 0x98, 0x9a,
+ 0x52, 0x90, 0x9e, 0x20, 0x81, 0x29, 0x92, 0x0f, 0xa2, 0x8b, 0x6a, 0x04, 0x89, 0x88, 0x20, 0x09,
+ 0x2a, 0xf2, 0x3a, 0x90, 0x0a, 0x16, 0x9b, 0x88, 0x2a, 0x80, 0x85, 0x33, 0xc0, 0x20, 0x8f, 0x93,
+ 0x50, 0x99, 0x91, 0xc0, 0x39, 0x00, 0x99, 0x82, 0x46, 0x8b, 0x2b, 0xa6, 0x0a, 0xc2, 0x1a, 0x81,
+ 0xb8, 0x00, 0x59, 0x9a, 0xc4, 0x48, 0x92, 0x30, 0x2b, 0xf2, 0x1d, 0x01, 0x28, 0xc8, 0xa1, 0x50,
+ 0x8c, 0x23, 0xcb, 0x61, 0x8a, 0x01, 0xa0, 0x43, 0xdb, 0x18, 0x19, 0x19, 0x02, 0xe8, 0x48, 0x90,
+ 0xc1, 0xff, 0x19, 0x00, 0x00, 0x89, 0x08, 0x07, 0x3a, 0x91, 0x1c, 0xb9, 0x34, 0x4b, 0xc3, 0x40,
+ 0x98, 0x10, 0xe4, 0x0c, 0x10, 0xab, 0x41, 0xd4, 0x2b, 0xa2, 0x88, 0x80, 0x39, 0x31, 0xa7, 0x18,
+ 0x99, 0x80, 0x18, 0x83, 0x27, 0x13, 0xff, 0x21, 0x89, 0x80, 0xa1, 0x31, 0x9c, 0xa3, 0x9c, 0x83,
+ 0x09, 0x49, 0xa8, 0x07, 0x1a, 0x80, 0x90, 0x8b, 0x12, 0x33, 0xd2, 0x3d, 0xa5, 0x2c, 0x89, 0x93,
+ 0x29, 0xc2, 0x6a, 0x84, 0x9d, 0x00, 0x10, 0xa0, 0x10, 0x00, 0xe0, 0x01, 0xa9, 0x3a, 0x94, 0x24,
+ 0xe3, 0x0a, 0x29, 0x99, 0x83, 0x78, 0x94, 0xa0, 0xba, 0x0b, 0x24, 0x49, 0xba, 0x26, 0xb0, 0xaa,
+ 0x82, 0x79, 0x00, 0x19, 0x28, 0xf1, 0x0a, 0x29, 0xa0, 0x99, 0x4a, 0x17, 0x08, 0xcb, 0x01, 0x28,
+ 0x39, 0x92, 0xb3, 0xa0, 0x79, 0xf2, 0x20, 0x8c, 0x00, 0x02, 0xa0, 0x50, 0x99, 0x2b, 0xca, 0x03,
+ 0x93, 0x0f, 0x32, 0xac, 0xc0, 0x25, 0xa8, 0x11, 0x22, 0x09, 0xbf, 0x82, 0x08, 0x23, 0xb8, 0x7a,
+ 0xe8, 0xb3, 0x3b, 0x10, 0xa4, 0x10, 0x1c, 0x09, 0xc0, 0x3a, 0x82, 0xab, 0x86, 0x3d, 0xb2, 0x1a,
+ 0x22, 0x92, 0x9e, 0x17, 0xa9, 0x10, 0x89, 0xa9, 0x31, 0x20, 0x1b, 0xf1, 0x94, 0x98, 0x2f, 0x90,
+ 0xa1, 0x42, 0x8c, 0x03, 0x1c, 0x19, 0x90, 0x80, 0x18, 0x07, 0x2a, 0xa1, 0x99, 0x7a, 0xd8, 0x81,
+ 0x20, 0x90, 0x9a, 0x11, 0x1e, 0x43, 0x0c, 0x84, 0x99, 0x09, 0x31, 0xcd, 0x20, 0x11, 0xd8, 0x81,
+ 0x13, 0x0f, 0x01, 0x90, 0x49, 0x80, 0x88, 0x04, 0x9e, 0x02, 0x89, 0x10, 0x99, 0x52, 0xda, 0xb0,
+ 0x14, 0x80, 0x30, 0xf1, 0x48, 0x8b, 0x92, 0xb9, 0x48, 0x00, 0x58, 0x08, 0xa2, 0x09, 0x91, 0x3c,
+ 0x87, 0x2c, 0x19, 0xd1, 0x08, 0xaa, 0x21, 0x98, 0x28, 0x71, 0x88, 0x91, 0xea, 0x20, 0x11, 0x8c,
+ 0xfa, 0xff, 0x18, 0x00, 0x05, 0x9b, 0xa2, 0x08, 0x1e, 0x12, 0x08, 0x00, 0xa0, 0x0f, 0x97, 0x88,
+ 0xa8, 0x22, 0x19, 0xa8, 0x87, 0x1e, 0x80, 0xb8, 0x23, 0x09, 0x92, 0x30, 0xfa, 0x19, 0x84, 0x3a,
+ 0xc2, 0x38, 0xfa, 0x20, 0x80, 0x02, 0xaa, 0x19, 0x14, 0x9d, 0x89, 0x88, 0xa4, 0x4b, 0xa2, 0x23,
+ 0x99, 0x8d, 0x02, 0x9c, 0x71, 0x18, 0x38, 0xf3, 0x90, 0x20, 0x8c, 0x01, 0xb3, 0x80, 0x28, 0xa8,
+ 0x1f, 0xc3, 0x50, 0x29, 0x22, 0xeb, 0x09, 0xc0, 0x28, 0x6b, 0xb1, 0x10, 0x02, 0xa9, 0x1b, 0x29,
+ 0x9a, 0x65, 0x83, 0x19, 0xd0, 0x8e, 0x02, 0x39, 0xa3, 0x4a, 0xb3, 0x9d, 0x18, 0xac, 0x25, 0x91,
+ 0x8c, 0x22, 0x9b, 0x28, 0xb9, 0x42, 0x0b, 0x52, 0xa2, 0xa4, 0x9e, 0x23, 0x2c, 0x85, 0x3a, 0xb8,
+ 0xa1, 0x0b, 0x2d, 0xa7, 0x28, 0x01, 0x19, 0xfa, 0x01, 0x88, 0x2b, 0x82, 0xb0, 0x17, 0xa9, 0x0c,
+ 0xa2, 0x78, 0x90, 0x01, 0x41, 0xc9, 0x8a, 0x80, 0x82, 0x50, 0x89, 0xb8, 0xa1, 0x9a, 0x78, 0xa0,
+ 0x13, 0x40, 0x80, 0xd8, 0x8a, 0x02, 0x83, 0x3a, 0x8f, 0x07, 0x1b, 0x00, 0x9c, 0x12, 0x90, 0x81,
+ 0x12, 0xaf, 0x23, 0x89, 0xac, 0x16, 0x30, 0xcb, 0x3a, 0x93, 0x3c, 0xe0, 0x82, 0x2b, 0xb2, 0x20,
+ 0xd2, 0x18, 0x91, 0x99, 0x18, 0x0c, 0x16, 0xaa, 0x2a, 0x04, 0x59, 0xc3, 0x38, 0xca, 0x85, 0x1c,
+ 0x98, 0xa1, 0x41, 0x08, 0x09, 0xb9, 0x43, 0x4a, 0x9a, 0xf4, 0x18, 0x3a, 0xc1, 0x18, 0x9a, 0x80,
+ 0x37, 0x0f, 0x81, 0x08, 0x01, 0x3b, 0xc0, 0x10, 0x11, 0x9c, 0x97, 0x0c, 0x00, 0x88, 0x20, 0xa2,
+ 0x2e, 0x91, 0x02, 0x8d, 0x51, 0xb9, 0x24, 0x99, 0x1b, 0xd1, 0x19, 0x08, 0x23, 0xc1, 0x3a, 0x80,
+ 0x00, 0x91, 0x9f, 0x85, 0x99, 0x39, 0xb9, 0xa6, 0x20, 0x5b, 0xb0, 0x11, 0x84, 0x00, 0xd9, 0x4b,
+ 0xe4, 0xff, 0x17, 0x00, 0x8d, 0x32, 0xe2, 0x4a, 0x91, 0xb8, 0x30, 0x1d, 0x84, 0x09, 0x81, 0x80,
+ 0x10, 0xca, 0x24, 0x0d, 0x91, 0x84, 0xb8, 0x3e, 0xc0, 0x23, 0x8b, 0x21, 0xba, 0x05, 0x0a, 0xb0,
+ 0x81, 0x79, 0x80, 0xd3, 0x63, 0x8c, 0xa2, 0x20, 0xb2, 0x1b, 0x00, 0x0a, 0xad, 0x32, 0xab, 0x71,
+ 0xb5, 0x18, 0x01, 0xbc, 0x38, 0xd4, 0x38, 0x08, 0x01, 0xa8, 0x2a, 0x9a, 0xc2, 0x40, 0x58, 0x86,
+ 0x89, 0x9a, 0xb9, 0x07, 0x3b, 0x11, 0x8a, 0xaa, 0x04, 0xad, 0x15, 0xa4, 0x2a, 0x59, 0xc0, 0x01,
+ 0x81, 0x9c, 0x84, 0x89, 0x30, 0x0a, 0xd1, 0x09, 0x8a, 0x41, 0x81, 0x88, 0x0b, 0x80, 0xae, 0x16,
+ 0x29, 0x92, 0xd8, 0x38, 0x89, 0x9f, 0x85, 0x80, 0x28, 0x98, 0xaa, 0x73, 0xb8, 0xa1, 0x2a, 0x11,
+ 0x52, 0xa3, 0x9f, 0x22, 0xc9, 0x91, 0x92, 0x33, 0x8d, 0x83, 0x9e, 0x00, 0x81, 0x80, 0x11, 0x68,
+ 0xab, 0x43, 0xae, 0x00, 0x00, 0xa8, 0x71, 0x01, 0x88, 0xb9, 0x89, 0xa1, 0x32, 0x11, 0x0f, 0x9a,
+ 0x26, 0xbb, 0x01, 0x40, 0x91, 0x13, 0x9f, 0xa1, 0x10, 0xb9, 0x42, 0x22, 0x8e, 0x06, 0x9c, 0x11,
+ 0x8a, 0x85, 0x09, 0x18, 0xd2, 0x4b, 0xa8, 0x1a, 0x63, 0xd0, 0x2a, 0x13, 0xac, 0x10, 0x81, 0x0d,
+ 0x05, 0x08, 0x0b, 0x01, 0xf0, 0x29, 0x03, 0x88, 0x21, 0xb3, 0xad, 0x30, 0xb1, 0x91, 0x10, 0x82,
+ 0x30, 0xec, 0xa1, 0x5c, 0x82, 0x80, 0x38, 0x0a, 0xbf, 0x10, 0xb3, 0x1d, 0x63, 0xa9, 0x11, 0x99,
+ 0x1a, 0x2e, 0x97, 0x28, 0x08, 0xbb, 0x81, 0xa1, 0x4a, 0x05, 0xaa, 0x10, 0x07, 0xaa, 0x02, 0x82,
+ 0x8b, 0x2c, 0xb3, 0xa3, 0x7a, 0xbc, 0x92, 0x02, 0x29, 0x20, 0x4a, 0xf4, 0x29, 0xa0, 0x88, 0x82,
+ 0x51, 0x02, 0x0b, 0xad, 0x12, 0xbb, 0x95, 0x33, 0x5e, 0x08, 0xc8, 0x00, 0x89, 0x00, 0xa3, 0x00,
+ 0x28, 0x00, 0x13, 0x00, 0xa2, 0xb6, 0x9e, 0x01, 0x39, 0x05, 0x29, 0xd8, 0xb9, 0x30, 0x30, 0x81,
+ 0xc1, 0x19, 0x0f, 0x91, 0x82, 0x58, 0xb0, 0x02, 0x9a, 0xd4, 0x6a, 0x98, 0x2b, 0x84, 0x88, 0x39,
+ 0x96, 0xba, 0x28, 0xa2, 0x80, 0x7c, 0x92, 0xa9, 0x00, 0xd9, 0x39, 0xa1, 0x35, 0x1e, 0x80, 0x0a,
+ 0xa8, 0x02, 0x23, 0x9b, 0x10, 0x01, 0x2d, 0xb7, 0x8b, 0x80, 0x70, 0xa1, 0x08, 0xd0, 0x88, 0x92,
+ 0x2b, 0x84, 0x03, 0x00, 0xac, 0x08, 0x0e, 0x02, 0x54, 0x82, 0xcb, 0x19, 0x80, 0xfa, 0x43, 0x91,
+ 0x2b, 0x20, 0x8b, 0xc9, 0x12, 0x1e, 0x33, 0xd1, 0x01, 0xba, 0xab, 0x71, 0x08, 0x00, 0x98, 0x82,
+ 0xb1, 0x68, 0x0a, 0xe0, 0x01, 0x2a, 0x1a, 0x37, 0x8f, 0x82, 0x98, 0x2a, 0x82, 0x19, 0x90, 0xb2,
+ 0xae, 0x10, 0x28, 0x15, 0x1a, 0x92, 0x9e, 0x29, 0x86, 0x90, 0x29, 0xca, 0x34, 0x99, 0x09, 0x80,
+ 0x91, 0x3b, 0x46, 0xc8, 0x89, 0x04, 0xaa, 0x6b, 0x0a, 0x84, 0x48, 0xc0, 0x00, 0x90, 0x81, 0x02,
+ 0x9c, 0x39, 0x0f, 0x91, 0x38, 0xab, 0x13, 0x95, 0x59, 0xb8, 0x28, 0xc9, 0x28, 0x44, 0x89, 0x0e,
+ 0x83, 0x99, 0xb0, 0x3d, 0x02, 0x81, 0x32, 0x0d, 0xc8, 0x82, 0x8f, 0x30, 0x80, 0x11, 0x3b, 0xc0,
+ 0xbb, 0x34, 0xb0, 0x57, 0xb8, 0x58, 0x90, 0xab, 0x82, 0x02, 0x13, 0x0b, 0x81, 0xee, 0x88, 0x09,
+ 0x18, 0x02, 0x3b, 0x00, 0x23, 0xf5, 0x3a, 0xaa, 0x52, 0xb8, 0x08, 0x81, 0x94, 0x18, 0xc2, 0x68,
+ 0xb3, 0x4d, 0xa2, 0x8a, 0xb9, 0x13, 0x59, 0x38, 0xf8, 0x89, 0x12, 0x0f, 0xa4, 0x28, 0x08, 0x10,
+ 0xf8, 0x11, 0x8a, 0x11, 0x90, 0x10, 0x08, 0xe9, 0x80, 0x00, 0x18, 0x11, 0x3d, 0x87, 0x9b, 0x00,
+ 0x98, 0x50, 0x02, 0x2c, 0x16, 0xca, 0x3a, 0xc0, 0x19, 0x32, 0xa1, 0x1b, 0x01, 0x00, 0xbe, 0x24,
+ 0x1b, 0x00, 0x14, 0x00, 0x8d, 0x92, 0x98, 0x8a, 0x43, 0x9d, 0x93, 0x25, 0x2a, 0x01, 0xd5, 0x1b,
+ 0x1a, 0x02, 0x15, 0x98, 0x99, 0x90, 0xb4, 0x2c, 0x93, 0x26, 0xca, 0xa2, 0xa0, 0x1b, 0x86, 0x1d,
+ 0x88, 0x87, 0x09, 0x18, 0xaa, 0xa0, 0x30, 0x11, 0x19, 0x8a, 0x07, 0x1a, 0xea, 0x00, 0x7a, 0x93,
+ 0x8c, 0x83, 0x8a, 0x21, 0x91, 0x42, 0x2d, 0xc4, 0x1a, 0xb3, 0x1b, 0x1a, 0x78, 0xb0, 0x21, 0xaa,
+ 0xb9, 0x8a, 0x10, 0x71, 0x83, 0x2a, 0x97, 0xa9, 0x18, 0x0a, 0x11, 0xb3, 0xb1, 0x39, 0xdd, 0x52,
+ 0xb0, 0x29, 0x03, 0x29, 0xa6, 0x1e, 0xd8, 0x1a, 0x02, 0x02, 0x38, 0x00, 0xf1, 0xe9, 0x30, 0xa0,
+ 0x30, 0x10, 0x01, 0x01, 0xeb, 0xab, 0x34, 0x3a, 0x05, 0xbc, 0x92, 0x88, 0x90, 0xb1, 0x2d, 0x16,
+ 0x8a, 0x12, 0x9b, 0xc2, 0x38, 0x18, 0x7d, 0x84, 0x98, 0xb9, 0x30, 0xbb, 0x12, 0x39, 0x98, 0x12,
+ 0xaf, 0x10, 0x0c, 0x07, 0x28, 0xb8, 0x3a, 0xf0, 0x18, 0x91, 0x8b, 0x27, 0x38, 0xab, 0x88, 0x98,
+ 0xd0, 0x70, 0x99, 0x31, 0xb1, 0x9a, 0xc1, 0x28, 0x11, 0xa2, 0x29, 0xd9, 0x43, 0x1b, 0xf0, 0x5b,
+ 0x89, 0x01, 0xd2, 0x08, 0x08, 0x2f, 0xa4, 0x30, 0xa0, 0x18, 0xc1, 0x2d, 0x93, 0x1a, 0x38, 0x84,
+ 0x8b, 0x03, 0xbf, 0x8a, 0x32, 0xa1, 0x42, 0x8b, 0x84, 0x8b, 0xf2, 0x7a, 0x00, 0x88, 0x81, 0xa8,
+ 0x1b, 0x13, 0xbe, 0x42, 0x39, 0x91, 0x1a, 0x92, 0x9b, 0x59, 0x3a, 0x01, 0x15, 0xb9, 0xc9, 0x90,
+ 0xb8, 0x7a, 0x17, 0x1b, 0xa8, 0x02, 0xb8, 0x1e, 0x31, 0xd0, 0x3a, 0x80, 0x08, 0xe1, 0xb8, 0x43,
+ 0x0d, 0x04, 0x80, 0x49, 0x98, 0xca, 0x10, 0x43, 0x01, 0x0c, 0x29, 0xfa, 0x10, 0x00, 0x13, 0xa0,
+ 0x91, 0x3a, 0xef, 0x18, 0x83, 0x19, 0x22, 0xea, 0x91, 0x30, 0x9a, 0x2a, 0x53, 0xe1, 0x90, 0x68,
+ 0x07, 0x00, 0x1c, 0x00, 0x89, 0x18, 0xb1, 0x02, 0x38, 0x98, 0x2f, 0xb0, 0x21, 0x03, 0x3a, 0xf0,
+ 0x20, 0x88, 0x0f, 0x89, 0x04, 0x02, 0x89, 0xc0, 0x19, 0x2d, 0x84, 0x09, 0x81, 0x50, 0x80, 0xab,
+ 0xa4, 0x1b, 0x8b, 0xb7, 0x50, 0x08, 0xd0, 0x00, 0x09, 0x9c, 0x21, 0x22, 0x19, 0xd8, 0x1c, 0xb3,
+ 0x23, 0x3d, 0x97, 0x89, 0x20, 0xc1, 0x19, 0x01, 0xd9, 0x23, 0x2a, 0xab, 0x49, 0xf0, 0x2a, 0x90,
+ 0x12, 0xb4, 0x40, 0x1a, 0x08, 0x03, 0xae, 0x07, 0x08, 0x89, 0x11, 0xac, 0x81, 0xa1, 0x0c, 0xa3,
+ 0x82, 0x18, 0x2e, 0x90, 0x21, 0xcb, 0x68, 0x01, 0x12, 0xa1, 0xf8, 0x69, 0x08, 0xa0, 0x00, 0xbc,
+ 0x51, 0x88, 0x00, 0x48, 0x99, 0x00, 0xb1, 0x18, 0x8d, 0x05, 0x2a, 0x94, 0x90, 0x69, 0xbb, 0x42,
+ 0xc1, 0x1b, 0x98, 0x02, 0x32, 0x0b, 0x98, 0xcc, 0x07, 0x83, 0x98, 0x2b, 0xb5, 0xd1, 0x20, 0xca,
+ 0x21, 0x08, 0xc7, 0x48, 0x9a, 0xaa, 0x31, 0x33, 0x3a, 0xe0, 0xd0, 0x91, 0x19, 0x08, 0x2d, 0xa3,
+ 0x86, 0x10, 0x9a, 0x89, 0x17, 0x0c, 0x10, 0x00, 0xb9, 0x00, 0x02, 0x0c, 0x04, 0x09, 0x48, 0xab,
+ 0x91, 0x0b, 0x72, 0x01, 0xb3, 0xa8, 0x8f, 0xa9, 0xa5, 0x19, 0x64, 0x81, 0x0d, 0x80, 0x9a, 0x11,
+ 0xc2, 0x30, 0x00, 0x2c, 0x99, 0xd3, 0x29, 0x09, 0x24, 0x97, 0x1b, 0xd3, 0x2a, 0x00, 0x08, 0x01,
+ 0x33, 0xe1, 0x8b, 0x01, 0xab, 0x9c, 0x47, 0xa1, 0x89, 0xa0, 0x0b, 0x25, 0xbb, 0x51, 0x19, 0xaa,
+ 0x34, 0xc9, 0x0a, 0x89, 0x12, 0x25, 0xb8, 0x78, 0x9b, 0xa8, 0xb4, 0x02, 0x44, 0xa9, 0x1d, 0x94,
+ 0x0f, 0x10, 0x88, 0x01, 0x98, 0x82, 0x80, 0x1c, 0x30, 0x81, 0x9b, 0x1b, 0x04, 0x17, 0xbb, 0x32,
+ 0xf2, 0x99, 0x40, 0x88, 0x9b, 0xb4, 0x90, 0x3e, 0x04, 0xb9, 0x40, 0x02, 0x8a, 0x0c, 0x81, 0x99,
+ 0x28, 0x00, 0x0d, 0x00, 0x05, 0xbd, 0x39, 0x14, 0x2d, 0x99, 0x11, 0xaa, 0x70, 0xd0, 0x08, 0x91,
+ 0x88, 0x10, 0xa2, 0xb2, 0x3f, 0xa0, 0x03, 0x3a, 0x04, 0x8d, 0xa8, 0x13, 0x2e, 0xc9, 0x32, 0x1b,
+ 0x93, 0x0b, 0x92, 0x03, 0xf8, 0x18, 0x70, 0x91, 0x1c, 0xb2, 0x22, 0x9b, 0x91, 0x87, 0x41, 0xba,
+ 0x2a, 0x59, 0xec, 0x21, 0x10, 0xa1, 0xa9, 0x15, 0xbc, 0x0a, 0x12, 0x12, 0x2a, 0xb0, 0x84, 0xaa,
+ 0x1f, 0x93, 0x32, 0xbc, 0x78, 0x90, 0x99, 0x91, 0x28, 0x51, 0x70, 0xc8, 0x01, 0x0e, 0x81, 0x80,
+ 0x11, 0x09, 0x3a, 0xb3, 0xaf, 0x30, 0x90, 0x02, 0xa3, 0x28, 0xea, 0x39, 0x91, 0x34, 0xb3, 0x5c,
+ 0xd0, 0x91, 0x2b, 0xa3, 0x0a, 0x23, 0xf8, 0x00, 0x09, 0xfa, 0x48, 0xb1, 0x3a, 0xb3, 0x70, 0xa0,
+ 0x89, 0x18, 0x0a, 0x92, 0x10, 0xc0, 0x12, 0x01, 0x0c, 0xa7, 0x5d, 0x81, 0x88, 0x32, 0xe8, 0x0a,
+ 0x09, 0x91, 0x52, 0xb0, 0x10, 0x98, 0xbd, 0x68, 0xa1, 0x92, 0x30, 0xf8, 0x39, 0x82, 0x1d, 0xb8,
+ 0x51, 0xb2, 0x18, 0xa9, 0xc8, 0x83, 0x1a, 0x22, 0x3a, 0x11, 0xd7, 0x2b, 0x19, 0x11, 0x97, 0x38,
+ 0x1a, 0xc9, 0x89, 0x89, 0x13, 0x93, 0x42, 0x06, 0x8f, 0x90, 0x00, 0x90, 0x3b, 0x11, 0xb8, 0x47,
+ 0xab, 0x0b, 0x83, 0xb9, 0x10, 0x15, 0x9a, 0x96, 0x8f, 0x10, 0xa2, 0x11, 0x11, 0xab, 0x9a, 0x07,
+ 0xca, 0x41, 0x81, 0x12, 0x1b, 0xda, 0x19, 0x13, 0xfa, 0x22, 0x82, 0x89, 0xd8, 0x19, 0x89, 0x29,
+ 0x3a, 0x97, 0x80, 0x7b, 0xc0, 0x90, 0x91, 0x29, 0x33, 0xd4, 0x99, 0x19, 0x91, 0x39, 0xb0, 0x37,
+ 0xca, 0x43, 0xfa, 0x49, 0x89, 0x28, 0x88, 0xa2, 0x40, 0x08, 0xc0, 0x40, 0xa9, 0x31, 0xb3, 0x8f,
+ 0x12, 0xa9, 0x8c, 0x49, 0x14, 0xa9, 0x82, 0xac, 0x31, 0x9a, 0x0d, 0x21, 0x17, 0xc9, 0x88, 0x09,
+ 0xd7, 0xff, 0x14, 0x00, 0x80, 0x10, 0x00, 0x90, 0x6d, 0xb9, 0x23, 0xa9, 0x17, 0x88, 0x01, 0xae,
+ 0x28, 0xc2, 0x1a, 0x20, 0x93, 0x21, 0xbc, 0x03, 0x3f, 0x88, 0xa1, 0x79, 0x02, 0xa8, 0x99, 0xa1,
+ 0x8b, 0x50, 0xb0, 0x6b, 0xb3, 0x0b, 0x5a, 0xc8, 0x01, 0x82, 0x29, 0xbd, 0x05, 0x0b, 0x13, 0x2a,
+ 0x28, 0x47, 0xba, 0x0b, 0x31, 0x8d, 0x19, 0x07, 0x08, 0x98, 0xa9, 0xc9, 0x51, 0x11, 0x2c, 0xa3,
+ 0x29, 0x92, 0x9f, 0x02, 0x89, 0x25, 0x1b, 0xe1, 0x08, 0x9b, 0x03, 0x00, 0x05, 0x80, 0x69, 0x8a,
+ 0xd1, 0x4a, 0x10, 0x00, 0x00, 0xb8, 0x1b, 0xb0, 0xc3, 0x29, 0x74, 0xa2, 0x90, 0x8f, 0x91, 0x8a,
+ 0x31, 0x08, 0x73, 0xc9, 0x09, 0xb8, 0x24, 0x91, 0x00, 0x00, 0x0b, 0x92, 0x08, 0x39, 0x75, 0xa1,
+ 0x84, 0xcc, 0x50, 0xc0, 0x8b, 0x22, 0x3b, 0xb2, 0x58, 0xc0, 0x21, 0x8c, 0x19, 0x16, 0x88, 0x0a,
+ 0x80, 0xf9, 0x88, 0x02, 0x00, 0x21, 0xab, 0xbb, 0xa0, 0x27, 0x3b, 0x2b, 0x9a, 0x87, 0x83, 0x1f,
+ 0x88, 0xb0, 0x14, 0x08, 0x21, 0xb3, 0x9f, 0x19, 0xb1, 0x62, 0x89, 0x08, 0x2a, 0x91, 0xf8, 0x00,
+ 0x58, 0x81, 0x1a, 0x80, 0x80, 0xa4, 0xa9, 0x28, 0x8b, 0x33, 0x04, 0x9f, 0xa3, 0x9f, 0x01, 0x03,
+ 0x32, 0x9c, 0x12, 0x94, 0x9d, 0x01, 0x0a, 0x20, 0xe8, 0x3c, 0xc0, 0xa9, 0x91, 0x43, 0x5b, 0x23,
+ 0xe9, 0x90, 0x00, 0x4c, 0xa2, 0x62, 0x90, 0x2a, 0x98, 0xbb, 0x10, 0x70, 0xb1, 0x81, 0x1b, 0xd1,
+ 0x39, 0x09, 0x13, 0x40, 0xb2, 0x4d, 0xa8, 0x02, 0xcc, 0x92, 0x32, 0x89, 0x86, 0x0d, 0xba, 0x82,
+ 0x99, 0x54, 0x98, 0x23, 0xcb, 0x10, 0x10, 0xcb, 0x04, 0x71, 0xd8, 0x01, 0xa8, 0x18, 0xa2, 0x38,
+ 0x1b, 0xd4, 0x2c, 0x91, 0x9a, 0x21, 0x87, 0x19, 0x00, 0x08, 0x11, 0xcc, 0x91, 0x40, 0x32, 0x2e,
+ 0x6f, 0x00, 0x13, 0x00, 0xcd, 0x39, 0xa2, 0x0c, 0x12, 0x00, 0xaa, 0x84, 0x9f, 0x22, 0xa9, 0x91,
+ 0x6a, 0x91, 0x91, 0x80, 0xa9, 0x69, 0xa1, 0x31, 0x91, 0x09, 0xe8, 0x0d, 0x82, 0x53, 0x91, 0x19,
+ 0xf8, 0x10, 0x8b, 0x29, 0x93, 0x2c, 0x02, 0xcb, 0x81, 0x18, 0x00, 0x75, 0xa2, 0x8d, 0x92, 0x91,
+ 0x2a, 0x00, 0x10, 0x33, 0xfb, 0x20, 0xca, 0x2a, 0xa9, 0x79, 0x04, 0x0b, 0xf3, 0x28, 0xa0, 0x18,
+ 0x93, 0x3b, 0xa5, 0x2b, 0xe1, 0x11, 0x09, 0x29, 0xd2, 0x28, 0xb4, 0x3b, 0x29, 0xb5, 0x8c, 0x02,
+ 0x20, 0xc8, 0x43, 0x99, 0x9d, 0x84, 0x40, 0xb8, 0x1a, 0x94, 0x8b, 0x03, 0x0e, 0x33, 0xa9, 0xe9,
+ 0x38, 0x92, 0x3a, 0xa1, 0x0b, 0xb1, 0x17, 0xaf, 0x13, 0x08, 0xb8, 0x52, 0x80, 0x38, 0x0a, 0x8c,
+ 0xa5, 0xc0, 0x50, 0x00, 0x90, 0xab, 0x92, 0xb4, 0x38, 0x6d, 0x92, 0x91, 0x8b, 0x0c, 0x43, 0xe9,
+ 0x20, 0x80, 0x1d, 0x82, 0xe9, 0x1a, 0x32, 0x28, 0xb1, 0x93, 0x28, 0x2b, 0xdb, 0x03, 0x3c, 0x62,
+ 0x80, 0xca, 0xa2, 0x40, 0xcc, 0x21, 0x11, 0x29, 0x14, 0x9a, 0x8a, 0x00, 0x1e, 0x15, 0xf8, 0x28,
+ 0xa1, 0x2b, 0xb9, 0xb3, 0x33, 0x50, 0x2b, 0x94, 0xf2, 0x1e, 0x02, 0xa0, 0x29, 0x81, 0xb0, 0x68,
+ 0xa9, 0x83, 0x11, 0x2b, 0xb6, 0x9a, 0x89, 0xb0, 0x4b, 0x33, 0x01, 0x87, 0x8d, 0x18, 0xb0, 0x94,
+ 0x4f, 0x81, 0x00, 0x00, 0x9b, 0xb0, 0x38, 0x91, 0x31, 0x30, 0xb9, 0xff, 0x81, 0x00, 0x98, 0x11,
+ 0x2a, 0x99, 0xf3, 0x39, 0x32, 0x80, 0x8d, 0x70, 0x94, 0xb0, 0x99, 0xb8, 0x40, 0x81, 0x2c, 0x03,
+ 0xe9, 0x98, 0x19, 0x39, 0x78, 0x94, 0x09, 0xe8, 0xa0, 0x49, 0x91, 0x08, 0xa0, 0x51, 0xf3, 0x18,
+ 0x90, 0x28, 0x10, 0xb0, 0x94, 0x52, 0xcc, 0x88, 0x10, 0x21, 0x93, 0x88, 0x9c, 0x00, 0x91, 0x5c,
+ 0x13, 0x00, 0x10, 0x00, 0x50, 0xab, 0xa8, 0xb1, 0x40, 0x0a, 0xb5, 0x7c, 0x88, 0x80, 0x01, 0x98,
+ 0x99, 0x35, 0xa9, 0x08, 0x78, 0x99, 0xb1, 0xb8, 0x82, 0x35, 0xc8, 0x3a, 0xc1, 0x8b, 0x38, 0x93,
+ 0x2a, 0x37, 0x98, 0x90, 0x0e, 0xe8, 0x21, 0x98, 0x30, 0xda, 0x04, 0x0c, 0x00, 0x22, 0xa3, 0x23,
+ 0x8d, 0x9a, 0xd0, 0x18, 0x29, 0xa3, 0x5c, 0x94, 0x9d, 0x3a, 0x91, 0x90, 0x06, 0x8c, 0x33, 0xb8,
+ 0x99, 0x12, 0x9d, 0x20, 0xa8, 0x86, 0x41, 0x90, 0xab, 0xd1, 0x22, 0x38, 0x08, 0xfa, 0x81, 0x09,
+ 0x9e, 0x04, 0x02, 0xa0, 0x7a, 0xa8, 0x08, 0xa1, 0x38, 0x01, 0x18, 0xe3, 0x01, 0x8f, 0xa1, 0x32,
+ 0x98, 0xa1, 0x1e, 0xb1, 0xba, 0x4c, 0x15, 0x98, 0x11, 0x2a, 0xb1, 0xb9, 0x7a, 0x92, 0x93, 0x2c,
+ 0x8a, 0xb2, 0x0e, 0x83, 0x18, 0xa2, 0x87, 0x8c, 0x51, 0xc0, 0x48, 0x89, 0x98, 0x13, 0xa0, 0x92,
+ 0x1e, 0x80, 0x0a, 0x05, 0xc9, 0x29, 0xa1, 0xa0, 0x59, 0xa8, 0x19, 0xa6, 0xc8, 0x12, 0x00, 0xaa,
+ 0x17, 0x98, 0x2b, 0x07, 0x8a, 0x83, 0x8c, 0xb0, 0x35, 0xa9, 0x20, 0xbb, 0x30, 0x06, 0x8e, 0x13,
+ 0x09, 0xb1, 0x00, 0x2c, 0xe2, 0x89, 0x52, 0x80, 0x8a, 0xb2, 0xb4, 0x4a, 0xcb, 0x50, 0x80, 0x00,
+ 0x10, 0xdb, 0x19, 0x60, 0x08, 0x96, 0x89, 0x01, 0x1b, 0x09, 0x83, 0xa0, 0x1e, 0x03, 0x9c, 0x40,
+ 0xd1, 0x48, 0x90, 0x08, 0x19, 0x03, 0x0f, 0x80, 0xa8, 0x03, 0x80, 0xa1, 0xd3, 0x1b, 0x6a, 0xd0,
+ 0x93, 0x78, 0x08, 0xb0, 0xa8, 0x8a, 0x12, 0x32, 0xbb, 0x39, 0x07, 0x39, 0xba, 0xa1, 0xb8, 0x27,
+ 0x20, 0xad, 0xa5, 0x1e, 0x91, 0x09, 0x14, 0x92, 0x9a, 0x49, 0xd3, 0x1b, 0x94, 0x1a, 0x01, 0xc2,
+ 0x18, 0xab, 0x98, 0x21, 0x39, 0xb0, 0x3b, 0x39, 0xf5, 0x35, 0xbc, 0xa2, 0x20, 0x29, 0x29, 0xf3,
+ 0xf8, 0xff, 0x0f, 0x00, 0xa0, 0x42, 0xa9, 0x93, 0x03, 0xba, 0x0a, 0x8f, 0x39, 0x16, 0x8b, 0xa3,
+ 0x21, 0x39, 0xfd, 0x02, 0x3a, 0xa1, 0x0c, 0xb5, 0x79, 0xaa, 0x11, 0x09, 0x08, 0x06, 0xb9, 0x4a,
+ 0x92, 0x8b, 0x06, 0x98, 0x20, 0xb8, 0x81, 0x28, 0x9d, 0x12, 0xf8, 0x58, 0xa0, 0x20, 0xaa, 0x30,
+ 0x0c, 0x1a, 0x97, 0x20, 0x99, 0xa9, 0x01, 0x88, 0x30, 0xa8, 0x07, 0x2b, 0xf9, 0x90, 0x92, 0x72,
+ 0xa1, 0x08, 0xb8, 0x3a, 0x9d, 0x33, 0x92, 0x85, 0x8b, 0xa5, 0x8b, 0x48, 0x22, 0xaa, 0xbb, 0x16,
+ 0xb1, 0x4c, 0xd0, 0x29, 0x81, 0x5b, 0xa1, 0x11, 0xf9, 0x11, 0x28, 0xa9, 0x02, 0x84, 0x9f, 0x11,
+ 0x09, 0x93, 0x4b, 0xb9, 0x22, 0xab, 0x9c, 0x88, 0x70, 0x87, 0x91, 0x09, 0xa8, 0x11, 0xb2, 0x4d,
+ 0x0a, 0x82, 0x98, 0x01, 0xf9, 0x31, 0x2c, 0x14, 0x9a, 0x09, 0x80, 0xa9, 0xda, 0x26, 0x8a, 0x2b,
+ 0x84, 0xa0, 0x9f, 0x84, 0x09, 0x02, 0x0b, 0x12, 0xb0, 0x2b, 0x99, 0x12, 0x0f, 0x23, 0xf1, 0x90,
+ 0x80, 0x30, 0xf1, 0x62, 0x99, 0x91, 0x0a, 0x05, 0x8a, 0x88, 0x01, 0x49, 0xc0, 0x38, 0xd0, 0x08,
+ 0x91, 0x09, 0x94, 0x20, 0x15, 0xab, 0xd8, 0x59, 0x18, 0xa0, 0x01, 0x49, 0xb9, 0x96, 0x1b, 0x03,
+ 0x3a, 0xbb, 0xf2, 0x19, 0x20, 0x29, 0xf3, 0x10, 0x2c, 0xa0, 0x04, 0x92, 0x89, 0x69, 0xd2, 0x11,
+ 0x3b, 0x2a, 0xa8, 0xf2, 0x99, 0x70, 0xc1, 0x28, 0x09, 0xc3, 0x1a, 0x51, 0xa9, 0x08, 0x97, 0x1b,
+ 0x89, 0x81, 0x38, 0x40, 0x90, 0xa9, 0x31, 0xfb, 0x1a, 0x39, 0xa5, 0x49, 0x3a, 0xb2, 0xa0, 0xb1,
+ 0xd1, 0x78, 0x00, 0x32, 0xab, 0xf2, 0x8a, 0x22, 0x88, 0x04, 0xa8, 0x2b, 0xfa, 0x12, 0x93, 0x1a,
+ 0x50, 0x9a, 0xb9, 0x15, 0xb9, 0xc9, 0x71, 0x80, 0xc1, 0x30, 0x99, 0x18, 0x98, 0x8b, 0x72, 0x93,
+ 0x10, 0x00, 0x0d, 0x00, 0x80, 0xfa, 0x59, 0x80, 0x90, 0x28, 0xa8, 0x93, 0xa9, 0x7a, 0x80, 0x91,
+ 0x3a, 0x07, 0x4b, 0xba, 0x90, 0x80, 0x18, 0x7b, 0x94, 0x0b, 0x91, 0x09, 0xea, 0x53, 0x91, 0x99,
+ 0x1a, 0x01, 0xd3, 0x2a, 0x5a, 0xb2, 0x2c, 0x80, 0x01, 0xba, 0x9a, 0xa2, 0x83, 0x73, 0x93, 0xba,
+ 0x7c, 0xb9, 0xa2, 0x30, 0x34, 0xd8, 0xa4, 0x3d, 0x89, 0x83, 0x92, 0x9a, 0x13, 0xe1, 0x9c, 0x10,
+ 0x11, 0x29, 0x10, 0xb5, 0x8a, 0x9a, 0xaf, 0x15, 0x21, 0x38, 0xbb, 0xd0, 0x90, 0x50, 0xd3, 0x12,
+ 0xb0, 0xcb, 0x51, 0x99, 0x8b, 0x52, 0x92, 0x23, 0xbf, 0x01, 0x83, 0x9a, 0x08, 0x90, 0x02, 0x13,
+ 0x41, 0xf1, 0xaf, 0x13, 0x08, 0x58, 0xd2, 0x20, 0x9a, 0x89, 0x04, 0x9b, 0x52, 0x08, 0xa0, 0xb0,
+ 0x3a, 0xb8, 0x71, 0xb2, 0x7a, 0xb8, 0x10, 0x91, 0x8a, 0x31, 0xc9, 0x02, 0x11, 0x02, 0xf9, 0x2e,
+ 0x11, 0x02, 0x90, 0x2e, 0xa8, 0xa1, 0x18, 0x4f, 0xa4, 0x8a, 0x03, 0x8c, 0x90, 0x20, 0x02, 0x51,
+ 0x89, 0x99, 0x10, 0x08, 0xb8, 0x0f, 0x87, 0x38, 0x9a, 0xb9, 0x01, 0x2f, 0x93, 0x28, 0x83, 0x9b,
+ 0xbd, 0x84, 0x0b, 0x00, 0xa5, 0x7a, 0xc3, 0x88, 0x19, 0x09, 0x04, 0x28, 0x09, 0x28, 0xca, 0xa1,
+ 0x20, 0x98, 0x17, 0x81, 0xaa, 0x90, 0xbf, 0x05, 0x32, 0x9a, 0xaa, 0x19, 0xb0, 0x1d, 0x5a, 0xb3,
+ 0x63, 0x9c, 0xa0, 0x50, 0x92, 0xbb, 0x48, 0x38, 0x94, 0xab, 0xa3, 0x43, 0x80, 0x8d, 0x96, 0x2b,
+ 0x14, 0xbc, 0xb8, 0x3a, 0x41, 0xd1, 0x01, 0x19, 0x11, 0x1b, 0xcf, 0x41, 0x11, 0x00, 0xa1, 0x8b,
+ 0x4a, 0x94, 0x49, 0xca, 0x20, 0xa1, 0xb9, 0x30, 0xfb, 0x10, 0x25, 0x89, 0x00, 0x02, 0x90, 0x89,
+ 0xff, 0x82, 0x10, 0x00, 0xa9, 0x19, 0xd1, 0x4a, 0x81, 0x33, 0xa4, 0x8b, 0x8f, 0x02, 0x30, 0x0c,
+ 0x0e, 0x00, 0x0d, 0x00, 0x19, 0x00, 0xbc, 0x29, 0x20, 0x31, 0xb7, 0x43, 0xbb, 0x01, 0xc8, 0x2b,
+ 0x72, 0x09, 0x2a, 0x05, 0xab, 0xa1, 0x91, 0x0d, 0x61, 0xb1, 0x00, 0xa3, 0x9b, 0x00, 0x1f, 0x19,
+ 0xc4, 0x8a, 0x28, 0x81, 0xd8, 0x40, 0xf8, 0x22, 0x18, 0x88, 0x89, 0x7b, 0xc1, 0x80, 0x10, 0x00,
+ 0x3a, 0xf9, 0x38, 0x19, 0x81, 0x82, 0x20, 0xf8, 0x2c, 0x98, 0x04, 0x2b, 0x88, 0x8a, 0xd1, 0x32,
+ 0xab, 0x28, 0x37, 0x0a, 0xaa, 0x81, 0x40, 0xd1, 0xb8, 0x82, 0xa5, 0xb3, 0x7b, 0x2a, 0xb4, 0x82,
+ 0x1c, 0x5a, 0x80, 0xc1, 0x18, 0x9a, 0x92, 0xb3, 0xab, 0x72, 0xa0, 0xbb, 0x24, 0xbb, 0x40, 0x72,
+ 0x00, 0xa1, 0xd1, 0x28, 0xc2, 0x8a, 0x5a, 0x24, 0x98, 0xd2, 0x19, 0x00, 0x9c, 0x85, 0x2b, 0x01,
+ 0x93, 0x8d, 0x81, 0x48, 0x99, 0x91, 0xa9, 0x22, 0x35, 0x0f, 0x0a, 0x03, 0x21, 0xca, 0x92, 0x49,
+ 0xea, 0xb2, 0x4b, 0x68, 0x91, 0xb1, 0x3a, 0x9e, 0x82, 0xa0, 0x54, 0xa8, 0x80, 0x08, 0x9a, 0x0b,
+ 0x84, 0x38, 0x2a, 0xf0, 0x02, 0x3d, 0x95, 0x99, 0x91, 0x4a, 0xb1, 0x8a, 0xa7, 0x09, 0x30, 0xb8,
+ 0x71, 0xab, 0x23, 0xab, 0x92, 0xc1, 0x6c, 0x90, 0x82, 0x2c, 0x82, 0x8b, 0x53, 0xcb, 0x21, 0x90,
+ 0x92, 0x18, 0x81, 0xfd, 0x20, 0x39, 0x92, 0xc2, 0x88, 0xcd, 0x10, 0x43, 0x30, 0x89, 0xd1, 0x00,
+ 0x9d, 0x38, 0x20, 0x91, 0x0a, 0x22, 0xf1, 0x39, 0x01, 0xa8, 0x05, 0x0a, 0x91, 0xd9, 0xa0, 0x91,
+ 0x4d, 0xb0, 0x09, 0xb4, 0xc2, 0x39, 0x8f, 0x80, 0x15, 0x11, 0x21, 0xf0, 0x1b, 0x11, 0x91, 0x58,
+ 0x89, 0xc2, 0x08, 0x98, 0x1c, 0x01, 0x82, 0xa4, 0xba, 0x53, 0xbd, 0x18, 0x13, 0x19, 0x17, 0xbd,
+ 0x21, 0x88, 0x10, 0x80, 0x89, 0x7b, 0xe3, 0x88, 0x21, 0x9d, 0x33, 0x98, 0x10, 0xab, 0x32, 0xcd,
+ 0xe7, 0xff, 0x0c, 0x00, 0x38, 0x07, 0x89, 0x10, 0xab, 0x84, 0xab, 0x3a, 0x15, 0xc2, 0x29, 0xc1,
+ 0x1b, 0x83, 0x9c, 0x28, 0x16, 0x8b, 0xd0, 0x80, 0x72, 0xb9, 0x30, 0x02, 0xb9, 0x23, 0x9d, 0xa4,
+ 0xa9, 0x31, 0xb5, 0x0b, 0x32, 0xc3, 0x9c, 0x54, 0x89, 0x01, 0x9c, 0x13, 0xc9, 0x81, 0x9a, 0x63,
+ 0xd8, 0x48, 0xc2, 0x2a, 0x01, 0x91, 0xc9, 0x20, 0xd2, 0x11, 0x2a, 0x01, 0x9e, 0x24, 0x9a, 0x00,
+ 0x01, 0xa4, 0x8d, 0x83, 0x78, 0xa9, 0x39, 0xd0, 0x81, 0x99, 0x7b, 0xa1, 0x31, 0xc9, 0x21, 0xb8,
+ 0x90, 0x40, 0x92, 0x2a, 0xd2, 0xc2, 0x50, 0x99, 0xda, 0x11, 0x28, 0xbb, 0x63, 0xbb, 0x51, 0xb8,
+ 0x2b, 0x17, 0x09, 0xb8, 0x33, 0xcb, 0x13, 0xa9, 0x4b, 0xb5, 0x31, 0x08, 0x93, 0x9f, 0xc3, 0x19,
+ 0x14, 0x9a, 0x13, 0xb0, 0x9b, 0xd1, 0x89, 0x44, 0x1a, 0x01, 0x1a, 0xe2, 0xc9, 0x50, 0xa4, 0x3b,
+ 0xc2, 0x00, 0x02, 0x0f, 0x91, 0x80, 0x43, 0x9a, 0x98, 0xb5, 0x0d, 0x10, 0x19, 0x22, 0xd1, 0x90,
+ 0x0e, 0x02, 0xb2, 0x79, 0x8a, 0x03, 0xa0, 0x9b, 0x60, 0x88, 0x11, 0x00, 0x98, 0xb9, 0xf8, 0x01,
+ 0x4a, 0x29, 0xa2, 0x1b, 0xb1, 0x35, 0xfb, 0x00, 0x03, 0x99, 0x50, 0xe8, 0x2a, 0x88, 0x19, 0x12,
+ 0xa3, 0x1b, 0x58, 0x10, 0x31, 0x9e, 0x83, 0xe1, 0x31, 0xc0, 0xc9, 0xb2, 0x32, 0x1b, 0xc7, 0x39,
+ 0x08, 0xb3, 0x28, 0x3b, 0x90, 0x78, 0x11, 0xaa, 0xe3, 0x19, 0xa4, 0x39, 0x13, 0xfc, 0x38, 0xa0,
+ 0x09, 0x01, 0xa5, 0x4d, 0x90, 0x09, 0x28, 0xa8, 0xa9, 0x65, 0x89, 0x29, 0xa1, 0x08, 0xc0, 0x9a,
+ 0x39, 0xd5, 0x39, 0xb4, 0x11, 0xeb, 0x29, 0x82, 0x4a, 0x24, 0xb1, 0x0a, 0xf8, 0x2a, 0x30, 0x98,
+ 0x92, 0xb2, 0x2e, 0xb0, 0x05, 0x99, 0x00, 0x09, 0x25, 0xf9, 0x01, 0x98, 0x0d, 0x92, 0x33, 0x81,
+ 0x15, 0x00, 0x08, 0x00, 0xe1, 0x0b, 0x22, 0x29, 0x8b, 0xa6, 0x49, 0x9a, 0xe1, 0x31, 0xdb, 0x32,
+ 0x80, 0xaa, 0x91, 0xc8, 0x92, 0x42, 0x29, 0x0a, 0xb5, 0x0d, 0x2c, 0x18, 0x98, 0x11, 0x47, 0xab,
+ 0x12, 0x94, 0x8f, 0x21, 0x91, 0x8b, 0x94, 0x98, 0x5a, 0xa9, 0x18, 0xa1, 0x39, 0x88, 0x17, 0xcb,
+ 0x10, 0x79, 0xa8, 0x29, 0x22, 0x9b, 0x80, 0x0a, 0x33, 0xdf, 0x41, 0x93, 0x0a, 0x1a, 0xb2, 0x2c,
+ 0x06, 0x89, 0x10, 0xaa, 0x00, 0xcb, 0x85, 0x90, 0x99, 0x44, 0x3b, 0xf2, 0x2a, 0x10, 0x81, 0xa5,
+ 0x0a, 0x23, 0x9f, 0x81, 0x12, 0x29, 0x9a, 0x13, 0x0d, 0x1a, 0x12, 0xba, 0x13, 0x0d, 0x98, 0x7b,
+ 0x94, 0x89, 0x99, 0x00, 0x7c, 0x92, 0x81, 0x89, 0x2b, 0xec, 0x95, 0x4a, 0xa8, 0x81, 0x32, 0xbc,
+ 0x12, 0x1a, 0xd2, 0x22, 0x5b, 0xd0, 0x80, 0x09, 0x3b, 0x87, 0xa9, 0x12, 0x8d, 0x10, 0x18, 0x10,
+ 0x28, 0x93, 0xba, 0xa7, 0x0f, 0x83, 0x2a, 0x00, 0x18, 0x9d, 0x85, 0x09, 0x09, 0x89, 0x59, 0xb0,
+ 0x83, 0x82, 0x08, 0x1d, 0xfb, 0x12, 0x29, 0x30, 0xb1, 0xca, 0x90, 0x21, 0x20, 0x78, 0xa8, 0x2a,
+ 0xc2, 0x0c, 0x95, 0x19, 0x13, 0x30, 0xe8, 0x1d, 0xa1, 0x2b, 0xa3, 0x49, 0x87, 0x1a, 0x99, 0x88,
+ 0x11, 0x42, 0xba, 0x31, 0xe9, 0x79, 0xd0, 0x01, 0x80, 0x29, 0x3b, 0xa0, 0xb1, 0x98, 0xa1, 0x97,
+ 0x98, 0x25, 0x2c, 0x09, 0x94, 0x1d, 0x99, 0x93, 0x49, 0x85, 0x9b, 0x23, 0x9b, 0x11, 0x13, 0x1a,
+ 0x03, 0x0f, 0x02, 0xbd, 0x2a, 0x04, 0x0c, 0x93, 0xc1, 0xa9, 0x31, 0xaa, 0x72, 0x96, 0x18, 0xb8,
+ 0xb8, 0x80, 0x5c, 0xa2, 0x01, 0x3c, 0x99, 0x02, 0x3b, 0x97, 0x38, 0xe2, 0x01, 0x31, 0xba, 0x5d,
+ 0xb1, 0x19, 0x24, 0x9b, 0xb4, 0x1b, 0xaa, 0xa8, 0x53, 0x90, 0x40, 0xe9, 0xa8, 0x02, 0x09, 0x52,
+ 0x06, 0x00, 0x08, 0x00, 0x7b, 0x98, 0xa1, 0x20, 0x1a, 0x01, 0x12, 0x8d, 0x20, 0xd1, 0xd1, 0x3b,
+ 0x09, 0xa6, 0x51, 0xb9, 0x12, 0x0e, 0x08, 0x08, 0x11, 0xb2, 0x19, 0x9a, 0x33, 0x99, 0x87, 0x2c,
+ 0x08, 0x2b, 0xa2, 0x2b, 0x06, 0xbc, 0x03, 0x63, 0xe1, 0x18, 0x20, 0x0a, 0xe0, 0x20, 0x81, 0xa2,
+ 0x7b, 0xb9, 0x91, 0x09, 0x19, 0x21, 0xc2, 0x60, 0x8c, 0xb3, 0x29, 0x4c, 0xc3, 0x00, 0x88, 0x4a,
+ 0xb1, 0x48, 0xd3, 0x08, 0x28, 0x8a, 0x87, 0x0a, 0x0c, 0x20, 0x82, 0xa0, 0x19, 0x89, 0xab, 0x3b,
+ 0x44, 0xc1, 0x08, 0x06, 0x1c, 0x08, 0xb9, 0x10, 0x90, 0x5b, 0x13, 0xfb, 0x15, 0x8b, 0x1a, 0x12,
+ 0x8a, 0x27, 0x0b, 0xa9, 0x90, 0xab, 0x87, 0x31, 0x10, 0x9b, 0xac, 0x07, 0x8b, 0x10, 0xb2, 0x7b,
+ 0x80, 0xb0, 0x8a, 0x15, 0x99, 0x01, 0x22, 0x0f, 0xa1, 0x0a, 0xb0, 0x90, 0x86, 0x18, 0x40, 0xeb,
+ 0x11, 0x81, 0x98, 0x17, 0x0a, 0x8a, 0x05, 0x0d, 0x00, 0x91, 0x2a, 0xb2, 0x19, 0xb2, 0xc0, 0x00,
+ 0x30, 0x26, 0x1c, 0x93, 0xa3, 0x8f, 0x41, 0x8d, 0x28, 0x91, 0x04, 0xda, 0x91, 0x09, 0x62, 0xa8,
+ 0x28, 0xb9, 0xa3, 0x4c, 0xa1, 0x80, 0x49, 0x0b, 0x23, 0xfc, 0x11, 0x20, 0x8b, 0x14, 0x82, 0x1d,
+ 0x91, 0xc0, 0x09, 0x1a, 0x86, 0x18, 0x08, 0xbc, 0x00, 0xb1, 0x60, 0x01, 0x02, 0x3b, 0xb9, 0xdb,
+ 0xa4, 0x80, 0x7b, 0xa2, 0x48, 0xa8, 0xba, 0x92, 0x8c, 0x59, 0x14, 0xbb, 0x41, 0x99, 0x9c, 0x37,
+ 0x9c, 0x12, 0x18, 0x08, 0x0c, 0x81, 0xc8, 0x01, 0x21, 0x61, 0xa0, 0x8b, 0x9b, 0x31, 0xf0, 0x48,
+ 0xb2, 0x0a, 0xb0, 0x89, 0x50, 0x60, 0x9b, 0x14, 0xd8, 0x38, 0xaa, 0x2e, 0x95, 0x89, 0x11, 0x80,
+ 0xaa, 0x02, 0xd0, 0x78, 0x82, 0x98, 0x20, 0xb9, 0x10, 0x89, 0x85, 0x02, 0x1b, 0x1a, 0x9f, 0xb2,
+ 0xf5, 0xff, 0x05, 0x00, 0x11, 0x7b, 0x28, 0xba, 0x93, 0x10, 0x09, 0xab, 0x7a, 0xa1, 0xa2, 0x83,
+ 0x1d, 0xb1, 0x09, 0x3b, 0x70, 0x93, 0x89, 0x93, 0x0d, 0x14, 0xc1, 0x28, 0x10, 0x00, 0xf9, 0xab,
+ 0x13, 0x0a, 0x79, 0x91, 0xa1, 0x3a, 0xb1, 0x1c, 0x30, 0xf3, 0x58, 0x09, 0x92, 0x9d, 0x12, 0x29,
+ 0x39, 0x92, 0x1d, 0x95, 0x2b, 0x0c, 0x21, 0x93, 0x01, 0xba, 0x51, 0xc8, 0x9a, 0x81, 0x60, 0x92,
+ 0x19, 0x90, 0x19, 0x0c, 0xea, 0x03, 0x39, 0xc8, 0x83, 0x9d, 0xb8, 0x35, 0xb3, 0x1b, 0x87, 0x0a,
+ 0x98, 0x01, 0x2d, 0x93, 0xb6, 0x50, 0x1b, 0xb9, 0xa4, 0x28, 0xeb, 0x42, 0xa1, 0x2c, 0x02, 0x99,
+ 0x43, 0xba, 0x10, 0x5b, 0xe1, 0x2a, 0xc1, 0x39, 0x82, 0x98, 0x32, 0x19, 0x09, 0xbd, 0x05, 0x5a,
+ 0xa2, 0x93, 0x18, 0xfa, 0xb2, 0x10, 0x0c, 0x31, 0x8c, 0x23, 0xb9, 0x85, 0x08, 0x81, 0x38, 0x92,
+ 0x1c, 0xcb, 0xbb, 0x35, 0x8e, 0x20, 0x03, 0x48, 0xd1, 0x19, 0x82, 0x1b, 0x80, 0x73, 0xa2, 0x0f,
+ 0x92, 0x18, 0x0b, 0x51, 0xb9, 0x58, 0xb0, 0x48, 0xb9, 0x31, 0x98, 0xf3, 0x39, 0x92, 0x9a, 0x01,
+ 0x2c, 0x33, 0x9b, 0x70, 0x11, 0xb1, 0x8f, 0x91, 0x89, 0x92, 0x10, 0x03, 0x0e, 0x09, 0x23, 0xf8,
+ 0x00, 0x82, 0x02, 0xbb, 0x3b, 0x3b, 0xb1, 0x87, 0x32, 0xbb, 0x03, 0xfa, 0x30, 0x5b, 0xa8, 0x13,
+ 0x02, 0x52, 0xae, 0xb2, 0x29, 0x4a, 0xc1, 0x80, 0x89, 0x0b, 0xf2, 0x22, 0x1d, 0x01, 0x99, 0x42,
+ 0xb9, 0x91, 0x26, 0x09, 0x3b, 0x92, 0xb0, 0x60, 0xc9, 0x10, 0xb8, 0x33, 0x39, 0xbb, 0x10, 0xb0,
+ 0x0f, 0x32, 0xb0, 0x06, 0xac, 0x01, 0x01, 0x9a, 0x60, 0x89, 0x81, 0x9d, 0x06, 0x98, 0x19, 0x80,
+ 0xb3, 0x7b, 0xa9, 0x48, 0x9a, 0x90, 0x9a, 0x43, 0xaa, 0x30, 0x21, 0xbb, 0x1d, 0x97, 0x10, 0x19,
+ 0x05, 0x00, 0x06, 0x00, 0x3a, 0xb5, 0x2b, 0x11, 0xb9, 0x4d, 0x95, 0xa8, 0xa2, 0x82, 0x8d, 0x39,
+ 0x20, 0x99, 0x01, 0xf9, 0x10, 0x9a, 0x92, 0x06, 0x0b, 0x00, 0x81, 0x59, 0xbb, 0x43, 0xf1, 0x49,
+ 0xb9, 0x31, 0xb0, 0x88, 0x21, 0xbb, 0x55, 0xb0, 0x19, 0x8b, 0x00, 0xb2, 0x63, 0xb8, 0x02, 0x1b,
+ 0x1e, 0xb4, 0x28, 0xd0, 0x21, 0x93, 0x1e, 0x98, 0xb1, 0x73, 0x08, 0x0d, 0x12, 0xa1, 0x2b, 0x91,
+ 0x11, 0x88, 0x0d, 0x91, 0xd1, 0x12, 0x13, 0x2d, 0xb1, 0xaa, 0x51, 0x0c, 0x90, 0x14, 0x0c, 0x31,
+ 0x81, 0x9c, 0xa9, 0x16, 0x09, 0x6b, 0xa8, 0x22, 0xab, 0x80, 0x1d, 0x05, 0x0c, 0x01, 0xb9, 0x71,
+ 0xb1, 0xa3, 0x09, 0xa8, 0x41, 0x08, 0x90, 0x2d, 0x9e, 0x39, 0xa4, 0x13, 0x1b, 0x31, 0xf9, 0x48,
+ 0xa9, 0x22, 0x10, 0xe0, 0x4a, 0x93, 0x9a, 0x39, 0xa3, 0xb4, 0x4d, 0xa1, 0x0a, 0x11, 0xaf, 0x04,
+ 0x89, 0x01, 0x81, 0x09, 0xab, 0xea, 0x12, 0x59, 0x30, 0x99, 0xd8, 0x80, 0xa9, 0xa0, 0x41, 0x73,
+ 0xb9, 0x31, 0x99, 0x91, 0xb4, 0x16, 0x10, 0x90, 0xbb, 0xb0, 0x1d, 0x33, 0x9d, 0x35, 0x9d, 0x81,
+ 0x19, 0x18, 0x2c, 0x01, 0xa9, 0xc8, 0x03, 0xb1, 0x03, 0x3b, 0xfb, 0x32, 0xd9, 0x20, 0xa4, 0x18,
+ 0x1b, 0x10, 0xab, 0xa3, 0x79, 0x91, 0xa9, 0x29, 0xab, 0x99, 0x35, 0x1c, 0x11, 0x01, 0x9d, 0x09,
+ 0x96, 0x92, 0x50, 0xaa, 0x01, 0xab, 0x30, 0x15, 0xd1, 0x30, 0x8b, 0x39, 0xfa, 0x19, 0x83, 0x90,
+ 0x99, 0x43, 0x8f, 0x03, 0x09, 0x10, 0xc2, 0x42, 0x29, 0xbc, 0xb0, 0x05, 0x1d, 0x10, 0x91, 0x92,
+ 0x1d, 0x00, 0xa9, 0x31, 0x30, 0x21, 0xd9, 0x01, 0xb3, 0x9b, 0x31, 0x12, 0x23, 0xb1, 0xab, 0xbb,
+ 0x07, 0x39, 0x38, 0xd8, 0x10, 0xe1, 0x10, 0x80, 0x20, 0x10, 0x4a, 0xca, 0x51, 0xaa, 0x1c, 0x15,
+ 0xff, 0xff, 0x08, 0x00, 0x10, 0xb2, 0x1c, 0x80, 0xb0, 0x18, 0x02, 0x50, 0xb1, 0x00, 0x0a, 0xb1,
+ 0x64, 0xc0, 0x4a, 0x93, 0x39, 0xbb, 0x13, 0x9d, 0x30, 0x3c, 0xa3, 0x0c, 0x87, 0x9b, 0xa0, 0x18,
+ 0x32, 0x29, 0xa5, 0x0a, 0xa9, 0x9c, 0x06, 0x2b, 0xa3, 0xbb, 0x73, 0x19, 0xa3, 0x8d, 0x22, 0x10,
+ 0x30, 0xf1, 0x0a, 0x00, 0x2c, 0x93, 0x86, 0x99, 0x29, 0xab, 0x91, 0x91, 0x59, 0x21, 0xbb, 0x40,
+ 0x33, 0x9f, 0x90, 0x38, 0xd3, 0x10, 0x89, 0x79, 0xb0, 0x2a, 0x90, 0x41, 0xc1, 0x2b, 0x85, 0x0d,
+ 0x21, 0x11, 0xb9, 0x91, 0x2c, 0xcb, 0x93, 0x1a, 0x27, 0x8a, 0x19, 0x03, 0x93, 0xc9, 0x4a, 0xd1,
+ 0x89, 0x0b, 0x11, 0x13, 0xc1, 0x6c, 0xa2, 0xa8, 0x31, 0x01, 0xc8, 0x29, 0xf1, 0x00, 0x82, 0x1d,
+ 0x94, 0xa9, 0x0a, 0x33, 0x96, 0x2a, 0x02, 0x99, 0xfa, 0x82, 0x9a, 0x39, 0x02, 0x92, 0x1f, 0x94,
+ 0x1a, 0xa9, 0x1a, 0x25, 0x9a, 0x80, 0xb0, 0x31, 0x9b, 0x96, 0x00, 0x32, 0xd0, 0x19, 0xda, 0x52,
+ 0x9a, 0x18, 0x22, 0xc1, 0x1a, 0x19, 0xa3, 0x9d, 0x00, 0x52, 0xb9, 0xa2, 0xb1, 0x9b, 0x07, 0xbb,
+ 0x34, 0xb1, 0x38, 0xcb, 0x92, 0x3b, 0x17, 0x29, 0xa1, 0x90, 0x1d, 0xa1, 0x00, 0x73, 0x91, 0xca,
+ 0x31, 0x99, 0x00, 0xb0, 0x9d, 0x43, 0x19, 0x90, 0x9d, 0xa4, 0x22, 0x1a, 0x30, 0xb0, 0xa3, 0xaf,
+ 0x21, 0x91, 0x1b, 0x05, 0x0c, 0x21, 0x0a, 0x94, 0x3b, 0x8d, 0x23, 0x93, 0xcb, 0x19, 0x8d, 0xb1,
+ 0x20, 0x20, 0x31, 0xb3, 0xe9, 0x01, 0x11, 0x88, 0x49, 0x2a, 0xe4, 0x3a, 0xa2, 0x8b, 0x30, 0xb2,
+ 0x50, 0xd2, 0x28, 0x0b, 0xa9, 0x18, 0x44, 0x99, 0x94, 0xba, 0x38, 0x3d, 0x91, 0xb0, 0x15, 0x0a,
+ 0xa4, 0xb9, 0x21, 0x3d, 0x81, 0xa0, 0x23, 0x9b, 0xb2, 0xbd, 0x61, 0x18, 0x11, 0xb0, 0x29, 0x00,
+ 0xfe, 0xff, 0x00, 0x00, 0xbb, 0x43, 0x4b, 0x2a, 0xd3, 0xbb, 0x11, 0x92, 0x32, 0x93, 0x59, 0x98,
+ 0xca, 0x3a, 0xb5, 0x49, 0x08, 0x08, 0x31, 0xbc, 0x29, 0x39, 0xb3, 0x1e, 0x13, 0x8c, 0x85, 0x0a,
+ 0x9a, 0x11, 0x08, 0x54, 0xb0, 0x29, 0xb3, 0x1e, 0x03, 0xaa, 0x1a, 0x19, 0xd2, 0x32, 0xac, 0x48,
+ 0xa8, 0x41, 0xd5, 0x30, 0xa9, 0x99, 0x80, 0x89, 0x05, 0x11, 0xa9, 0x29, 0xea, 0x20, 0x21, 0x02,
+ 0xac, 0x22, 0xbb, 0x2a, 0xb6, 0x99, 0x58, 0xa0, 0x81, 0x28, 0x1b, 0xa4, 0xac, 0x34, 0x91, 0x2a,
+ 0x9a, 0x99, 0x01, 0x31, 0x41, 0xd1, 0x98, 0x9a, 0x04, 0x39, 0x31, 0x93, 0xbb, 0x0d, 0xa1, 0xb2,
+ 0x3b, 0xc0, 0x62, 0x92, 0x99, 0x39, 0xc3, 0x92, 0x32, 0x1e, 0x8a, 0xa2, 0x01, 0x01, 0x9d, 0x19,
+ 0x11, 0x1a, 0x09, 0x91, 0x33, 0xb1, 0x3a, 0x19, 0x96, 0x0a, 0x91, 0x10, 0x33, 0xad, 0xd1, 0x12,
+ 0x1a, 0x92, 0x03, 0xda, 0x10, 0x18, 0x1b, 0x32, 0x87, 0x2b, 0xb9, 0x82, 0x29, 0x13, 0x24, 0x0f,
+ 0x19, 0x98, 0x93, 0x4b, 0x82, 0x4b, 0xc2, 0x0b, 0x20, 0x39, 0xd1, 0x2b, 0x98, 0x15, 0x08, 0xb8,
+ 0x33, 0x91, 0x0f, 0x21, 0xa9, 0x93, 0xa1, 0x9b, 0x11, 0x11, 0xa2, 0x3a, 0x8d, 0xa2, 0x10, 0xb0,
+ 0x43, 0xa0, 0x10, 0xdb, 0x22, 0x9c, 0x31, 0x12, 0xb1, 0x11, 0x2a, 0xa0, 0xa0, 0x12, 0x2b, 0x93,
+ 0x3a, 0x99, 0x10, 0x0d, 0x11, 0xd0, 0x21, 0x01, 0xbb, 0x1d, 0x94, 0x00, 0x9d, 0x02, 0x20, 0xf0,
+ 0x11, 0x08, 0x0b, 0x93, 0x29, 0x10, 0xb3, 0xb9, 0x3a, 0xb0, 0x09, 0x11, 0x13, 0x20, 0x19, 0xd9,
+ 0x00, 0x0a, 0x33, 0x39, 0x20, 0xca, 0x1a, 0x31, 0x12, 0xbb, 0x92, 0x12, 0x9c, 0x33, 0x1b, 0x11,
+ 0x01, 0xbb, 0x17, 0xaa, 0x01, 0x2d, 0xa3, 0x3b, 0x90, 0x11, 0xb2, 0x92, 0x10, 0x19, 0x0b, 0x13,
+ 0x06, 0x00, 0x00, 0x00, 0xdb, 0x90, 0x13, 0x1b, 0x31, 0xb3, 0x11, 0xba, 0x3b, 0xb9, 0x33, 0x92,
+ 0x3b, 0x99, 0x93, 0xa0, 0x9b, 0x19, 0xa3, 0x2b, 0x11, 0x93, 0x93, 0x9b, 0x3b, 0x94, 0x2a, 0x95,
+ 0x19, 0x1a, 0x11, 0xb9, 0x13, 0x0a, 0x33, 0xc9, 0x03, 0xbb, 0xba, 0x21, 0x10, 0x31, 0x99, 0xb9,
+ 0x1a, 0xb1, 0x1d, 0x31, 0x32, 0xb1, 0x21, 0xbb, 0x2b, 0x31, 0x10, 0x15, 0x9b, 0xa0, 0x9b, 0xb9,
+ 0x49, 0x98, 0x15, 0x99, 0x93, 0xbc, 0x58, 0x90, 0xa0, 0x13, 0x90, 0xa9, 0x72, 0x99, 0xa9, 0x13,
+ 0x00, 0x09, 0xb2, 0x4b, 0x00, 0x9c, 0x14, 0x1a, 0xab, 0x19, 0xb0, 0x09, 0x39, 0x10, 0x13, 0xa0,
+ 0x11, 0xac, 0x15, 0xab, 0x31, 0x93, 0x1a, 0xa9, 0x93, 0x9a, 0x39, 0xb3, 0x31, 0x12, 0xbb, 0xaa,
+ 0x19, 0x11, 0x05, 0x90, 0x39, 0xb9, 0x32, 0x99, 0xd9, 0x92, 0x10, 0x39, 0x20, 0xd9, 0x80, 0x20,
+ 0x3a, 0x13, 0x1c, 0x12, 0xbd, 0x11, 0x90, 0x13, 0x2f, 0x91, 0x81, 0x0b, 0xa9, 0x01, 0x31, 0xc3,
+ 0x11, 0x11, 0x0a, 0xb0, 0xb9, 0x39, 0x13, 0x01, 0x15, 0xab, 0x12, 0xa9, 0x30, 0x19, 0x91, 0xb0,
+ 0x93, 0xbb, 0x39, 0x01, 0x13, 0x31, 0xcb, 0x9a, 0x33, 0x91, 0x3a, 0x99, 0x01, 0x1b, 0xa3, 0x1e,
+ 0x03, 0x99, 0x10, 0x39, 0xa2, 0x00, 0x3b, 0xb3, 0xb1, 0x1b, 0x16, 0xa8, 0x9b, 0x14, 0x0c, 0x11,
+ 0x39, 0x91, 0x01, 0x1b, 0xba, 0x13, 0x0a, 0x13, 0x9b, 0x01, 0x32, 0x03, 0xf3, 0x19, 0x98, 0x03,
+ 0x08, 0x39, 0xb9, 0x02, 0xbb, 0x41, 0x09, 0x11, 0x29, 0xb1, 0x0a, 0x2b, 0xd9, 0x11, 0x19, 0x31,
+ 0xb3, 0x43, 0xdb, 0x10, 0x03, 0x39, 0xd2, 0x90, 0x09, 0x1f, 0x10, 0x91, 0x10, 0x98, 0x03, 0xbb,
+ 0x11, 0x09, 0x33, 0xd0, 0x18, 0xc2, 0x19, 0x0a, 0x95, 0x19, 0x31, 0x99, 0xe0, 0x30, 0x99, 0x3c,
+ 0x06, 0x00, 0x03, 0x00, 0x99, 0xb1, 0x51, 0xc9, 0x00, 0x02, 0x9a, 0x04, 0x30, 0xf1, 0x30, 0x98,
+ 0x99, 0x22, 0x0e, 0xa1, 0x1a, 0xa0, 0x2b, 0x91, 0x11, 0x39, 0x03, 0x01, 0x1b, 0x11, 0xdb, 0x91,
+ 0x01, 0x33, 0xbb, 0x30, 0x21, 0x19, 0x9b, 0x19, 0xa3, 0x09, 0x31, 0x9a, 0x19, 0x91, 0xa9, 0x42,
+ 0xaa, 0x11, 0x39, 0xc9, 0x11, 0x93, 0x92, 0x99, 0x44, 0xdb, 0x20, 0x98, 0x10, 0x90, 0xb9, 0x3a,
+ 0xa2, 0x9d, 0x02, 0x1a, 0x17, 0x8a, 0x00, 0xb1, 0x39, 0x11, 0x99, 0x02, 0xc9, 0x7b, 0x08, 0xa9,
+ 0x21, 0xb2, 0x3a, 0x13, 0x90, 0x21, 0xac, 0x90, 0x3a, 0x99, 0x13, 0x30, 0xc0, 0x4a, 0xa1, 0x20,
+ 0x21, 0xad, 0x15, 0x9b, 0x01, 0x99, 0x31, 0x10, 0xa0, 0x31, 0x99, 0xa9, 0x93, 0x2c, 0x13, 0x1b,
+ 0x03, 0xbb, 0x2c, 0xb2, 0x90, 0x2b, 0x19, 0x31, 0xd9, 0x30, 0xa1, 0x91, 0x9a, 0x31, 0x13, 0x9b,
+ 0x9b, 0x13, 0x1b, 0x32, 0x1a, 0x13, 0xc0, 0x29, 0x1b, 0x91, 0x4a, 0x90, 0x23, 0xbb, 0x1c, 0x10,
+ 0x0a, 0xa5, 0x19, 0x11, 0xb1, 0x19, 0x13, 0xb9, 0x29, 0xb9, 0x22, 0x01, 0x0a, 0x3b, 0xa3, 0x01,
+ 0x11, 0x12, 0x9a, 0x11, 0xb9, 0x11, 0x20, 0x1b, 0xa3, 0x90, 0x00, 0xb2, 0x1d, 0x91, 0x10, 0x51,
+ 0x99, 0x90, 0xb1, 0x39, 0x10, 0xb3, 0x41, 0x98, 0xb0, 0x99, 0x2b, 0x3b, 0x07, 0xa8, 0x10, 0xa9,
+ 0x90, 0xbb, 0x50, 0x81, 0x88, 0x39, 0xb0, 0x09, 0x15, 0xa9, 0x10, 0x13, 0x13, 0xcb, 0x90, 0x21,
+ 0x30, 0xb1, 0x39, 0xb2, 0x01, 0xaa, 0x00, 0x99, 0x03, 0xb9, 0x91, 0x22, 0x1d, 0x00, 0x90, 0x9a,
+ 0x94, 0x10, 0xc9, 0x12, 0xa2, 0x1c, 0x90, 0x3b, 0x09, 0x03, 0xcb, 0x28, 0x91, 0x03, 0x31, 0xba,
+ 0x13, 0x19, 0x0a, 0x0a, 0x33, 0x99, 0x9b, 0xa3, 0x13, 0xba, 0x11, 0x3a, 0x21, 0x90, 0x93, 0x2e,
+ 0x01, 0x00, 0x05, 0x00, 0x18, 0x90, 0xba, 0x32, 0x93, 0x1b, 0xb9, 0x90, 0x30, 0x12, 0xab, 0x33,
+ 0xb1, 0x9d, 0x02, 0x19, 0x13, 0x13, 0x0c, 0x09, 0x11, 0x23, 0x29, 0xd0, 0x31, 0x80, 0xae, 0x10,
+ 0x12, 0xa0, 0xa0, 0x29, 0xa3, 0x31, 0xb0, 0xb1, 0x1b, 0xa2, 0x32, 0x0b, 0xb0, 0x3b, 0xa5, 0x98,
+ 0x31, 0x99, 0x10, 0x91, 0x1b, 0x13, 0xb9, 0x39, 0x11, 0xb3, 0x39, 0x0b, 0x9a, 0xb3, 0x3a, 0x99,
+ 0x19, 0x01, 0x23, 0x9e, 0x01, 0x81, 0x3a, 0x92, 0xb0, 0x4a, 0x10, 0xba, 0x21, 0xaa, 0x33, 0x9a,
+ 0x11, 0xa3, 0x0b, 0x11, 0x13, 0x99, 0x19, 0x29, 0xbb, 0x12, 0x39, 0x00, 0xd3, 0x30, 0x0a, 0x09,
+ 0xc9, 0x10, 0x93, 0xb9, 0x39, 0x11, 0x99, 0xab, 0x11, 0x04, 0x1a, 0x99, 0x15, 0x9c, 0x13, 0x9b,
+ 0x03, 0x11, 0x29, 0x19, 0x12, 0x99, 0xba, 0x31, 0x13, 0xbb, 0x13, 0xd9, 0x11, 0x01, 0x20, 0x00,
+ 0x91, 0x99, 0x0a, 0xa2, 0x0a, 0x10, 0x19, 0x13, 0xa9, 0x1b, 0x23, 0xad, 0x12, 0xd3, 0x1b, 0x80,
+ 0x01, 0x11, 0x90, 0x29, 0x09, 0x39, 0xb3, 0x23, 0xa9, 0x1b, 0x04, 0x90, 0x9b, 0xb9, 0x49, 0xd2,
+ 0x19, 0x00, 0x22, 0x09, 0xa9, 0x91, 0xbb, 0x2b, 0x87, 0x19, 0x11, 0xa0, 0x0a, 0x12, 0x11, 0xaa,
+ 0x11, 0x31, 0x0b, 0x91, 0x99, 0xa9, 0xa1, 0x19, 0x43, 0x99, 0x93, 0x19, 0xb1, 0x22, 0xb9, 0x21,
+ 0x1b, 0x01, 0x11, 0xb1, 0x10, 0xbb, 0x85, 0x80, 0x18, 0x09, 0x30, 0x93, 0xbb, 0x3a, 0xa2, 0x21,
+ 0x99, 0x20, 0xbb, 0x11, 0x03, 0x99, 0x00, 0xb3, 0x9b, 0x99, 0x1a, 0x15, 0xa9, 0x39, 0x12, 0x11,
+ 0xb0, 0x3b, 0x13, 0x91, 0x1b, 0x93, 0xcb, 0x21, 0x19, 0x19, 0x29, 0x91, 0x09, 0x99, 0x99, 0xa2,
+ 0x09, 0x13, 0x31, 0xb9, 0x0b, 0x90, 0x99, 0x31, 0xb9, 0x10, 0xa2, 0x00, 0x10, 0x11, 0x10, 0x90,
+ 0x04, 0x00, 0x00, 0x00, 0x09, 0xb1, 0x4a, 0x99, 0x13, 0x91, 0x91, 0x39, 0xb0, 0x19, 0x99, 0x91,
+ 0x99, 0x13, 0x91, 0x9b, 0x09, 0x91, 0x09, 0x33, 0xb1, 0x39, 0xb1, 0xa9, 0x29, 0x31, 0x99, 0x11,
+ 0x11, 0xa1, 0xaa, 0x90, 0x49, 0x91, 0xa1, 0x20, 0x9a, 0x10, 0x09, 0x09, 0xb1, 0x31, 0x92, 0x9b,
+ 0x10, 0x19, 0x10, 0x94, 0x90, 0x10, 0xb9, 0x29, 0xb3, 0x91, 0x19, 0x91, 0x99, 0x1b, 0x31, 0xb0,
+ 0x3a, 0x92, 0x1a, 0x33, 0x09, 0x09, 0xb0, 0x3b, 0x02, 0x90, 0x91, 0x10, 0xb9, 0xb0, 0x40, 0x98,
+ 0x13, 0x92, 0x9b, 0x1b, 0xa5, 0x29, 0x10, 0x99, 0x31, 0xab, 0x31, 0xa2, 0x91, 0xb9, 0x19, 0x31,
+ 0x19, 0xb1, 0x1b, 0x22, 0xaa, 0x92, 0x22, 0x9b, 0x90, 0x92, 0x29, 0x1b, 0x30, 0xb1, 0x11, 0xb1,
+ 0x2c, 0x91, 0xaa, 0x21, 0x31, 0x00, 0x99, 0x99, 0xb9, 0x31, 0x01, 0x09, 0x31, 0xb1, 0x1b, 0x90,
+ 0x2a, 0x02, 0x01, 0xb0, 0x0a, 0x99, 0x31, 0x91, 0x22, 0x11, 0x9b, 0x92, 0xaa, 0x19, 0x11, 0x91,
+ 0x3b, 0xa1, 0x02, 0x09, 0xa1, 0x1a, 0x01, 0x11, 0x21, 0xb0, 0x19, 0x10, 0xba, 0x02, 0x93, 0x31,
+ 0x99, 0x1d, 0xa1, 0x08, 0x33, 0x01, 0x11, 0x9a, 0xab, 0x10, 0x30, 0x92, 0x00, 0x3a, 0x99, 0xc9,
+ 0x82, 0x19, 0x91, 0xb1, 0x32, 0xaa, 0x91, 0x11, 0x30, 0x99, 0x20, 0x92, 0x1a, 0xa9, 0x29, 0x2a,
+ 0x11, 0x09, 0x91, 0x39, 0x91, 0x1b, 0x11, 0x19, 0xb1, 0x31, 0x9a, 0x02, 0xba, 0x30, 0x01, 0x9a,
+ 0x02, 0x1a, 0x03, 0x91, 0x0b, 0x11, 0x9b, 0x11, 0x99, 0x23, 0xaa, 0x29, 0x90, 0x29, 0x12, 0x9b,
+ 0x05, 0x99, 0x2a, 0xb0, 0x1a, 0x13, 0x91, 0x11, 0x19, 0x19, 0x90, 0x12, 0x99, 0x10, 0x11, 0x1b,
+ 0x90, 0x21, 0xb0, 0x19, 0x19, 0x9b, 0xb3, 0x2a, 0x1a, 0x31, 0x13, 0x9b, 0x12, 0x99, 0x99, 0x90,
+ 0xfc, 0xff, 0x00, 0x00, 0x01, 0x11, 0xa0, 0xa2, 0x12, 0x9a, 0x1b, 0x31, 0x23, 0x9a, 0x00, 0x9a,
+ 0x00, 0x19, 0x91, 0x19, 0x91, 0x19, 0x09, 0xa2, 0x19, 0x01, 0x00, 0x12, 0x92, 0x00, 0x9b, 0x11,
+ 0x91, 0x00, 0x10, 0x90, 0xab, 0x23, 0xb0, 0x19, 0x11, 0x11, 0x10, 0x90, 0x1b, 0x01, 0x9a, 0x13,
+ 0x91, 0x91, 0x2b, 0x0a, 0x12, 0x00, 0x91, 0x91, 0x00, 0x00, 0x11, 0xbb, 0x13, 0x11, 0x19, 0x00,
+ 0x01, 0x0a, 0x11, 0x0a, 0x21, 0x01, 0x9a, 0x91, 0x12, 0xbb, 0x13, 0x11, 0x1b, 0x01, 0x91, 0x90,
+ 0x19, 0x01, 0x1b, 0x95, 0x08, 0x09, 0x39, 0x91, 0x21, 0x99, 0x20, 0x99, 0xb1, 0x19, 0x19, 0xb1,
+ 0x11, 0x0a, 0x91, 0x11, 0x00, 0x11, 0x2b, 0xb3, 0x1a, 0x12, 0x90, 0x11, 0x90, 0x1b, 0x99, 0x31,
+ 0xa9, 0x11, 0x99, 0x02, 0x91, 0x3a, 0x99, 0xa2, 0x11, 0x90, 0x19, 0xa9, 0x12, 0x2b, 0x19, 0x90,
+ 0x11, 0x91, 0x99, 0x99, 0x30, 0xb2, 0x3a, 0x10, 0xa0, 0x90, 0x31, 0x99, 0x99, 0x93, 0x3b, 0x99,
+ 0x99, 0x02, 0x21, 0x99, 0x9a, 0x91, 0x10, 0x0a, 0x93, 0x0a, 0x00, 0x09, 0x01, 0x10, 0x91, 0x31,
+ 0x99, 0x21, 0xa0, 0x20, 0xab, 0x91, 0x20, 0x93, 0x20, 0xab, 0x90, 0x19, 0x01, 0x29, 0x09, 0x11,
+ 0xa1, 0x19, 0xb9, 0x21, 0xb0, 0x20, 0x90, 0x31, 0xb9, 0x10, 0x91, 0x13, 0xb1, 0x31, 0x91, 0x99,
+ 0xb9, 0x02, 0x2b, 0x90, 0x21, 0x00, 0xa1, 0x9b, 0x10, 0x31, 0xa2, 0x10, 0x0a, 0x11, 0x9a, 0x11,
+ 0x00, 0xa0, 0x19, 0x01, 0x10, 0x01, 0x12, 0xa9, 0x10, 0x12, 0xa1, 0x19, 0x01, 0xa9, 0x9a, 0x11,
+ 0x11, 0x01, 0x91, 0x09, 0x09, 0x09, 0x11, 0x92, 0x19, 0x99, 0x92, 0x09, 0x19, 0x19, 0xa1, 0x30,
+ 0xa9, 0x21, 0x19, 0x2b, 0x91, 0x19, 0x11, 0x91, 0xb1, 0x1a, 0x11, 0x2a, 0xa3, 0x1a, 0x11, 0xa1,
+ 0x01, 0x00, 0x00, 0x00, 0x90, 0x13, 0xa9, 0x29, 0x90, 0x91, 0x01, 0xa9, 0x11, 0x00, 0x09, 0x11,
+ 0x90, 0x1b, 0x92, 0xb9, 0x11, 0x10, 0x12, 0x99, 0x02, 0x09, 0x99, 0x91, 0x11, 0x09, 0x91, 0x99,
+ 0x10, 0x01, 0x11, 0x0a, 0x11, 0x09, 0x29, 0xa0, 0x01, 0x10, 0x00, 0x00, 0x91, 0x10, 0x1a, 0x91,
+ 0x19, 0x11, 0x09, 0x99, 0xb2, 0x20, 0x99, 0xa1, 0x39, 0xb9, 0x11, 0x11, 0x1b, 0x11, 0x01, 0x00,
+ 0x01, 0x11, 0x99, 0x11, 0x99, 0x91, 0x19, 0xb2, 0x01, 0x19, 0x19, 0xb1, 0x99, 0x21, 0x19, 0x21,
+ 0x90, 0x09, 0x19, 0x09, 0x92, 0x09, 0x11, 0x99, 0x09, 0x09, 0x91, 0x09, 0x13, 0x1a, 0x99, 0x90,
+ 0x91, 0x09, 0x00, 0x90, 0x12, 0x99, 0x12, 0x9a, 0x09, 0x91, 0x99, 0x11, 0x12, 0xb9, 0x31, 0xa9,
+ 0x39, 0xb1, 0x21, 0xa9, 0x01, 0x19, 0x19, 0x02, 0x09, 0x99, 0x92, 0x00, 0x11, 0x99, 0x00, 0x90,
+ 0x00, 0x10, 0xa1, 0x19, 0x09, 0x11, 0xa9, 0x01, 0x11, 0x90, 0x00, 0x99, 0x01, 0x91, 0x10, 0x11,
+ 0x90, 0x11, 0x90, 0x19, 0x01, 0x09, 0x10, 0x90, 0x99, 0x91, 0x1a, 0x91, 0x01, 0x91, 0x10, 0x90,
+ 0x92, 0x90, 0x1a, 0x11, 0x11, 0x01, 0x9b, 0x11, 0x19, 0x11, 0x99, 0x19, 0x91, 0x09, 0x01, 0x11,
+ 0x99, 0x01, 0x99, 0x31, 0x99, 0x90, 0x01, 0x99, 0x01, 0x11, 0x19, 0x00, 0x99, 0xa1, 0x10, 0x19,
+ 0x91, 0x90, 0x29, 0xb1, 0x99, 0x21, 0x91, 0x90, 0x91, 0x00, 0x10, 0x10, 0x99, 0x11, 0x91, 0x2b,
+ 0x91, 0x09, 0x01, 0x11, 0x99, 0x01, 0x91, 0x09, 0x11, 0x09, 0x90, 0x91, 0x10, 0x19, 0x01, 0xb1,
+ 0x19, 0x90, 0x31, 0x99, 0x10, 0x90, 0x10, 0x01, 0x00, 0x21, 0x0b, 0x91, 0x91, 0x09, 0x99, 0x10,
+ 0x09, 0x11, 0x01, 0x19, 0x09, 0x91, 0x0b, 0x10, 0x00, 0x03, 0x90, 0x19, 0x99, 0x91, 0x29, 0x11,
+ 0x01, 0x00, 0x00, 0x00, 0x00, 0x91, 0x19, 0x99, 0x19, 0x01, 0x99, 0x29, 0xa2, 0x19, 0xa9, 0x11,
+ 0x02, 0x10, 0x99, 0x01, 0x91, 0x0a, 0x21, 0x9a, 0x11, 0x01, 0x10, 0x99, 0x10, 0x90, 0x19, 0x10,
+ 0x11, 0x09, 0x90, 0x19, 0x00, 0x01, 0x99, 0x12, 0x9a, 0x93, 0x09, 0x99, 0x10, 0x01, 0x99, 0x31,
+ 0x9a, 0x10, 0x09, 0x19, 0x91, 0x11, 0x99, 0x01, 0x1a, 0x91, 0x10, 0x01, 0x90, 0x1a, 0x91, 0x19,
+ 0x11, 0x09, 0x11, 0xa1, 0x10, 0x19, 0x12, 0xb9, 0x19, 0x00, 0x11, 0x90, 0x99, 0x19, 0x93, 0x0a,
+ 0x01, 0x01, 0x19, 0x91, 0x09, 0x99, 0x09, 0x19, 0x01, 0x11, 0x09, 0x90, 0x11, 0x99, 0x31, 0x91,
+ 0x99, 0x19, 0x91, 0x99, 0x10, 0x09, 0x02, 0x99, 0x31, 0x1a, 0x99, 0x90, 0x90, 0x19, 0x90, 0x19,
+ 0x11, 0xa9, 0x11, 0x90, 0x19, 0x00, 0x11, 0x90, 0x10, 0x99, 0x11, 0x99, 0x11, 0x11, 0x09, 0x10,
+ 0x90, 0x11, 0x91, 0x99, 0x19, 0x90, 0x1a, 0x92, 0x09, 0x92, 0x19, 0x09, 0x10, 0x91, 0x00, 0x91,
+ 0x19, 0x01, 0x10, 0x90, 0x19, 0x09, 0x91, 0x00, 0x91, 0x19, 0x91, 0x09, 0x11, 0x99, 0x91, 0x99,
+ 0x11, 0x91, 0x19, 0x91, 0x10, 0x90, 0x11, 0x11, 0x00, 0x00, 0x09, 0x09, 0x00, 0x90, 0x91, 0x19,
+ 0x99, 0x11, 0x90, 0x10, 0x11, 0x11, 0x99, 0x99, 0x00, 0x90, 0x11, 0x09, 0x11, 0x99, 0x00, 0x01,
+ 0x90, 0x19, 0x01, 0x19, 0x10, 0x90, 0xa0, 0x99, 0x13, 0x10, 0x99, 0x19, 0x01, 0x99, 0x90, 0x20,
+ 0x19, 0x91, 0x00, 0x20, 0x99, 0x99, 0x00, 0x09, 0x11, 0x91, 0x2b, 0x01, 0x99, 0x11, 0x90, 0x19,
+ 0x91, 0x90, 0x11, 0x19, 0x90, 0x99, 0x12, 0x19, 0xa9, 0x01, 0x11, 0x09, 0x19, 0x01, 0x99, 0x19,
+ 0x90, 0x00, 0x01, 0x99, 0x30, 0x99, 0x09, 0x11, 0xa9, 0x21, 0x91, 0x10, 0x91, 0x19, 0x91, 0x00,
+ 0x01, 0x00, 0x00, 0x00, 0x90, 0x19, 0x00, 0x01, 0x99, 0x09, 0x19, 0x00, 0x11, 0x01, 0x99, 0x00,
+ 0x09, 0x11, 0x91, 0x91, 0x19, 0x09, 0x99, 0x10, 0x11, 0x19, 0x99, 0x11, 0x10, 0x11, 0x99, 0x00,
+ 0x11, 0x99, 0x11, 0x99, 0x01, 0x09, 0x91, 0x90, 0x11, 0x09, 0x09, 0x90, 0x90, 0x11, 0x91, 0x19,
+ 0x90, 0x19, 0x01, 0x19, 0x11, 0x09, 0x99, 0x91, 0x11, 0x10, 0x99, 0x99, 0x09, 0x02, 0x19, 0x01,
+ 0x00, 0x91, 0x19, 0x00, 0x99, 0x00, 0x2a, 0x11, 0x90, 0x09, 0x19, 0x91, 0x19, 0x09, 0x11, 0x91,
+ 0x10, 0x90, 0x19, 0x90, 0x20, 0x99, 0x01, 0x90, 0x99, 0x11, 0x00, 0x09, 0x10, 0x00, 0x01, 0x09,
+ 0x00, 0x90, 0x10, 0x19, 0x09, 0x11, 0x91, 0x99, 0x91, 0x01, 0x91, 0x00, 0x91, 0x1a, 0x91, 0x10,
+ 0x10, 0x90, 0x01, 0x90, 0x10, 0x19, 0x90, 0x29, 0x09, 0x01, 0x09, 0x90, 0x01, 0x11, 0x0a, 0x11,
+ 0x90, 0x19, 0x09, 0x01, 0x00, 0x90, 0x09, 0x12, 0xa9, 0x11, 0x90, 0x01, 0x90, 0x01, 0x09, 0x01,
+ 0x00, 0x01, 0x91, 0x19, 0x09, 0x19, 0x09, 0x00, 0x19, 0x92, 0x1a, 0x01, 0x00, 0x90, 0x11, 0x90,
+ 0x09, 0x00, 0x19, 0x11, 0x11, 0x90, 0x90, 0x00, 0x19, 0xa2, 0x10, 0x90, 0x01, 0xb9, 0x21, 0x99,
+ 0x10, 0x01, 0x90, 0x99, 0x01, 0x90, 0x10, 0x10, 0x09, 0x01, 0x09, 0x11, 0x01, 0xa9, 0x31, 0x90,
+ 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0x99, 0x09, 0x11, 0x99, 0x01, 0x10, 0x00, 0x10, 0x99, 0x10,
+ 0x01, 0x1a, 0x19, 0x00, 0x90, 0x91, 0x99, 0x11, 0x01, 0x99, 0x00, 0x19, 0x01, 0x10, 0x01, 0x19,
+ 0x91, 0x90, 0x11, 0x99, 0x99, 0x02, 0xa9, 0x21, 0x09, 0x09, 0x09, 0x11, 0x10, 0x0a, 0x01, 0x11,
+ 0x19, 0x09, 0xa1, 0x10, 0x09, 0x11, 0x00,
+};
@@ -0,0 +1,9 @@
+
+#include <stdint.h>
+
+#define MISSILELAUNCH_ADPCM_BLOCK 256
+#define MISSILELAUNCH_SAMPLE_RATE 24000
+#define MISSILELAUNCH_SAMPLES 36847
+#define MISSILELAUNCH_LENGTH 18679
+
+extern const uint8_t missileLaunch[MISSILELAUNCH_LENGTH];
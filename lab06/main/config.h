@@ -3,8 +3,18 @@
 
 #define CONFIG_GAME_TIMER_PERIOD 40.0E-3f
 
+// Stress test: fill the screen with enemy missiles to time the missile
+// update and draw. The host benchmark (test/test_missile.c) builds both.
+#ifndef CONFIG_STRESS
+#define CONFIG_STRESS 0
+#endif
+
 #define CONFIG_MAX_PLAYER_MISSILES 4
+#if CONFIG_STRESS
+#define CONFIG_MAX_ENEMY_MISSILES  400
+#else
 #define CONFIG_MAX_ENEMY_MISSILES  7
+#endif
 #define CONFIG_MAX_PLANE_MISSILES  1
 #define CONFIG_MAX_TOTAL_MISSILES  \
   (CONFIG_MAX_ENEMY_MISSILES +     \
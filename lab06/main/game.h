@@ -6,9 +6,9 @@
 void game_init(void);
 
 // Update the game control logic.
-// This function calls the missile & plane tick functions, reinitializes
+// This function updates the missiles, calls the plane tick function, relaunches
 // idle enemy missiles, handles button presses, fires player missiles,
-// detects collisions, and updates statistics.
+// detects collisions, draws the missiles, and updates statistics.
 void game_tick(void);
 
 #endif // GAME_H_
@@ -13,18 +13,15 @@
 #include "config.h"
 
 // sound support
-#include "missileLaunch.h"
+#include "missileLaunch.h" // IMA-ADPCM, play with sound_play_adpcm()
 
 // M2: Define stats constants
 
-// All missiles
-missile_t missiles[CONFIG_MAX_TOTAL_MISSILES];
-
-// Alias into missiles array
-missile_t *enemy_missiles = missiles+0;
-missile_t *player_missiles = missiles+CONFIG_MAX_ENEMY_MISSILES;
-missile_t *plane_missile = missiles+CONFIG_MAX_ENEMY_MISSILES+
-									CONFIG_MAX_PLAYER_MISSILES;
+// Missile handles: enemy missiles, then player missiles, then the plane
+// missile. Each range ends where the next begins.
+#define ENEMY_MISSILES  0
+#define PLAYER_MISSILES (ENEMY_MISSILES+CONFIG_MAX_ENEMY_MISSILES)
+#define PLANE_MISSILE   (PLAYER_MISSILES+CONFIG_MAX_PLAYER_MISSILES)
 
 // M2: Declare stats variables
 
@@ -34,11 +31,11 @@ missile_t *plane_missile = missiles+CONFIG_MAX_ENEMY_MISSILES+
 void game_init(void)
 {
 	// Initialize missiles
-	for (uint32_t i = 0; i < CONFIG_MAX_TOTAL_MISSILES; i++)
-		missile_init(missiles+i);
+	for (missile_id_t id = 0; id < MISSILE_MAX; id++)
+		missile_init(id);
 
 	// Initialize plane
-	plane_init(plane_missile);
+	plane_init(PLANE_MISSILE);
 
 	// M2: Initialize stats
 
@@ -46,27 +43,26 @@ void game_init(void)
 }
 
 // Update the game control logic.
-// This function calls the missile & plane tick functions, relaunches
+// This function updates the missiles, calls the plane tick function, relaunches
 // idle enemy missiles, handles button presses, launches player missiles,
-// detects collisions, and updates statistics.
+// detects collisions, draws the missiles, and updates statistics.
 void game_tick(void)
 {
-	// Tick missiles in one batch
-	for (uint32_t i = 0; i < CONFIG_MAX_TOTAL_MISSILES; i++)
-		missile_tick(missiles+i);
+	// Update all missiles in one batch
+	missile_update();
 
 	// Tick plane
 	plane_tick();
 
 	// Relaunch idle enemy missiles
-	for (uint32_t i = 0; i < CONFIG_MAX_ENEMY_MISSILES; i++)
-		if (missile_is_idle(enemy_missiles+i))
-			missile_launch_enemy(enemy_missiles+i);
+	for (missile_id_t id = ENEMY_MISSILES;
+		(id = missile_next_idle(id, PLAYER_MISSILES)) != MISSILE_NONE; id++)
+		missile_launch_enemy(id);
 
 	// M1: Relaunch idle player missiles, !!! remove after Milestone 1 !!!
-	for (uint32_t i = 0; i < CONFIG_MAX_PLAYER_MISSILES; i++)
-		if (missile_is_idle(player_missiles+i))
-			missile_launch_player(player_missiles+i, rand()%LCD_W, rand()%LCD_H);
+	for (missile_id_t id = PLAYER_MISSILES;
+		(id = missile_next_idle(id, PLANE_MISSILE)) != MISSILE_NONE; id++)
+		missile_launch_player(id, rand()%LCD_W, rand()%LCD_H);
 
 	// M2: Check for button press. If so, launch a free player missile.
 
@@ -76,5 +72,8 @@ void game_tick(void)
 
 	// M2: Count non-player impacted missiles
 
+	// Draw all missiles in one batch
+	missile_draw();
+
 	// M2: Draw stats
 }
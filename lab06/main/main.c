@@ -66,22 +66,13 @@ void app_main(void)
 	lcd_frameEnable();
 	lcd_fillScreen(CONFIG_COLOR_BACKGROUND);
 	CHK_RET(cursor_init(PER_MS));
+	cursor_set_curve(CURSOR_DUAL); // fine aim near the center
 	sound_init(MISSILELAUNCH_SAMPLE_RATE);
 	game_init();
 
 	// Configure I/O pins for buttons
-	pin_reset(HW_BTN_A);
-	pin_input(HW_BTN_A, true);
-	pin_reset(HW_BTN_B);
-	pin_input(HW_BTN_B, true);
-	pin_reset(HW_BTN_MENU);
-	pin_input(HW_BTN_MENU, true);
-	pin_reset(HW_BTN_OPTION);
-	pin_input(HW_BTN_OPTION, true);
-	pin_reset(HW_BTN_SELECT);
-	pin_input(HW_BTN_SELECT, true);
-	pin_reset(HW_BTN_START);
-	pin_input(HW_BTN_START, true);
+	pin_reset_mask(HW_BTN_MASK);
+	pin_input_mask(HW_BTN_MASK, true);
 
 	// Initialize update timer
 	update_timer = xTimerCreate(
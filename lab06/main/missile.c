@@ -4,245 +4,261 @@
 #include "missile.h"
 #include "config.h"
 
-#define RAND_SEED 42
 #define FIRE_LOC_1 (LCD_W / 4)
-#define FIRE_LOC_2 (LCD_W / 2) 
+#define FIRE_LOC_2 (LCD_W / 2)
 #define FIRE_LOC_3 (LCD_W * 3 / 4)
 #define FIRE_LOC_BORDER_L (LCD_W * 3 / 8)
 #define FIRE_LOC_BORDER_R (LCD_W * 5 / 8)
 
-// define missile SM states
-enum missile_state_t {
-    INIT_ST,
-    IDLE_ST,
-    MOVE_ST,
-    EXPLODE_GROW_ST,
-    EXPLODE_SHRINK_ST,
-    IMPACT_ST,
+// fixed point: positions, velocities and radii have FIX_Q fraction bits
+#define FIX_Q 16
+#define FIX(f) ((int32_t)((f) * (1 << FIX_Q)))
+#define FIX_INT(v) ((coord_t)((v) >> FIX_Q))
+
+// state bitmasks, one bit per missile
+#define WORD_BITS 32
+#define WORDS ((MISSILE_MAX + WORD_BITS - 1) / WORD_BITS)
+#define WORD(id) ((id) / WORD_BITS)
+#define BIT(id) (1U << ((id) % WORD_BITS))
+
+// visit each set bit of a mask word, i is the missile
+#define FOR_BITS(w, bits, i) \
+    for (uint32_t _b = (bits), i; \
+         _b && (i = (w) * WORD_BITS + __builtin_ctz(_b), 1); _b &= _b - 1)
+
+#define RADIUS_STEP FIX(CONFIG_EXPLOSION_RADIUS_CHANGE_PER_TICK)
+#define RADIUS_MAX FIX(CONFIG_EXPLOSION_MAX_RADIUS)
+
+// speed and color by missile type, looked up at launch and draw
+static const int32_t SPEED[] = {
+    [MISSILE_TYPE_PLAYER] = FIX(CONFIG_PLAYER_MISSILE_DISTANCE_PER_TICK),
+    [MISSILE_TYPE_ENEMY] = FIX(CONFIG_ENEMY_MISSILE_DISTANCE_PER_TICK),
+    [MISSILE_TYPE_PLANE] = FIX(CONFIG_ENEMY_MISSILE_DISTANCE_PER_TICK),
+};
+static const color_t COLOR[] = {
+    [MISSILE_TYPE_PLAYER] = CONFIG_COLOR_PLAYER_MISSILE,
+    [MISSILE_TYPE_ENEMY] = CONFIG_COLOR_ENEMY_MISSILE,
+    [MISSILE_TYPE_PLANE] = CONFIG_COLOR_PLANE_MISSILE,
 };
 
-void finalize_launch(missile_t *);
+// missile pool, one entry per missile in each array
+static int32_t x[MISSILE_MAX], y[MISSILE_MAX];       // current position
+static int32_t dx[MISSILE_MAX], dy[MISSILE_MAX];     // velocity per tick
+static int32_t radius[MISSILE_MAX];                  // explosion radius
+static coord_t x_orig[MISSILE_MAX], y_orig[MISSILE_MAX];
+static coord_t x_dest[MISSILE_MAX], y_dest[MISSILE_MAX];
+static uint16_t steps[MISSILE_MAX];                  // ticks to destination
+static uint8_t type[MISSILE_MAX];                    // missile_type_t
 
-color_t get_color(missile_type_t);
+// missile states, a missile with no state bit set is idle
+static uint32_t moving[WORDS];
+static uint32_t impacted[WORDS];
+static uint32_t growing[WORDS];
+static uint32_t shrinking[WORDS];
+static uint32_t explode_me[WORDS]; // detonate on the next update
+
+static void launch_path(missile_id_t, missile_type_t, coord_t, coord_t, coord_t, coord_t);
 
 /******************** Missile Init & Launch Functions ********************/
 
 // Different _launch_ functions are used depending on the missile type.
 
 // Initialize the missile as an idle missile. When initialized to the idle
-// state, a missile doesn't appear nor does it move. The launch flag should
-// also be set to false. Other missile_t members will be set up at launch.
-void missile_init(missile_t *missile) {
-    missile->currentState = IDLE_ST;
-    missile->launch = false;
+// state, a missile doesn't appear nor does it move. Other members will be
+// set up at launch.
+void missile_init(missile_id_t id) {
+    uint32_t w = WORD(id), b = BIT(id);
+    moving[w] &= ~b;
+    impacted[w] &= ~b;
+    growing[w] &= ~b;
+    shrinking[w] &= ~b;
+    explode_me[w] &= ~b;
 }
 
 // Launch the missile as a player missile. This function takes an (x, y)
 // destination of the missile (as specified by the user). The origin is the
 // closest "firing location" to the destination (there are three firing
 // locations evenly spaced along the bottom of the screen).
-void missile_launch_player(missile_t *missile, coord_t x_dest, coord_t y_dest) {
+void missile_launch_player(missile_id_t id, coord_t x_dest, coord_t y_dest) {
+    coord_t x_orig;
     if (x_dest < FIRE_LOC_BORDER_L) { // if dest is on the left 3/8 of the screen, left fire location
-        missile->x_origin = FIRE_LOC_1;
+        x_orig = FIRE_LOC_1;
     } else if (x_dest < FIRE_LOC_BORDER_R) { // if dest is in the middle 1/4 of the screen, middle fire location
-        missile->x_origin = FIRE_LOC_2;
+        x_orig = FIRE_LOC_2;
     } else { // if dest is on the right 3/8 of the screen, right fire location
-        missile->x_origin = FIRE_LOC_3;
+        x_orig = FIRE_LOC_3;
     }
-    missile->y_origin = LCD_H; // bottom of screen
-    missile->x_dest = x_dest;
-    missile->y_dest = y_dest;
-    finalize_launch(missile);
+    launch_path(id, MISSILE_TYPE_PLAYER, x_orig, LCD_H, x_dest, y_dest); // from bottom of screen
 }
 
 // Launch the missile as an enemy missile. This will randomly choose the
 // origin and destination of the missile. The origin is somewhere near the
 // top of the screen, and the destination is the very bottom of the screen.
-void missile_launch_enemy(missile_t *missile) {
-    srand(RAND_SEED);
+void missile_launch_enemy(missile_id_t id) {
     // origin is top of screen with random x value
-    missile->x_origin = (rand() % LCD_W);
-    missile->y_origin = 0;
+    coord_t x_orig = rand() % LCD_W;
     // destination is bottom of screen with random x value
-    missile->x_dest = (rand() % LCD_W);
-    missile->y_dest = LCD_H;
-    finalize_launch(missile);
+    launch_path(id, MISSILE_TYPE_ENEMY, x_orig, 0, rand() % LCD_W, LCD_H);
 }
 
 // Launch the missile as a plane missile. This function takes the (x, y)
 // location of the plane as an argument and uses it as the missile origin.
 // The destination is randomly chosen along the bottom of the screen.
-void missile_launch_plane(missile_t *missile, coord_t x_orig, coord_t y_orig) {
-    srand(RAND_SEED);
-    // origin is plane location
-    missile->x_origin = x_orig;
-    missile->y_origin = y_orig;
+void missile_launch_plane(missile_id_t id, coord_t x_orig, coord_t y_orig) {
     // destination is bottom of screen with random x value
-    missile->x_dest = (rand() % LCD_W);
-    missile->y_dest = LCD_H;
-    finalize_launch(missile);
+    launch_path(id, MISSILE_TYPE_PLANE, x_orig, y_orig, rand() % LCD_W, LCD_H);
 }
 
-/******************** Missile Control & Tick Functions ********************/
+/******************** Missile Control & Update Functions ********************/
 
 // Used to indicate that a moving missile should be detonated. This occurs
 // when an enemy or a plane missile is located within an explosion zone.
-void missile_explode(missile_t *missile) {
-    missile->explode_me = true;
-}
-
-// Tick the state machine for a single missile.
-void missile_tick(missile_t *missile) {
-    // transitions
-    switch (missile->currentState) {
-        case INIT_ST:
-            missile->launch = false;
-            missile->currentState = IDLE_ST;
-            break;
-        case IDLE_ST:
-            if (missile->launch) { // go to move state if launch flag is true
-                missile->currentState = MOVE_ST;
-            } else {
-                missile->currentState = IDLE_ST;
-            }
-            break;
-        case MOVE_ST:
-            if (missile->explode_me) { // go to exp state if exp flag is true, go to impact if y coord is at bottom
-                missile->currentState = EXPLODE_GROW_ST;
-            } else if (missile->y_current <= LCD_H) {
-                missile->currentState = IMPACT_ST;
-            } else {
-                missile->currentState = MOVE_ST;
-            }
-            break;
-        case EXPLODE_GROW_ST:
-            if (missile->radius >= CONFIG_EXPLOSION_MAX_RADIUS) { // go to shrink if rad is maxxed out
-                missile->currentState = EXPLODE_SHRINK_ST;
-            } else {
-                missile->currentState = EXPLODE_GROW_ST;
-            }
-            break;
-        case EXPLODE_SHRINK_ST:
-            if (missile->radius <= 0) { // go back to idle when rad is 0
-                missile->currentState = IDLE_ST;
-            } else {
-                missile->currentState = EXPLODE_SHRINK_ST;
-            }
-            break;
-        case IMPACT_ST:
-            missile->currentState = EXPLODE_GROW_ST;
-            break;
-        default:
-            // uh oh
-    };
-
-    // actions
-    switch (missile->currentState) {
-        case INIT_ST:
-            break;
-        case IDLE_ST:
-            break;
-        case MOVE_ST:
-            missile->length += (missile->type == MISSILE_TYPE_PLAYER) 
-                ? CONFIG_PLAYER_MISSILE_DISTANCE_PER_TICK : CONFIG_ENEMY_MISSILE_DISTANCE_PER_TICK;
-            float fraction = missile->length / missile->total_length;
-            missile->x_current = missile->x_origin + fraction * (missile->x_dest = missile->x_origin);
-            missile->y_current = missile->y_origin + fraction * (missile->y_dest = missile->y_origin);
-            lcd_drawLine(missile->x_origin, missile->y_origin, missile->x_current, missile->y_current, get_color(missile->type));
-            break;
-        case EXPLODE_GROW_ST:
-            // increase radius
-            missile->radius += CONFIG_EXPLOSION_RADIUS_CHANGE_PER_TICK;
-            // draw circle
-            lcd_fillCircle(missile->x_current, missile->y_current, missile->radius, get_color(missile->type));
-            break;
-        case EXPLODE_SHRINK_ST:
-            // decrease radius
-            missile->radius -= CONFIG_EXPLOSION_RADIUS_CHANGE_PER_TICK;
-            // draw circle
-            lcd_fillCircle(missile->x_current, missile->y_current, missile->radius, get_color(missile->type));
-            break;
-        case IMPACT_ST:
-            // increment impact counter
-            break;
-        default:
-            // uh oh
-    };
+// The missile explodes on the next missile_update().
+void missile_explode(missile_id_t id) {
+    explode_me[WORD(id)] |= BIT(id);
+}
+
+// Advance all missiles one tick: move, impact, grow and shrink explosions.
+void missile_update(void) {
+    for (uint32_t w = 0; w < WORDS; w++) {
+        // missiles detonated or impacted last tick start to explode
+        uint32_t start = (moving[w] & explode_me[w]) | impacted[w];
+        moving[w] &= ~explode_me[w];
+        explode_me[w] = 0;
+        impacted[w] = 0;
+        FOR_BITS(w, start, i) radius[i] = 0;
+        growing[w] |= start;
+
+        // move, a missile on its last step lands exactly on its destination
+        uint32_t arrived = 0;
+        FOR_BITS(w, moving[w], i) {
+            int32_t last = -(int32_t)(--steps[i] == 0); // all ones on arrival
+            x[i] = ((x[i] + dx[i]) & ~last) | (((int32_t)x_dest[i] << FIX_Q) & last);
+            y[i] = ((y[i] + dy[i]) & ~last) | (((int32_t)y_dest[i] << FIX_Q) & last);
+            arrived |= (uint32_t)last & (1U << (i % WORD_BITS));
+        }
+        moving[w] &= ~arrived;
+        impacted[w] |= arrived;
+
+        // grow to the largest radius, then shrink back to idle
+        uint32_t full = 0, gone = 0;
+        FOR_BITS(w, growing[w], i) {
+            radius[i] += RADIUS_STEP;
+            full |= (uint32_t)(radius[i] >= RADIUS_MAX) << (i % WORD_BITS);
+        }
+        FOR_BITS(w, shrinking[w], i) {
+            radius[i] -= RADIUS_STEP;
+            gone |= (uint32_t)(radius[i] <= 0) << (i % WORD_BITS);
+        }
+        growing[w] &= ~full;
+        shrinking[w] = (shrinking[w] & ~gone) | full;
+    }
+}
+
+// Draw all missiles that are not idle.
+void missile_draw(void) {
+    for (uint32_t w = 0; w < WORDS; w++) {
+        FOR_BITS(w, moving[w] | impacted[w], i) {
+            lcd_drawLine(x_orig[i], y_orig[i], FIX_INT(x[i]), FIX_INT(y[i]), COLOR[type[i]]);
+        }
+        FOR_BITS(w, growing[w] | shrinking[w], i) {
+            lcd_fillCircle(FIX_INT(x[i]), FIX_INT(y[i]), FIX_INT(radius[i]), COLOR[type[i]]);
+        }
+    }
 }
 
 /******************** Missile Status Functions ********************/
 
 // Return the current missile position through the pointers *x,*y.
-void missile_get_pos(missile_t *missile, coord_t *x, coord_t *y) {
-    *x = missile->x_current;
-    *y=missile->y_current;
+void missile_get_pos(missile_id_t id, coord_t *x_pos, coord_t *y_pos) {
+    *x_pos = FIX_INT(x[id]);
+    *y_pos = FIX_INT(y[id]);
 }
 
 // Return the missile type.
-missile_type_t missile_get_type(missile_t *missile) {
-    return missile->type;
+missile_type_t missile_get_type(missile_id_t id) {
+    return type[id];
 }
 
 // Return whether the given missile is moving.
-bool missile_is_moving(missile_t *missile) {
-    return missile->currentState == MOVE_ST;
+bool missile_is_moving(missile_id_t id) {
+    return moving[WORD(id)] & BIT(id);
 }
 
 // Return whether the given missile is exploding. If this missile
 // is exploding, it can explode another intersecting missile.
-bool missile_is_exploding(missile_t *missile) {
-    return  missile->currentState == EXPLODE_GROW_ST || 
-            missile->currentState == EXPLODE_SHRINK_ST;
+bool missile_is_exploding(missile_id_t id) {
+    return (growing[WORD(id)] | shrinking[WORD(id)]) & BIT(id);
 }
 
 // Return whether the given missile is idle.
-bool missile_is_idle(missile_t *missile) {
-    return missile->currentState == IDLE_ST;
+bool missile_is_idle(missile_id_t id) {
+    uint32_t w = WORD(id);
+    return !((moving[w] | impacted[w] | growing[w] | shrinking[w]) & BIT(id));
 }
 
-// Return whether the given missile is impacted.
-bool missile_is_impacted(missile_t *missile) {
-    return missile->currentState == IMPACT_ST;
+// Return whether the given missile is impacted. A missile is impacted for
+// one tick after it reaches its destination, then explodes.
+bool missile_is_impacted(missile_id_t id) {
+    return impacted[WORD(id)] & BIT(id);
 }
 
 // Return whether an object (e.g., missile or plane) at the specified
 // (x,y) position is colliding with the given missile. For a collision
 // to occur, the missile needs to be exploding and the specified
 // position needs to be within the explosion radius.
-bool missile_is_colliding(missile_t *missile, coord_t x, coord_t y) {
+bool missile_is_colliding(missile_id_t id, coord_t x_pos, coord_t y_pos) {
     // check if missile is exploding
-    if (!missile_is_exploding(missile)) {
+    if (!missile_is_exploding(id)) {
         return false;
     }
     // check if point is inside radius of explosion
-    int32_t dx = missile->x_current - x;
-    int32_t dy = missile->y_current - y;
-    return (pow(dy, 2) + pow(dx, 2)) <= pow(missile->radius, 2);
+    int32_t ddx = FIX_INT(x[id]) - x_pos;
+    int32_t ddy = FIX_INT(y[id]) - y_pos;
+    int32_t r = FIX_INT(radius[id]);
+    return ddx * ddx + ddy * ddy <= r * r;
+}
+
+// Return the first idle missile in a range of handles, or MISSILE_NONE if
+// none are idle.
+// first: first handle of the range.
+// end: one past the last handle of the range.
+missile_id_t missile_next_idle(missile_id_t first, missile_id_t end) {
+    if (first < 0) first = 0;
+    if (end > MISSILE_MAX) end = MISSILE_MAX;
+    for (missile_id_t id = first; id < end; ) {
+        uint32_t w = WORD(id);
+        // idle bits of this word at or after id
+        uint32_t idle = ~(moving[w] | impacted[w] | growing[w] | shrinking[w]);
+        idle &= ~(BIT(id) - 1);
+        if (idle) {
+            id = w * WORD_BITS + __builtin_ctz(idle);
+            return (id < end) ? id : MISSILE_NONE;
+        }
+        id = (w + 1) * WORD_BITS;
+    }
+    return MISSILE_NONE;
 }
 
 /******************** Missile Helper Functions ********************/
 
-// initialize values before launch. To be called by individual launch functions.
-void finalize_launch(missile_t *missile) {
-    missile->length = 0;
-    missile->launch = true;
-    missile->explode_me = false;
-    missile->total_length = sqrtf(pow((missile->y_dest - missile->y_origin), 2) 
-                                + pow((missile->x_dest - missile->x_origin), 2));
-    missile->x_current = missile->x_origin;
-    missile->y_current = missile->y_origin;
-}
-
-// return missile color based on missile type
-color_t get_color(missile_type_t type) {
-    switch (type) { // from missile type
-        case MISSILE_TYPE_ENEMY:
-            return CONFIG_COLOR_ENEMY_MISSILE;
-        case MISSILE_TYPE_PLANE:
-            return CONFIG_COLOR_PLANE_MISSILE;
-        case MISSILE_TYPE_PLAYER:
-            return CONFIG_COLOR_PLAYER_MISSILE;
-        default:
-            return CONFIG_COLOR_BACKGROUND;
-    }
-}
\ No newline at end of file
+// set up the fixed point path of a missile and start it moving. To be
+// called by the individual launch functions.
+static void launch_path(missile_id_t id, missile_type_t t, coord_t xo, coord_t yo, coord_t xd, coord_t yd) {
+    uint32_t w = WORD(id), b = BIT(id);
+    float length = sqrtf((float)(xd - xo) * (xd - xo) + (float)(yd - yo) * (yd - yo));
+    float ticks = ceilf(length * (1 << FIX_Q) / SPEED[t]);
+
+    type[id] = t;
+    x_orig[id] = xo;
+    y_orig[id] = yo;
+    x_dest[id] = xd;
+    y_dest[id] = yd;
+    x[id] = (int32_t)xo << FIX_Q;
+    y[id] = (int32_t)yo << FIX_Q;
+    steps[id] = (ticks < 1) ? 1 : (ticks > UINT16_MAX) ? UINT16_MAX : ticks;
+    dx[id] = FIX((float)(xd - xo) / steps[id]);
+    dy[id] = FIX((float)(yd - yo) / steps[id]);
+    missile_init(id);
+    moving[w] |= b;
+}
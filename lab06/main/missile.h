@@ -5,11 +5,24 @@
 #include <stdint.h>
 
 #include "lcd.h" // coord_t
+#include "config.h" // CONFIG_MAX_TOTAL_MISSILES
 
-// The same missile structure is used for all missiles in the game.
-// All state variables for a missile are contained in the missile structure.
-// There are no global variables maintained in the missile.c file.
-// Each missile function requires a pointer argument to a missile struct.
+// All missiles in the game are kept in one pool in missile.c, stored as
+// separate arrays for each field (positions, velocities, radii) with the
+// states kept as bitmasks, one bit per missile. A missile is named by its
+// handle, an index into the pool from 0 to MISSILE_MAX-1. The game decides
+// which handles are used for which kind of missile.
+//
+// missile_update() advances every missile one tick in one pass, and
+// missile_draw() draws every missile in a second pass. Positions are fixed
+// point, and the velocity of a missile is worked out once at launch, so
+// the update does no floating point and does not look at missile types.
+
+#define MISSILE_MAX CONFIG_MAX_TOTAL_MISSILES // Missiles in the pool
+#define MISSILE_NONE -1 // No missile
+
+// Missile handle, 0 to MISSILE_MAX-1
+typedef int16_t missile_id_t;
 
 // This enum is used to identify the type of missile.
 typedef enum {
@@ -18,101 +31,76 @@ typedef enum {
 	MISSILE_TYPE_PLANE
 } missile_type_t;
 
-// This struct contains all information about a missile.
-typedef struct {
-
-	// Missile type (player, enemy, enemy plane).
-	missile_type_t type;
-
-	// Current state. The 'enum' is defined in your missile.c file.
-	int32_t currentState;
-
-	// Origin & destination x,y of missile.
-	coord_t x_origin;
-	coord_t y_origin;
-	coord_t x_dest;
-	coord_t y_dest;
-
-	// The total length of the flight path from origin to destination x,y.
-	float total_length;
-
-	// Tracks the current x,y of missile.
-	coord_t x_current;
-	coord_t y_current;
-
-	// The current length of the flight path from origin to current x,y.
-	float length;
-
-	// A flag to indicate the missile should proceed to launch.
-	bool launch;
-
-	// A flag to indicate the missile should be detonated when moving.
-	bool explode_me;
-
-	// While exploding, this tracks the current radius.
-	float radius;
-
-} missile_t;
-
 /******************** Missile Init & Launch Functions ********************/
 
 // Different _launch_ functions are used depending on the missile type.
 
 // Initialize the missile as an idle missile. When initialized to the idle
-// state, a missile doesn't appear nor does it move. The launch flag should
-// also be set to false. Other missile_t members will be set up at launch.
-void missile_init(missile_t *missile);
+// state, a missile doesn't appear nor does it move. Other members will be
+// set up at launch.
+void missile_init(missile_id_t id);
 
 // Launch the missile as a player missile. This function takes an (x, y)
 // destination of the missile (as specified by the user). The origin is the
 // closest "firing location" to the destination (there are three firing
 // locations evenly spaced along the bottom of the screen).
-void missile_launch_player(missile_t *missile, coord_t x_dest, coord_t y_dest);
+void missile_launch_player(missile_id_t id, coord_t x_dest, coord_t y_dest);
 
 // Launch the missile as an enemy missile. This will randomly choose the
 // origin and destination of the missile. The origin is somewhere near the
 // top of the screen, and the destination is the very bottom of the screen.
-void missile_launch_enemy(missile_t *missile);
+void missile_launch_enemy(missile_id_t id);
 
 // Launch the missile as a plane missile. This function takes the (x, y)
 // location of the plane as an argument and uses it as the missile origin.
 // The destination is randomly chosen along the bottom of the screen.
-void missile_launch_plane(missile_t *missile, coord_t x_orig, coord_t y_orig);
+void missile_launch_plane(missile_id_t id, coord_t x_orig, coord_t y_orig);
 
-/******************** Missile Control & Tick Functions ********************/
+/******************** Missile Control & Update Functions ********************/
 
 // Used to indicate that a moving missile should be detonated. This occurs
 // when an enemy or a plane missile is located within an explosion zone.
-void missile_explode(missile_t *missile);
+// The missile explodes on the next missile_update().
+void missile_explode(missile_id_t id);
+
+// Advance all missiles one tick: move, impact, grow and shrink explosions.
+void missile_update(void);
 
-// Tick the state machine for a single missile.
-void missile_tick(missile_t *missile);
+// Draw all missiles that are not idle.
+void missile_draw(void);
 
 /******************** Missile Status Functions ********************/
 
 // Return the current missile position through the pointers *x,*y.
-void missile_get_pos(missile_t *missile, coord_t *x, coord_t *y);
+void missile_get_pos(missile_id_t id, coord_t *x, coord_t *y);
 
 // Return the missile type.
-missile_type_t missile_get_type(missile_t *missile);
+missile_type_t missile_get_type(missile_id_t id);
 
 // Return whether the given missile is moving.
-bool missile_is_moving(missile_t *missile);
+bool missile_is_moving(missile_id_t id);
 
 // Return whether the given missile is exploding. If this missile
 // is exploding, it can explode another intersecting missile.
-bool missile_is_exploding(missile_t *missile);
+bool missile_is_exploding(missile_id_t id);
 
 // Return whether the given missile is idle.
-bool missile_is_idle(missile_t *missile);
+bool missile_is_idle(missile_id_t id);
 
-// Return whether the given missile is impacted.
-bool missile_is_impacted(missile_t *missile);
+// Return whether the given missile is impacted. A missile is impacted for
+// one tick after it reaches its destination, then explodes.
+bool missile_is_impacted(missile_id_t id);
 
 // Return whether an object (e.g., missile or plane) at the specified
 // (x,y) position is colliding with the given missile. For a collision
 // to occur, the missile needs to be exploding and the specified
 // position needs to be within the explosion radius.
-bool missile_is_colliding(missile_t *missile, coord_t x, coord_t y);
+bool missile_is_colliding(missile_id_t id, coord_t x, coord_t y);
+
+// Return the first idle missile in a range of handles, or MISSILE_NONE if
+// none are idle.
+// first: first handle of the range.
+// end: one past the last handle of the range.
+missile_id_t missile_next_idle(missile_id_t first, missile_id_t end);
 
 #endif // MISSILE_H_
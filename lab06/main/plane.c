@@ -11,7 +11,7 @@
 static int16_t x_pos;
 static int16_t y_pos;
 
-static missile_t *missile;
+static missile_id_t missile;
 
 static bool explode_flag;
 
@@ -28,9 +28,9 @@ static enum plane_state_t plane_state;
 
 /******************** Plane Init Function ********************/
 
-// Initialize the plane state machine. Pass a pointer to the missile
+// Initialize the plane state machine. Pass the handle of the missile
 // that will be (re)launched by the plane. It will only have one missile.
-void plane_init(missile_t *plane_missile) {
+void plane_init(missile_id_t plane_missile) {
     missile = plane_missile;
     plane_state = INIT_ST;
     x_pos = X_START;
@@ -5,9 +5,9 @@
 
 /******************** Plane Init Function ********************/
 
-// Initialize the plane state machine. Pass a pointer to the missile
+// Initialize the plane state machine. Pass the handle of the missile
 // that will be (re)launched by the plane. It will only have one missile.
-void plane_init(missile_t *plane_missile);
+void plane_init(missile_id_t plane_missile);
 
 /******************** Plane Control & Tick Functions ********************/
 
@@ -397,6 +397,37 @@ int64_t lcd_test_fillArrow(void) {
 	return diffTick;
 }
 
+int64_t lcd_test_fillPolygon(void) {
+	int64_t startTick, endTick, diffTick;
+
+	// Five pointed star (concave outline), radius 40
+	static const coord_t star[] = {
+		  0,-40,   9,-12,  38,-12,  15,  5,  24, 32,
+		  0, 15, -24, 32, -15,  5, -38,-12,  -9,-12,
+	};
+	const coord_t n = sizeof(star)/sizeof(star[0])/2;
+	coord_t xy[sizeof(star)/sizeof(star[0])];
+	lcd_fillScreen(CYAN);
+	srand((unsigned int)time(NULL));
+
+	startTick = esp_timer_get_time();
+	for (int32_t i = 0; i < 100; i++) {
+		coord_t xpos = rand() % width;
+		coord_t ypos = rand() % height;
+		for (coord_t j = 0; j < n; j++) {
+			xy[2*j  ] = star[2*j  ] + xpos;
+			xy[2*j+1] = star[2*j+1] + ypos;
+		}
+		lcd_fillPolygon(xy, n, RAND_COLOR());
+	}
+	endTick = esp_timer_get_time();
+
+	lcd_writeFrame();
+	diffTick = endTick - startTick;
+	PRINT_TIME(diffTick);
+	return diffTick;
+}
+
 int64_t lcd_test_drawBitmap(void) {
 	int64_t startTick, endTick, diffTick;
 
@@ -419,6 +450,28 @@ int64_t lcd_test_drawBitmap(void) {
 	return diffTick;
 }
 
+int64_t lcd_test_drawBitmapBg(void) {
+	int64_t startTick, endTick, diffTick;
+
+	color_t ctab[] = {RED,GREEN,BLUE,BLACK,GRAY,YELLOW,CYAN,MAGENTA};
+	lcd_fillScreen(rgb565(4, 16, 64));
+
+	startTick = esp_timer_get_time();
+	for (coord_t y = 0; y < LCD_H; y += CROSSHAIR_H+1) {
+		coord_t x;
+		uint8_t c;
+		for (x = 0, c = 0; x < LCD_W; x += CROSSHAIR_W+1, c++) {
+			lcd_drawBitmapBg(x, y, crosshair, CROSSHAIR_W, CROSSHAIR_H, ctab[c%8], WHITE);
+		}
+	}
+	endTick = esp_timer_get_time();
+
+	lcd_writeFrame();
+	diffTick = endTick - startTick;
+	PRINT_TIME(diffTick);
+	return diffTick;
+}
+
 int64_t lcd_test_drawRGBBitmap(void) {
 	int64_t startTick, endTick, diffTick;
 	coord_t x = 0, y = 0;
@@ -440,6 +493,26 @@ int64_t lcd_test_drawRGBBitmap(void) {
 	return diffTick;
 }
 
+int64_t lcd_test_drawRGBBitmapStride(void) {
+	int64_t startTick, endTick, diffTick;
+	const coord_t tw = PEPPERS_W/4, th = PEPPERS_H/4;
+
+	// Draw the image as a grid of 4x4 sub-images, in reverse order
+	startTick = esp_timer_get_time();
+	for (coord_t j = 0; j < 4; j++) {
+		for (coord_t i = 0; i < 4; i++) {
+			lcd_drawRGBBitmapStride(i*tw, j*th,
+				peppers + (3-j)*th*PEPPERS_W + (3-i)*tw, tw, th, PEPPERS_W);
+		}
+	}
+	endTick = esp_timer_get_time();
+
+	lcd_writeFrame();
+	diffTick = endTick - startTick;
+	PRINT_TIME(diffTick);
+	return diffTick;
+}
+
 //----------------------------------------------------------------------------//
 // Rectangle variants that specify two diagonal corners
 //----------------------------------------------------------------------------//
@@ -798,8 +871,11 @@ void lcd_test_all(void *pvParameters)
 		lcd_test_fillRoundRect(); WAIT;
 		lcd_test_drawArrow(); WAIT;
 		lcd_test_fillArrow(); WAIT;
+		lcd_test_fillPolygon(); WAIT;
 		lcd_test_drawBitmap(); WAIT;
+		lcd_test_drawBitmapBg(); WAIT;
 		lcd_test_drawRGBBitmap(); WAIT;
+		lcd_test_drawRGBBitmapStride(); WAIT;
 		lcd_test_drawRect2(); WAIT;
 		lcd_test_fillRect2(); WAIT;
 		lcd_test_drawRoundRect2(); WAIT;
@@ -0,0 +1,31 @@
+#ifndef CHECK_H_
+#define CHECK_H_
+
+#include <stdio.h>
+
+// Checks for the host tests. A failed check prints where it failed and the
+// test goes on, so one run shows every failure. Return CHECK_RESULT() from
+// main().
+
+static int check_fails;
+
+#define CHECK(cond) do { \
+	if (!(cond)) { \
+		fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+		check_fails++; \
+	} \
+} while (0)
+
+// Check that two integer values are equal, and print both if not.
+#define CHECK_EQ(a, b) do { \
+	long long a_ = (long long)(a), b_ = (long long)(b); \
+	if (a_ != b_) { \
+		fprintf(stderr, "%s:%d: CHECK_EQ(%s, %s) failed: 0x%llx != 0x%llx\n", \
+			__FILE__, __LINE__, #a, #b, a_, b_); \
+		check_fails++; \
+	} \
+} while (0)
+
+#define CHECK_RESULT() (check_fails ? (fprintf(stderr, "%d checks failed\n", check_fails), 1) : 0)
+
+#endif // CHECK_H_
@@ -0,0 +1,125 @@
+// Simulated serial link for the host tests, see link.h.
+
+#include <errno.h>
+#include <poll.h>
+#include <stdbool.h>
+#include <sys/socket.h>
+#include <time.h>
+
+#include "link.h"
+
+#define PEND_SZ 8192 // Bytes received and not yet read, a power of two
+
+// Global variables
+static int link_fd = -1;
+static link_cfg_t cfg;
+static link_stats_t stats;
+static uint8_t pend[PEND_SZ]; // Bytes received, waiting out the latency
+static int64_t pend_ms[PEND_SZ]; // Time each byte arrived
+static uint32_t head, tail;
+static uint32_t rnd;
+
+
+static int64_t now_ms(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (int64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+// Pseudo-random number in [0, 1000000).
+static uint32_t link_ppm(void)
+{
+	rnd ^= rnd << 13;
+	rnd ^= rnd >> 17;
+	rnd ^= rnd << 5;
+	return rnd % 1000000;
+}
+
+void link_open(int fd, const link_cfg_t *c)
+{
+	link_fd = fd;
+	cfg = (c != NULL) ? *c : (link_cfg_t){0};
+	rnd = cfg.seed | 1;
+	stats = (link_stats_t){0};
+	head = tail = 0;
+}
+
+int32_t link_write(const void *buf, uint32_t size)
+{
+	ssize_t n = send(link_fd, buf, size, MSG_NOSIGNAL);
+	return (n < 0) ? -1 : n;
+}
+
+// Move the bytes that have arrived into the pending ring, with errors.
+// Return false if the other end closed.
+static bool link_pull(void)
+{
+	uint8_t buf[256];
+
+	while (PEND_SZ - (head - tail) >= sizeof(buf)) {
+		ssize_t n = recv(link_fd, buf, sizeof(buf), MSG_DONTWAIT);
+		if (!n) return false;
+		if (n < 0) return errno == EAGAIN || errno == EWOULDBLOCK;
+		int64_t now = now_ms();
+		for (ssize_t i = 0; i < n; i++) {
+			stats.bytes++;
+			if (link_ppm() < cfg.drop_ppm) {
+				stats.dropped++;
+				continue;
+			}
+			if (link_ppm() < cfg.flip_ppm) {
+				buf[i] ^= 1 << link_ppm() % 8;
+				stats.flipped++;
+			}
+			pend[head % PEND_SZ] = buf[i];
+			pend_ms[head % PEND_SZ] = now;
+			head++;
+		}
+	}
+	return true;
+}
+
+// Return the number of pending bytes that have waited out the latency.
+static uint32_t link_ready(void)
+{
+	int64_t now = now_ms();
+	uint32_t n = 0;
+
+	while (tail + n != head && pend_ms[(tail + n) % PEND_SZ] + cfg.latency_ms <= now) n++;
+	return n;
+}
+
+int32_t link_read(void *buf, uint32_t size)
+{
+	uint8_t *p = buf;
+
+	if (!link_pull() && head == tail) return -1;
+	uint32_t n = link_ready();
+	if (n > size) n = size;
+	for (uint32_t i = 0; i < n; i++) p[i] = pend[tail++ % PEND_SZ];
+	return n;
+}
+
+int32_t link_wait(uint32_t ms)
+{
+	int64_t end = now_ms() + ms;
+
+	for (;;) {
+		bool open = link_pull();
+		uint32_t n = link_ready();
+		if (n) return n;
+		if (!open && head == tail) return -1;
+		int64_t now = now_ms(), until = end;
+		if (head != tail && pend_ms[tail % PEND_SZ] + cfg.latency_ms < until)
+			until = pend_ms[tail % PEND_SZ] + cfg.latency_ms;
+		if (now >= end) return 0;
+		struct pollfd pfd = {.fd = link_fd, .events = POLLIN};
+		poll(&pfd, 1, (until > now) ? until - now : 0);
+	}
+}
+
+void link_get_stats(link_stats_t *st)
+{
+	*st = stats;
+}
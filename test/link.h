@@ -0,0 +1,49 @@
+#ifndef LINK_H_
+#define LINK_H_
+
+#include <stdint.h>
+
+// Simulated serial link for the host tests, in place of the UART of com.c.
+// A process opens its end of a socket pair; two processes, one per board,
+// then talk as two boards joined by a cable. The bytes received can be
+// held back (latency), dropped or have a bit flipped, as on a noisy line.
+// link_write(), link_read() and link_wait() match com_write(), com_read()
+// and com_wait(), for proto_io_t and lockstep_io_t.
+
+typedef struct {
+	uint32_t latency_ms; // Time from write to read
+	uint32_t drop_ppm;   // Bytes lost, per million
+	uint32_t flip_ppm;   // Bytes with a bit flipped, per million
+	uint32_t seed;       // Seed of the errors
+} link_cfg_t;
+
+// Link statistics
+typedef struct {
+	uint32_t bytes;   // Bytes received, before errors
+	uint32_t dropped; // Bytes dropped
+	uint32_t flipped; // Bytes with a bit flipped
+} link_stats_t;
+
+// Use a file descriptor as the link of this process.
+// fd: one end of a socket pair.
+// *cfg: errors and latency of the bytes received, or NULL for none.
+void link_open(int fd, const link_cfg_t *cfg);
+
+// Write data to the link. Does not wait.
+// Return number of bytes written, or negative number if error.
+int32_t link_write(const void *buf, uint32_t size);
+
+// Read the data that has arrived. Does not wait.
+// Return number of bytes read, or negative number if error.
+int32_t link_read(void *buf, uint32_t size);
+
+// Wait for data to arrive.
+// ms: time to wait in milliseconds.
+// Return number of bytes waiting to be read, zero on time out,
+// or negative number if the other end closed.
+int32_t link_wait(uint32_t ms);
+
+// Get the link statistics.
+void link_get_stats(link_stats_t *st);
+
+#endif // LINK_H_
@@ -0,0 +1,130 @@
+// Host stand-in of the continuous ADC driver, see esp_adc/adc_continuous.h.
+
+#include <stdlib.h>
+
+#include "freertos/FreeRTOS.h"
+#include "esp_adc/adc_continuous.h"
+
+#define PATTERN_MAX 8
+#define ADC_MID 2048
+
+struct adc_continuous_ctx_t {
+	adc_continuous_handle_cfg_t cfg;
+	adc_digi_pattern_config_t pattern[PATTERN_MAX];
+	uint32_t pattern_num;
+	adc_continuous_evt_cbs_t cbs;
+	void *user;
+	uint8_t *frame;
+	uint64_t conv; // Conversions since the start
+	bool configured, running;
+};
+
+// Global variables
+static struct adc_continuous_ctx_t *adc; // Last handle created
+uint16_t (*stub_adc_in)(uint32_t chan, uint64_t k);
+
+
+esp_err_t adc_continuous_new_handle(const adc_continuous_handle_cfg_t *cfg, adc_continuous_handle_t *ret_handle)
+{
+	if (cfg == NULL || ret_handle == NULL) return ESP_ERR_INVALID_ARG;
+	if (!cfg->conv_frame_size || cfg->conv_frame_size % SOC_ADC_DIGI_RESULT_BYTES)
+		return ESP_ERR_INVALID_ARG;
+	struct adc_continuous_ctx_t *h = calloc(1, sizeof(*h));
+	if (h == NULL) return ESP_ERR_NO_MEM;
+	h->frame = malloc(cfg->conv_frame_size);
+	if (h->frame == NULL) {
+		free(h);
+		return ESP_ERR_NO_MEM;
+	}
+	h->cfg = *cfg;
+	*ret_handle = adc = h;
+	return ESP_OK;
+}
+
+esp_err_t adc_continuous_config(adc_continuous_handle_t h, const adc_continuous_config_t *config)
+{
+	if (h == NULL || config == NULL) return ESP_ERR_INVALID_ARG;
+	if (h->running) return ESP_ERR_INVALID_STATE;
+	if (!config->pattern_num || config->pattern_num > PATTERN_MAX) return ESP_ERR_INVALID_ARG;
+	// the ESP32 ADC DMA runs from 20 kHz to 2 MHz
+	if (config->sample_freq_hz < 20000 || config->sample_freq_hz > 2000000)
+		return ESP_ERR_INVALID_ARG;
+	for (uint32_t i = 0; i < config->pattern_num; i++) h->pattern[i] = config->adc_pattern[i];
+	h->pattern_num = config->pattern_num;
+	h->configured = true;
+	return ESP_OK;
+}
+
+esp_err_t adc_continuous_register_event_callbacks(adc_continuous_handle_t h,
+	const adc_continuous_evt_cbs_t *cbs, void *user_data)
+{
+	if (h == NULL || cbs == NULL) return ESP_ERR_INVALID_ARG;
+	if (h->running) return ESP_ERR_INVALID_STATE;
+	h->cbs = *cbs;
+	h->user = user_data;
+	return ESP_OK;
+}
+
+esp_err_t adc_continuous_start(adc_continuous_handle_t h)
+{
+	if (h == NULL || !h->configured || h->running) return ESP_ERR_INVALID_STATE;
+	stub_critical_enter();
+	h->conv = 0;
+	h->running = true;
+	stub_critical_exit();
+	return ESP_OK;
+}
+
+esp_err_t adc_continuous_stop(adc_continuous_handle_t h)
+{
+	if (h == NULL || !h->running) return ESP_ERR_INVALID_STATE;
+	stub_critical_enter();
+	h->running = false;
+	stub_critical_exit();
+	return ESP_OK;
+}
+
+esp_err_t adc_continuous_deinit(adc_continuous_handle_t h)
+{
+	if (h == NULL || h->running) return ESP_ERR_INVALID_STATE;
+	if (h == adc) adc = NULL;
+	free(h->frame);
+	free(h);
+	return ESP_OK;
+}
+
+// GPIO of the ESP32 ADC1 inputs, by channel.
+esp_err_t adc_continuous_io_to_channel(int io_num, adc_unit_t *unit_id, adc_channel_t *channel)
+{
+	static const int8_t ADC1_IO[] = {36, 37, 38, 39, 32, 33, 34, 35};
+
+	for (uint32_t ch = 0; ch < sizeof(ADC1_IO); ch++) {
+		if (ADC1_IO[ch] != io_num) continue;
+		*unit_id = ADC_UNIT_1;
+		*channel = ch;
+		return ESP_OK;
+	}
+	return ESP_ERR_INVALID_ARG;
+}
+
+uint32_t stub_adc_run(uint32_t n)
+{
+	uint32_t i;
+
+	stub_critical_enter();
+	for (i = 0; i < n && adc != NULL && adc->running; i++) {
+		uint32_t results = adc->cfg.conv_frame_size / SOC_ADC_DIGI_RESULT_BYTES;
+		adc_digi_output_data_t *p = (adc_digi_output_data_t *)adc->frame;
+		for (uint32_t r = 0; r < results; r++, adc->conv++) {
+			uint32_t ch = adc->pattern[adc->conv % adc->pattern_num].channel;
+			uint64_t k = adc->conv / adc->pattern_num;
+			p[r].type1.channel = ch;
+			p[r].type1.data = (stub_adc_in != NULL) ? stub_adc_in(ch, k) : ADC_MID;
+		}
+		adc_continuous_evt_data_t ev = {.conv_frame_buffer = adc->frame,
+			.size = adc->cfg.conv_frame_size};
+		if (adc->cbs.on_conv_done != NULL) adc->cbs.on_conv_done(adc, &ev, adc->user);
+	}
+	stub_critical_exit();
+	return i;
+}
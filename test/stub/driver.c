@@ -0,0 +1,311 @@
+// Host stand-ins of the GPTimer and DAC drivers, see driver/gptimer.h,
+// driver/dac_oneshot.h and driver/dac_continuous.h.
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "driver/gptimer.h"
+#include "driver/dac_oneshot.h"
+#include "driver/dac_continuous.h"
+#include "esp_timer.h"
+
+#if CONFIG_DAC_DMA_AUTO_16BIT_ALIGN
+#define DMA_BYTES 2 // DMA buffer bytes per sample
+#else
+#define DMA_BYTES 1
+#endif
+
+struct gptimer {
+	gptimer_event_callbacks_t cbs;
+	void *user;
+	gptimer_alarm_config_t alarm;
+	bool enabled, running;
+	uint32_t resolution_hz;
+	uint64_t count;
+};
+
+struct dac_oneshot {
+	dac_channel_t chan;
+};
+
+struct dac_continuous {
+	dac_continuous_config_t cfg;
+	dac_event_callbacks_t cbs;
+	void *user;
+	uint8_t **desc; // DMA buffers, cfg.desc_num of cfg.buf_size bytes
+	bool *fresh; // Buffer written since it last played
+	uint32_t stale; // Buffers played again that are not one level
+	uint32_t next; // Next buffer the DMA plays
+	uint64_t played; // Samples played since the start
+	bool enabled, running;
+};
+
+// Global variables
+static struct gptimer *timer; // Last timer created
+static struct dac_continuous *dma; // Last continuous channel created
+void (*stub_dac_out)(const uint8_t *buf, size_t n);
+uint32_t (*stub_dac_late)(void);
+
+
+esp_err_t gptimer_new_timer(const gptimer_config_t *config, gptimer_handle_t *ret_timer)
+{
+	if (config == NULL || ret_timer == NULL) return ESP_ERR_INVALID_ARG;
+	if (!config->resolution_hz) return ESP_ERR_INVALID_ARG;
+	*ret_timer = timer = calloc(1, sizeof(struct gptimer));
+	if (timer == NULL) return ESP_ERR_NO_MEM;
+	timer->resolution_hz = config->resolution_hz;
+	return ESP_OK;
+}
+
+esp_err_t gptimer_del_timer(gptimer_handle_t t)
+{
+	if (t == NULL || t->enabled) return ESP_ERR_INVALID_STATE;
+	if (t == timer) timer = NULL;
+	free(t);
+	return ESP_OK;
+}
+
+esp_err_t gptimer_register_event_callbacks(gptimer_handle_t t,
+	const gptimer_event_callbacks_t *cbs, void *user_data)
+{
+	if (t == NULL || cbs == NULL) return ESP_ERR_INVALID_ARG;
+	if (t->enabled) return ESP_ERR_INVALID_STATE;
+	t->cbs = *cbs;
+	t->user = user_data;
+	return ESP_OK;
+}
+
+esp_err_t gptimer_set_alarm_action(gptimer_handle_t t, const gptimer_alarm_config_t *config)
+{
+	if (t == NULL || config == NULL) return ESP_ERR_INVALID_ARG;
+	t->alarm = *config;
+	return ESP_OK;
+}
+
+esp_err_t gptimer_enable(gptimer_handle_t t)
+{
+	if (t == NULL || t->enabled) return ESP_ERR_INVALID_STATE;
+	t->enabled = true;
+	return ESP_OK;
+}
+
+esp_err_t gptimer_disable(gptimer_handle_t t)
+{
+	if (t == NULL || !t->enabled || t->running) return ESP_ERR_INVALID_STATE;
+	t->enabled = false;
+	return ESP_OK;
+}
+
+esp_err_t gptimer_start(gptimer_handle_t t)
+{
+	if (t == NULL || !t->enabled || t->running) return ESP_ERR_INVALID_STATE;
+	t->running = true;
+	return ESP_OK;
+}
+
+esp_err_t gptimer_stop(gptimer_handle_t t)
+{
+	if (t == NULL || !t->running) return ESP_ERR_INVALID_STATE;
+	t->running = false;
+	return ESP_OK;
+}
+
+// Run the alarm callback of the started timer n times, each at its alarm
+// time in simulated time.
+uint32_t stub_gptimer_run(uint32_t n)
+{
+	uint32_t i;
+
+	if (timer == NULL || !timer->running || timer->cbs.on_alarm == NULL) return 0;
+	for (i = 0; i < n && timer->running; i++) {
+		uint64_t us = timer->count * 1000000 / timer->resolution_hz;
+		timer->count += timer->alarm.alarm_count;
+		stub_time_advance(timer->count * 1000000 / timer->resolution_hz - us);
+		gptimer_alarm_event_data_t ev = {.count_value = timer->count,
+			.alarm_value = timer->alarm.alarm_count};
+		timer->cbs.on_alarm(timer, &ev, timer->user);
+	}
+	return i;
+}
+
+// Return the alarm period in timer ticks, or zero if no timer is set up.
+uint64_t stub_gptimer_period(void)
+{
+	return (timer != NULL) ? timer->alarm.alarm_count : 0;
+}
+
+esp_err_t dac_oneshot_new_channel(const dac_oneshot_config_t *cfg, dac_oneshot_handle_t *ret_handle)
+{
+	if (cfg == NULL || ret_handle == NULL) return ESP_ERR_INVALID_ARG;
+	*ret_handle = calloc(1, sizeof(struct dac_oneshot));
+	if (*ret_handle == NULL) return ESP_ERR_NO_MEM;
+	(*ret_handle)->chan = cfg->chan_id;
+	return ESP_OK;
+}
+
+esp_err_t dac_oneshot_del_channel(dac_oneshot_handle_t handle)
+{
+	if (handle == NULL) return ESP_ERR_INVALID_ARG;
+	free(handle);
+	return ESP_OK;
+}
+
+esp_err_t dac_oneshot_output_voltage(dac_oneshot_handle_t handle, uint8_t digi_value)
+{
+	if (handle == NULL) return ESP_ERR_INVALID_ARG;
+	if (stub_dac_out != NULL) stub_dac_out(&digi_value, 1);
+	return ESP_OK;
+}
+
+esp_err_t dac_continuous_new_channels(const dac_continuous_config_t *cfg, dac_continuous_handle_t *ret_handle)
+{
+	if (cfg == NULL || ret_handle == NULL || !cfg->desc_num || !cfg->buf_size ||
+		!cfg->freq_hz) return ESP_ERR_INVALID_ARG;
+	struct dac_continuous *h = calloc(1, sizeof(*h));
+	if (h == NULL) return ESP_ERR_NO_MEM;
+	h->cfg = *cfg;
+	h->desc = calloc(cfg->desc_num, sizeof(uint8_t *));
+	h->fresh = calloc(cfg->desc_num, sizeof(bool));
+	for (uint32_t i = 0; h->desc != NULL && i < cfg->desc_num; i++)
+		if ((h->desc[i] = calloc(1, cfg->buf_size)) == NULL) {
+			dac_continuous_del_channels(h);
+			return ESP_ERR_NO_MEM;
+		}
+	*ret_handle = dma = h;
+	return ESP_OK;
+}
+
+esp_err_t dac_continuous_del_channels(dac_continuous_handle_t h)
+{
+	if (h == NULL || h->enabled) return ESP_ERR_INVALID_STATE;
+	for (uint32_t i = 0; h->desc != NULL && i < h->cfg.desc_num; i++) free(h->desc[i]);
+	free(h->desc);
+	free(h->fresh);
+	if (h == dma) dma = NULL;
+	free(h);
+	return ESP_OK;
+}
+
+esp_err_t dac_continuous_enable(dac_continuous_handle_t h)
+{
+	if (h == NULL || h->enabled) return ESP_ERR_INVALID_STATE;
+	h->enabled = true;
+	return ESP_OK;
+}
+
+esp_err_t dac_continuous_disable(dac_continuous_handle_t h)
+{
+	if (h == NULL || !h->enabled || h->running) return ESP_ERR_INVALID_STATE;
+	h->enabled = false;
+	return ESP_OK;
+}
+
+esp_err_t dac_continuous_register_event_callback(dac_continuous_handle_t h,
+	const dac_event_callbacks_t *callbacks, void *user_data)
+{
+	if (h == NULL || callbacks == NULL) return ESP_ERR_INVALID_ARG;
+	h->cbs = *callbacks;
+	h->user = user_data;
+	return ESP_OK;
+}
+
+esp_err_t dac_continuous_start_async_writing(dac_continuous_handle_t h)
+{
+	if (h == NULL || !h->enabled || h->running) return ESP_ERR_INVALID_STATE;
+	// the driver clears the DMA buffers before the DMA starts
+	for (uint32_t i = 0; i < h->cfg.desc_num; i++) {
+		memset(h->desc[i], 0, h->cfg.buf_size);
+		h->fresh[i] = true;
+	}
+	h->next = 0;
+	h->stale = 0;
+	h->played = 0;
+	h->running = true;
+	return ESP_OK;
+}
+
+esp_err_t dac_continuous_stop_async_writing(dac_continuous_handle_t h)
+{
+	if (h == NULL || !h->running) return ESP_ERR_INVALID_STATE;
+	h->running = false;
+	return ESP_OK;
+}
+
+esp_err_t dac_continuous_write_asynchronously(dac_continuous_handle_t h,
+	uint8_t *dma_buf, size_t dma_buf_len, const uint8_t *data, size_t data_len,
+	size_t *p_loaded_bytes)
+{
+	if (h == NULL || dma_buf == NULL || data == NULL) return ESP_ERR_INVALID_ARG;
+	if (!h->running) return ESP_ERR_INVALID_STATE;
+	size_t n = dma_buf_len / DMA_BYTES;
+	if (n > data_len) n = data_len;
+	for (size_t i = 0; i < n; i++) {
+		memset(dma_buf + i*DMA_BYTES, 0, DMA_BYTES);
+		dma_buf[i*DMA_BYTES + DMA_BYTES-1] = data[i]; // high byte
+	}
+	for (uint32_t d = 0; d < h->cfg.desc_num; d++)
+		if (h->desc[d] == dma_buf) h->fresh[d] = true;
+	if (p_loaded_bytes != NULL) *p_loaded_bytes = n;
+	return ESP_OK;
+}
+
+// Play the next DMA buffer to stub_dac_out, advancing simulated time.
+static void dma_play(struct dac_continuous *h)
+{
+	uint32_t n = h->cfg.buf_size / DMA_BYTES;
+	uint8_t out[n];
+	uint8_t *d = h->desc[h->next];
+
+	bool level = true; // holds one level, a replay is not heard
+	for (uint32_t i = 0; i < n; i++) {
+		out[i] = d[i*DMA_BYTES + DMA_BYTES-1];
+		level &= out[i] == out[0];
+	}
+	if (!h->fresh[h->next] && !level) h->stale++;
+	h->fresh[h->next] = false;
+	if (stub_dac_out != NULL) stub_dac_out(out, n);
+	uint64_t us = h->played * 1000000 / h->cfg.freq_hz;
+	h->played += n;
+	stub_time_advance(h->played * 1000000 / h->cfg.freq_hz - us);
+	h->next = (h->next + 1) % h->cfg.desc_num;
+}
+
+// Play n DMA buffers and run the callback after each. If stub_dac_late is
+// set, it is called before each callback and returns how many more buffers
+// play before the callback runs, as when the interrupt is held off. The
+// callback then gets only the last buffer played, as the end of frame
+// interrupts merge into one, and the buffers in between are not refilled.
+// Return the number of buffers played.
+uint32_t stub_dac_cont_run(uint32_t n)
+{
+	struct dac_continuous *h = dma;
+	uint32_t i = 0;
+
+	while (i < n && h != NULL && h->running) {
+		uint32_t done = h->next;
+		dma_play(h);
+		i++;
+		// buffers played while the interrupt is held off
+		for (uint32_t late = stub_dac_late ? stub_dac_late() : 0; late--; i++) {
+			done = h->next;
+			dma_play(h);
+		}
+		dac_event_data_t ev = {.buf = h->desc[done], .buf_size = h->cfg.buf_size,
+			.write_bytes = h->cfg.buf_size};
+		if (h->cbs.on_convert_done != NULL) h->cbs.on_convert_done(h, &ev, h->user);
+	}
+	return i;
+}
+
+// Return the samples held by one DMA buffer, or zero if none set up.
+uint32_t stub_dac_cont_samples(void)
+{
+	return (dma != NULL) ? dma->cfg.buf_size / DMA_BYTES : 0;
+}
+
+// Return the number of buffers played again without being refilled since
+// their last play, not counting buffers that hold one level (silence).
+uint32_t stub_dac_cont_stale(void)
+{
+	return (dma != NULL) ? dma->stale : 0;
+}
@@ -0,0 +1,79 @@
+#ifndef DAC_CONTINUOUS_H_
+#define DAC_CONTINUOUS_H_
+
+// Host stand-in of the continuous (DMA) DAC driver, see test/CMakeLists.txt.
+// The DMA does not run by itself: stub_dac_cont_run() plays DMA buffers
+// from the ring to stub_dac_out and runs the convert done callback for each
+// one, as the DMA interrupt would. A buffer not written again is played
+// again, as on the chip. With CONFIG_DAC_DMA_AUTO_16BIT_ALIGN each sample
+// takes two bytes of a DMA buffer.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "sdkconfig.h"
+#include "driver/dac_oneshot.h" // stub_dac_out
+
+typedef struct dac_continuous *dac_continuous_handle_t;
+
+typedef enum {DAC_CHANNEL_MASK_CH0 = 1, DAC_CHANNEL_MASK_CH1 = 2, DAC_CHANNEL_MASK_ALL = 3} dac_channel_mask_t;
+typedef enum {DAC_CHANNEL_MODE_SIMUL, DAC_CHANNEL_MODE_ALTER} dac_continuous_channel_mode_t;
+typedef enum {DAC_DIGI_CLK_SRC_DEFAULT, DAC_DIGI_CLK_SRC_APLL} dac_continuous_digi_clk_src_t;
+
+typedef struct {
+	dac_channel_mask_t chan_mask;
+	uint32_t desc_num;
+	size_t buf_size;
+	uint32_t freq_hz;
+	int8_t offset;
+	dac_continuous_digi_clk_src_t clk_src;
+	dac_continuous_channel_mode_t chan_mode;
+} dac_continuous_config_t;
+
+typedef struct {
+	void *buf;
+	size_t buf_size;
+	size_t write_bytes;
+} dac_event_data_t;
+
+typedef bool (*dac_isr_callback_t)(dac_continuous_handle_t handle,
+	const dac_event_data_t *event, void *user_data);
+
+typedef struct {
+	dac_isr_callback_t on_convert_done;
+	dac_isr_callback_t on_stop;
+} dac_event_callbacks_t;
+
+esp_err_t dac_continuous_new_channels(const dac_continuous_config_t *cfg, dac_continuous_handle_t *ret_handle);
+esp_err_t dac_continuous_del_channels(dac_continuous_handle_t handle);
+esp_err_t dac_continuous_enable(dac_continuous_handle_t handle);
+esp_err_t dac_continuous_disable(dac_continuous_handle_t handle);
+esp_err_t dac_continuous_register_event_callback(dac_continuous_handle_t handle,
+	const dac_event_callbacks_t *callbacks, void *user_data);
+esp_err_t dac_continuous_start_async_writing(dac_continuous_handle_t handle);
+esp_err_t dac_continuous_stop_async_writing(dac_continuous_handle_t handle);
+esp_err_t dac_continuous_write_asynchronously(dac_continuous_handle_t handle,
+	uint8_t *dma_buf, size_t dma_buf_len, const uint8_t *data, size_t data_len,
+	size_t *p_loaded_bytes);
+
+// Play n DMA buffers and run the callback after each. If stub_dac_late is
+// set, it is called before each callback and returns how many more buffers
+// play before the callback runs, as when the interrupt is held off. The
+// callback then gets only the last buffer played, as the end of frame
+// interrupts merge into one (the ESP-IDF driver reads one EOF descriptor
+// per interrupt), and the buffers in between are not refilled.
+// Return the number of buffers played.
+uint32_t stub_dac_cont_run(uint32_t n);
+
+// Return the number of buffers played again without being refilled since
+// their last play, not counting buffers that hold one level (silence).
+uint32_t stub_dac_cont_stale(void);
+
+// Return the samples held by one DMA buffer, or zero if none set up.
+uint32_t stub_dac_cont_samples(void);
+
+extern uint32_t (*stub_dac_late)(void);
+
+#endif // DAC_CONTINUOUS_H_
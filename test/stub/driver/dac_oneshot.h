@@ -0,0 +1,28 @@
+#ifndef DAC_ONESHOT_H_
+#define DAC_ONESHOT_H_
+
+// Host stand-in of the one-shot DAC driver, see test/CMakeLists.txt.
+// Samples written go to stub_dac_out, if set.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+typedef enum {DAC_CHAN_0, DAC_CHAN_1} dac_channel_t;
+
+typedef struct dac_oneshot *dac_oneshot_handle_t;
+
+typedef struct {
+	dac_channel_t chan_id;
+} dac_oneshot_config_t;
+
+esp_err_t dac_oneshot_new_channel(const dac_oneshot_config_t *cfg, dac_oneshot_handle_t *ret_handle);
+esp_err_t dac_oneshot_del_channel(dac_oneshot_handle_t handle);
+esp_err_t dac_oneshot_output_voltage(dac_oneshot_handle_t handle, uint8_t digi_value);
+
+// Called with the samples written to a DAC
+extern void (*stub_dac_out)(const uint8_t *buf, size_t n);
+
+#endif // DAC_ONESHOT_H_
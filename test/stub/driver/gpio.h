@@ -0,0 +1,53 @@
+#ifndef GPIO_H_
+#define GPIO_H_
+
+// Host stand-in of the GPIO driver, see test/CMakeLists.txt. Pin levels
+// are set by the test with stub_gpio_input(), as a button or another chip
+// would drive them, and an enabled edge interrupt runs its handler then.
+// Pins read high until driven.
+
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+typedef int gpio_num_t;
+#define GPIO_NUM_MAX 40
+
+typedef enum {
+	GPIO_MODE_DISABLE, GPIO_MODE_INPUT, GPIO_MODE_OUTPUT, GPIO_MODE_INPUT_OUTPUT,
+} gpio_mode_t;
+typedef enum {GPIO_PULLUP_DISABLE, GPIO_PULLUP_ENABLE} gpio_pullup_t;
+typedef enum {GPIO_PULLDOWN_DISABLE, GPIO_PULLDOWN_ENABLE} gpio_pulldown_t;
+typedef enum {
+	GPIO_INTR_DISABLE, GPIO_INTR_POSEDGE, GPIO_INTR_NEGEDGE, GPIO_INTR_ANYEDGE,
+	GPIO_INTR_LOW_LEVEL, GPIO_INTR_HIGH_LEVEL,
+} gpio_int_type_t;
+
+typedef struct {
+	uint64_t pin_bit_mask;
+	gpio_mode_t mode;
+	gpio_pullup_t pull_up_en;
+	gpio_pulldown_t pull_down_en;
+	gpio_int_type_t intr_type;
+} gpio_config_t;
+
+typedef void (*gpio_isr_t)(void *arg);
+
+esp_err_t gpio_config(const gpio_config_t *conf);
+esp_err_t gpio_reset_pin(gpio_num_t pin);
+esp_err_t gpio_set_direction(gpio_num_t pin, gpio_mode_t mode);
+esp_err_t gpio_set_level(gpio_num_t pin, uint32_t level);
+int gpio_get_level(gpio_num_t pin);
+esp_err_t gpio_set_intr_type(gpio_num_t pin, gpio_int_type_t type);
+esp_err_t gpio_install_isr_service(int flags);
+void gpio_uninstall_isr_service(void);
+esp_err_t gpio_isr_handler_add(gpio_num_t pin, gpio_isr_t isr, void *arg);
+esp_err_t gpio_isr_handler_remove(gpio_num_t pin);
+
+// Drive a pin from outside and run its edge interrupt, if enabled.
+// pin: pin number.
+// level: new level, 0 or 1.
+void stub_gpio_input(gpio_num_t pin, int level);
+
+#endif // GPIO_H_
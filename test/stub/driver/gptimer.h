@@ -0,0 +1,65 @@
+#ifndef GPTIMER_H_
+#define GPTIMER_H_
+
+// Host stand-in of the GPTimer driver, see test/CMakeLists.txt. Alarms do
+// not come by themselves: stub_gptimer_run() runs the alarm callback of
+// the started timer, as the timer interrupt would, and moves simulated
+// time (see esp_timer.h) to each alarm.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+typedef struct gptimer *gptimer_handle_t;
+
+typedef enum {GPTIMER_CLK_SRC_DEFAULT} gptimer_clock_source_t;
+typedef enum {GPTIMER_COUNT_DOWN, GPTIMER_COUNT_UP} gptimer_count_direction_t;
+
+typedef struct {
+	gptimer_clock_source_t clk_src;
+	gptimer_count_direction_t direction;
+	uint32_t resolution_hz;
+	int intr_priority;
+} gptimer_config_t;
+
+typedef struct {
+	uint64_t count_value;
+	uint64_t alarm_value;
+} gptimer_alarm_event_data_t;
+
+typedef bool (*gptimer_alarm_cb_t)(gptimer_handle_t timer,
+	const gptimer_alarm_event_data_t *edata, void *user_ctx);
+
+typedef struct {
+	gptimer_alarm_cb_t on_alarm;
+} gptimer_event_callbacks_t;
+
+typedef struct {
+	uint64_t alarm_count;
+	uint64_t reload_count;
+	struct {
+		uint32_t auto_reload_on_alarm: 1;
+	} flags;
+} gptimer_alarm_config_t;
+
+esp_err_t gptimer_new_timer(const gptimer_config_t *config, gptimer_handle_t *ret_timer);
+esp_err_t gptimer_del_timer(gptimer_handle_t timer);
+esp_err_t gptimer_register_event_callbacks(gptimer_handle_t timer,
+	const gptimer_event_callbacks_t *cbs, void *user_data);
+esp_err_t gptimer_set_alarm_action(gptimer_handle_t timer, const gptimer_alarm_config_t *config);
+esp_err_t gptimer_enable(gptimer_handle_t timer);
+esp_err_t gptimer_disable(gptimer_handle_t timer);
+esp_err_t gptimer_start(gptimer_handle_t timer);
+esp_err_t gptimer_stop(gptimer_handle_t timer);
+
+// Run the alarm callback of the started timer n times, each at its alarm
+// time in simulated time.
+// Return the number of alarms run.
+uint32_t stub_gptimer_run(uint32_t n);
+
+// Return the alarm period in timer ticks, or zero if no timer is set up.
+uint64_t stub_gptimer_period(void);
+
+#endif // GPTIMER_H_
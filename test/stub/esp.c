@@ -0,0 +1,43 @@
+// Host stand-ins of ESP-IDF system functions, see test/CMakeLists.txt.
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_random.h"
+
+esp_log_level_t stub_log_level = ESP_LOG_WARN;
+
+const char *esp_err_to_name(esp_err_t code)
+{
+	static char name[16];
+	snprintf(name, sizeof(name), "0x%x", (unsigned)code);
+	return name;
+}
+
+void stub_log(esp_log_level_t level, const char *tag, const char *fmt, ...)
+{
+	static const char LETTER[] = " EWIDV";
+	va_list ap;
+
+	if (level > stub_log_level) return;
+	fprintf(stderr, "%c (%s) ", LETTER[level], tag);
+	va_start(ap, fmt);
+	vfprintf(stderr, fmt, ap);
+	va_end(ap);
+	fputc('\n', stderr);
+}
+
+uint32_t esp_random(void)
+{
+	static uint32_t x;
+
+	if (!x) x = ((uint32_t)time(NULL) * 2654435761u ^ (uint32_t)getpid() << 16) | 1;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	return x;
+}
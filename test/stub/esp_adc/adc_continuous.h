@@ -0,0 +1,95 @@
+#ifndef ADC_CONTINUOUS_H_
+#define ADC_CONTINUOUS_H_
+
+// Host stand-in of the continuous (DMA) ADC driver on the ESP32, see
+// test/CMakeLists.txt. The DMA does not run by itself: stub_adc_run()
+// converts frames of samples from the scripted input stub_adc_in, cycling
+// through the pattern as the ADC does, and runs the conversion done
+// callback for each frame, as the DMA interrupt would.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+#define SOC_ADC_DIGI_RESULT_BYTES 2
+#define SOC_ADC_DIGI_MAX_BITWIDTH 12
+
+typedef struct adc_continuous_ctx_t *adc_continuous_handle_t;
+
+typedef enum {ADC_UNIT_1, ADC_UNIT_2} adc_unit_t;
+typedef enum {
+	ADC_CHANNEL_0, ADC_CHANNEL_1, ADC_CHANNEL_2, ADC_CHANNEL_3, ADC_CHANNEL_4,
+	ADC_CHANNEL_5, ADC_CHANNEL_6, ADC_CHANNEL_7, ADC_CHANNEL_8, ADC_CHANNEL_9,
+} adc_channel_t;
+typedef enum {ADC_ATTEN_DB_0, ADC_ATTEN_DB_2_5, ADC_ATTEN_DB_6, ADC_ATTEN_DB_12} adc_atten_t;
+typedef enum {ADC_CONV_SINGLE_UNIT_1 = 1, ADC_CONV_SINGLE_UNIT_2} adc_digi_convert_mode_t;
+typedef enum {ADC_DIGI_OUTPUT_FORMAT_TYPE1, ADC_DIGI_OUTPUT_FORMAT_TYPE2} adc_digi_output_format_t;
+
+typedef struct {
+	uint8_t atten;
+	uint8_t channel;
+	uint8_t unit;
+	uint8_t bit_width;
+} adc_digi_pattern_config_t;
+
+// One conversion result, ESP32 type 1 format.
+typedef struct {
+	union {
+		struct {
+			uint16_t data: 12;
+			uint16_t channel: 4;
+		} type1;
+		uint16_t val;
+	};
+} adc_digi_output_data_t;
+
+typedef struct {
+	uint32_t max_store_buf_size;
+	uint32_t conv_frame_size;
+	struct {
+		uint32_t flush_pool: 1;
+	} flags;
+} adc_continuous_handle_cfg_t;
+
+typedef struct {
+	uint32_t pattern_num;
+	adc_digi_pattern_config_t *adc_pattern;
+	uint32_t sample_freq_hz;
+	adc_digi_convert_mode_t conv_mode;
+	adc_digi_output_format_t format;
+} adc_continuous_config_t;
+
+typedef struct {
+	uint8_t *conv_frame_buffer;
+	uint32_t size;
+} adc_continuous_evt_data_t;
+
+typedef bool (*adc_continuous_callback_t)(adc_continuous_handle_t handle,
+	const adc_continuous_evt_data_t *edata, void *user_data);
+
+typedef struct {
+	adc_continuous_callback_t on_conv_done;
+	adc_continuous_callback_t on_pool_ovf;
+} adc_continuous_evt_cbs_t;
+
+esp_err_t adc_continuous_new_handle(const adc_continuous_handle_cfg_t *cfg, adc_continuous_handle_t *ret_handle);
+esp_err_t adc_continuous_config(adc_continuous_handle_t handle, const adc_continuous_config_t *config);
+esp_err_t adc_continuous_register_event_callbacks(adc_continuous_handle_t handle,
+	const adc_continuous_evt_cbs_t *cbs, void *user_data);
+esp_err_t adc_continuous_start(adc_continuous_handle_t handle);
+esp_err_t adc_continuous_stop(adc_continuous_handle_t handle);
+esp_err_t adc_continuous_deinit(adc_continuous_handle_t handle);
+esp_err_t adc_continuous_io_to_channel(int io_num, adc_unit_t *unit_id, adc_channel_t *channel);
+
+// Convert n frames and run the callback after each. Sample k of a channel
+// (counted from the start, at the pattern rate) reads stub_adc_in(ch, k),
+// or mid scale if no input is set.
+// Return the number of frames converted, zero if the ADC is not started.
+uint32_t stub_adc_run(uint32_t n);
+
+extern uint16_t (*stub_adc_in)(uint32_t chan, uint64_t k);
+
+#endif // ADC_CONTINUOUS_H_
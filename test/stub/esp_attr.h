@@ -0,0 +1,12 @@
+#ifndef ESP_ATTR_H_
+#define ESP_ATTR_H_
+
+// Host stand-in of the ESP-IDF memory placement attributes, see
+// test/CMakeLists.txt. The host has one kind of memory.
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define RTC_DATA_ATTR
+#define EXT_RAM_BSS_ATTR
+
+#endif // ESP_ATTR_H_
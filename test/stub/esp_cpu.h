@@ -0,0 +1,18 @@
+#ifndef ESP_CPU_H_
+#define ESP_CPU_H_
+
+// Host stand-in of the CPU cycle counter, see test/CMakeLists.txt. Counts
+// nanoseconds of the host monotonic clock, so "cycles" measured on the
+// host are host nanoseconds, not ESP32 cycles.
+
+#include <stdint.h>
+#include <time.h>
+
+static inline uint32_t esp_cpu_get_cycle_count(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint32_t)((uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec);
+}
+
+#endif // ESP_CPU_H_
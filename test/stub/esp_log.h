@@ -0,0 +1,30 @@
+#ifndef ESP_LOG_H_
+#define ESP_LOG_H_
+
+// Host stand-in of ESP-IDF logging, see test/CMakeLists.txt. Errors and
+// warnings go to stderr, other levels only if stub_log_level is raised.
+
+#include <stddef.h> // as the ESP-IDF header, by way of esp_rom_sys.h
+#include <stdint.h>
+
+#include "sdkconfig.h"
+
+typedef enum {
+	ESP_LOG_NONE, ESP_LOG_ERROR, ESP_LOG_WARN, ESP_LOG_INFO, ESP_LOG_DEBUG, ESP_LOG_VERBOSE
+} esp_log_level_t;
+
+extern esp_log_level_t stub_log_level; // Highest level printed
+
+void stub_log(esp_log_level_t level, const char *tag, const char *fmt, ...)
+	__attribute__((format(printf, 3, 4)));
+
+#define ESP_LOGE(tag, fmt, ...) stub_log(ESP_LOG_ERROR, tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGW(tag, fmt, ...) stub_log(ESP_LOG_WARN, tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGI(tag, fmt, ...) stub_log(ESP_LOG_INFO, tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGD(tag, fmt, ...) stub_log(ESP_LOG_DEBUG, tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGV(tag, fmt, ...) stub_log(ESP_LOG_VERBOSE, tag, fmt, ##__VA_ARGS__)
+#define ESP_EARLY_LOGE ESP_LOGE
+#define ESP_EARLY_LOGW ESP_LOGW
+#define ESP_DRAM_LOGE ESP_LOGE
+
+#endif // ESP_LOG_H_
@@ -0,0 +1,63 @@
+// Host stand-in of the partition API, see esp_partition.h.
+
+#include <string.h>
+
+#include "esp_partition.h"
+
+#define PART_MAX 8
+
+typedef struct {
+	esp_partition_t part;
+	const uint8_t *data;
+} stub_part_t;
+
+// Global variables
+static stub_part_t parts[PART_MAX];
+static uint32_t nparts;
+static uint32_t reads;
+
+
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t type,
+	esp_partition_subtype_t subtype, const char *label)
+{
+	for (uint32_t i = 0; i < nparts; i++) {
+		const esp_partition_t *p = &parts[i].part;
+		if (p->type != type) continue;
+		if (subtype != ESP_PARTITION_SUBTYPE_ANY && p->subtype != subtype) continue;
+		if (label != NULL && strcmp(p->label, label)) continue;
+		return p;
+	}
+	return NULL;
+}
+
+esp_err_t esp_partition_read(const esp_partition_t *partition,
+	size_t src_offset, void *dst, size_t size)
+{
+	const stub_part_t *sp = (const stub_part_t *)partition;
+
+	if (partition == NULL || dst == NULL) return ESP_ERR_INVALID_ARG;
+	if (src_offset > partition->size || size > partition->size - src_offset)
+		return ESP_ERR_INVALID_SIZE;
+	memcpy(dst, sp->data + src_offset, size);
+	reads++;
+	return ESP_OK;
+}
+
+// Add a data partition holding size bytes of data (not copied).
+// Return zero if successful, or non-zero otherwise.
+int stub_partition_add(const char *label, const void *data, uint32_t size)
+{
+	if (nparts == PART_MAX || label == NULL || strlen(label) > 16) return 1;
+	stub_part_t *sp = &parts[nparts++];
+	sp->part = (esp_partition_t){.type = ESP_PARTITION_TYPE_DATA,
+		.subtype = 0x80, .address = 0x110000 * nparts, .size = size};
+	strcpy(sp->part.label, label);
+	sp->data = data;
+	return 0;
+}
+
+// Return the number of esp_partition_read() calls.
+uint32_t stub_partition_reads(void)
+{
+	return reads;
+}
@@ -0,0 +1,41 @@
+#ifndef ESP_PARTITION_H_
+#define ESP_PARTITION_H_
+
+// Host stand-in of the partition API, see test/CMakeLists.txt. Partitions
+// are memory buffers added by the test with stub_partition_add().
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+
+typedef enum {
+	ESP_PARTITION_TYPE_APP = 0x00,
+	ESP_PARTITION_TYPE_DATA = 0x01,
+} esp_partition_type_t;
+
+typedef enum {
+	ESP_PARTITION_SUBTYPE_ANY = 0xff,
+} esp_partition_subtype_t;
+
+typedef struct {
+	esp_partition_type_t type;
+	esp_partition_subtype_t subtype;
+	uint32_t address;
+	uint32_t size;
+	char label[17];
+} esp_partition_t;
+
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t type,
+	esp_partition_subtype_t subtype, const char *label);
+esp_err_t esp_partition_read(const esp_partition_t *partition,
+	size_t src_offset, void *dst, size_t size);
+
+// Add a data partition holding size bytes of data (not copied).
+// Return zero if successful, or non-zero otherwise.
+int stub_partition_add(const char *label, const void *data, uint32_t size);
+
+// Return the number of esp_partition_read() calls.
+uint32_t stub_partition_reads(void);
+
+#endif // ESP_PARTITION_H_
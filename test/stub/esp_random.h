@@ -0,0 +1,12 @@
+#ifndef ESP_RANDOM_H_
+#define ESP_RANDOM_H_
+
+// Host stand-in of the hardware random number generator, see
+// test/CMakeLists.txt. Seeded from the time and process id, so each run,
+// and each process of a test, gets other numbers.
+
+#include <stdint.h>
+
+uint32_t esp_random(void);
+
+#endif // ESP_RANDOM_H_
@@ -0,0 +1,127 @@
+// Host stand-in of esp_timer, see esp_timer.h.
+
+#include <stdlib.h>
+#include <time.h>
+
+#include "freertos/FreeRTOS.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#define TIMER_MAX 64
+
+struct esp_timer {
+	esp_timer_create_args_t args;
+	bool active;
+	int64_t expiry;
+	uint64_t period; // 0 for a one-shot timer
+};
+
+// Global variables
+static struct esp_timer *timers[TIMER_MAX];
+static bool sim; // simulated time
+static int64_t sim_now;
+
+
+int64_t esp_timer_get_time(void)
+{
+	struct timespec ts;
+
+	if (sim) return sim_now;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t *args, esp_timer_handle_t *out)
+{
+	if (args == NULL || args->callback == NULL || out == NULL) return ESP_ERR_INVALID_ARG;
+	for (uint32_t i = 0; i < TIMER_MAX; i++) {
+		if (timers[i] != NULL) continue;
+		timers[i] = calloc(1, sizeof(struct esp_timer));
+		if (timers[i] == NULL) return ESP_ERR_NO_MEM;
+		timers[i]->args = *args;
+		*out = timers[i];
+		return ESP_OK;
+	}
+	return ESP_ERR_NO_MEM;
+}
+
+static esp_err_t timer_start(esp_timer_handle_t t, uint64_t us, uint64_t period)
+{
+	if (t == NULL) return ESP_ERR_INVALID_ARG;
+	stub_critical_enter();
+	esp_err_t ret = t->active ? ESP_ERR_INVALID_STATE : ESP_OK;
+	if (ret == ESP_OK) {
+		t->active = true;
+		t->expiry = esp_timer_get_time() + us;
+		t->period = period;
+	}
+	stub_critical_exit();
+	return ret;
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us)
+{
+	return timer_start(timer, timeout_us, 0);
+}
+
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period_us)
+{
+	return timer_start(timer, period_us, period_us);
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer)
+{
+	if (timer == NULL) return ESP_ERR_INVALID_ARG;
+	stub_critical_enter();
+	esp_err_t ret = timer->active ? ESP_OK : ESP_ERR_INVALID_STATE;
+	timer->active = false;
+	stub_critical_exit();
+	return ret;
+}
+
+esp_err_t esp_timer_delete(esp_timer_handle_t timer)
+{
+	if (timer == NULL) return ESP_ERR_INVALID_ARG;
+	if (timer->active) return ESP_ERR_INVALID_STATE;
+	for (uint32_t i = 0; i < TIMER_MAX; i++)
+		if (timers[i] == timer) timers[i] = NULL;
+	free(timer);
+	return ESP_OK;
+}
+
+bool esp_timer_is_active(esp_timer_handle_t timer)
+{
+	return timer != NULL && timer->active;
+}
+
+// Switch to simulated time, starting at now_us.
+void stub_time_set(int64_t now_us)
+{
+	sim = true;
+	sim_now = now_us;
+}
+
+// Move simulated time ahead and run the timers that expire.
+void stub_time_advance(int64_t us)
+{
+	int64_t end = sim_now + us;
+
+	for (;;) {
+		struct esp_timer *next = NULL;
+		stub_critical_enter();
+		for (uint32_t i = 0; i < TIMER_MAX; i++) {
+			struct esp_timer *t = timers[i];
+			if (t != NULL && t->active && t->expiry <= end &&
+				(next == NULL || t->expiry < next->expiry)) next = t;
+		}
+		if (next != NULL) {
+			sim_now = next->expiry;
+			if (next->period) next->expiry += next->period;
+			else next->active = false;
+		}
+		stub_critical_exit();
+		if (next == NULL) break;
+		next->args.callback(next->args.arg);
+	}
+	sim_now = end;
+}
@@ -0,0 +1,44 @@
+#ifndef ESP_TIMER_H_
+#define ESP_TIMER_H_
+
+// Host stand-in of esp_timer, see test/CMakeLists.txt.
+//
+// Time is the host monotonic clock until a test calls stub_time_set().
+// From then on time only moves with stub_time_advance(), which runs the
+// callbacks of the timers that expire on the way, in order, each at its
+// expiry time. Timers only run in this simulated time.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+typedef struct esp_timer *esp_timer_handle_t;
+typedef void (*esp_timer_cb_t)(void *arg);
+
+typedef enum {ESP_TIMER_TASK, ESP_TIMER_ISR} esp_timer_dispatch_t;
+
+typedef struct {
+	esp_timer_cb_t callback;
+	void *arg;
+	esp_timer_dispatch_t dispatch_method;
+	const char *name;
+	bool skip_unhandled_events;
+} esp_timer_create_args_t;
+
+int64_t esp_timer_get_time(void);
+esp_err_t esp_timer_create(const esp_timer_create_args_t *args, esp_timer_handle_t *out);
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us);
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period_us);
+esp_err_t esp_timer_stop(esp_timer_handle_t timer);
+esp_err_t esp_timer_delete(esp_timer_handle_t timer);
+bool esp_timer_is_active(esp_timer_handle_t timer);
+
+// Switch to simulated time, starting at now_us.
+void stub_time_set(int64_t now_us);
+
+// Move simulated time ahead and run the timers that expire.
+void stub_time_advance(int64_t us);
+
+#endif // ESP_TIMER_H_
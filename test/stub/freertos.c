@@ -0,0 +1,225 @@
+// Host stand-in of FreeRTOS on POSIX threads, see freertos/FreeRTOS.h.
+
+#define _GNU_SOURCE // PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+
+struct queue {
+	pthread_mutex_t lock;
+	pthread_cond_t changed;
+	uint8_t *buf;
+	UBaseType_t len, size; // items, bytes per item
+	UBaseType_t head, count;
+};
+
+typedef struct {
+	TaskFunction_t fn;
+	void *arg;
+	BaseType_t core;
+} task_start_t;
+
+static pthread_mutex_t critical = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP;
+static pthread_mutex_t creating = PTHREAD_MUTEX_INITIALIZER; // Held until the handle is stored
+static __thread BaseType_t core; // Core of the calling thread
+
+
+void stub_critical_enter(void)
+{
+	pthread_mutex_lock(&critical);
+}
+
+void stub_critical_exit(void)
+{
+	pthread_mutex_unlock(&critical);
+}
+
+// Wait on a condition for up to a number of ticks. Return false on timeout.
+static bool wait_ticks(pthread_cond_t *cond, pthread_mutex_t *lock, TickType_t wait)
+{
+	if (wait == portMAX_DELAY) return pthread_cond_wait(cond, lock) == 0;
+	struct timespec ts;
+	clock_gettime(CLOCK_REALTIME, &ts);
+	uint64_t ns = ts.tv_nsec + (uint64_t)wait * portTICK_PERIOD_MS * 1000000;
+	ts.tv_sec += ns / 1000000000;
+	ts.tv_nsec = ns % 1000000000;
+	return pthread_cond_timedwait(cond, lock, &ts) == 0;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t len, UBaseType_t item_size)
+{
+	struct queue *q = calloc(1, sizeof(*q));
+	if (q == NULL) return NULL;
+	q->buf = malloc((size_t)len * item_size);
+	if (q->buf == NULL) {
+		free(q);
+		return NULL;
+	}
+	q->len = len;
+	q->size = item_size;
+	pthread_mutex_init(&q->lock, NULL);
+	pthread_cond_init(&q->changed, NULL);
+	return q;
+}
+
+void vQueueDelete(QueueHandle_t q)
+{
+	pthread_mutex_destroy(&q->lock);
+	pthread_cond_destroy(&q->changed);
+	free(q->buf);
+	free(q);
+}
+
+BaseType_t xQueueSend(QueueHandle_t q, const void *item, TickType_t wait)
+{
+	BaseType_t ret = pdFALSE;
+
+	pthread_mutex_lock(&q->lock);
+	while (q->count == q->len && wait && wait_ticks(&q->changed, &q->lock, wait)) ;
+	if (q->count < q->len) {
+		memcpy(q->buf + (q->head + q->count) % q->len * q->size, item, q->size);
+		q->count++;
+		pthread_cond_broadcast(&q->changed);
+		ret = pdTRUE;
+	}
+	pthread_mutex_unlock(&q->lock);
+	return ret;
+}
+
+BaseType_t xQueueSendFromISR(QueueHandle_t q, const void *item, BaseType_t *woken)
+{
+	if (woken != NULL) *woken = pdFALSE;
+	return xQueueSend(q, item, 0);
+}
+
+// Copy the oldest item, and take it off the queue if take is true.
+static BaseType_t queue_get(QueueHandle_t q, void *item, TickType_t wait, bool take)
+{
+	BaseType_t ret = pdFALSE;
+
+	pthread_mutex_lock(&q->lock);
+	while (!q->count && wait && wait_ticks(&q->changed, &q->lock, wait)) ;
+	if (q->count) {
+		memcpy(item, q->buf + q->head * q->size, q->size);
+		if (take) {
+			q->head = (q->head + 1) % q->len;
+			q->count--;
+			pthread_cond_broadcast(&q->changed);
+		}
+		ret = pdTRUE;
+	}
+	pthread_mutex_unlock(&q->lock);
+	return ret;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t q, void *item, TickType_t wait)
+{
+	return queue_get(q, item, wait, true);
+}
+
+BaseType_t xQueuePeek(QueueHandle_t q, void *item, TickType_t wait)
+{
+	return queue_get(q, item, wait, false);
+}
+
+BaseType_t xQueueReset(QueueHandle_t q)
+{
+	pthread_mutex_lock(&q->lock);
+	q->head = q->count = 0;
+	pthread_cond_broadcast(&q->changed);
+	pthread_mutex_unlock(&q->lock);
+	return pdPASS;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t q)
+{
+	pthread_mutex_lock(&q->lock);
+	UBaseType_t n = q->count;
+	pthread_mutex_unlock(&q->lock);
+	return n;
+}
+
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t q)
+{
+	pthread_mutex_lock(&q->lock);
+	UBaseType_t n = q->len - q->count;
+	pthread_mutex_unlock(&q->lock);
+	return n;
+}
+
+static void *task_run(void *p)
+{
+	task_start_t st = *(task_start_t *)p;
+
+	free(p);
+	core = st.core;
+	// as a new task of lower priority, start after the creator has the handle
+	pthread_mutex_lock(&creating);
+	pthread_mutex_unlock(&creating);
+	st.fn(st.arg);
+	return NULL;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack,
+	void *arg, UBaseType_t prio, TaskHandle_t *task, BaseType_t core_id)
+{
+	pthread_t th;
+	task_start_t *st = malloc(sizeof(*st));
+
+	if (st == NULL) return pdFAIL;
+	*st = (task_start_t){fn, arg, (core_id < 0) ? 0 : core_id};
+	pthread_mutex_lock(&creating);
+	if (pthread_create(&th, NULL, task_run, st)) {
+		pthread_mutex_unlock(&creating);
+		free(st);
+		return pdFAIL;
+	}
+	pthread_detach(th);
+	if (task != NULL) *task = (TaskHandle_t)(uintptr_t)th;
+	pthread_mutex_unlock(&creating);
+	return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack,
+	void *arg, UBaseType_t prio, TaskHandle_t *task)
+{
+	return xTaskCreatePinnedToCore(fn, name, stack, arg, prio, task, -1);
+}
+
+// Only a task deleting itself (NULL) is supported.
+void vTaskDelete(TaskHandle_t task)
+{
+	if (task == NULL) pthread_exit(NULL);
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+	struct timespec ts = {
+		.tv_sec = ticks * portTICK_PERIOD_MS / 1000,
+		.tv_nsec = ticks * portTICK_PERIOD_MS % 1000 * 1000000L,
+	};
+	nanosleep(&ts, NULL);
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (TickType_t)(((uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000) / portTICK_PERIOD_MS);
+}
+
+BaseType_t xPortGetCoreID(void)
+{
+	return core;
+}
+
+// Set the core number of the calling thread.
+void stub_core_set(BaseType_t core_id)
+{
+	core = core_id;
+}
@@ -0,0 +1,40 @@
+#ifndef FREERTOS_H_
+#define FREERTOS_H_
+
+// Host stand-in of FreeRTOS on POSIX threads, see test/CMakeLists.txt.
+// Critical sections share one recursive mutex, so they keep out every other
+// thread, as disabling interrupts on both cores would.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sdkconfig.h"
+#include "esp_attr.h"
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdFALSE 0
+#define pdTRUE  1
+#define pdFAIL  pdFALSE
+#define pdPASS  pdTRUE
+#define portMAX_DELAY UINT32_MAX
+#define configTICK_RATE_HZ 1000
+#define portTICK_PERIOD_MS (1000 / configTICK_RATE_HZ)
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms) * configTICK_RATE_HZ / 1000)
+
+typedef int portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED 0
+
+void stub_critical_enter(void);
+void stub_critical_exit(void);
+
+#define portENTER_CRITICAL(mux) ((void)(mux), stub_critical_enter())
+#define portEXIT_CRITICAL(mux) ((void)(mux), stub_critical_exit())
+#define portENTER_CRITICAL_ISR(mux) portENTER_CRITICAL(mux)
+#define portEXIT_CRITICAL_ISR(mux) portEXIT_CRITICAL(mux)
+#define portYIELD_FROM_ISR(...) ((void)0)
+
+#endif // FREERTOS_H_
@@ -0,0 +1,23 @@
+#ifndef QUEUE_H_
+#define QUEUE_H_
+
+// Host stand-in of FreeRTOS queues, see freertos/FreeRTOS.h.
+
+#include "freertos/FreeRTOS.h"
+
+typedef struct queue *QueueHandle_t;
+
+QueueHandle_t xQueueCreate(UBaseType_t len, UBaseType_t item_size);
+void vQueueDelete(QueueHandle_t q);
+BaseType_t xQueueSend(QueueHandle_t q, const void *item, TickType_t wait);
+BaseType_t xQueueSendFromISR(QueueHandle_t q, const void *item, BaseType_t *woken);
+BaseType_t xQueueReceive(QueueHandle_t q, void *item, TickType_t wait);
+BaseType_t xQueuePeek(QueueHandle_t q, void *item, TickType_t wait);
+BaseType_t xQueueReset(QueueHandle_t q);
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t q);
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t q);
+
+#define xQueueSendToBack xQueueSend
+#define xQueueReceiveFromISR(q, item, woken) xQueueReceive(q, item, 0)
+
+#endif // QUEUE_H_
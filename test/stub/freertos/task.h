@@ -0,0 +1,28 @@
+#ifndef TASK_H_
+#define TASK_H_
+
+// Host stand-in of FreeRTOS tasks, see freertos/FreeRTOS.h. A task is a
+// POSIX thread. Each thread has a core number, 0 unless set with
+// stub_core_set(), so code that runs in an ISR on one core can be run in
+// its own thread on "another core".
+
+#include "freertos/FreeRTOS.h"
+
+typedef struct task *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *arg);
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack,
+	void *arg, UBaseType_t prio, TaskHandle_t *task);
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack,
+	void *arg, UBaseType_t prio, TaskHandle_t *task, BaseType_t core);
+void vTaskDelete(TaskHandle_t task);
+void vTaskDelay(TickType_t ticks);
+TickType_t xTaskGetTickCount(void);
+BaseType_t xPortGetCoreID(void);
+
+#define taskYIELD() ((void)0)
+
+// Set the core number of the calling thread.
+void stub_core_set(BaseType_t core);
+
+#endif // TASK_H_
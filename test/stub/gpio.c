@@ -0,0 +1,102 @@
+// Host stand-in of the GPIO driver, see driver/gpio.h.
+
+#include <stdbool.h>
+
+#include "driver/gpio.h"
+
+typedef struct {
+	bool low;  // driven low by the test (pins start high)
+	gpio_int_type_t intr;
+	gpio_isr_t isr;
+	void *arg;
+} pin_t;
+
+// Global variables
+static pin_t pins[GPIO_NUM_MAX];
+static bool isr_service;
+
+
+static bool pin_ok(gpio_num_t pin)
+{
+	return pin >= 0 && pin < GPIO_NUM_MAX;
+}
+
+esp_err_t gpio_config(const gpio_config_t *conf)
+{
+	if (conf == NULL || conf->pin_bit_mask >> GPIO_NUM_MAX) return ESP_ERR_INVALID_ARG;
+	for (gpio_num_t pin = 0; pin < GPIO_NUM_MAX; pin++)
+		if (conf->pin_bit_mask >> pin & 1) pins[pin].intr = conf->intr_type;
+	return ESP_OK;
+}
+
+esp_err_t gpio_reset_pin(gpio_num_t pin)
+{
+	if (!pin_ok(pin)) return ESP_ERR_INVALID_ARG;
+	pins[pin].intr = GPIO_INTR_DISABLE;
+	return ESP_OK;
+}
+
+esp_err_t gpio_set_direction(gpio_num_t pin, gpio_mode_t mode)
+{
+	return pin_ok(pin) ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t gpio_set_level(gpio_num_t pin, uint32_t level)
+{
+	if (!pin_ok(pin)) return ESP_ERR_INVALID_ARG;
+	pins[pin].low = !level;
+	return ESP_OK;
+}
+
+int gpio_get_level(gpio_num_t pin)
+{
+	return pin_ok(pin) && !pins[pin].low;
+}
+
+esp_err_t gpio_set_intr_type(gpio_num_t pin, gpio_int_type_t type)
+{
+	if (!pin_ok(pin)) return ESP_ERR_INVALID_ARG;
+	pins[pin].intr = type;
+	return ESP_OK;
+}
+
+esp_err_t gpio_install_isr_service(int flags)
+{
+	if (isr_service) return ESP_ERR_INVALID_STATE;
+	isr_service = true;
+	return ESP_OK;
+}
+
+void gpio_uninstall_isr_service(void)
+{
+	isr_service = false;
+}
+
+esp_err_t gpio_isr_handler_add(gpio_num_t pin, gpio_isr_t isr, void *arg)
+{
+	if (!isr_service) return ESP_ERR_INVALID_STATE;
+	if (!pin_ok(pin)) return ESP_ERR_INVALID_ARG;
+	pins[pin].isr = isr;
+	pins[pin].arg = arg;
+	return ESP_OK;
+}
+
+esp_err_t gpio_isr_handler_remove(gpio_num_t pin)
+{
+	if (!pin_ok(pin)) return ESP_ERR_INVALID_ARG;
+	pins[pin].isr = NULL;
+	return ESP_OK;
+}
+
+// Drive a pin from outside and run its edge interrupt, if enabled.
+void stub_gpio_input(gpio_num_t pin, int level)
+{
+	if (!pin_ok(pin)) return;
+	bool was = !pins[pin].low;
+	pins[pin].low = !level;
+	if (was == !!level || pins[pin].isr == NULL) return;
+	gpio_int_type_t t = pins[pin].intr;
+	if (t == GPIO_INTR_ANYEDGE || (t == GPIO_INTR_POSEDGE && level) ||
+		(t == GPIO_INTR_NEGEDGE && !level))
+		pins[pin].isr(pins[pin].arg);
+}
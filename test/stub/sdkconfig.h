@@ -0,0 +1,42 @@
+#ifndef SDKCONFIG_H_
+#define SDKCONFIG_H_
+
+// Host stand-in of the generated sdkconfig.h, see test/CMakeLists.txt.
+// Holds the Kconfig defaults of the components under test. A test may set
+// its own values with DEFINES in host_test().
+
+#ifndef CONFIG_BUTTON_DEBOUNCE_MS
+#define CONFIG_BUTTON_DEBOUNCE_MS 20
+#endif
+#ifndef CONFIG_BUTTON_LONG_MS
+#define CONFIG_BUTTON_LONG_MS 800
+#endif
+#ifndef CONFIG_BUTTON_QUEUE_LEN
+#define CONFIG_BUTTON_QUEUE_LEN 16
+#endif
+#ifndef CONFIG_DAC_DMA_AUTO_16BIT_ALIGN
+#define CONFIG_DAC_DMA_AUTO_16BIT_ALIGN 1
+#endif
+#ifndef CONFIG_SOUND_DAC_DESC_NUM
+#define CONFIG_SOUND_DAC_DESC_NUM 8
+#endif
+#ifndef CONFIG_SOUND_DAC_BUF_SZ
+#define CONFIG_SOUND_DAC_BUF_SZ 128
+#endif
+#ifndef CONFIG_SOUND_STREAM_RING_SZ
+#define CONFIG_SOUND_STREAM_RING_SZ 4096
+#endif
+#ifndef CONFIG_LOCKSTEP_DELAY
+#define CONFIG_LOCKSTEP_DELAY 3
+#endif
+#ifndef CONFIG_LOCKSTEP_HASH_PERIOD
+#define CONFIG_LOCKSTEP_HASH_PERIOD 16
+#endif
+#ifndef CONFIG_JOY_SAMPLE_HZ
+#define CONFIG_JOY_SAMPLE_HZ 20000
+#endif
+#ifndef CONFIG_JOY_FILTER_SHIFT
+#define CONFIG_JOY_FILTER_SHIFT 2
+#endif
+
+#endif // SDKCONFIG_H_
@@ -0,0 +1,163 @@
+// Lab05 computer opponent (ai.c) checks and benchmark, built for each board
+// size in test/CMakeLists.txt. The checks cover taking a win, blocking a
+// loss, never losing to random moves, a draw against itself on 3x3, and the
+// search stopping within its time budget. The benchmark prints the nodes
+// per second and the depth reached in the game's time budget and others,
+// from the empty board and from the middle of a game.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "esp_timer.h"
+#include "board.h"
+#include "ai.h"
+#include "config.h"
+#include "check.h"
+
+#define R CONFIG_BOARD_R
+#define C CONFIG_BOARD_C
+#define N CONFIG_BOARD_N
+#define SPACES CONFIG_BOARD_SPACES
+#define GAME_US ((uint32_t)(CONFIG_GAME_TIMER_PERIOD * 1000000)) // Game tick
+#define FAST_US 5000 // Budget of the games against random moves
+#define LATE_US 10000 // Host scheduling allowed past the budget
+#define RANDOM_GAMES 20
+#define MID_MOVES (SPACES/4) // Moves played before the mid game benchmark
+
+// Global variables
+static uint32_t seed = 1;
+
+
+// Play a move found by the computer and check it is legal.
+static void ai_play(mark_t m, uint32_t budget_us)
+{
+	int8_t r, c;
+
+	CHECK(ai_move(m, budget_us, &r, &c));
+	CHECK(r >= 0 && r < R && c >= 0 && c < C);
+	CHECK(board_set(r, c, m));
+}
+
+// Play a random free cell.
+static void random_play(mark_t m)
+{
+	int8_t i;
+
+	do i = rand_r(&seed) % SPACES; while (board_get(i / C, i % C) != no_m);
+	board_set(i / C, i % C, m);
+}
+
+static bool game_over(void)
+{
+	return board_winner(X_m) || board_winner(O_m) || board_mark_count() == SPACES;
+}
+
+// Takes N in a row when it can, and blocks N in a row of the other side.
+static void test_tactics(void)
+{
+	int8_t r, c;
+
+	ai_new_game();
+	board_clear();
+	for (int8_t j = 0; j < N-1; j++) {
+		board_set(0, j, X_m);
+		board_set(1, j, O_m);
+	}
+	CHECK(ai_move(X_m, GAME_US, &r, &c));
+	CHECK_EQ(r, 0);
+	CHECK_EQ(c, N-1);
+
+	ai_new_game();
+	board_clear();
+	board_set(0, 0, X_m);
+	board_set(R-1, C-1, X_m);
+	for (int8_t j = 0; j < N-1; j++) board_set(1, j, O_m);
+	CHECK(ai_move(X_m, GAME_US, &r, &c));
+	CHECK_EQ(r, 1);
+	CHECK_EQ(c, N-1);
+
+	// a full board has no move
+	board_clear();
+	for (int8_t i = 0; i < SPACES; i++) board_set(i / C, i % C, X_m);
+	CHECK(!ai_move(O_m, GAME_US, &r, &c));
+}
+
+// The computer, moving first or second, never loses to random moves, and
+// stops each search near its budget.
+static void test_random(void)
+{
+	uint32_t wins = 0, draws = 0;
+	ai_stats_t st;
+
+	for (uint32_t g = 0; g < RANDOM_GAMES; g++) {
+		mark_t ai = (g & 1) ? O_m : X_m;
+		ai_new_game();
+		board_clear();
+		for (mark_t m = X_m; !game_over(); m = (m == X_m) ? O_m : X_m) {
+			if (m != ai) {
+				random_play(m);
+				continue;
+			}
+			ai_play(m, FAST_US);
+			ai_get_stats(&st);
+			CHECK(st.time_us < FAST_US + LATE_US);
+			CHECK(st.depth >= 1);
+		}
+		CHECK(!board_winner((ai == X_m) ? O_m : X_m));
+		wins += board_winner(ai);
+		draws += !board_winner(X_m) && !board_winner(O_m);
+	}
+	printf("%dx%d, %d in a row: against random moves %u won, %u drawn of %u\n",
+		R, C, N, wins, draws, RANDOM_GAMES);
+}
+
+// On 3x3 the search sees to the end, so the computer draws with itself.
+static void test_self(void)
+{
+	if (SPACES > 9) return;
+	ai_new_game();
+	board_clear();
+	for (mark_t m = X_m; !game_over(); m = (m == X_m) ? O_m : X_m) ai_play(m, GAME_US);
+	CHECK(!board_winner(X_m));
+	CHECK(!board_winner(O_m));
+}
+
+// Search the current board with each budget and print the statistics.
+static void bench_position(const char *name, mark_t m)
+{
+	static const uint32_t budget[] = {GAME_US/4, GAME_US, GAME_US*4};
+	ai_stats_t st;
+	int8_t r, c;
+
+	for (uint32_t i = 0; i < sizeof(budget)/sizeof(budget[0]); i++) {
+		ai_new_game();
+		ai_move(m, budget[i], &r, &c);
+		ai_get_stats(&st);
+		printf("%-9s %4lu ms: depth %2d, %8lu nodes, %5.2f M nodes/s, score %d\n",
+			name, (unsigned long)budget[i] / 1000, st.depth, (unsigned long)st.nodes,
+			st.time_us ? (double)st.nodes / st.time_us : 0.0, st.score);
+	}
+}
+
+static void bench(void)
+{
+	printf("%dx%d search, host time (game tick %lu ms)\n", R, C, (unsigned long)GAME_US / 1000);
+	board_clear();
+	bench_position("empty", X_m);
+	// the computer plays both sides, so the game is still open
+	ai_new_game();
+	board_clear();
+	mark_t m = X_m;
+	for (uint32_t i = 0; i < MID_MOVES; i++, m = (m == X_m) ? O_m : X_m) ai_play(m, FAST_US);
+	bench_position("mid game", m);
+}
+
+int main(void)
+{
+	ai_init();
+	test_tactics();
+	test_random();
+	test_self();
+	bench();
+	return CHECK_RESULT();
+}
@@ -0,0 +1,165 @@
+// Lab05 bitboard (board.c) checks and benchmark, built for each board size
+// in test/CMakeLists.txt. Random games, with moves taken back now and then
+// as the computer opponent does, are checked after every move against a
+// plain grid whose winner is found by scanning every line, as board.c did
+// before it kept bitboards. The benchmark prints the host time of a move
+// and winner check for both.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "board.h"
+#include "config.h"
+#include "check.h"
+
+#define R CONFIG_BOARD_R
+#define C CONFIG_BOARD_C
+#define N CONFIG_BOARD_N
+#define SPACES CONFIG_BOARD_SPACES
+#define GAMES 20000
+#define BENCH_GAMES 200000
+
+// Global variables
+static mark_t grid[R][C]; // Reference board
+static uint32_t seed = 1;
+
+
+// Check a full scan of every line of the reference for N marks in a row.
+static bool scan_winner(mark_t m)
+{
+	static const int8_t dir[][2] = {{0,1}, {1,0}, {-1,1}, {1,1}};
+
+	for (int32_t r = 0; r < R; r++)
+		for (int32_t c = 0; c < C; c++)
+			for (uint32_t d = 0; d < 4; d++) {
+				int32_t n = 0;
+				for (int32_t i = r, j = c; n < N && i >= 0 && i < R && j >= 0 && j < C &&
+					grid[i][j] == m; i += dir[d][0], j += dir[d][1])
+					n++;
+				if (n == N) return true;
+			}
+	return false;
+}
+
+// Compare board.c with the reference.
+static void check_same(uint16_t count)
+{
+	static uint32_t fails;
+	int f = check_fails;
+	uint64_t bits[3] = {0};
+
+	for (int8_t r = 0; r < R; r++)
+		for (int8_t c = 0; c < C; c++) {
+			CHECK_EQ(board_get(r, c), grid[r][c]);
+			bits[grid[r][c]] |= 1LLU << (r*C + c);
+		}
+	CHECK_EQ(board_bits(X_m), bits[X_m]);
+	CHECK_EQ(board_bits(O_m), bits[O_m]);
+	CHECK_EQ(board_winner(X_m), scan_winner(X_m));
+	CHECK_EQ(board_winner(O_m), scan_winner(O_m));
+	CHECK_EQ(board_mark_count(), count);
+	// stop after a few failed games, one shows the problem
+	if (check_fails != f && ++fails >= 4) exit(CHECK_RESULT());
+}
+
+// Random games to the end, taking a move back one time in four.
+static void test_games(void)
+{
+	uint32_t wins = 0, draws = 0;
+
+	for (uint32_t g = 0; g < GAMES; g++) {
+		int8_t hist[SPACES];
+		uint16_t n = 0;
+		mark_t m = X_m;
+		board_clear();
+		for (int8_t r = 0; r < R; r++)
+			for (int8_t c = 0; c < C; c++) grid[r][c] = no_m;
+		check_same(0);
+		while (n < SPACES && !scan_winner(X_m) && !scan_winner(O_m)) {
+			if (n && rand_r(&seed) % 4 == 0) {
+				int8_t i = hist[--n];
+				board_unset(i / C, i % C);
+				grid[i / C][i % C] = no_m;
+				m = (m == X_m) ? O_m : X_m;
+				check_same(n);
+				continue;
+			}
+			int8_t i;
+			do i = rand_r(&seed) % SPACES; while (grid[i / C][i % C] != no_m);
+			CHECK(board_set(i / C, i % C, m));
+			CHECK(!board_set(i / C, i % C, m)); // taken
+			grid[i / C][i % C] = m;
+			hist[n++] = i;
+			m = (m == X_m) ? O_m : X_m;
+			check_same(n);
+		}
+		if (n == SPACES && !scan_winner(X_m) && !scan_winner(O_m)) draws++;
+		else wins++;
+		// take the whole game back, past the win
+		while (n) {
+			int8_t i = hist[--n];
+			board_unset(i / C, i % C);
+			grid[i / C][i % C] = no_m;
+			check_same(n);
+		}
+	}
+	printf("%dx%d, %d in a row: %u random games, %u won, %u drawn\n",
+		R, C, N, GAMES, wins, draws);
+}
+
+static uint64_t now_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+// Time random games, with the winner checked after each move.
+// scan: use the full scan of the reference, otherwise board.c.
+// Return nanoseconds per move.
+static double bench_games(bool scan)
+{
+	static int8_t moves[SPACES];
+	uint32_t s = 7, total = 0;
+
+	for (int8_t i = 0; i < SPACES; i++) moves[i] = i;
+	uint64_t t0 = now_ns();
+	for (uint32_t g = 0; g < BENCH_GAMES; g++) {
+		// a random order of the cells, the same for both runs
+		for (int8_t i = SPACES-1; i > 0; i--) {
+			int8_t j = rand_r(&s) % (i+1), t = moves[i];
+			moves[i] = moves[j];
+			moves[j] = t;
+		}
+		mark_t m = X_m;
+		bool won = false;
+		if (scan) {
+			for (int8_t r = 0; r < R; r++)
+				for (int8_t c = 0; c < C; c++) grid[r][c] = no_m;
+		} else {
+			board_clear();
+		}
+		for (int8_t k = 0; k < SPACES && !won; k++, total++) {
+			int8_t r = moves[k] / C, c = moves[k] % C;
+			if (scan) {
+				grid[r][c] = m;
+				won = scan_winner(m);
+			} else {
+				board_set(r, c, m);
+				won = board_winner(m);
+			}
+			m = (m == X_m) ? O_m : X_m;
+		}
+	}
+	return (double)(now_ns() - t0) / total;
+}
+
+int main(void)
+{
+	test_games();
+	double scan = bench_games(true), bits = bench_games(false);
+	printf("%dx%d move and winner check: scan %6.1f ns, bitboard %5.1f ns (%.1fx), host time\n",
+		R, C, scan, bits, scan / bits);
+	return CHECK_RESULT();
+}
@@ -0,0 +1,120 @@
+// Scripted button presses. Each script drives the button pins at set times
+// in simulated time, with contact bounce, taps shorter than the debounce
+// time and long presses, and lists the events button_get() must return.
+
+#include "esp_timer.h"
+#include "driver/gpio.h"
+#include "button.h"
+#include "check.h"
+
+#define A 32
+#define B 33
+#define MS 1000 // us
+#define END -1
+#define LAST {END, 0, 0} // End of a script or of the events
+
+// Pin level at a time
+typedef struct {
+	int32_t ms;
+	int8_t pin;
+	int8_t level;
+} step_t;
+
+// Event expected at a time
+typedef struct {
+	int32_t ms;
+	int8_t pin;
+	uint8_t type;
+} expect_t;
+
+static const char *NAME[] = {"press", "release", "long"};
+
+// Run a script from time 0 to end_ms, then check the events.
+static void run(const char *name, const step_t *steps, int32_t end_ms, const expect_t *exp)
+{
+	button_event_t ev;
+	int32_t now = 0;
+
+	stub_time_set(0);
+	CHECK_EQ(button_init(1LLU << A | 1LLU << B), 0);
+	for (; steps->ms != END; steps++) {
+		stub_time_advance((int64_t)(steps->ms - now) * MS);
+		now = steps->ms;
+		stub_gpio_input(steps->pin, steps->level);
+	}
+	stub_time_advance((int64_t)(end_ms - now) * MS);
+
+	for (; exp->ms != END; exp++) {
+		if (!button_get(&ev)) {
+			fprintf(stderr, "%s: missing %s of pin %d at %d ms\n",
+				name, NAME[exp->type], exp->pin, (int)exp->ms);
+			check_fails++;
+			break;
+		}
+		if (ev.pin != exp->pin || ev.type != exp->type || ev.time_us != exp->ms * MS) {
+			fprintf(stderr, "%s: got %s of pin %d at %lld us, expected %s of pin %d at %d ms\n",
+				name, NAME[ev.type], ev.pin, (long long)ev.time_us,
+				NAME[exp->type], exp->pin, (int)exp->ms);
+			check_fails++;
+		}
+	}
+	if (exp->ms == END && button_get(&ev)) {
+		fprintf(stderr, "%s: extra %s of pin %d at %lld us\n",
+			name, NAME[ev.type], ev.pin, (long long)ev.time_us);
+		check_fails++;
+	}
+	CHECK(!button_down(A) && !button_down(B)); // every script ends released
+	CHECK_EQ(button_deinit(), 0);
+}
+
+int main(void)
+{
+	// Bounce on press and release: one event each, taken at the first edge
+	run("bounce", (const step_t[]){
+		{0, A, 0}, {1, A, 1}, {2, A, 0}, {4, A, 1}, {5, A, 0},
+		{300, A, 1}, {301, A, 0}, {303, A, 1},
+		LAST}, 600,
+		(const expect_t[]){{0, A, BUTTON_PRESS}, {300, A, BUTTON_RELEASE}, LAST});
+
+	// A tap shorter than the debounce time is released when it ends
+	run("tap", (const step_t[]){
+		{10, A, 0}, {15, A, 1},
+		LAST}, 100,
+		(const expect_t[]){{10, A, BUTTON_PRESS}, {30, A, BUTTON_RELEASE}, LAST});
+
+	// A held button sends a long press once
+	run("long", (const step_t[]){
+		{0, B, 0}, {1, B, 1}, {2, B, 0},
+		{2000, B, 1},
+		LAST}, 2100,
+		(const expect_t[]){{0, B, BUTTON_PRESS}, {CONFIG_BUTTON_LONG_MS, B, BUTTON_LONG},
+			{2000, B, BUTTON_RELEASE}, LAST});
+
+	// A release within the long press time cancels it
+	run("no long", (const step_t[]){
+		{0, B, 0}, {CONFIG_BUTTON_LONG_MS - 1, B, 1},
+		LAST}, 2000,
+		(const expect_t[]){{0, B, BUTTON_PRESS}, {CONFIG_BUTTON_LONG_MS - 1, B, BUTTON_RELEASE}, LAST});
+
+	// Two buttons are debounced apart
+	run("two", (const step_t[]){
+		{0, A, 0}, {3, B, 0}, {4, A, 1}, {5, A, 0}, {6, B, 1}, {7, B, 0},
+		{100, A, 1}, {110, B, 1},
+		LAST}, 200,
+		(const expect_t[]){{0, A, BUTTON_PRESS}, {3, B, BUTTON_PRESS},
+			{100, A, BUTTON_RELEASE}, {110, B, BUTTON_RELEASE}, LAST});
+
+	// A full queue drops new events, the state is still tracked
+	step_t taps[2*CONFIG_BUTTON_QUEUE_LEN + 1];
+	expect_t kept[CONFIG_BUTTON_QUEUE_LEN + 1];
+	for (int32_t i = 0; i < CONFIG_BUTTON_QUEUE_LEN; i++) {
+		taps[2*i] = (step_t){100*i, A, 0};
+		taps[2*i+1] = (step_t){100*i + 50, A, 1};
+		kept[i] = (expect_t){(i/2)*100 + (i%2)*50, A, (i%2) ? BUTTON_RELEASE : BUTTON_PRESS};
+	}
+	taps[2*CONFIG_BUTTON_QUEUE_LEN] = (step_t)LAST;
+	kept[CONFIG_BUTTON_QUEUE_LEN] = (expect_t)LAST;
+	run("full", taps, 100*CONFIG_BUTTON_QUEUE_LEN, kept);
+
+	return CHECK_RESULT();
+}
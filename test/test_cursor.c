@@ -0,0 +1,159 @@
+// Cursor (components/cursor) checks, with a stand-in joystick. The linear
+// curve must move the cursor as the float code it replaced did, fractions
+// of a pixel must add up over ticks, the dual curve must slow the cursor
+// near the center only, and the position must stop at the screen edges.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "cursor.h"
+#include "joy.h"
+#include "check.h"
+
+#define PER 40 // Update period in ms, as lab06
+#define SEN 1.25f // Default sensitivity, screen widths per second
+#define TICKS 200
+
+// Global variables
+static int32_t joy_x, joy_y; // Displacement of the stand-in joystick
+
+
+// Stand-ins of the joystick calls made by cursor.c.
+int32_t joy_init(void)
+{
+	return 0;
+}
+
+void joy_get_displacement(int32_t *dcx, int32_t *dcy)
+{
+	*dcx = joy_x;
+	*dcy = joy_y;
+}
+
+// Run n ticks at a displacement.
+static void run(int32_t dx, int32_t dy, uint32_t n)
+{
+	joy_x = dx;
+	joy_y = dy;
+	for (uint32_t i = 0; i < n; i++) cursor_tick();
+}
+
+// The linear curve follows the float position of the old cursor_tick():
+// xpos += dcx*sfactor, clipped, read back rounded.
+static void test_linear(void)
+{
+	const float rate = SEN*LCD_W;
+	const float sfactor = rate / JOY_MAX_DISP * PER / 1000;
+	uint32_t bad = 0, near = 0, n = 0;
+
+	for (int32_t d = -JOY_MAX_DISP; d <= JOY_MAX_DISP; d += 37) {
+		float xf = LCD_W/2, yf = LCD_H/2;
+		cursor_set_pos(LCD_W/2, LCD_H/2);
+		joy_x = d;
+		joy_y = -d/2;
+		for (uint32_t i = 0; i < TICKS/10; i++) {
+			coord_t x, y;
+			n++;
+			cursor_tick();
+			cursor_get_pos(&x, &y);
+			xf += joy_x*sfactor;
+			yf += joy_y*sfactor;
+			if (xf < 0) xf = 0; else if (xf > LCD_W-1) xf = LCD_W-1;
+			if (yf < 0) yf = 0; else if (yf > LCD_H-1) yf = LCD_H-1;
+			// a float exactly between two pixels may round either way
+			if (fabsf(xf - floorf(xf) - 0.5f) < 0.01f ||
+				fabsf(yf - floorf(yf) - 0.5f) < 0.01f) {near++; continue;}
+			bad += x != (coord_t)(xf+0.5f) || y != (coord_t)(yf+0.5f);
+		}
+	}
+	CHECK_EQ(bad, 0);
+	CHECK(near < n/10); // most positions are compared
+}
+
+// A speed of an eighth of a pixel per tick moves the cursor one pixel
+// every eight ticks, in both directions.
+static void test_subpixel(void)
+{
+	const float vmax = SEN*LCD_W * PER / 1000; // pixels per tick at full displacement
+	const int32_t d = lrintf(JOY_MAX_DISP / vmax / 8);
+	coord_t x, y;
+
+	cursor_set_pos(LCD_W/2, LCD_H/2);
+	for (uint32_t i = 1; i <= 64; i++) {
+		run(d, -d, 1);
+		cursor_get_pos(&x, &y);
+		CHECK_EQ(x, LCD_W/2 + (coord_t)((i + 4) / 8));
+		CHECK_EQ(y, LCD_H/2 - (coord_t)((i + 3) / 8));
+	}
+	run(-d, d, 64);
+	cursor_get_pos(&x, &y);
+	CHECK_EQ(x, LCD_W/2);
+	CHECK_EQ(y, LCD_H/2);
+}
+
+// The dual curve moves at a quarter speed up to half displacement and
+// reaches full speed at full displacement.
+static void test_dual(void)
+{
+	coord_t x, y, xl;
+
+	cursor_set_curve(CURSOR_LINEAR);
+	cursor_set_pos(0, 0);
+	run(JOY_MAX_DISP/2, 0, 10);
+	cursor_get_pos(&xl, &y);
+	cursor_set_curve(CURSOR_DUAL);
+	cursor_set_pos(0, 0);
+	run(JOY_MAX_DISP/2, 0, 10);
+	cursor_get_pos(&x, &y);
+	CHECK_EQ(x, (xl + 2) / 4);
+
+	cursor_set_curve(CURSOR_LINEAR);
+	cursor_set_pos(0, 0);
+	run(JOY_MAX_DISP, 0, 10);
+	cursor_get_pos(&xl, &y);
+	cursor_set_curve(CURSOR_DUAL);
+	cursor_set_pos(0, 0);
+	run(JOY_MAX_DISP, 0, 10);
+	cursor_get_pos(&x, &y);
+	CHECK_EQ(x, xl);
+	cursor_set_curve(CURSOR_LINEAR);
+}
+
+// Positions stop at the edges, and move back at once when the joystick
+// turns around.
+static void test_clip(void)
+{
+	coord_t x, y;
+
+	cursor_set_pos(LCD_W/2, LCD_H/2);
+	run(JOY_MAX_DISP, JOY_MAX_DISP, TICKS);
+	cursor_get_pos(&x, &y);
+	CHECK_EQ(x, LCD_W-1);
+	CHECK_EQ(y, LCD_H-1);
+	run(-JOY_MAX_DISP/32, -JOY_MAX_DISP/32, 2); // half a pixel a tick
+	cursor_get_pos(&x, &y);
+	CHECK_EQ(x, LCD_W-2);
+	CHECK_EQ(y, LCD_H-2);
+
+	run(-JOY_MAX_DISP, -JOY_MAX_DISP, TICKS);
+	cursor_get_pos(&x, &y);
+	CHECK_EQ(x, 0);
+	CHECK_EQ(y, 0);
+
+	cursor_set_pos(-5, LCD_H+5);
+	cursor_get_pos(&x, &y);
+	CHECK_EQ(x, 0);
+	CHECK_EQ(y, LCD_H-1);
+}
+
+int main(void)
+{
+	CHECK_EQ(cursor_init(PER), 0);
+	cursor_set_threshold(0); // every displacement moves the cursor
+	test_linear();
+	test_subpixel();
+	test_dual();
+	test_clip();
+	return CHECK_RESULT();
+}
@@ -0,0 +1,254 @@
+// Continuous joystick driver (joy_cont.c) checks and benchmark, with the ADC
+// DMA frames converted by the stub from a scripted input. The checks cover
+// the center and dead zone found at joy_init(), the filter step response,
+// clamping, tracking of a drifting rest position, and that a reader never
+// sees X and Y from different frames. The benchmark prints the host time
+// of a read and of a frame.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+
+#include "freertos/FreeRTOS.h"
+#include "esp_adc/adc_continuous.h"
+#include "hw.h"
+#include "joy.h"
+#include "check.h"
+
+#define CH_X 6 // ADC1 channel of HW_JOY_X (GPIO34)
+#define CH_Y 7 // ADC1 channel of HW_JOY_Y (GPIO35)
+#define REST_X 1800 // Rest position in raw ADC values
+#define REST_Y 2300
+#define NOISE 2 // Input noise, +/- raw ADC values
+#define FRAME_K 64 // Samples of an axis in a frame, FRAME_SZ of joy_cont.c
+#define SETTLE 40 // Frames for the filter to settle
+#define TRACK 1000 // Frames for the center to follow the rest position
+#define TEAR_RUN 20000 // Frames run against the reader
+#define BENCH_READS 10000000
+#define BENCH_FRAMES 20000
+
+// Global variables
+static int32_t in[2]; // Input of each axis
+static int32_t noise = NOISE;
+static int32_t ramp; // Step added to both axes every frame, or zero
+static atomic_bool init_done, running;
+static int32_t init_ret;
+static atomic_uint reads, torn;
+
+
+// Scripted ADC input: the axis value plus a little noise.
+static uint16_t adc_in(uint32_t chan, uint64_t k)
+{
+	int32_t a = (chan == CH_Y);
+	int32_t v = in[a];
+
+	if (ramp) v += (int32_t)(k / FRAME_K) * ramp % 1600;
+	if (noise) v += (int32_t)((((uint32_t)k * 2654435761u + chan * 97) >> 13) % (2*noise+1)) - noise;
+	if (v < 0) v = 0;
+	if (v > 4095) v = 4095;
+	return v;
+}
+
+static void *init_task(void *arg)
+{
+	init_ret = joy_init();
+	atomic_store(&init_done, true);
+	return NULL;
+}
+
+// Run joy_init() while the ADC converts frames, as the DMA would.
+// Return the joy_init() result.
+static int32_t init_run(bool frames)
+{
+	pthread_t th;
+
+	atomic_store(&init_done, false);
+	pthread_create(&th, NULL, init_task, NULL);
+	while (!atomic_load(&init_done)) {
+		if (frames) stub_adc_run(1);
+		usleep(1000);
+	}
+	pthread_join(th, NULL);
+	return init_ret;
+}
+
+// Set the input and run frames until the output settles.
+static void move(int32_t x, int32_t y)
+{
+	in[0] = x;
+	in[1] = y;
+	stub_adc_run(SETTLE);
+}
+
+// Return to the rest position, and let the center settle on it again.
+static void rest(void)
+{
+	move(REST_X, REST_Y);
+	stub_adc_run(TRACK);
+}
+
+static void test_init(void)
+{
+	int32_t dx, dy;
+
+	// no frames: the center cannot be measured
+	CHECK_EQ(init_run(false), 1);
+	CHECK_EQ(joy_deinit(), 1);
+
+	move(REST_X, REST_Y);
+	CHECK_EQ(init_run(true), 0);
+	CHECK_EQ(joy_init(), 0); // already initialized
+	joy_get_displacement(&dx, &dy);
+	CHECK_EQ(dx, 0);
+	CHECK_EQ(dy, 0);
+}
+
+// Inside the dead zone the output is zero, and the center moves toward the
+// input. Outside it the output is the offset.
+static void test_dead(void)
+{
+	int32_t dx, dy;
+
+	move(REST_X + 10, REST_Y - 10);
+	joy_get_displacement(&dx, &dy);
+	CHECK_EQ(dx, 0);
+	CHECK_EQ(dy, 0);
+	rest();
+	move(REST_X + 40, REST_Y - 60);
+	joy_get_displacement(&dx, &dy);
+	CHECK(abs(dx - 40) <= 1);
+	CHECK(abs(dy + 60) <= 1);
+	rest();
+}
+
+// A step settles as the Kconfig help says: 63% in 4 frames for a shift
+// of 2 (25 ms at 156 frames per second).
+static void test_step(void)
+{
+	int32_t dx, dy, n;
+
+	in[0] = REST_X + 1000;
+	for (n = 1; n < SETTLE; n++) {
+		stub_adc_run(1);
+		joy_get_displacement(&dx, &dy);
+		if (dx >= 630) break;
+	}
+	printf("step of 1000: 63%% in %ld frames\n", (long)n);
+	CHECK_EQ(n, 4);
+	stub_adc_run(SETTLE);
+	joy_get_displacement(&dx, &dy);
+	CHECK(abs(dx - 1000) <= 1);
+	CHECK(abs(dy) <= 1); // the noise of the axis at rest
+
+	// full deflection is clamped
+	move(4095, 0);
+	joy_get_displacement(&dx, &dy);
+	CHECK_EQ(dx, JOY_MAX_DISP);
+	CHECK_EQ(dy, -JOY_MAX_DISP);
+	move(REST_X, REST_Y);
+	joy_get_displacement(&dx, &dy);
+	CHECK_EQ(dx, 0);
+	CHECK_EQ(dy, 0);
+}
+
+// A rest position drifting inside the dead zone is followed, so a later
+// displacement is measured from where the joystick now rests.
+static void test_drift(void)
+{
+	int32_t dx, dy;
+
+	for (int32_t d = 1; d <= 12; d++) {
+		move(REST_X + d, REST_Y - d);
+		stub_adc_run(100);
+		joy_get_displacement(&dx, &dy);
+		CHECK_EQ(dx, 0);
+		CHECK_EQ(dy, 0);
+	}
+	move(REST_X + 12 + 30, REST_Y - 12 - 30);
+	joy_get_displacement(&dx, &dy);
+	printf("drift of 12, then 30 more: %ld, %ld\n", (long)dx, (long)dy);
+	CHECK(abs(dx - 30) <= 2);
+	CHECK(abs(dy + 30) <= 2);
+	move(REST_X + 12, REST_Y - 12);
+}
+
+// Reader in another context, checking X and Y come from one frame.
+static void *reader(void *arg)
+{
+	while (atomic_load(&running)) {
+		int32_t dx, dy;
+		joy_get_displacement(&dx, &dy);
+		if (abs(dx - dy) > 2) atomic_fetch_add(&torn, 1);
+		atomic_fetch_add(&reads, 1);
+	}
+	return NULL;
+}
+
+// Both axes move together by 16 raw values a frame: a read mixing X of one
+// frame with Y of another shows a difference of several values.
+static void test_tear(void)
+{
+	pthread_t th;
+
+	// the same rest offset on both axes, so dx == dy
+	noise = 0;
+	move(REST_X + 12, REST_Y - 12);
+	ramp = 16;
+	atomic_store(&running, true);
+	pthread_create(&th, NULL, reader, NULL);
+	for (uint32_t i = 0; i < TEAR_RUN; i += 10) {
+		stub_adc_run(10);
+		sched_yield();
+	}
+	atomic_store(&running, false);
+	pthread_join(th, NULL);
+	printf("tear: %u reads, %u torn\n", atomic_load(&reads), atomic_load(&torn));
+	CHECK(atomic_load(&reads) > 0);
+	CHECK_EQ(atomic_load(&torn), 0);
+	ramp = 0;
+	noise = NOISE;
+}
+
+static uint64_t now_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static void bench(void)
+{
+	volatile int32_t sink;
+	int32_t dx, dy;
+
+	uint64_t t0 = now_ns();
+	for (uint32_t i = 0; i < BENCH_READS; i++) {
+		joy_get_displacement(&dx, &dy);
+		sink = dx + dy;
+	}
+	uint64_t t1 = now_ns();
+	stub_adc_run(BENCH_FRAMES);
+	uint64_t t2 = now_ns();
+	(void)sink;
+	printf("joy_get_displacement %5.1f ns/read, host time\n",
+		(double)(t1 - t0) / BENCH_READS);
+	printf("frame of %u samples   %5.0f ns, host time of conversion and callback\n",
+		2*FRAME_K, (double)(t2 - t1) / BENCH_FRAMES);
+}
+
+int main(void)
+{
+	stub_adc_in = adc_in;
+	test_init();
+	test_dead();
+	test_step();
+	test_drift();
+	test_tear();
+	bench();
+	CHECK_EQ(joy_deinit(), 0);
+	return CHECK_RESULT();
+}
@@ -0,0 +1,144 @@
+// Lockstep (components/lockstep) checks over the simulated serial link
+// (link.c). Each run plays two boards, each in its own process, over a
+// link with some latency and loss. The game of each board is a hash of all
+// the inputs it was given, so the boards stay in step only if they get the
+// same inputs in the same order, as lockstep_hash() checks. The runs cover
+// a clean, a noisy and a slow link, a board that restarts in the middle of
+// the game, and a game that is not deterministic, which must be found.
+// Each run prints the ticks run, the stalls and the packets dropped.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+
+#include "lockstep.h"
+#include "sdkconfig.h"
+#include "link.h"
+#include "check.h"
+
+#define DELAY CONFIG_LOCKSTEP_DELAY
+#define TICK_MS 10 // Game tick of the test, faster than the lab's
+#define TICKS 200 // Ticks each run plays
+#define LINGER_MS 500 // Time a board goes on so the other can finish
+#define RUN_S 30 // Longest run
+
+typedef struct {
+	const char *name;
+	link_cfg_t link;
+	uint32_t restart_at; // Tick board 1 restarts at, 0 for none
+	uint32_t differ_at; // Tick the game of board 1 differs at, 0 for none
+} run_t;
+
+
+static uint64_t now_ms(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+static void sleep_until(uint64_t ms)
+{
+	uint64_t now = now_ms();
+	if (ms > now) usleep((ms - now) * 1000);
+}
+
+// One board: play the game for TICKS ticks, then for LINGER_MS more.
+// Return the CHECK_RESULT() of the board.
+static int board_run(uint32_t player, int fd, const run_t *run)
+{
+	const lockstep_io_t io = {link_write, link_read};
+	link_cfg_t cfg = run->link;
+	lockstep_input_t mine[DELAY+1] = {0}; // Local inputs given, by tick
+	uint32_t seed = 7 + player, state = LOCKSTEP_FNV_INIT, restarts = 0, ran = 0, ran_end = 0;
+	bool restart = player && run->restart_at;
+	lockstep_stats_t st = {0};
+	link_stats_t ls;
+
+	alarm(RUN_S); // a board that hangs fails the run
+	cfg.seed += player;
+	link_open(fd, &cfg);
+	CHECK_EQ(lockstep_init(&io), 0);
+	uint64_t t0 = now_ms(), next = t0, end = 0;
+	while (!end || next < end) {
+		sleep_until(next += TICK_MS);
+		lockstep_input_t local = rand_r(&seed), in[LOCKSTEP_PLAYERS];
+		if (!lockstep_tick(local, in)) continue;
+		lockstep_get_stats(&st);
+		uint32_t t = st.tick - 1; // tick just run
+		ran++;
+		if (lockstep_restarted()) {
+			CHECK_EQ(t, 0);
+			state = LOCKSTEP_FNV_INIT;
+			restarts++;
+		}
+		int8_t me = lockstep_player();
+		CHECK(me == 0 || me == 1);
+		CHECK_EQ(in[me], (t < DELAY) ? 0 : mine[(t - DELAY) % (DELAY+1)]);
+		mine[t % (DELAY+1)] = local;
+		state = lockstep_fnv(state, in, sizeof(in));
+		if (player && t + 1 == run->differ_at) state++;
+		lockstep_hash(state);
+		if (restart && st.tick == run->restart_at) {
+			// as a board that restarts: a new id, the game from the start
+			CHECK_EQ(lockstep_init(&io), 0);
+			state = LOCKSTEP_FNV_INIT;
+			restart = false;
+		}
+		if (!end && !restart && st.tick >= TICKS && (player || restarts >= !!run->restart_at)) {
+			end = now_ms() + LINGER_MS;
+			ran_end = ran;
+		}
+	}
+	CHECK_EQ(lockstep_desync(), run->differ_at != 0);
+	CHECK_EQ(restarts, player ? 0 : !!run->restart_at);
+	link_get_stats(&ls);
+	printf("%-8s board %u: %4u ticks, %5.1f ms/tick, %4u stalls, %3u bad packets; "
+		"%5u bytes in, %3u dropped, %3u flipped\n", run->name, player, ran_end,
+		(double)(end - LINGER_MS - t0) / ran_end, st.stalls, st.bad, ls.bytes, ls.dropped, ls.flipped);
+	return CHECK_RESULT();
+}
+
+// Play two boards against each other, each in its own process.
+static void test_run(const run_t *run)
+{
+	int sv[2];
+	pid_t pid[2];
+
+	CHECK_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, sv), 0);
+	fflush(stdout);
+	for (uint32_t p = 0; p < 2; p++) {
+		pid[p] = fork();
+		if (pid[p] == 0) {
+			close(sv[!p]);
+			exit(board_run(p, sv[p], run));
+		}
+	}
+	close(sv[0]);
+	close(sv[1]);
+	for (uint32_t p = 0; p < 2; p++) {
+		int status;
+		CHECK_EQ(waitpid(pid[p], &status, 0), pid[p]);
+		if (!WIFEXITED(status) || WEXITSTATUS(status))
+			fprintf(stderr, "%s: board %u failed\n", run->name, p);
+		CHECK(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+	}
+}
+
+int main(void)
+{
+	static const run_t runs[] = {
+		{"clean", {0}, 0, 0},
+		{"noisy", {.latency_ms = TICK_MS/2, .drop_ppm = 10000, .flip_ppm = 10000, .seed = 1}, 0, 0},
+		{"slow", {.latency_ms = 2*DELAY*TICK_MS, .seed = 2}, 0, 0},
+		{"restart", {.latency_ms = TICK_MS/2, .drop_ppm = 10000, .seed = 3}, .restart_at = TICKS/2},
+		{"differ", {0}, .differ_at = TICKS/2},
+	};
+
+	printf("lockstep, delay %d ticks, %d ms ticks\n", DELAY, TICK_MS);
+	for (uint32_t i = 0; i < sizeof(runs)/sizeof(runs[0]); i++) test_run(runs + i);
+	return CHECK_RESULT();
+}
@@ -0,0 +1,253 @@
+// Lab06 missile pool (missile.c) checks and benchmark, built with and
+// without CONFIG_STRESS in test/CMakeLists.txt. The checks follow missiles
+// through their states: moving to the exact destination, impacted for one
+// tick, then an explosion that grows to its largest radius and shrinks
+// back to idle, or a detonation on the way. The benchmark plays the
+// missiles as game_tick() does, relaunching idle ones, and prints the host
+// time of missile_update() and missile_draw() per tick.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "missile.h"
+#include "config.h"
+#include "check.h"
+
+#define PLAYER_SPEED CONFIG_PLAYER_MISSILE_DISTANCE_PER_TICK
+#define MAX_R CONFIG_EXPLOSION_MAX_RADIUS
+#define RADIUS_TICKS ((uint32_t)(MAX_R / CONFIG_EXPLOSION_RADIUS_CHANGE_PER_TICK) + 1)
+#define BENCH_TICKS 20000
+
+// Global variables
+static uint32_t lines, circles; // LCD calls made
+
+
+// Stand-ins of the LCD calls made by missile.c, counted.
+void lcd_drawLine(coord_t x0, coord_t y0, coord_t x1, coord_t y1, color_t color)
+{
+	lines++;
+}
+
+void lcd_fillCircle(coord_t xc, coord_t yc, coord_t r, color_t color)
+{
+	circles++;
+}
+
+static void init_all(void)
+{
+	for (missile_id_t id = 0; id < MISSILE_MAX; id++) missile_init(id);
+}
+
+// Return the explosion radius of a missile, found by its collisions.
+static int32_t radius_of(missile_id_t id)
+{
+	coord_t x, y;
+	int32_t r = -1;
+
+	missile_get_pos(id, &x, &y);
+	while (r <= 2*MAX_R && missile_is_colliding(id, x + r + 1, y)) r++;
+	return r;
+}
+
+// Follow an explosion to idle. It must grow to the largest radius, then
+// shrink, and touch nothing once idle.
+static void check_explosion(missile_id_t id)
+{
+	int32_t r, last = -1, top = -1;
+	uint32_t n = 0;
+
+	CHECK(missile_is_exploding(id));
+	for (; missile_is_exploding(id) && n <= 2*RADIUS_TICKS; n++) {
+		r = radius_of(id);
+		if (top < 0 && r < last) top = last; // started to shrink
+		CHECK(top < 0 || r <= last);
+		last = r;
+		missile_update();
+	}
+	CHECK_EQ(top, MAX_R);
+	CHECK(n >= 2*RADIUS_TICKS - 2 && n <= 2*RADIUS_TICKS);
+	CHECK(missile_is_idle(id));
+	CHECK(!missile_is_colliding(id, 0, 0));
+}
+
+// A player missile leaves from the nearest firing location, lands exactly
+// on its destination, is impacted for one tick, then explodes.
+static void test_player(void)
+{
+	static const coord_t dest[][2] = {
+		{0, 0}, {LCD_W/3, LCD_H/2}, {LCD_W/2, 10}, {LCD_W-1, LCD_H-1}, {LCD_W*3/4, LCD_H-7},
+	};
+
+	for (uint32_t i = 0; i < sizeof(dest)/sizeof(dest[0]); i++) {
+		coord_t xd = dest[i][0], yd = dest[i][1], x, y;
+		coord_t xo = (xd < LCD_W*3/8) ? LCD_W/4 : (xd < LCD_W*5/8) ? LCD_W/2 : LCD_W*3/4;
+		init_all();
+		missile_launch_player(0, xd, yd);
+		CHECK_EQ(missile_get_type(0), MISSILE_TYPE_PLAYER);
+		missile_get_pos(0, &x, &y);
+		CHECK_EQ(x, xo);
+		CHECK_EQ(y, LCD_H);
+		double len = sqrt((double)(xd - xo) * (xd - xo) + (double)(yd - LCD_H) * (yd - LCD_H));
+		uint32_t steps = ceil(len / PLAYER_SPEED), n = 0;
+		double dist = len;
+		for (; missile_is_moving(0) && n <= steps; n++) {
+			missile_update();
+			missile_get_pos(0, &x, &y);
+			double d = sqrt((double)(xd - x) * (xd - x) + (double)(yd - y) * (yd - y));
+			CHECK(d <= dist + 1); // closer each tick, to rounding
+			dist = d;
+		}
+		CHECK(n == steps || n == steps + 1); // float to fixed point
+		CHECK(missile_is_impacted(0));
+		CHECK(!missile_is_exploding(0));
+		CHECK_EQ(x, xd);
+		CHECK_EQ(y, yd);
+		missile_update();
+		CHECK(!missile_is_impacted(0));
+		check_explosion(0);
+		missile_get_pos(0, &x, &y);
+		CHECK_EQ(x, xd); // explodes where it landed
+		CHECK_EQ(y, yd);
+	}
+}
+
+// Enemy missiles fall from the top to the bottom, on different paths.
+static void test_enemy(void)
+{
+	coord_t x0[MISSILE_MAX], xd[MISSILE_MAX];
+	uint32_t paths = 0;
+
+	srand(1);
+	init_all();
+	for (missile_id_t id = 0; id < MISSILE_MAX; id++) {
+		coord_t y;
+		missile_launch_enemy(id);
+		missile_get_pos(id, &x0[id], &y);
+		CHECK_EQ(y, 0);
+		CHECK(x0[id] >= 0 && x0[id] < LCD_W);
+	}
+	for (uint32_t n = 0; n < LCD_H * 2 / CONFIG_ENEMY_MISSILE_DISTANCE_PER_TICK; n++) {
+		missile_update();
+		for (missile_id_t id = 0; id < MISSILE_MAX; id++) {
+			coord_t x, y;
+			if (!missile_is_impacted(id)) continue;
+			missile_get_pos(id, &x, &y);
+			CHECK_EQ(y, LCD_H);
+			CHECK(x >= 0 && x < LCD_W);
+			xd[id] = x;
+		}
+	}
+	for (missile_id_t id = 0; id < MISSILE_MAX; id++) {
+		CHECK(!missile_is_moving(id)); // all landed
+		paths += id && (x0[id] != x0[id-1] || xd[id] != xd[id-1]);
+	}
+	CHECK(MISSILE_MAX < 2 || paths >= MISSILE_MAX / 2);
+}
+
+// A missile detonated on its way explodes where it is on the next update.
+// Idle and exploding missiles are not detonated.
+static void test_detonate(void)
+{
+	coord_t x, y, xe, ye;
+
+	init_all();
+	missile_launch_plane(0, LCD_W/2, 20);
+	CHECK_EQ(missile_get_type(0), MISSILE_TYPE_PLANE);
+	for (uint32_t n = 0; n < 5; n++) missile_update();
+	missile_get_pos(0, &x, &y);
+	CHECK(y > 20);
+	missile_explode(0);
+	CHECK(missile_is_moving(0)); // on the next update
+	missile_update();
+	CHECK(!missile_is_moving(0));
+	missile_get_pos(0, &xe, &ye);
+	CHECK_EQ(xe, x);
+	CHECK_EQ(ye, y);
+	missile_explode(0); // already exploding
+	check_explosion(0);
+
+	missile_explode(1); // idle
+	missile_update();
+	CHECK(missile_is_idle(1));
+	missile_launch_enemy(1); // an idle detonation is not kept
+	missile_update();
+	CHECK(missile_is_moving(1));
+}
+
+// Idle handles are found in a range, and draws follow the states.
+static void test_pool(void)
+{
+	init_all();
+	CHECK_EQ(missile_next_idle(0, MISSILE_MAX), 0);
+	for (missile_id_t id = 0; id < MISSILE_MAX; id++) missile_launch_enemy(id);
+	CHECK_EQ(missile_next_idle(0, MISSILE_MAX), MISSILE_NONE);
+	missile_init(MISSILE_MAX-1);
+	CHECK_EQ(missile_next_idle(0, MISSILE_MAX), MISSILE_MAX-1);
+	CHECK_EQ(missile_next_idle(0, MISSILE_MAX-1), MISSILE_NONE);
+	missile_init(MISSILE_MAX/2);
+	CHECK_EQ(missile_next_idle(0, MISSILE_MAX), MISSILE_MAX/2);
+	CHECK_EQ(missile_next_idle(MISSILE_MAX/2 + 1, MISSILE_MAX), MISSILE_MAX-1);
+	CHECK_EQ(missile_next_idle(-5, MISSILE_MAX + 5), MISSILE_MAX/2);
+
+	lines = circles = 0;
+	missile_draw();
+	CHECK_EQ(lines, MISSILE_MAX - 2);
+	CHECK_EQ(circles, 0);
+	missile_explode(0);
+	missile_update();
+	lines = circles = 0;
+	missile_draw();
+	CHECK_EQ(lines, MISSILE_MAX - 3);
+	CHECK_EQ(circles, 1);
+}
+
+static uint64_t now_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+// Play the missiles as game_tick() does and time each pass.
+static void bench(void)
+{
+	const missile_id_t player = CONFIG_MAX_ENEMY_MISSILES;
+	const missile_id_t plane = player + CONFIG_MAX_PLAYER_MISSILES;
+	uint64_t t_update = 0, t_launch = 0, t_draw = 0, live = 0;
+
+	srand(2);
+	init_all();
+	for (uint32_t n = 0; n < BENCH_TICKS; n++) {
+		uint64_t t0 = now_ns();
+		missile_update();
+		uint64_t t1 = now_ns();
+		for (missile_id_t id = 0; (id = missile_next_idle(id, player)) != MISSILE_NONE; id++)
+			missile_launch_enemy(id);
+		for (missile_id_t id = player; (id = missile_next_idle(id, plane)) != MISSILE_NONE; id++)
+			missile_launch_player(id, rand() % LCD_W, rand() % LCD_H);
+		uint64_t t2 = now_ns();
+		lines = circles = 0;
+		missile_draw();
+		uint64_t t3 = now_ns();
+		live += lines + circles;
+		t_update += t1 - t0;
+		t_launch += t2 - t1;
+		t_draw += t3 - t2;
+	}
+	printf("%3d missiles (CONFIG_STRESS %d), per tick: update %6.0f ns (%.1f ns a missile), "
+		"launch %6.0f ns, draw %6.0f ns, host time\n", MISSILE_MAX, CONFIG_STRESS,
+		(double)t_update / BENCH_TICKS, (double)t_update / live, (double)t_launch / BENCH_TICKS,
+		(double)t_draw / BENCH_TICKS);
+}
+
+int main(void)
+{
+	test_player();
+	test_enemy();
+	test_detonate();
+	test_pool();
+	bench();
+	return CHECK_RESULT();
+}
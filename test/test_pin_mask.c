@@ -0,0 +1,108 @@
+// Register model check of the mask based pin calls. A random sequence of
+// calls runs on the simulated registers and on a plain model of OUT and
+// ENABLE, and both must agree after every call. Also prints the register
+// accesses of a mask call next to those of the same change made one pin
+// at a time.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "pin.h"
+#include "pin_reg.h"
+#include "pin_sim.h"
+#include "check.h"
+
+#define STEPS 20000
+#define VALID (((1LLU << PIN_MAX) - 1) & ~(0xFLLU << 28))
+
+#if !HAVE_PIN_C
+int32_t pin_reset(pin_num_t pin)
+{
+	return 0;
+}
+#endif
+
+static uint64_t get_pair(uint32_t r0, uint32_t r1)
+{
+	return pin_sim_get(r0) | (uint64_t)pin_sim_get(r1) << REG_BITS;
+}
+
+static uint64_t rand_mask(void)
+{
+	uint64_t m = (uint64_t)rand() << 31 ^ rand();
+	switch (rand() % 4) {
+		case 0: return m & 0xFFFFFFFFLLU; // bank 0 only
+		case 1: return m & 0xFFLLU << 32; // bank 1 only
+		case 2: return m & -m; // one pin
+		default: return m; // any, with pins that do not exist
+	}
+}
+
+// Number of banks with pins in a mask, the writes a mask call should take
+static uint32_t banks(uint64_t mask)
+{
+	return ((uint32_t)mask != 0) + ((mask >> REG_BITS) != 0);
+}
+
+int main(void)
+{
+	uint64_t out = 0, en = 0;
+
+	srand(330);
+	pin_sim_reset();
+	for (uint32_t i = 0; i < STEPS; i++) {
+		uint64_t m = rand_mask(), v = rand_mask(), vm = m & VALID;
+		uint32_t expect;
+		pin_sim_trace_clear();
+		switch (rand() % 5) {
+			case 0:
+				pin_set_mask(m);
+				out |= vm;
+				expect = banks(vm);
+				break;
+			case 1:
+				pin_clear_mask(m);
+				out &= ~vm;
+				expect = banks(vm);
+				break;
+			case 2:
+				pin_write_mask(m, v);
+				out = (out & ~vm) | (v & vm);
+				expect = banks(vm & ~v) + banks(vm & v);
+				break;
+			case 3:
+				pin_output_mask(m, true);
+				en |= vm;
+				expect = banks(vm);
+				break;
+			default:
+				pin_output_mask(m, false);
+				en &= ~vm;
+				expect = banks(vm);
+				break;
+		}
+		CHECK_EQ(pin_sim_accesses(), expect);
+		CHECK_EQ(get_pair(GPIO_OUT_REG, GPIO_OUT1_REG), out);
+		CHECK_EQ(get_pair(GPIO_ENABLE_REG, GPIO_ENABLE1_REG), en);
+		if (check_fails) break;
+	}
+
+	// Accesses to change 8 data pins and a clock, as a bit-banged bus would
+	uint64_t bus = 0xFFLLU << 12 | 1LLU << 33, val = 0xA5LLU << 12 | 1LLU << 33;
+	pin_sim_trace_clear();
+	pin_write_mask(bus, val);
+	uint32_t mask_acc = pin_sim_accesses();
+	pin_sim_trace_clear();
+	for (pin_num_t pin = 0; pin < PIN_MAX; pin++) { // read-modify-write per pin
+		if (!(bus >> pin & 1)) continue;
+		uint32_t r = (pin < REG_BITS) ? GPIO_OUT_REG : GPIO_OUT1_REG;
+		uint32_t bit = 1U << pin % REG_BITS;
+		if (val >> pin & 1) REG(r) |= bit;
+		else REG(r) &= ~bit;
+	}
+	uint32_t pin_acc = pin_sim_accesses();
+	printf("9 pins in 2 banks: pin_write_mask %u accesses, one pin at a time %u\n",
+		(unsigned)mask_acc, (unsigned)pin_acc);
+	CHECK_EQ(mask_acc, 3);
+	return CHECK_RESULT();
+}
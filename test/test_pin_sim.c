@@ -0,0 +1,172 @@
+// Drive the pin component through its register simulator (pin_sim.c) and
+// check the register state and the number of register accesses of each
+// call, as the linux target would run it.
+
+#include "pin.h"
+#include "pin_reg.h"
+#include "pin_sim.h"
+#include "driver/rtc_io.h"
+#include "check.h"
+
+#define IO_MUX_RESET (2U << MCU_SEL | 2U << FUN_DRV | 1U << FUN_WPU)
+
+#if !HAVE_PIN_C
+// Without the student's pin.c, record the pins pin_reset() is called with.
+static uint64_t reset_pins;
+static uint32_t reset_calls;
+
+int32_t pin_reset(pin_num_t pin)
+{
+	reset_pins |= 1LLU << pin;
+	reset_calls++;
+	return 0;
+}
+#endif
+
+static uint64_t get_out(void)
+{
+	return pin_sim_get(GPIO_OUT_REG) | (uint64_t)pin_sim_get(GPIO_OUT1_REG) << REG_BITS;
+}
+
+static uint64_t get_enable(void)
+{
+	return pin_sim_get(GPIO_ENABLE_REG) | (uint64_t)pin_sim_get(GPIO_ENABLE1_REG) << REG_BITS;
+}
+
+static uint64_t get_in(void)
+{
+	return pin_sim_get(GPIO_IN_REG) | (uint64_t)pin_sim_get(GPIO_IN1_REG) << REG_BITS;
+}
+
+// Power-on values
+static void test_reset(void)
+{
+	pin_sim_reset();
+	CHECK_EQ(get_out(), 0);
+	CHECK_EQ(get_enable(), 0);
+	CHECK_EQ(get_in(), 0);
+	CHECK_EQ(pin_sim_get(GPIO_FUNC_OUT_SEL_CFG_REG(5)), 0x100);
+	CHECK_EQ(pin_sim_get(IO_MUX_REG(5)), 2U << FUN_DRV);
+	CHECK_EQ(pin_sim_accesses(), 0);
+}
+
+// W1TS and W1TC writes fold into their register, and are traced
+static void test_w1(void)
+{
+	pin_sim_write_t tr[8];
+
+	pin_sim_reset();
+	REG(GPIO_OUT_W1TS_REG) = 0x0000F00F;
+	REG(GPIO_OUT_W1TC_REG) = 0x0000000F;
+	REG(GPIO_OUT1_W1TS_REG) = 0x81;
+	CHECK_EQ(get_out(), 0x0000F000 | 0x81LLU << 32);
+	CHECK_EQ(pin_sim_get(GPIO_OUT_W1TS_REG), 0); // aliases read zero
+	CHECK_EQ(pin_sim_accesses(), 3);
+	CHECK_EQ(pin_sim_trace(tr, 8), 3);
+	CHECK_EQ(tr[0].addr, GPIO_OUT_W1TS_REG);
+	CHECK_EQ(tr[0].value, 0x0000F00F);
+	CHECK_EQ(tr[2].addr, GPIO_OUT1_W1TS_REG);
+
+	// a read is an access but not a write
+	pin_sim_trace_clear();
+	(void)REG(GPIO_IN_REG);
+	CHECK_EQ(pin_sim_accesses(), 1);
+	CHECK_EQ(pin_sim_trace(tr, 8), 0);
+}
+
+// Inputs follow the pads: own output, outside driver, or pull resistor
+static void test_pads(void)
+{
+	pin_sim_reset();
+	pin_input_mask(1LLU << 5 | 1LLU << 18 | 1LLU << 34, true);
+	CHECK_EQ(get_in(), 0); // pull-ups off, floating reads low
+
+	pin_pullup_mask(1LLU << 5, true); // IO_MUX pull-up
+	pin_pullup_mask(1LLU << 34, true); // RTC pad pull-up
+	CHECK_EQ(get_in(), 1LLU << 5 | 1LLU << 34);
+
+	pin_sim_drive(1LLU << 5 | 1LLU << 18, 1LLU << 18, true);
+	CHECK_EQ(get_in(), 1LLU << 18 | 1LLU << 34);
+	pin_sim_drive(1LLU << 5, 0, false); // released, pulled up again
+	CHECK_EQ(get_in(), 1LLU << 5 | 1LLU << 18 | 1LLU << 34);
+
+	// an output drives its own pad over the outside driver
+	pin_output_mask(1LLU << 18, true);
+	pin_clear_mask(1LLU << 18);
+	CHECK_EQ(get_in(), 1LLU << 5 | 1LLU << 34);
+
+	// no input enable, no input
+	pin_input_mask(1LLU << 34, false);
+	CHECK_EQ(get_in(), 1LLU << 5);
+}
+
+// The mask calls take one write per bank of the GPIO registers, and one
+// access per pin of the IO_MUX registers
+static void test_counts(void)
+{
+	uint64_t both = 1LLU << 2 | 1LLU << 23 | 1LLU << 33 | 1LLU << 39;
+
+	pin_sim_reset();
+	pin_output_mask(both, true);
+	CHECK_EQ(pin_sim_accesses(), 2);
+	CHECK_EQ(get_enable(), both);
+
+	pin_sim_trace_clear();
+	pin_set_mask(1LLU << 2 | 1LLU << 23); // bank 0 only
+	CHECK_EQ(pin_sim_accesses(), 1);
+
+	pin_sim_trace_clear();
+	pin_write_mask(both, 1LLU << 33);
+	CHECK_EQ(pin_sim_accesses(), 3); // W1TC, W1TC1, W1TS1
+	CHECK_EQ(get_out(), 1LLU << 33);
+
+	pin_sim_trace_clear();
+	pin_input_mask(both, true);
+	CHECK_EQ(pin_sim_accesses(), 4);
+
+	pin_sim_trace_clear();
+	pin_output_mask(0, true); // no pins, no access
+	pin_set_mask(0xFLLU << 28); // pins 28-31 do not exist
+	CHECK_EQ(pin_sim_accesses(), 0);
+}
+
+// pin_reset_mask() resets each pin, then disables the outputs, one write
+// per bank
+static void test_reset_mask(void)
+{
+	uint64_t mask = 1LLU << 4 | 1LLU << 21 | 0xFLLU << 28 | 1LLU << 38;
+	uint64_t valid = mask & ~(0xFLLU << 28);
+
+	pin_sim_reset();
+	pin_output_mask(valid | 1LLU << 22, true);
+	pin_set_mask(valid | 1LLU << 22);
+	pin_sim_trace_clear();
+#if HAVE_PIN_C
+	CHECK_EQ(pin_reset_mask(mask), 0);
+	CHECK_EQ(get_enable(), 1LLU << 22);
+	CHECK_EQ(get_out(), 1LLU << 22);
+	for (pin_num_t pin = 0; pin < PIN_MAX; pin++) {
+		if (!(valid & 1LLU << pin)) continue;
+		CHECK_EQ(pin_sim_get(GPIO_PIN_REG(pin)), 0);
+		CHECK_EQ(pin_sim_get(GPIO_FUNC_OUT_SEL_CFG_REG(pin)), 0x100);
+		CHECK_EQ(pin_sim_get(IO_MUX_REG(pin)), IO_MUX_RESET);
+	}
+#else
+	reset_pins = reset_calls = 0;
+	CHECK_EQ(pin_reset_mask(mask), 0);
+	CHECK_EQ(reset_pins, valid);
+	CHECK_EQ(reset_calls, 3);
+	CHECK_EQ(get_enable(), 1LLU << 22);
+	CHECK_EQ(pin_sim_accesses(), 2); // ENABLE and ENABLE1 W1TC
+#endif
+}
+
+int main(void)
+{
+	test_reset();
+	test_w1();
+	test_pads();
+	test_counts();
+	test_reset_mask();
+	return CHECK_RESULT();
+}
@@ -0,0 +1,376 @@
+// Lab05 protocol (proto.c) checks over the simulated serial link (link.c).
+//
+// Two boards: two processes, each running the protocol over its end of a
+// socket pair with latency, lost bytes and flipped bits, play games of the
+// lab's board (board.c) with the computer (ai.c) choosing moves. After each
+// game the boards swap their state and must agree.
+//
+// Frames: the test plays the other board by hand, with its own COBS and
+// CRC-16, and checks the frames sent, the resend of a frame not acked, the
+// batching of messages, acks, and that duplicate, corrupt, overlong and
+// malformed frames are dropped without losing the next good frame.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <poll.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "board.h"
+#include "ai.h"
+#include "proto.h"
+#include "config.h"
+#include "link.h"
+#include "check.h"
+
+#define RESEND_MS 100 // Resend time of proto.c
+#define QUEUE_LEN 8 // Receive queue of proto.c
+#define FRAME_WAIT 500 // Longest wait for a frame from the board
+#define MOVE_WAIT 5000 // Longest wait for the other board to move
+#define GAMES 10
+#define AI_US 2000
+
+// Global variables
+static int peer; // The test's end of the link, as the other board
+
+
+//---------- two boards ----------//
+
+static uint64_t now_ms(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+// Wait for a message from the other board.
+// Return true if one came in time.
+static bool msg_wait(proto_msg_t *m, uint32_t ms)
+{
+	for (uint64_t end = now_ms() + ms; !proto_get(m); vTaskDelay(1))
+		if (now_ms() >= end) return false;
+	return true;
+}
+
+static bool game_over(void)
+{
+	return board_winner(X_m) || board_winner(O_m) || board_mark_count() == CONFIG_BOARD_SPACES;
+}
+
+// One board: play X (player 0) or O (player 1) for GAMES games.
+// Return the CHECK_RESULT() of the board.
+static int board_run(uint32_t player, int fd)
+{
+	link_cfg_t cfg = {.latency_ms = 2, .drop_ppm = 10000, .flip_ppm = 10000, .seed = 11 + player};
+	mark_t me = player ? O_m : X_m;
+	uint32_t seed = 1 + player, wins[3] = {0};
+	link_stats_t ls;
+
+	alarm(60); // a board that hangs fails the test
+	link_open(fd, &cfg);
+	CHECK_EQ(proto_init(&(proto_io_t){link_write, link_read, link_wait}), 0);
+	ai_init();
+	for (uint32_t g = 0; g < GAMES; g++) {
+		board_clear();
+		ai_new_game();
+		for (mark_t m = X_m; !game_over(); m = (m == X_m) ? O_m : X_m) {
+			proto_msg_t msg = {.type = PROTO_MOVE};
+			if (m == me) {
+				if (board_mark_count() < 2) { // vary the games
+					do {
+						msg.move.r = rand_r(&seed) % CONFIG_BOARD_R;
+						msg.move.c = rand_r(&seed) % CONFIG_BOARD_C;
+					} while (board_get(msg.move.r, msg.move.c) != no_m);
+				} else {
+					ai_move(me, AI_US, &msg.move.r, &msg.move.c);
+				}
+				CHECK(board_set(msg.move.r, msg.move.c, me));
+				CHECK(proto_send(&msg));
+				continue;
+			}
+			if (!msg_wait(&msg, MOVE_WAIT)) {
+				fprintf(stderr, "board %u: no move in game %u\n", player, g);
+				return 1;
+			}
+			CHECK_EQ(msg.type, PROTO_MOVE);
+			CHECK(board_set(msg.move.r, msg.move.c, m));
+		}
+		wins[board_winner(X_m) ? X_m : board_winner(O_m) ? O_m : no_m]++;
+		// swap the boards, they must agree
+		proto_msg_t mine = {.type = PROTO_BOARD, .board = {
+			.turn = (board_mark_count() & 1) ? O_m : X_m,
+			.x = board_bits(X_m), .o = board_bits(O_m)}}, theirs;
+		CHECK(proto_send(&mine));
+		CHECK(msg_wait(&theirs, MOVE_WAIT));
+		CHECK_EQ(theirs.type, PROTO_BOARD);
+		CHECK_EQ(theirs.board.turn, mine.board.turn);
+		CHECK_EQ(theirs.board.x, mine.board.x);
+		CHECK_EQ(theirs.board.o, mine.board.o);
+	}
+	link_get_stats(&ls);
+	printf("board %u: %u games, X won %u, O won %u, %u drawn; "
+		"%u bytes in, %u dropped, %u flipped\n", player, GAMES, wins[X_m], wins[O_m],
+		wins[no_m], ls.bytes, ls.dropped, ls.flipped);
+	return CHECK_RESULT();
+}
+
+// Play two boards against each other, each in its own process. A board
+// that is done reports its result and keeps its protocol task running
+// until both are done, so its last frames are still sent again if lost.
+static void test_boards(void)
+{
+	int sv[2], done[2];
+	pid_t pid[2];
+
+	CHECK_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, sv), 0);
+	CHECK_EQ(pipe(done), 0);
+	fflush(stdout);
+	for (uint32_t p = 0; p < 2; p++) {
+		pid[p] = fork();
+		if (pid[p] == 0) {
+			close(sv[!p]);
+			close(done[0]);
+			uint8_t result = board_run(p, sv[p]);
+			fflush(stdout);
+			write(done[1], &result, 1);
+			for (;;) pause(); // until killed, or the alarm
+		}
+	}
+	close(sv[0]);
+	close(sv[1]);
+	close(done[1]);
+	for (uint32_t p = 0; p < 2; p++) {
+		uint8_t result = 1;
+		CHECK_EQ(read(done[0], &result, 1), 1); // 0 if a board died
+		CHECK_EQ(result, 0);
+	}
+	close(done[0]);
+	for (uint32_t p = 0; p < 2; p++) {
+		kill(pid[p], SIGKILL);
+		CHECK_EQ(waitpid(pid[p], NULL, 0), pid[p]);
+	}
+}
+
+//---------- frames ----------//
+
+// CRC-16/CCITT-FALSE, bit by bit.
+static uint16_t ref_crc(const uint8_t *p, uint32_t len)
+{
+	uint16_t crc = 0xFFFF;
+
+	while (len--) {
+		crc ^= *p++ << 8;
+		for (uint32_t b = 0; b < 8; b++)
+			crc = (crc & 0x8000) ? (uint16_t)(crc << 1) ^ 0x1021 : (uint16_t)(crc << 1);
+	}
+	return crc;
+}
+
+// COBS encode, with the delimiter. Return the encoded length.
+static uint32_t ref_encode(const uint8_t *src, uint32_t len, uint8_t *dst)
+{
+	uint32_t o = 0;
+
+	for (uint32_t i = 0; i <= len; ) {
+		uint32_t n = 0;
+		while (i + n < len && src[i+n] && n < 254) n++;
+		dst[o++] = n + 1;
+		memcpy(dst + o, src + i, n);
+		o += n;
+		i += n + (n < 254); // skip the zero, or the end
+	}
+	dst[o++] = 0;
+	return o;
+}
+
+// COBS decode, without the delimiter. Return the decoded length, or -1.
+static int32_t ref_decode(const uint8_t *src, uint32_t len, uint8_t *dst)
+{
+	uint32_t o = 0;
+
+	for (uint32_t i = 0; i < len; ) {
+		uint32_t code = src[i++];
+		if (!code || i + code - 1 > len) return -1;
+		memcpy(dst + o, src + i, code - 1);
+		o += code - 1;
+		i += code - 1;
+		if (code < 0xFF && i < len) dst[o++] = 0;
+	}
+	return o;
+}
+
+// Read the next frame from the board and check its CRC.
+// Return the frame length without the CRC, or -1 on time out.
+static int32_t peer_frame(uint8_t *f, uint32_t ms)
+{
+	uint8_t enc[512];
+	uint32_t n = 0;
+	uint64_t end = now_ms() + ms;
+
+	for (;;) {
+		uint8_t b;
+		if (recv(peer, &b, 1, MSG_DONTWAIT) == 1) {
+			if (b) {
+				if (n < sizeof(enc)) enc[n++] = b;
+				continue;
+			}
+			int32_t len = ref_decode(enc, n, f);
+			CHECK(len >= 4);
+			if (len < 4) return -1;
+			CHECK_EQ(ref_crc(f, len - 2), f[len-2] << 8 | f[len-1]);
+			return len - 2;
+		}
+		uint64_t now = now_ms();
+		if (now >= end) return -1;
+		struct pollfd pfd = {.fd = peer, .events = POLLIN};
+		poll(&pfd, 1, end - now);
+	}
+}
+
+// Send a frame to the board.
+// seq, ack: frame header.
+// *msgs: messages, with their type and length, len bytes.
+// bad: send a wrong CRC.
+static void peer_send(uint8_t seq, uint8_t ack, const uint8_t *msgs, uint32_t len, bool bad)
+{
+	uint8_t f[256], enc[300];
+
+	f[0] = seq;
+	f[1] = ack;
+	memcpy(f + 2, msgs, len);
+	uint16_t crc = ref_crc(f, len + 2) ^ bad;
+	f[len+2] = crc >> 8;
+	f[len+3] = crc;
+	send(peer, enc, ref_encode(f, len + 4, enc), 0);
+}
+
+// Wait for the board to ack a frame on its own.
+static void peer_acked(uint8_t seq)
+{
+	uint8_t f[256];
+
+	CHECK_EQ(peer_frame(f, FRAME_WAIT), 2);
+	CHECK_EQ(f[0], 0);
+	CHECK_EQ(f[1], seq);
+}
+
+// Messages waiting in the board's receive queue.
+static uint32_t got(proto_msg_t *m, uint32_t max)
+{
+	uint32_t n = 0;
+
+	vTaskDelay(pdMS_TO_TICKS(50));
+	while (n < max && proto_get(m + n)) n++;
+	return n;
+}
+
+static void test_frames(void)
+{
+	static const uint8_t crc_check[] = "123456789";
+	uint8_t f[256], g[256];
+	proto_msg_t m[QUEUE_LEN+1];
+	int sv[2];
+
+	CHECK_EQ(ref_crc(crc_check, 9), 0x29B1); // the catalogued check value
+	CHECK_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, sv), 0);
+	peer = sv[1];
+	link_open(sv[0], NULL);
+	CHECK_EQ(proto_init(&(proto_io_t){link_write, link_read, link_wait}), 0);
+
+	// a move: seq, ack of nothing yet, type, length, r, c
+	CHECK(proto_send(&(proto_msg_t){.type = PROTO_MOVE, .move = {1, 2}}));
+	CHECK_EQ(peer_frame(f, FRAME_WAIT), 6);
+	uint8_t seq = f[0];
+	CHECK(seq != 0);
+	CHECK_EQ(f[1], 0);
+	CHECK(!memcmp(f + 2, "\x01\x02\x01\x02", 4));
+
+	// not acked: sent again after RESEND_MS
+	uint64_t t0 = now_ms();
+	CHECK_EQ(peer_frame(g, RESEND_MS + FRAME_WAIT), 6);
+	CHECK(now_ms() - t0 >= RESEND_MS - 20);
+	CHECK(!memcmp(f, g, 6));
+
+	// queued while the frame waits for its ack: sent together when acked,
+	// and the board's 64-bit words hold zero bytes for COBS
+	proto_msg_t board = {.type = PROTO_BOARD, .board = {.turn = O_m,
+		.x = 0x0100000000000001LLU, .o = 0x8000000000FF0000LLU}};
+	CHECK(proto_send(&(proto_msg_t){.type = PROTO_MOVE, .move = {0, 0}}));
+	CHECK(proto_send(&(proto_msg_t){.type = PROTO_RESYNC}));
+	CHECK(proto_send(&board));
+	peer_send(0, seq, NULL, 0, false);
+	int32_t n;
+	while ((n = peer_frame(f, FRAME_WAIT)) > 0 && f[0] == seq) {} // sent again before the ack
+	CHECK_EQ(n, 2 + 4 + 2 + 2 + 1 + 16);
+	CHECK_EQ(f[0], seq % 255 + 1);
+	CHECK(!memcmp(f + 2, "\x01\x02\x00\x00\x02\x00\x03\x11\x02", 9));
+	CHECK(!memcmp(f + 11, "\x01\x00\x00\x00\x00\x00\x00\x01", 8));
+	CHECK(!memcmp(f + 19, "\x00\x00\xFF\x00\x00\x00\x00\x80", 8));
+	seq = f[0];
+	peer_send(0, seq, NULL, 0, false);
+	CHECK_EQ(peer_frame(f, RESEND_MS + 100), -1); // acked, not sent again
+
+	// two moves from the other board, acked on their own
+	peer_send(7, seq, (const uint8_t *)"\x01\x02\x02\x01\x01\x02\x00\x02", 8, false);
+	peer_acked(7);
+	CHECK_EQ(got(m, QUEUE_LEN), 2);
+	CHECK(m[0].type == PROTO_MOVE && m[0].move.r == 2 && m[0].move.c == 1);
+	CHECK(m[1].type == PROTO_MOVE && m[1].move.r == 0 && m[1].move.c == 2);
+
+	// sent again as the ack was lost: acked again, not delivered again
+	peer_send(7, seq, (const uint8_t *)"\x01\x02\x02\x01\x01\x02\x00\x02", 8, false);
+	peer_acked(7);
+	CHECK_EQ(got(m, QUEUE_LEN), 0);
+
+	// a wrong CRC: dropped, not acked
+	static const uint8_t MOVE11[] = {PROTO_MOVE, 2, 1, 1};
+	peer_send(8, seq, MOVE11, 4, true);
+	CHECK_EQ(peer_frame(f, RESEND_MS), -1);
+	CHECK_EQ(got(m, QUEUE_LEN), 0);
+
+	// noise, then an overlong run of bytes: the next frame still gets in
+	send(peer, "\x05\x41\x42\x00", 4, 0);
+	uint8_t junk[300];
+	memset(junk, 0x55, sizeof(junk));
+	send(peer, junk, sizeof(junk), 0);
+	send(peer, "", 1, 0);
+	peer_send(8, seq, MOVE11, 4, false);
+	peer_acked(8);
+	CHECK_EQ(got(m, QUEUE_LEN), 1);
+
+	// a message running past the end of the frame: dropped, not acked
+	peer_send(9, seq, (const uint8_t *)"\x01\x05\x01\x01", 4, false);
+	CHECK_EQ(peer_frame(f, RESEND_MS), -1);
+	CHECK_EQ(got(m, QUEUE_LEN), 0);
+
+	// a message length that does not match its type: acked, the message skipped
+	peer_send(9, seq, (const uint8_t *)"\x01\x03\x01\x01\x01\x01\x02\x02\x02", 9, false);
+	peer_acked(9);
+	CHECK_EQ(got(m, QUEUE_LEN), 1);
+	CHECK(m[0].move.r == 2 && m[0].move.c == 2);
+
+	// a frame that does not fit the receive queue waits for the next send
+	uint8_t moves[4*(QUEUE_LEN-2)];
+	for (uint32_t i = 0; i < QUEUE_LEN-2; i++) memcpy(moves + 4*i, MOVE11, 4);
+	peer_send(10, seq, moves, sizeof(moves), false);
+	peer_acked(10);
+	peer_send(11, seq, moves, sizeof(moves), false);
+	CHECK_EQ(peer_frame(f, RESEND_MS), -1);
+	CHECK_EQ(got(m, QUEUE_LEN), QUEUE_LEN-2);
+	peer_send(11, seq, moves, sizeof(moves), false);
+	peer_acked(11);
+	CHECK_EQ(got(m, QUEUE_LEN), QUEUE_LEN-2);
+}
+
+int main(void)
+{
+	test_boards(); // first, the processes must not inherit the protocol task
+	test_frames();
+	return CHECK_RESULT();
+}
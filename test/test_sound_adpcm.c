@@ -0,0 +1,214 @@
+// IMA-ADPCM voices against a reference encoder. The encoder below follows
+// audio/audio2c_adpcm.m and keeps the decoder state it expects the player
+// to reach, so the mixer output must match it sample for sample, across
+// blocks, a short last block and a loop. The decoder is also checked
+// against fixed vectors from an independent decoder. Also prints the round
+// trip SNR and the decode time per sample.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "esp_cpu.h"
+#include "sound.h"
+#include "sound_mix.h"
+#include "sound_adpcm.h"
+#include "check.h"
+
+#define HZ 24000
+#define BLK 64 // Samples per refill
+#define PER_BLOCK (1 + (SOUND_ADPCM_BLOCK - ADPCM_HDR) * 2) // Samples per block
+#define N (PER_BLOCK * 5 + 101) // Five blocks and a short one
+#define BENCH_N 1000000
+#define VEC_BYTES 24 // Most code bytes of a vector
+
+// A block decoded by an independent decoder: the header, the code bytes
+// (low nibble first) and the samples expected, the header sample first.
+typedef struct {
+	int16_t pred;
+	uint8_t index;
+	uint8_t n; // Code bytes
+	uint8_t codes[VEC_BYTES];
+	int16_t pcm[1 + 2*VEC_BYTES];
+} vector_t;
+
+// Global variables
+static int16_t pcm[N]; // Input
+static int16_t ref[N]; // Decoded by the encoder's decoder
+static uint8_t adpcm[(N / PER_BLOCK + 1) * SOUND_ADPCM_BLOCK];
+
+// Decoded with Python's audioop.adpcm2lin() (the Intel/DVI reference
+// decoder, which takes the high nibble first, so the code bytes were
+// swapped for it). The vectors cover all 16 codes, both clamps of the
+// predictor and the top step index.
+static const vector_t vectors[] = {
+	{0, 0, 24, {
+		0x10, 0x32, 0x54, 0x76, 0x98, 0xba, 0xdc, 0xfe, 0x77, 0x77, 0x77, 0x77,
+		0xff, 0xff, 0xff, 0xff, 0xc3, 0xa5, 0xe1, 0x96, 0xd2, 0xb4, 0x80, 0x07,
+	}, {
+		0, 0, 1, 4, 8, 15, 27, 47, 88, 82, 66, 41, 10, -28, -84, -181, -380,
+		50, 975, 2962, 7222, 16353, 32767, 32767, 32767, -28669, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -4099, -32768, 12285,
+		-8193, 2979, -32768, 20477, 8191, 26812, -10430, 26432, -2237, 1487,
+		-1898, 32767, 32767,
+	}},
+	{32000, 70, 8, {
+		0x77, 0x77, 0xff, 0xff, 0x00, 0x00, 0x88, 0x88,
+	}, {
+		32000, 32767, 32767, 32767, 32767, -28669, -32768, -32768, -32768,
+		-28673, -24949, -21564, -18487, -21285, -23828, -26140, -28242,
+	}},
+	{-32000, 88, 4, {
+		0xff, 0x87, 0xf0, 0xff,
+	}, {
+		-32000, -32768, -32768, 28668, 24573, 28297, -22488, -32768, -32768,
+	}},
+};
+
+
+// Encode one sample as in ima_encode() of audio2c_adpcm.m.
+static uint32_t encode(adpcm_state_t *st, int32_t x)
+{
+	int32_t step = adpcm_step_tab[st->index];
+	int32_t d = x - st->pred;
+	uint32_t code = 0;
+
+	if (d < 0) {code = 8; d = -d;}
+	if (d >= step) {code |= 4; d -= step;}
+	if (d >= step >> 1) {code |= 2; d -= step >> 1;}
+	if (d >= step >> 2) code |= 1;
+	adpcm_decode(st, code); // track the decoder
+	return code;
+}
+
+// Encode n samples into blocks.
+// Return the number of bytes.
+static uint32_t encode_all(const int16_t *in, int16_t *out, uint8_t *dst, uint32_t n)
+{
+	adpcm_state_t st = {0, 0};
+	uint32_t b = 0;
+
+	for (uint32_t i = 0; i < n;) {
+		// header: the sample itself, and the step index reached so far
+		st.pred = in[i];
+		dst[b++] = st.pred & 0xFF;
+		dst[b++] = (st.pred >> 8) & 0xFF;
+		dst[b++] = st.index;
+		dst[b++] = 0;
+		out[i++] = st.pred;
+		for (uint32_t k = 0; k < SOUND_ADPCM_BLOCK - ADPCM_HDR && i < n; k++) {
+			uint32_t lo = encode(&st, in[i]);
+			out[i++] = st.pred;
+			uint32_t hi = 0;
+			if (i < n) {hi = encode(&st, in[i]); out[i++] = st.pred;}
+			dst[b++] = lo | hi << 4;
+		}
+	}
+	return b;
+}
+
+// Mixer output of a decoded sample at unity gain and full volume.
+static uint8_t mix_out(int32_t s)
+{
+	return (uint8_t)((s >> 8) + SILENCE);
+}
+
+static void test_decode(uint32_t size)
+{
+	uint8_t buf[BLK];
+	uint32_t bad = 0, i = 0;
+
+	CHECK(sound_play_adpcm(0, adpcm, size, MAX_VOL, true, 1) >= 0);
+	// two laps, the loop restarts at block 0
+	for (uint32_t lap = 0; lap < 2 * N; lap += BLK) {
+		sound_mix(buf, BLK);
+		for (uint32_t k = 0; k < BLK; k++, i++) {
+			uint8_t want = mix_out(ref[i % N]);
+			if (buf[k] != want && !bad++)
+				printf("sample %u: %u != %u\n", i, buf[k], want);
+		}
+	}
+	CHECK_EQ(bad, 0);
+	sound_stop();
+	sound_mix(buf, BLK);
+
+	// played once, the voice ends after the last sample
+	sound_play_adpcm(0, adpcm, size, MAX_VOL, false, 1);
+	for (i = 0; i < N + BLK; i += BLK) sound_mix(buf, BLK);
+	CHECK(!sound_busy());
+}
+
+// Decode the fixed vectors, directly and through a voice.
+static void test_vectors(void)
+{
+	for (uint32_t v = 0; v < sizeof(vectors)/sizeof(vectors[0]); v++) {
+		const vector_t *vp = vectors + v;
+		uint8_t block[ADPCM_HDR + VEC_BYTES] = {
+			vp->pred & 0xFF, (vp->pred >> 8) & 0xFF, vp->index, 0,
+		};
+		uint32_t bad = 0, n = 1 + 2*vp->n;
+		adpcm_state_t st;
+
+		for (uint32_t i = 0; i < vp->n; i++) block[ADPCM_HDR + i] = vp->codes[i];
+		bad += adpcm_header(&st, block) != vp->pcm[0];
+		for (uint32_t i = 0; i < vp->n; i++) {
+			bad += adpcm_decode(&st, vp->codes[i] & 0xF) != vp->pcm[1 + 2*i];
+			bad += adpcm_decode(&st, vp->codes[i] >> 4) != vp->pcm[2 + 2*i];
+		}
+		CHECK_EQ(bad, 0);
+
+		// a voice plays the short block, then ends
+		uint8_t buf[BLK];
+		CHECK(sound_play_adpcm(0, block, ADPCM_HDR + vp->n, MAX_VOL, false, 1) >= 0);
+		sound_mix(buf, BLK);
+		for (uint32_t i = 0; i < n; i++) bad += buf[i] != mix_out(vp->pcm[i]);
+		CHECK_EQ(bad, 0);
+		CHECK(!sound_busy());
+	}
+}
+
+// Round trip signal to noise ratio in dB.
+static double snr(void)
+{
+	double sig = 0, noise = 0;
+
+	for (uint32_t i = 0; i < N; i++) {
+		sig += (double)pcm[i] * pcm[i];
+		noise += (double)(pcm[i] - ref[i]) * (pcm[i] - ref[i]);
+	}
+	return 10 * log10(sig / noise);
+}
+
+static void bench_decode(void)
+{
+	adpcm_state_t st = {0, 0};
+	volatile int32_t sink = 0;
+
+	uint32_t t0 = esp_cpu_get_cycle_count();
+	for (uint32_t i = 0; i < BENCH_N; i++)
+		sink += adpcm_decode(&st, adpcm[ADPCM_HDR + i % (SOUND_ADPCM_BLOCK - ADPCM_HDR)] >> (i & 4) & 0xF);
+	uint32_t ns = esp_cpu_get_cycle_count() - t0;
+	printf("adpcm_decode: %.2f ns/sample (host)\n", (double)ns / BENCH_N);
+}
+
+int main(void)
+{
+	sound_mix_init(HZ, 0);
+	sound_set_volume(MAX_VOL); // identity table
+	test_vectors();
+
+	// a sweep with noise, loud enough to reach the large steps
+	for (uint32_t i = 0; i < N; i++) {
+		double f = 200 + 1800.0 * i / N;
+		pcm[i] = lrint(20000 * sin(2 * M_PI * f * i / HZ) + (rand() % 601 - 300));
+	}
+	uint32_t size = encode_all(pcm, ref, adpcm, N);
+	CHECK_EQ(size, 5 * SOUND_ADPCM_BLOCK + ADPCM_HDR + 50);
+	test_decode(size);
+
+	double db = snr();
+	printf("%u samples, %u bytes, SNR %.1f dB\n", N, size, db);
+	CHECK(db > 22);
+	bench_decode();
+	return CHECK_RESULT();
+}
@@ -0,0 +1,135 @@
+// Output timing of a DAC driver, built once with each driver (SOUND_DMA
+// set for sound_cont.c, otherwise sound_one.c) and run in simulated time.
+// The start to DAC output latency of a voice is measured at the DAC and
+// must match the latency the statistics report. With the DMA driver, the
+// refill interrupt is also held off by one to all of the DMA buffers, and
+// the underruns counted must match the buffers the DAC played again.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "esp_timer.h"
+#include "sound.h"
+#include "check.h"
+
+#if SOUND_DMA
+#include "driver/dac_continuous.h"
+#define DRIVER "dma"
+#else
+#include "driver/gptimer.h"
+#include "driver/dac_oneshot.h"
+#define DRIVER "one-shot"
+#endif
+
+#define HZ 24000
+#define SILENCE 0x80
+#define TRIALS 200
+#define SAMPLE_US (1000000 / HZ + 1)
+
+// Global variables
+static int64_t sound_us; // Time of the first sound at the DAC, or -1
+#if SOUND_DMA
+static uint32_t late_buf, late_n; // Hold off the callback after late_buf buffers
+#endif
+
+
+static void dac_out(const uint8_t *buf, size_t n)
+{
+	int64_t now = esp_timer_get_time();
+
+	if (sound_us >= 0) return;
+	for (size_t i = 0; i < n; i++)
+		if (buf[i] != SILENCE) {
+			sound_us = now + (int64_t)i * 1000000 / HZ;
+			return;
+		}
+}
+
+// Run the driver for n interrupts.
+static void run(uint32_t n)
+{
+#if SOUND_DMA
+	stub_dac_cont_run(n);
+#else
+	stub_gptimer_run(n);
+#endif
+}
+
+// Start a voice between two interrupts and measure when it is heard.
+static void test_latency(void)
+{
+	static uint8_t tone[HZ / 10];
+	sound_stats_t st;
+	int64_t sum = 0, max = 0;
+	uint32_t bad = 0;
+
+	for (uint32_t i = 0; i < sizeof(tone); i++) tone[i] = 0xFF;
+	run(64); // the DMA ring holds silence
+	for (uint32_t t = 0; t < TRIALS; t++) {
+		run(rand() % 16);
+		sound_us = -1;
+		int64_t t0 = esp_timer_get_time();
+		CHECK(sound_play(0, tone, sizeof(tone), MAX_VOL, false, 1) >= 0);
+		for (uint32_t k = 0; sound_us < 0 && k < HZ; k++) run(1);
+		CHECK(sound_us >= 0);
+		int64_t lat = sound_us - t0;
+		sound_stats_get(&st);
+		if (llabs((int64_t)st.lat_last_us - lat) > SAMPLE_US && !bad++)
+			printf("measured %lld us, reported %lu us\n", (long long)lat, (unsigned long)st.lat_last_us);
+		sum += lat;
+		if (lat > max) max = lat;
+		sound_stop();
+		run(64);
+	}
+	CHECK_EQ(bad, 0);
+	printf("%s: start to DAC %lld us average, %lld us max\n", DRIVER,
+		(long long)(sum / TRIALS), (long long)max);
+}
+
+#if SOUND_DMA
+// Refill interrupt held off by late_n buffers once.
+static uint32_t late(void)
+{
+	return (late_buf && !--late_buf) ? late_n : 0;
+}
+
+// Hold off one refill interrupt by 1 to CONFIG_SOUND_DAC_DESC_NUM buffers.
+static void test_underrun(void)
+{
+	static uint8_t noise[HZ / 4];
+	sound_stats_t st;
+
+	for (uint32_t i = 0; i < sizeof(noise); i++) noise[i] = rand();
+	stub_dac_late = late;
+	for (late_n = 0; late_n <= CONFIG_SOUND_DAC_DESC_NUM; late_n++) {
+		CHECK_EQ(sound_init(HZ), 0);
+		sound_play(0, noise, sizeof(noise), MAX_VOL, true, 1);
+		run(3 * CONFIG_SOUND_DAC_DESC_NUM); // the whole ring holds noise
+		sound_stats_reset();
+		late_buf = 5;
+		run(3 * CONFIG_SOUND_DAC_DESC_NUM);
+		sound_stats_get(&st);
+		CHECK_EQ(stub_dac_cont_stale(), late_n);
+		CHECK_EQ(st.underruns, late_n);
+		printf("interrupt late by %lu buffers: %lu played again, %lu underruns\n",
+			(unsigned long)late_n, (unsigned long)stub_dac_cont_stale(),
+			(unsigned long)st.underruns);
+		sound_stop();
+	}
+	stub_dac_late = NULL;
+}
+#endif
+
+int main(void)
+{
+	stub_dac_out = dac_out;
+	stub_time_set(0);
+	CHECK_EQ(sound_init(HZ), 0);
+	sound_set_volume(MAX_VOL);
+	test_latency();
+#if SOUND_DMA
+	test_underrun();
+#endif
+	CHECK_EQ(sound_deinit(), 0);
+	return CHECK_RESULT();
+}
@@ -0,0 +1,254 @@
+// Voice claim checks, with tasks playing and stopping sounds on any free
+// voice while an "ISR" thread mixes. Each task marks the voices it was
+// handed in an owner table: a voice handed to a second task while the first
+// still owns it, or found free while its owner has not stopped it, means a
+// stop or the end of a sound freed a claim made since.
+//
+// Stop all revokes every claim made before it, so in that phase an owner
+// counts only if no stop all ran since it claimed the voice.
+//
+// With one host CPU the threads seldom switch inside the few instructions
+// of a race, so the end of a sound racing a new claim is also set up
+// exactly: the mixer clock, called in the refill before the voices are
+// mixed, plays as a task on the other core would.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "sound.h"
+#include "sound_mix.h"
+#include "check.h"
+
+#define HZ 24000
+#define BLK 64 // Samples per refill, MIX_BLK of sound_mix.c
+#define TASKS 3
+#define HOLD 2 // Voices held by a task at a time, TASKS*HOLD < SOUND_VOICES
+#define RUN_MS 400
+
+// Global variables
+static atomic_bool running, stopping;
+static atomic_ullong owner[SOUND_VOICES]; // Stop all count << 8 | task+1, or 0
+static atomic_uint stops; // Odd while a stop all runs
+static atomic_uint plays, dups, lost;
+static atomic_uint refills;
+static uint8_t loop[256];
+static int32_t clock_voice; // Voice the clock plays on, or negative
+
+
+// Audio ISR: mix refills.
+static void *isr(void *arg)
+{
+	uint8_t buf[BLK];
+
+	stub_core_set(1);
+	while (atomic_load(&running)) {
+		sound_mix(buf, BLK);
+		atomic_fetch_add(&refills, 1);
+	}
+	return NULL;
+}
+
+// Wait for the ISR to apply the commands posted, so the ring does not fill
+// and drop a stop. A stop that could not be posted leaves the voice owned.
+static void settle(void)
+{
+	uint32_t r = atomic_load(&refills);
+
+	while (atomic_load(&refills) - r < 2 && atomic_load(&running)) sched_yield();
+}
+
+// Play a looped sound on any voice and take it in the owner table.
+// Return the voice, or negative if none was free.
+static int32_t take(uint32_t task)
+{
+	uint32_t s = atomic_load(&stops);
+	int32_t v = sound_play(SOUND_ANY, loop, sizeof(loop), 50, true, 1);
+
+	if (v < 0) return v;
+	atomic_fetch_add(&plays, 1);
+	unsigned long long tok = (unsigned long long)s << 8 | (task + 1);
+	unsigned long long old = atomic_load(&owner[v]);
+	while (!atomic_compare_exchange_weak(&owner[v], &old, tok)) ;
+	// the last owner had not stopped its sound, and no stop all took it
+	if (old && old >> 8 == atomic_load(&stops) && !(old >> 8 & 1))
+		atomic_fetch_add(&dups, 1);
+	return v;
+}
+
+// Task playing and stopping its own voices.
+static void *player(void *arg)
+{
+	uint32_t task = (uintptr_t)arg;
+	int32_t held[HOLD];
+	uint32_t n = 0, seed = task;
+
+	while (atomic_load(&running)) {
+		if (n < HOLD) {
+			int32_t v = take(task);
+			if (v >= 0) held[n++] = v;
+			continue;
+		}
+		uint32_t i = rand_r(&seed) % HOLD;
+		int32_t v = held[i];
+		held[i] = held[--n];
+		if (!sound_busy_voice(v)) atomic_fetch_add(&lost, 1);
+		atomic_store(&owner[v], 0);
+		sound_stop_voice(v);
+		settle();
+	}
+	while (n) sound_stop_voice(held[--n]);
+	return NULL;
+}
+
+// Task playing sounds it never stops.
+static void *filler(void *arg)
+{
+	uint32_t task = (uintptr_t)arg;
+
+	while (atomic_load(&running)) {
+		take(task);
+		settle();
+	}
+	return NULL;
+}
+
+// Task stopping all sounds now and then.
+static void *stopper(void *arg)
+{
+	while (atomic_load(&stopping)) {
+		atomic_fetch_add(&stops, 1);
+		sound_stop();
+		atomic_fetch_add(&stops, 1);
+		vTaskDelay(1);
+	}
+	return NULL;
+}
+
+// Run the tasks given for RUN_MS against the mixing ISR.
+static void run(void *(*task)(void *), bool stop_all)
+{
+	pthread_t th[TASKS+2];
+	uint8_t buf[BLK];
+
+	for (uint32_t v = 0; v < SOUND_VOICES; v++) atomic_store(&owner[v], 0);
+	atomic_store(&plays, 0);
+	atomic_store(&running, true);
+	atomic_store(&stopping, stop_all);
+	pthread_create(th+TASKS, NULL, isr, NULL);
+	for (uint32_t i = 0; i < TASKS; i++)
+		pthread_create(th+i, NULL, task, (void *)(uintptr_t)i);
+	if (stop_all) pthread_create(th+TASKS+1, NULL, stopper, NULL);
+	vTaskDelay(pdMS_TO_TICKS(RUN_MS));
+	atomic_store(&stopping, false);
+	if (stop_all) pthread_join(th[TASKS+1], NULL);
+	atomic_store(&running, false);
+	for (uint32_t i = 0; i <= TASKS; i++) pthread_join(th[i], NULL);
+	sound_stop();
+	sound_mix(buf, BLK);
+	CHECK(!sound_busy());
+}
+
+// A stopped voice claimed again at once keeps its new sound.
+static void test_stop(void)
+{
+	run(player, false);
+	printf("play/stop: %u plays, %u handed out twice, %u lost\n",
+		atomic_load(&plays), atomic_load(&dups), atomic_load(&lost));
+	CHECK(atomic_load(&plays) > 100);
+	CHECK_EQ(atomic_load(&dups), 0);
+	CHECK_EQ(atomic_load(&lost), 0);
+}
+
+// Stop all only frees the claims made before it.
+static void test_stop_all(void)
+{
+	atomic_store(&dups, 0);
+	run(filler, true);
+	printf("stop all: %u plays, %u stop alls, %u handed out twice\n",
+		atomic_load(&plays), atomic_load(&stops) / 2, atomic_load(&dups));
+	CHECK(atomic_load(&stops) > 2);
+	CHECK_EQ(atomic_load(&dups), 0);
+}
+
+// Mixer clock: claim the voice as a task on the other core would, while
+// the ISR is in the refill that ends its sound.
+static uint32_t clock_play(void)
+{
+	if (clock_voice >= 0) {
+		stub_core_set(0); // post the play, not applied until the next refill
+		CHECK_EQ(sound_play(clock_voice, loop, sizeof(loop), 50, true, 1), clock_voice);
+		stub_core_set(1);
+		clock_voice = -1;
+	}
+	return BLK;
+}
+
+// A sound ending in the refill that a new claim of its voice is made in
+// leaves the voice owned by the new claim.
+static void test_end(void)
+{
+	static uint8_t shot[BLK + BLK/2];
+	uint8_t buf[BLK];
+
+	stub_core_set(1);
+	int32_t v = sound_play(SOUND_ANY, shot, sizeof(shot), 50, false, 1);
+	sound_mix(buf, BLK); // first half of the sound
+	clock_voice = v;
+	sound_mix_clock(clock_play);
+	sound_mix(buf, BLK); // new claim, then the sound ends
+	CHECK(sound_busy_voice(v));
+	int32_t w = sound_play(SOUND_ANY, loop, sizeof(loop), 50, true, 1);
+	CHECK(w != v);
+	sound_mix(buf, BLK);
+	CHECK(sound_busy_voice(v));
+	sound_mix_clock(NULL);
+	sound_stop();
+	sound_mix(buf, BLK);
+	CHECK(!sound_busy());
+	stub_core_set(0);
+}
+
+// A stop or stop all posted before the play of a new claim is applied
+// leaves the new sound playing, and a stop posted after a play that is
+// still queued drops it.
+static void test_order(void)
+{
+	uint8_t buf[BLK];
+
+	int32_t v = sound_play(SOUND_ANY, loop, sizeof(loop), 50, true, 1);
+	sound_stop_voice(v);
+	CHECK_EQ(sound_play(SOUND_ANY, loop, sizeof(loop), 50, true, 1), v);
+	sound_mix(buf, BLK); // STOP, then PLAY of the new claim
+	CHECK(sound_busy_voice(v));
+	sound_stop();
+	CHECK_EQ(sound_play(v, loop, sizeof(loop), 50, true, 1), v);
+	sound_mix(buf, BLK); // STOP_ALL, then PLAY
+	CHECK(sound_busy_voice(v));
+	sound_stop_voice(v);
+	sound_mix(buf, BLK);
+	CHECK(!sound_busy());
+
+	sound_play(v, loop, sizeof(loop), 50, true, 1);
+	sound_stop_voice(v);
+	sound_mix(buf, BLK); // PLAY dropped, STOP finds nothing to stop
+	CHECK(!sound_busy());
+	sound_stats_t st;
+	sound_stats_get(&st);
+	CHECK_EQ(st.voices, 0);
+}
+
+int main(void)
+{
+	for (uint32_t i = 0; i < sizeof(loop); i++) loop[i] = i;
+	sound_mix_init(HZ, 0);
+	test_order();
+	test_end();
+	test_stop();
+	test_stop_all();
+	return CHECK_RESULT();
+}
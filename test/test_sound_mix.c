@@ -0,0 +1,152 @@
+// Mixer checks and benchmark, with the mixer run directly as the drivers
+// run it from the audio ISR. The master volume check changes the volume
+// from two tasks while an "ISR" thread mixes, and checks that each refill
+// is mapped through one complete volume table. The benchmark prints the
+// host time of a refill for a mix of voice kinds and counts.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_cpu.h"
+#include "sound.h"
+#include "sound_mix.h"
+#include "check.h"
+
+#define HZ 24000
+#define BLK 64 // Samples per refill, MIX_BLK of sound_mix.c
+#define VOL_RUN_MS 300
+#define BENCH_REFILLS 20000
+
+// Global variables
+static atomic_bool running;
+static uint32_t vol_refills, vol_torn, vol_bad;
+
+
+// Output of a full scale DC voice through the table of volume vol.
+static uint8_t vol_out(uint32_t vol)
+{
+	return (127 * (int32_t)vol) / 100 + SILENCE;
+}
+
+// Audio ISR: mix refills and check each one came from one table.
+static void *isr(void *arg)
+{
+	uint8_t buf[BLK];
+
+	stub_core_set(1);
+	while (atomic_load(&running)) {
+		sound_mix(buf, BLK);
+		vol_refills++;
+		for (uint32_t i = 1; i < BLK; i++)
+			if (buf[i] != buf[0]) {vol_torn++; break;}
+		bool ok = false;
+		for (uint32_t v = 0; v <= MAX_VOL && !ok; v++) ok = buf[0] == vol_out(v);
+		vol_bad += !ok;
+	}
+	return NULL;
+}
+
+// Task changing the volume as fast as it can.
+static void *setter(void *arg)
+{
+	uint32_t vol = (uintptr_t)arg;
+
+	while (atomic_load(&running)) {
+		sound_set_volume(vol);
+		vol = (vol + 37) % (MAX_VOL + 1);
+	}
+	return NULL;
+}
+
+// Volume changes from two tasks never tear a refill.
+static void test_volume(void)
+{
+	static uint8_t dc[256];
+	uint8_t buf[BLK];
+	pthread_t th[3];
+
+	for (uint32_t i = 0; i < sizeof(dc); i++) dc[i] = 0xFF;
+	sound_set_volume(MAX_VOL);
+	CHECK(sound_play(0, dc, sizeof(dc), MAX_VOL, true, 1) >= 0);
+
+	atomic_store(&running, true);
+	pthread_create(th+0, NULL, isr, NULL);
+	pthread_create(th+1, NULL, setter, (void *)0);
+	pthread_create(th+2, NULL, setter, (void *)50);
+	vTaskDelay(pdMS_TO_TICKS(VOL_RUN_MS));
+	atomic_store(&running, false);
+	for (uint32_t i = 0; i < 3; i++) pthread_join(th[i], NULL);
+	sound_mix(buf, BLK); // apply the changes still queued
+
+	CHECK(vol_refills > 0);
+	CHECK_EQ(vol_torn, 0);
+	CHECK_EQ(vol_bad, 0);
+	sound_stop();
+
+	// a single change is taken at the next refill
+	sound_play(0, dc, sizeof(dc), MAX_VOL, true, 1);
+	sound_set_volume(30);
+	sound_mix(buf, BLK);
+	CHECK_EQ(buf[0], vol_out(30));
+	sound_set_volume(70);
+	sound_set_volume(80);
+	sound_mix(buf, BLK);
+	CHECK_EQ(buf[BLK-1], vol_out(80));
+	sound_stop();
+	sound_mix(buf, BLK);
+}
+
+// Time refills of the voices already started, in host nanoseconds.
+static void bench(const char *name)
+{
+	uint8_t buf[BLK];
+	sound_stats_t st;
+
+	sound_mix(buf, BLK); // apply the commands
+	sound_stats_reset();
+	for (uint32_t i = 0; i < BENCH_REFILLS; i++) sound_mix(buf, BLK);
+	sound_stats_get(&st);
+	printf("%-22s %6lu ns/refill (min %lu, max %lu) %5.1f ns/sample\n", name,
+		(unsigned long)st.cyc_avg, (unsigned long)st.cyc_min,
+		(unsigned long)st.cyc_max, (double)st.cyc_avg / BLK);
+	sound_stop();
+	sound_mix(buf, BLK);
+}
+
+static void bench_mix(void)
+{
+	static uint8_t pcm[4096], adpcm[2048];
+
+	for (uint32_t i = 0; i < sizeof(pcm); i++) pcm[i] = rand();
+	for (uint32_t i = 0; i < sizeof(adpcm); i++) adpcm[i] = rand();
+	printf("refill of %u samples, host time\n", BLK);
+	bench("idle");
+	sound_play(SOUND_ANY, pcm, sizeof(pcm), 50, true, 1);
+	bench("1 pcm");
+	for (uint32_t v = 0; v < SOUND_VOICES; v++)
+		sound_play(SOUND_ANY, pcm, sizeof(pcm), 50, true, 1);
+	bench("8 pcm");
+	for (uint32_t v = 0; v < SOUND_VOICES; v++) {
+		sound_play(SOUND_ANY, pcm, sizeof(pcm), 50, true, 1);
+		sound_set_rate(v, 11025);
+	}
+	bench("8 pcm resampled");
+	for (uint32_t v = 0; v < SOUND_VOICES; v++)
+		sound_play_adpcm(SOUND_ANY, adpcm, sizeof(adpcm), 50, true, 1);
+	bench("8 adpcm");
+	for (uint32_t v = 0; v < SOUND_VOICES; v++)
+		sound_synth_start(SOUND_ANY, v % 4, 220 << v % 4, 50, NULL, 1);
+	bench("8 synth");
+}
+
+int main(void)
+{
+	sound_mix_init(HZ, 0);
+	test_volume();
+	bench_mix();
+	return CHECK_RESULT();
+}
@@ -0,0 +1,95 @@
+// Render the one-shot DAC driver (sound_one.c) on the host. The timer
+// interrupt is run by the test, each DAC write is captured, and the level
+// the DAC holds at each sample is written to sound_one.wav. Checks that a
+// voice reaches the DAC sample for sample, and that while idle the DAC is
+// left alone and the mixer runs once per output block, not per interrupt.
+
+#include <stdlib.h>
+
+#include "driver/gptimer.h"
+#include "driver/dac_oneshot.h"
+#include "sound.h"
+#include "check.h"
+#include "wav.h"
+
+#define HZ 24000
+#define ONE_BLK 32 // Output block of sound_one.c
+#define TICKS (HZ * 2)
+#define TONE_N 4800
+
+// Global variables
+static uint8_t out[TICKS]; // DAC level at each interrupt
+static uint8_t level = 0x80; // DAC level held
+static uint32_t writes;
+static uint32_t tick;
+
+
+static void dac_out(const uint8_t *buf, size_t n)
+{
+	level = buf[n-1];
+	writes += n;
+}
+
+// Run interrupts and record the DAC level after each.
+static void run(uint32_t n)
+{
+	for (uint32_t i = 0; i < n && tick < TICKS; i++) {
+		CHECK_EQ(stub_gptimer_run(1), 1);
+		out[tick++] = level;
+	}
+}
+
+static uint32_t refills(void)
+{
+	sound_stats_t st;
+	sound_stats_get(&st);
+	return st.refills;
+}
+
+int main(void)
+{
+	static uint8_t tone[TONE_N];
+
+	stub_dac_out = dac_out;
+	CHECK_EQ(sound_init(HZ), 0);
+	CHECK_EQ(stub_gptimer_period(), 42); // 1 MHz / 24 kHz
+	sound_set_volume(MAX_VOL); // DAC gets the samples unchanged
+
+	// Idle: no DAC writes, one mix per block
+	run(ONE_BLK); // first block applies the stats reset of sound_init()
+	uint32_t r0 = refills(), w0 = writes;
+	run(100 * ONE_BLK);
+	CHECK_EQ(writes, w0);
+	CHECK_EQ(refills() - r0, 100);
+
+	// A voice plays sample for sample from the next block
+	for (uint32_t i = 0; i < TONE_N; i++)
+		tone[i] = 0x80 + (int8_t)(100 * ((i / 20) & 1 ? 1 : -1) * (int32_t)(i % 20) / 20);
+	uint32_t start = tick;
+	CHECK_EQ(sound_play(0, tone, TONE_N, MAX_VOL, false, 1), 0);
+	w0 = writes;
+	run(TONE_N + 4 * ONE_BLK);
+	uint32_t first = start + (ONE_BLK - start % ONE_BLK) % ONE_BLK;
+	for (uint32_t i = 0; i < TONE_N; i++)
+		if (out[first + i] != tone[i]) {
+			CHECK_EQ(out[first + i], tone[i]);
+			break;
+		}
+	// then one block of silence is written, and the DAC is left alone
+	CHECK(!sound_busy());
+	uint32_t blocks = (TONE_N + ONE_BLK - 1) / ONE_BLK + 1;
+	CHECK_EQ(writes - w0, blocks * ONE_BLK);
+	CHECK_EQ(out[tick-1], 0x80);
+
+	// Two voices mixed, for listening
+	sound_set_volume(50);
+	sound_play(1, tone, TONE_N, 60, true, 1);
+	sound_synth_start(2, SOUND_WAVE_TRIANGLE, 440, 60, NULL, 1);
+	run(TICKS / 4);
+	sound_stop();
+	run(TICKS);
+	CHECK_EQ(wav_write("sound_one.wav", out, tick, HZ), 0);
+
+	CHECK_EQ(sound_deinit(), 0);
+	return CHECK_RESULT();
+}
@@ -0,0 +1,85 @@
+// Interrupt rate and CPU time of a DAC driver, built once with each driver
+// (SOUND_DMA set for sound_cont.c, otherwise sound_one.c). Plays one second
+// of audio idle and with voices, counts the interrupts and mixer refills,
+// and prints the host time the interrupts took. The rates are checked
+// against those in the Kconfig help of the sound component. Host time is
+// not ESP32 time, compare the drivers by it; sound_stats_dump() gives the
+// refill cycles on the board.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "esp_cpu.h"
+#include "esp_timer.h"
+#include "sound.h"
+#include "check.h"
+
+#if SOUND_DMA
+#include "driver/dac_continuous.h"
+#define DRIVER "dma"
+#else
+#include "driver/gptimer.h"
+#define DRIVER "one-shot"
+#endif
+
+#define HZ 24000
+#define SECONDS 1
+#define ONE_BLK 32 // Output block of sound_one.c
+
+// Run the driver for one second of audio.
+// Return the number of interrupts.
+static uint32_t run_second(void)
+{
+#if SOUND_DMA
+	uint32_t n = HZ * SECONDS / stub_dac_cont_samples();
+	return stub_dac_cont_run(n);
+#else
+	return stub_gptimer_run(HZ * SECONDS);
+#endif
+}
+
+// Run a second of audio, print and check the rates.
+static void measure(const char *name)
+{
+	sound_stats_t st;
+
+	run_second(); // settle, start the voices
+	sound_stats_reset();
+	run_second(); // apply the reset
+	sound_stats_reset();
+	uint32_t t0 = esp_cpu_get_cycle_count();
+	uint32_t irq = run_second();
+	uint32_t ns = esp_cpu_get_cycle_count() - t0;
+	sound_stats_get(&st);
+	printf("%-8s %-10s %6lu interrupts/s %5lu refills/s %7.1f us host time/s (%.3f%%)\n",
+		DRIVER, name, (unsigned long)irq / SECONDS, (unsigned long)st.refills / SECONDS,
+		ns / 1e3 / SECONDS, ns / 1e7 / SECONDS);
+#if SOUND_DMA
+	// one interrupt per DMA buffer, 16-bit padding halves the samples held
+	CHECK_EQ(irq, HZ * SECONDS / (CONFIG_SOUND_DAC_BUF_SZ / (CONFIG_DAC_DMA_AUTO_16BIT_ALIGN ? 2 : 1)));
+	CHECK_EQ(st.refills, irq);
+#else
+	// one interrupt per sample, one refill per ONE_BLK samples
+	CHECK_EQ(irq, HZ * SECONDS);
+	CHECK_EQ(st.refills, irq / ONE_BLK);
+#endif
+}
+
+int main(void)
+{
+	static uint8_t pcm[4096];
+
+	for (uint32_t i = 0; i < sizeof(pcm); i++) pcm[i] = rand();
+	stub_time_set(0);
+	CHECK_EQ(sound_init(HZ), 0);
+	sound_set_volume(50);
+	measure("idle");
+	sound_play(SOUND_ANY, pcm, sizeof(pcm), 50, true, 1);
+	measure("1 voice");
+	for (uint32_t v = 1; v < SOUND_VOICES; v++)
+		sound_play(SOUND_ANY, pcm, sizeof(pcm), 50, true, 1);
+	measure("8 voices");
+	sound_stop();
+	CHECK_EQ(sound_deinit(), 0);
+	return CHECK_RESULT();
+}
@@ -0,0 +1,119 @@
+// Resampling of PCM and IMA-ADPCM voices to the output rate. A sine
+// recorded at several rates is played back at 24 kHz and compared with
+// the same sine computed at the output sample times, giving the SNR of
+// the linear interpolation. Also prints the host mix time per sample.
+
+#include <stdio.h>
+#include <math.h>
+
+#include "sound.h"
+#include "sound_mix.h"
+#include "sound_adpcm.h"
+#include "check.h"
+
+#define HZ 24000
+#define BLK 64 // Samples per refill
+#define TONE_HZ 440.0
+#define AMP 100.0 // Sine amplitude in 8-bit steps
+#define OUT_N 16384
+#define SRC_N (OUT_N * 2 + 1024) // Enough for the highest rate
+#define PER_BLOCK (1 + (SOUND_ADPCM_BLOCK - ADPCM_HDR) * 2) // ADPCM samples per block
+#define SKIP 512 // Output samples left out of the SNR (ADPCM start up)
+
+// Global variables
+static uint8_t src[SRC_N];
+static int16_t src16[SRC_N];
+static uint8_t adpcm[(SRC_N / PER_BLOCK + 1) * SOUND_ADPCM_BLOCK];
+static uint8_t out[OUT_N];
+
+
+// Signal to noise ratio in dB of out against the sine recorded at hz.
+static double snr(uint32_t hz)
+{
+	uint64_t step = ((uint64_t)hz << 16) / HZ; // as the mixer, Q16
+	double sig = 0, noise = 0;
+
+	for (uint32_t i = SKIP; i < OUT_N; i++) {
+		double pos = (double)(i * step) / 65536.0; // source sample
+		double want = AMP * sin(2 * M_PI * TONE_HZ * pos / hz);
+		double got = (double)out[i] - SILENCE;
+		sig += want * want;
+		noise += (got - want) * (got - want);
+	}
+	return 10 * log10(sig / noise);
+}
+
+// Play a voice at hz into out.
+// Return the host ns per output sample.
+static double play(int32_t voice, uint32_t hz)
+{
+	sound_stats_t st;
+	uint8_t tail[BLK];
+
+	CHECK(voice >= 0);
+	CHECK_EQ(sound_set_rate(voice, hz), 0);
+	sound_stats_reset();
+	for (uint32_t i = 0; i < OUT_N; i += BLK) sound_mix(out + i, BLK);
+	sound_stats_get(&st);
+	sound_stop();
+	sound_mix(tail, BLK);
+	return (double)st.cyc_avg / BLK;
+}
+
+// Encode one sample, tracking the decoder.
+static uint32_t encode1(adpcm_state_t *st, int32_t x)
+{
+	int32_t step = adpcm_step_tab[st->index], d = x - st->pred;
+	uint32_t code = 0;
+
+	if (d < 0) {code = 8; d = -d;}
+	if (d >= step) {code |= 4; d -= step;}
+	if (d >= step >> 1) {code |= 2; d -= step >> 1;}
+	if (d >= step >> 2) code |= 1;
+	adpcm_decode(st, code);
+	return code;
+}
+
+// Encode whole blocks of src16, as audio2c_adpcm.m.
+// Return the number of bytes.
+static uint32_t encode(void)
+{
+	adpcm_state_t st = {0, 0};
+	uint32_t b = 0, i = 0;
+
+	while (i + PER_BLOCK <= SRC_N) {
+		st.pred = src16[i++];
+		adpcm[b++] = st.pred & 0xFF;
+		adpcm[b++] = (st.pred >> 8) & 0xFF;
+		adpcm[b++] = st.index;
+		adpcm[b++] = 0;
+		for (uint32_t k = ADPCM_HDR; k < SOUND_ADPCM_BLOCK; k++, i += 2)
+			adpcm[b++] = encode1(&st, src16[i]) | encode1(&st, src16[i+1]) << 4;
+	}
+	return b;
+}
+
+int main(void)
+{
+	const uint32_t rates[] = {8000, 11025, 16000, 22050, 32000, 44100};
+
+	sound_mix_init(HZ, 0);
+	sound_set_volume(MAX_VOL); // identity table
+	printf("%5s %8s %8s %10s %10s\n", "Hz", "pcm dB", "adpcm dB", "pcm ns", "adpcm ns");
+	for (uint32_t r = 0; r < sizeof(rates) / sizeof(rates[0]); r++) {
+		uint32_t hz = rates[r];
+		for (uint32_t i = 0; i < SRC_N; i++) {
+			double s = sin(2 * M_PI * TONE_HZ * i / hz);
+			src[i] = lround(AMP * s) + SILENCE;
+			src16[i] = lround(AMP * 256 * s);
+		}
+		double ns_pcm = play(sound_play(0, src, SRC_N, MAX_VOL, false, 1), hz);
+		double db_pcm = snr(hz);
+		double ns_adpcm = play(sound_play_adpcm(0, adpcm, encode(), MAX_VOL, false, 1), hz);
+		double db_adpcm = snr(hz);
+		printf("%5u %8.1f %8.1f %10.2f %10.2f\n", hz, db_pcm, db_adpcm, ns_pcm, ns_adpcm);
+		CHECK(db_pcm > 30);
+		CHECK(db_adpcm > 25);
+	}
+	return CHECK_RESULT();
+}
@@ -0,0 +1,159 @@
+// Render a song through the sequencer and the mixer. Rows are played by
+// the mixer clock, so note onsets must fall on exact sample positions,
+// follow tempo changes, and not depend on the refill size of the driver.
+// The render is written to sound_seq.wav. The restart check starts and
+// stops songs while an "ISR" thread mixes, as a game does between levels.
+
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "sound.h"
+#include "sound_mix.h"
+#include "check.h"
+#include "wav.h"
+
+#define HZ 24000
+#define ROW (HZ * 60 / (120 * 4)) // Samples per row at 120 bpm, 4 rows per beat
+#define ROWS 4
+#define CLICK_N 100
+#define SONG_N (ROWS * 2 * ROW + 4 * HZ / 10) // Song and some release tail
+#define N SONG_N
+#define RESTARTS 50
+
+#define C(note, inst, fx, param) note, inst, fx, param,
+#define __ C(0, 0, 0, 0)
+
+// Two channels: a click sample on channel 0, a square wave on channel 1
+static const uint8_t song[] = {
+	'S', 'Q', 2, ROWS, 2, 2, 120, 4,
+	0, 1, // orders
+	// pattern 0
+	C(60, 1, 0, 0)   C(57, 2, 0, 0)
+	__               __
+	C(60, 0, 0, 0)   C(SOUND_SEQ_OFF, 0, 0, 0)
+	__               C(64, 0, SOUND_FX_VOLUME, 50)
+	// pattern 1, double tempo from its first row
+	C(0, 0, SOUND_FX_TEMPO, 240) C(69, 0, SOUND_FX_GLIDE, 5)
+	C(60, 0, 0, 0)   __
+	__               __
+	__               C(SOUND_SEQ_OFF, 0, 0, 0)
+};
+
+static uint8_t click[CLICK_N];
+static const sound_inst_t inst[] = {
+	{.audio = click, .size = CLICK_N, .vol = MAX_VOL},
+	{.wave = SOUND_WAVE_SQUARE, .adsr = {5, 50, 70, 30}, .vol = 60},
+};
+
+static uint8_t out[2][N];
+static atomic_bool running;
+static atomic_uint ticks; // Calls of tick_clock()
+
+
+// Render the song with refills of blk samples.
+static void render(uint8_t *dst, uint32_t insts, uint32_t blk)
+{
+	CHECK_EQ(sound_seq_start(song, sizeof(song), inst, insts, 0, false), 0);
+	CHECK(sound_seq_busy());
+	for (uint32_t i = 0; i < N; i += blk)
+		sound_mix(dst + i, (N - i < blk) ? N - i : blk);
+	CHECK(!sound_seq_busy());
+	sound_seq_stop();
+	sound_stop();
+	uint8_t tail[64];
+	sound_mix(tail, sizeof(tail));
+}
+
+// Click onsets, at the exact row samples
+static void test_onsets(void)
+{
+	// tempo doubles at row 4, so row 5 starts half a row early
+	const uint32_t at[] = {0, 2 * ROW, 4 * ROW + ROW / 2};
+	uint32_t k = 0;
+
+	render(out[0], 1, 64); // the click only
+	for (uint32_t i = 0; i < N; i++) {
+		bool on = out[0][i] != SILENCE;
+		bool start = on && (i == 0 || out[0][i-1] == SILENCE);
+		if (start) {
+			CHECK(k < 3);
+			if (k < 3) CHECK_EQ(i, at[k]);
+			k++;
+		}
+	}
+	CHECK_EQ(k, 3);
+	// each click plays whole, then silence
+	for (uint32_t j = 0; j < 3; j++) {
+		CHECK_EQ(out[0][at[j] + CLICK_N - 1], 0xFF);
+		CHECK_EQ(out[0][at[j] + CLICK_N], SILENCE);
+	}
+}
+
+// The same song, rendered with different refill sizes
+static void test_refill_size(void)
+{
+	render(out[0], 2, 64);
+	render(out[1], 2, 37);
+	CHECK(memcmp(out[0], out[1], N) == 0);
+	CHECK_EQ(wav_write("sound_seq.wav", out[0], N, HZ), 0);
+}
+
+// Audio ISR: mix refills until stopped.
+static void *isr(void *arg)
+{
+	uint8_t buf[64];
+
+	stub_core_set(1);
+	while (atomic_load(&running)) sound_mix(buf, sizeof(buf));
+	return NULL;
+}
+
+// Mixer clock counting its calls.
+static uint32_t tick_clock(void)
+{
+	atomic_fetch_add(&ticks, 1);
+	return 1;
+}
+
+// A clock removed is not called again, and songs started and stopped
+// while the mixer runs never see the state of another song.
+static void test_restart(void)
+{
+	pthread_t th;
+
+	atomic_store(&running, true);
+	pthread_create(&th, NULL, isr, NULL);
+	for (uint32_t i = 0; i < RESTARTS; i++) {
+		sound_mix_clock(tick_clock);
+		while (!atomic_load(&ticks)) vTaskDelay(1);
+		sound_mix_clock(NULL);
+		uint32_t n = atomic_load(&ticks);
+		vTaskDelay(1); // many refills
+		CHECK_EQ(atomic_load(&ticks), n);
+		atomic_store(&ticks, 0);
+		CHECK_EQ(sound_seq_start(song, sizeof(song), inst, 2, 0, i & 1), 0);
+		CHECK(sound_seq_busy() || !(i & 1)); // a song played once may be over
+		sound_seq_stop();
+		CHECK(!sound_seq_busy());
+	}
+	atomic_store(&running, false);
+	pthread_join(th, NULL);
+	sound_stop();
+	uint8_t tail[64];
+	sound_mix(tail, sizeof(tail));
+}
+
+int main(void)
+{
+	for (uint32_t i = 0; i < CLICK_N; i++) click[i] = 0xFF;
+	sound_mix_init(HZ, 0);
+	sound_set_volume(MAX_VOL);
+	test_onsets();
+	test_refill_size();
+	test_restart();
+	return CHECK_RESULT();
+}
@@ -0,0 +1,147 @@
+// Stream audio from a partition and from a file through the stream task
+// while an "ISR" thread mixes at about three times the real rate. The
+// mixed output must be the source sample for sample, with no underruns,
+// for PCM, IMA-ADPCM and a looping stream.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_partition.h"
+#include "sound.h"
+#include "sound_mix.h"
+#include "sound_adpcm.h"
+#include "check.h"
+
+#define HZ 24000
+#define BLK 64 // Samples per refill
+#define BLK_US 1000 // Time between refills, real time is 2667 us
+#define PCM_N 30000
+#define ADPCM_BLOCKS 40
+#define ADPCM_N (ADPCM_BLOCKS * (1 + (SOUND_ADPCM_BLOCK - ADPCM_HDR) * 2))
+#define OUT_MAX (PCM_N * 3)
+
+// Global variables
+static uint8_t part[4 + PCM_N]; // Length header and PCM samples
+static uint8_t adpcm[ADPCM_BLOCKS * SOUND_ADPCM_BLOCK];
+static uint8_t want[ADPCM_N];
+static uint8_t out[OUT_MAX + BLK];
+static atomic_uint nout;
+static atomic_bool running;
+
+
+// Audio ISR: mix a refill every BLK_US.
+static void *isr(void *arg)
+{
+	stub_core_set(1);
+	while (atomic_load(&running)) {
+		uint32_t n = atomic_load(&nout);
+		if (n < OUT_MAX) {
+			sound_mix(out + n, BLK);
+			atomic_store(&nout, n + BLK);
+		}
+		usleep(BLK_US);
+	}
+	return NULL;
+}
+
+// Play a stream until it ends, or for max samples.
+// Return the number of samples mixed.
+static uint32_t play(const char *name, sound_fmt_t fmt, bool loop, uint32_t max)
+{
+	pthread_t th;
+
+	atomic_store(&nout, 0);
+	CHECK(sound_stream_start(name, fmt, MAX_VOL, loop) >= 0);
+	atomic_store(&running, true);
+	pthread_create(&th, NULL, isr, NULL);
+	while (sound_stream_busy() && atomic_load(&nout) < max) usleep(BLK_US);
+	sound_stream_stop();
+	atomic_store(&running, false);
+	pthread_join(th, NULL);
+	CHECK(!sound_stream_busy());
+	CHECK(!sound_busy());
+	return atomic_load(&nout);
+}
+
+// Return the number of samples of out that differ from src, repeated.
+static uint32_t diff(const uint8_t *src, uint32_t n, uint32_t len)
+{
+	uint32_t bad = 0;
+
+	for (uint32_t i = 0; i < len; i++)
+		if (out[i] != src[i % n] && !bad++)
+			printf("sample %u: %u != %u\n", i, out[i], src[i % n]);
+	return bad;
+}
+
+static void test_partition(void)
+{
+	uint8_t *pcm = part + 4;
+
+	for (uint32_t i = 0; i < PCM_N; i++) pcm[i] = 0x81 + (i * 7 + i / 100) % 120;
+	part[0] = PCM_N & 0xFF;
+	part[1] = PCM_N >> 8 & 0xFF;
+	part[2] = part[3] = 0;
+	CHECK_EQ(stub_partition_add("audio", part, sizeof(part)), 0);
+
+	uint32_t n = play("audio", SOUND_FMT_PCM8, false, OUT_MAX);
+	CHECK(n >= PCM_N);
+	CHECK_EQ(diff(pcm, PCM_N, PCM_N), 0);
+	CHECK_EQ(out[PCM_N], SILENCE); // ended
+	CHECK_EQ(sound_stream_underruns(), 0);
+
+	// looping, stopped in the third lap
+	n = play("audio", SOUND_FMT_PCM8, true, PCM_N * 5 / 2);
+	CHECK(n >= PCM_N * 5 / 2);
+	CHECK_EQ(diff(pcm, PCM_N, PCM_N * 5 / 2), 0);
+	CHECK_EQ(sound_stream_underruns(), 0);
+
+	// missing, too long
+	CHECK(sound_stream_start("none", SOUND_FMT_PCM8, MAX_VOL, false) < 0);
+	part[2] = 1;
+	CHECK(sound_stream_start("audio", SOUND_FMT_PCM8, MAX_VOL, false) < 0);
+}
+
+static void test_file(void)
+{
+	char path[] = "/tmp/sound_streamXXXXXX";
+	adpcm_state_t st;
+	uint32_t k = 0;
+
+	// random codes in valid blocks, decoded as the stream task must
+	for (uint32_t b = 0; b < ADPCM_BLOCKS; b++) {
+		uint8_t *blk = adpcm + b * SOUND_ADPCM_BLOCK;
+		for (uint32_t i = 0; i < SOUND_ADPCM_BLOCK; i++) blk[i] = rand();
+		blk[2] %= 89;
+		want[k++] = (adpcm_header(&st, blk) >> 8) + SILENCE;
+		for (uint32_t i = ADPCM_HDR; i < SOUND_ADPCM_BLOCK; i++) {
+			want[k++] = (adpcm_decode(&st, blk[i] & 0xF) >> 8) + SILENCE;
+			want[k++] = (adpcm_decode(&st, blk[i] >> 4) >> 8) + SILENCE;
+		}
+	}
+	int fd = mkstemp(path);
+	CHECK(fd >= 0);
+	CHECK_EQ(write(fd, adpcm, sizeof(adpcm)), sizeof(adpcm));
+	close(fd);
+
+	uint32_t n = play(path, SOUND_FMT_ADPCM, false, OUT_MAX);
+	unlink(path);
+	CHECK(n >= ADPCM_N);
+	CHECK_EQ(diff(want, ADPCM_N, ADPCM_N), 0);
+	CHECK_EQ(sound_stream_underruns(), 0);
+}
+
+int main(void)
+{
+	sound_mix_init(HZ, 0);
+	sound_set_volume(MAX_VOL); // identity table
+	test_partition();
+	test_file();
+	return CHECK_RESULT();
+}
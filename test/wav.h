@@ -0,0 +1,23 @@
+#ifndef WAV_H_
+#define WAV_H_
+
+#include <stdint.h>
+#include <stdio.h>
+
+// Write unsigned 8-bit mono samples as a WAV file, to listen to what a
+// host test rendered.
+// Return zero if successful, or non-zero otherwise.
+static inline int wav_write(const char *path, const uint8_t *buf, uint32_t n, uint32_t hz)
+{
+	FILE *f = fopen(path, "wb");
+	if (f == NULL) return 1;
+	uint32_t hdr[] = {
+		0x46464952, 36 + n, 0x45564157, // "RIFF" size "WAVE"
+		0x20746D66, 16, 1 | 1 << 16, hz, hz, 1 | 8 << 16, // "fmt " PCM mono, 8 bits
+		0x61746164, n, // "data" size
+	};
+	int err = fwrite(hdr, sizeof(hdr), 1, f) != 1 || fwrite(buf, 1, n, f) != n;
+	return fclose(f) || err;
+}
+
+#endif // WAV_H_